@@ -8,9 +8,10 @@ struct Material {
     sampler2D diffuse;
     sampler2D specular;
     sampler2D normal;
-    float shininess;
 }; 
 
+// the light structs follow the std140 layout of LightsBlock (core_shader_uniforms.h),
+// each vec3 shares its 16 bytes with the float after it
 struct DirLight {
     vec3 direction;
     vec3 ambient;
@@ -21,28 +22,27 @@ struct DirLight {
 struct PointLight {
     vec3 position;
     float constant;
-    float linear;
-    float quadratic;
     vec3 ambient;
+    float linear;
     vec3 diffuse;
+    float quadratic;
     vec3 specular;
-    samplerCube depthCube;
     float farPlane;
 };
 
 struct SpotLight {
+    mat4 lightSpaceMatrix;
     vec3 position;
-    vec3 direction;
     float cutOff;
+    vec3 direction;
     float outerCutOff;
-    float constant;
-    float linear;
-    float quadratic;
     vec3 ambient;
+    float constant;
     vec3 diffuse;
+    float linear;
     vec3 specular;
-    sampler2D depthTex;
-    mat4 lightSpaceMatrix;
+    float quadratic;
+    vec4 atlasRect;     // offset (xy) and scale (zw) of its shadow atlas tile
 };
 
 vec3 gridSamplingDisk[20] = vec3[] (    // array of offset direction for sampling
@@ -63,20 +63,33 @@ in VS_OUT {
     vec3 FragPos;
     vec3 Normal;
     vec2 TexCoords;
+    float Shininess;
 } fs_in;
 
-uniform vec3 viewPos;
+layout (std140) uniform Camera {
+    mat4 projection;
+    mat4 view;
+    vec3 viewPos;
+};
+
+layout (std140) uniform Lights {
+    DirLight dirLight;
+    PointLight pointLights[NR_POINT_LIGHTS];
+    SpotLight spotLights[NR_SPOT_LIGHTS];
+};
+
 uniform Material material;
-uniform DirLight dirLight;
-uniform PointLight pointLights[NR_POINT_LIGHTS];
-uniform SpotLight spotLights[NR_SPOT_LIGHTS];
+// samplers cannot live in a uniform block, one shadow map per point light 
+// instead. Spot lights share one atlas, each reading its own tile
+uniform samplerCube pointShadowMaps[NR_POINT_LIGHTS];
+uniform sampler2D spotShadowAtlas;
 
 // ____________________________________________________________________________
 // helper function declarations
 // ----------------------------------------------------------------------------
 
 float ShadowCubeCalculation(vec3 lightPosition, float farPlane, samplerCube depthCube, vec3 fragPos);
-float ShadowTexCalculation(vec3 lightPosition, sampler2D depthTex, vec4 fragPosLightSpace);
+float ShadowTexCalculation(vec3 lightPosition, vec4 atlasRect, vec4 fragPosLightSpace);
 
 // ____________________________________________________________________________
 // ----------------------------------------------------------------------------
@@ -96,14 +109,24 @@ void main() {
     vec3 ambient = dirLight.ambient * vec3(texture(material.diffuse, fs_in.TexCoords));
     vec3 diffuse = dirLight.diffuse * diff * vec3(texture(material.diffuse, fs_in.TexCoords));
     vec3 halfwayDir = normalize(lightDir + viewDir); 
-    float spec = pow(max(dot(normal, halfwayDir), 0.0), material.shininess);
+    float spec = pow(max(dot(normal, halfwayDir), 0.0), fs_in.Shininess);
     vec3 specular = dirLight.specular * spec * vec3(texture(material.specular, fs_in.TexCoords));
     vec3 totalLighting = ambient + diffuse + specular;
 
     // ________________________________________________________________________
     // point lights
     // ------------------------------------------------------------------------
-    float distance, attenuation, cubeShadow;
+    // GLSL 3.30 indexes sampler arrays with constants only, so each cube
+    // shadow is looked up outside the loop
+#if NR_POINT_LIGHTS != 3
+#error "one cube shadow lookup per point light below"
+#endif
+    float cubeShadows[NR_POINT_LIGHTS];
+    cubeShadows[0] = ShadowCubeCalculation(pointLights[0].position, pointLights[0].farPlane, pointShadowMaps[0], fs_in.FragPos);
+    cubeShadows[1] = ShadowCubeCalculation(pointLights[1].position, pointLights[1].farPlane, pointShadowMaps[1], fs_in.FragPos);
+    cubeShadows[2] = ShadowCubeCalculation(pointLights[2].position, pointLights[2].farPlane, pointShadowMaps[2], fs_in.FragPos);
+
+    float distance, attenuation;
     for (int i = 0; i < NR_POINT_LIGHTS; i++) {
         lightDir = normalize(pointLights[i].position - fs_in.FragPos);
         diff = max(dot(lightDir, normal), 0.0);
@@ -112,13 +135,12 @@ void main() {
         ambient = pointLights[i].ambient * vec3(texture(material.diffuse, fs_in.TexCoords));
         diffuse = pointLights[i].diffuse * diff * vec3(texture(material.diffuse, fs_in.TexCoords));
         halfwayDir = normalize(lightDir + viewDir); 
-        spec = pow(max(dot(normal, halfwayDir), 0.0), material.shininess);
+        spec = pow(max(dot(normal, halfwayDir), 0.0), fs_in.Shininess);
         specular = pointLights[i].specular * spec * vec3(texture(material.specular, fs_in.TexCoords));
         ambient *= attenuation;
         diffuse *= attenuation;
         specular *= attenuation;
-        cubeShadow = ShadowCubeCalculation(pointLights[i].position, pointLights[i].farPlane, pointLights[i].depthCube, fs_in.FragPos);
-        totalLighting += (ambient + (1.0 - cubeShadow) * (diffuse + specular)); 
+        totalLighting += (ambient + (1.0 - cubeShadows[i]) * (diffuse + specular)); 
     }
 
     // ________________________________________________________________________
@@ -138,13 +160,13 @@ void main() {
         ambient = spotLights[j].ambient * vec3(texture(material.diffuse, fs_in.TexCoords));
         diffuse = spotLights[j].diffuse * diff * vec3(texture(material.diffuse, fs_in.TexCoords));
         halfwayDir = normalize(lightDir + viewDir); 
-        spec = pow(max(dot(normal, halfwayDir), 0.0), material.shininess);
+        spec = pow(max(dot(normal, halfwayDir), 0.0), fs_in.Shininess);
         specular = spotLights[j].specular * spec * vec3(texture(material.specular, fs_in.TexCoords));
         ambient *= attenuation * intensity;
         diffuse *= attenuation * intensity;
         specular *= attenuation * intensity;
         fragPosSpace = spotLights[j].lightSpaceMatrix * vec4(fs_in.FragPos, 1.0);
-        texShadow = ShadowTexCalculation(spotLights[j].position, spotLights[j].depthTex, fragPosSpace);
+        texShadow = ShadowTexCalculation(spotLights[j].position, spotLights[j].atlasRect, fragPosSpace);
         totalLighting += (ambient + (1.0 - texShadow) * (diffuse + specular));
     }
 
@@ -177,13 +199,17 @@ float ShadowCubeCalculation(vec3 lightPosition, float farPlane, samplerCube dept
     return shadow;
 }
 
-float ShadowTexCalculation(vec3 lightPosition, sampler2D depthTex, vec4 fragPosLightSpace) {
+float ShadowTexCalculation(vec3 lightPosition, vec4 atlasRect, vec4 fragPosLightSpace) {
+    // lights without a tile cast no shadow
+    if(atlasRect.z == 0.0)
+        return 0.0;
     // perform perspective divide
     vec3 projCoords = fragPosLightSpace.xyz / fragPosLightSpace.w;
     // transform to [0,1] range
     projCoords = projCoords * 0.5 + 0.5;
-    // get closest depth value from light's perspective (using [0,1] range fragPosLight as coords)
-    float closestDepth = texture(depthTex, projCoords.xy).r; 
+    // outside the light's tile is outside its frustum, which casts no shadow
+    if(projCoords.x < 0.0 || projCoords.x > 1.0 || projCoords.y < 0.0 || projCoords.y > 1.0)
+        return 0.0;
     // get depth of current fragment from light's perspective
     float currentDepth = projCoords.z;
     // calculate bias (based on depth map resolution and slope)
@@ -192,10 +218,14 @@ float ShadowTexCalculation(vec3 lightPosition, sampler2D depthTex, vec4 fragPosL
     float bias = max(0.05 * (1.0 - dot(normal, lightDir)), 0.005);
     // PCF
     float shadow = 0.0;
-    vec2 texelSize = 1.0 / textureSize(depthTex, 0);
+    // samples stay half a texel inside the tile, never reading its neighbors
+    vec2 texelSize = 1.0 / textureSize(spotShadowAtlas, 0);
+    vec2 tileCoords = atlasRect.xy + projCoords.xy * atlasRect.zw;
+    vec2 tileMin = atlasRect.xy + 0.5 * texelSize;
+    vec2 tileMax = atlasRect.xy + atlasRect.zw - 0.5 * texelSize;
     for(int x = -1; x <= 1; ++x) {
         for(int y = -1; y <= 1; ++y) {
-            float pcfDepth = texture(depthTex, projCoords.xy + vec2(x, y) * texelSize).r; 
+            float pcfDepth = texture(spotShadowAtlas, clamp(tileCoords + vec2(x, y) * texelSize, tileMin, tileMax)).r; 
             shadow += currentDepth - bias > pcfDepth  ? 1.0 : 0.0;        
         }    
     }
@@ -1,9 +1,10 @@
 #version 330 core
 layout (location = 0) in vec3 aPos;
+// per-instance attributes, filled by the RenderSystem's instance buffer
+layout (location = 3) in mat4 aInstanceModel;
 
 uniform mat4 lightSpaceMatrix;
-uniform mat4 model;
 
 void main() {
-    gl_Position = lightSpaceMatrix * model * vec4(aPos, 1.0);
+    gl_Position = lightSpaceMatrix * aInstanceModel * vec4(aPos, 1.0);
 }
\ No newline at end of file
@@ -1,8 +1,13 @@
 #version 330 core
 layout (location = 0) in vec3 aPos;
+// per-instance attributes, filled by the RenderSystem's instance buffer
+layout (location = 3) in mat4 aInstanceModel;
+layout (location = 11) in uint aInstanceShadowFaces;
 
-uniform mat4 model;
+// cubemap faces the caster's bounds reach, a bit per face
+flat out uint vShadowFaces;
 
 void main() {
-    gl_Position = model * vec4(aPos, 1.0);
+    gl_Position = aInstanceModel * vec4(aPos, 1.0);
+    vShadowFaces = aInstanceShadowFaces;
 }
\ No newline at end of file
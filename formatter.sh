@@ -6,7 +6,7 @@ mv $1 ../../build
 cd ..
 cd ..
 cd build
-./MeshFormatter $1 $2
+./MeshFormatter $1 $2 $3
 
 mv $1 ../assets/models
-mv $2 ../include/meshes
\ No newline at end of file
+mv $2 ../assets/meshes
\ No newline at end of file
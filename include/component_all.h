@@ -18,10 +18,7 @@
 #include "component_fixture_user_data.h"
 #include "component_light.h"
 #include "component_material.h"
-#include "meshes/component_mesh_cube.h"
-#include "meshes/component_mesh_ground.h"
 #include "meshes/component_mesh_skybox.h"
-#include "meshes/component_mesh_sphere.h"
 #include "meshes/component_mesh_sprite.h"
 #include "component_player.h"
 #include "component_render_data.h"
@@ -34,5 +31,6 @@
 #include "component_test.h"
 #include "component_text.h"
 #include "component_texture.h"
+#include "component_transform.h"
 
 #endif // COMPONENT_ALL_H
@@ -73,6 +73,11 @@ struct CameraComponent {
      * \brief Camera position value member variable. Vector.
      */
     glm::vec3 m_position;
+    /**
+     * \brief Camera position after the previous update step, for render 
+     *        interpolation. Vector.
+     */
+    glm::vec3 m_previousPosition;
     /**
      * \brief Camera front direction value member variable. Vector.
      */
@@ -111,6 +116,7 @@ struct CameraComponent {
         m_front(glm::vec3(0.0f, 0.0f, -1.0f))
     {
         m_position = position;
+        m_previousPosition = position;
         m_worldUp = worldUp;
         m_yaw = yaw;
         m_pitch = pitch;
@@ -15,7 +15,10 @@
  * \brief   The FixtureUserDataComponent struct.
  * \details A struct to hold user data used to connect Box2D fixtures to 
  *          associated game actors/objects/entities. Can add a category for any
- *          game entity information relevant to Box2D.
+ *          game entity information relevant to Box2D. A fixture's own 
+ *          b2FixtureUserData::pointer holds the integral value of its entity 
+ *          plus one (0 for fixtures without an entity), so it stays valid
+ *          however the registry's storage moves.
  */
 struct FixtureUserDataComponent {
     /**
@@ -28,10 +31,6 @@ struct FixtureUserDataComponent {
      *          4: non-spheres
      */
     int m_fixtureType;
-    /**
-     * \brief Pointer to memory address for EnTT::entity associated with this fixture.
-     */
-    entt::entity* m_enttEntity;
 };
 
 #endif // COMPONENT_FIXTURE_USER_DATA_H
\ No newline at end of file
@@ -8,6 +8,19 @@
 #ifndef COMPONENT_RENDER_DATA_H
 #define COMPONENT_RENDER_DATA_H
 
+/**
+ * \brief   The VertexFormat enum.
+ * \details Encoding of a mesh's vertex data. vertexFormatFloat: consecutive 
+ *          32-bit float attributes. vertexFormatPacked: the position, normal,
+ *          tex coord layout in 16 bytes, a half float position (plus 2 bytes 
+ *          of padding), a GL_INT_2_10_10_10_REV normal and normalized 16-bit
+ *          tex coords. Mesh headers store it as their m_vertexFormat.
+ */
+enum VertexFormat {
+    vertexFormatFloat = 0,
+    vertexFormatPacked
+};
+
 /** 
  * \brief   The RenderDataComponent struct.
  * \details A struct to hold data pertaining to OpenGL mesh vertex buffer and 
@@ -15,18 +28,37 @@
  *          to RenderSystem class for rendering.
  */
 struct RenderDataComponent {
+    /**
+     * \brief Handle of the object's mesh in the RenderSystem's MeshRegistry, 
+     *        0 when the buffers below belong to the object alone (text).
+     */
+    unsigned int m_mesh = 0;
     /**
      * \brief Unique OpenGL ID for a vertex buffer object.
      */
     unsigned int m_VBO; 
     /**
-     * \brief Unique OpenGL ID for a vertex array object.
+     * \brief Unique OpenGL ID for a vertex array object, shared by every
+     *        object drawing the same mesh.
      */
     unsigned int m_VAO;
     /**
-     * \brief The number of vertices constituting an object's mesh.
+     * \brief Unique OpenGL ID for an element buffer object, recorded in the
+     *        VAO. 0 for objects drawn without indices (text).
+     */
+    unsigned int m_EBO = 0;
+    /**
+     * \brief The number of unique vertices constituting an object's mesh.
      */
     int m_vertexCount = 0;
+    /**
+     * \brief The number of indices drawn, three per triangle.
+     */
+    int m_indexCount = 0;
+    /**
+     * \brief Encoding of the mesh's vertex data, set before creating buffers.
+     */
+    VertexFormat m_vertexFormat = vertexFormatFloat;
     /**
      * \brief Flag representing whether to render stencil buffer for object.
      */
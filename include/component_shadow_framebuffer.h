@@ -31,13 +31,10 @@ struct ShadowFramebufferComponent {
     unsigned int m_index;
 
     /**
-     * \brief Unique OpenGL ID for a shadow FBO w/ depth map.
+     * \brief Unique OpenGL ID for a shadow FBO w/ depth cubemap. Type 1
+     *        lights have none, they are drawn to the RenderSystem's atlas.
      */
     unsigned int m_shadowFramebuffer;
-    /**
-     * \brief Unique OpenGL ID for a depth map texture.
-     */
-    unsigned int m_depthMap;
     /**
      * \brief Unique OpenGL ID for a depth cubemap texture.
      */
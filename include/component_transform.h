@@ -0,0 +1,48 @@
+// -----------------------------------------------------------------------------
+// Onset Engine
+// https://github.com/dylanafterall/OnsetEngine.git
+//
+// component_transform.h
+//  header: component to hold a body's transform, extracted after each step
+// -----------------------------------------------------------------------------
+#ifndef COMPONENT_TRANSFORM_H
+#define COMPONENT_TRANSFORM_H
+
+#include "glm/glm.hpp"
+
+/** 
+ * \brief   The TransformComponent struct.
+ * \details A struct to hold a copy of a Box2D body's position, angle and 
+ *          velocity. Filled by the TransformSystem after every physics step,
+ *          so other systems can read transforms without touching b2Body. The
+ *          transform of the step before is kept, for render interpolation.
+ */
+struct TransformComponent {
+    /**
+     * \brief Position of the body in world space.
+     */
+    glm::vec2 m_position = glm::vec2(0.0f, 0.0f);
+    /**
+     * \brief Angle of the body, in radians.
+     */
+    float m_angle = 0.0f;
+    /**
+     * \brief Linear velocity of the body's center of mass.
+     */
+    glm::vec2 m_velocity = glm::vec2(0.0f, 0.0f);
+    /**
+     * \brief Position of the body after the previous physics step.
+     */
+    glm::vec2 m_previousPosition = glm::vec2(0.0f, 0.0f);
+    /**
+     * \brief Angle of the body after the previous physics step, in radians.
+     */
+    float m_previousAngle = 0.0f;
+    /**
+     * \brief Radius around the body's position enclosing its scaled mesh, at 
+     *        any angle. Set once, when the body is created. 0 if unknown.
+     */
+    float m_boundingRadius = 0.0f;
+};
+
+#endif // COMPONENT_TRANSFORM_H
@@ -8,18 +8,24 @@
 #ifndef CORE_ASSET_MANAGER_H
 #define CORE_ASSET_MANAGER_H
 
+#include "core_job_manager.h"
 #include "core_log_macros.h"
+#include "core_profile_macros.h"
+#include "core_shader_uniforms.h"
 #include "core_text_manager.h"
+#include "core_texture_streamer.h"
 
 #define GLFW_INCLUDE_NONE
 #include "glad/glad.h"
 #include "GLFW/glfw3.h"
 #include "box2d/box2d.h"
 
+#include <cstdint>
 #include <map>
 #include <fstream>
 #include <sstream>
 #include <string>
+#include <vector>
 
 /** 
  * \brief   The AssetManager class.
@@ -63,11 +69,61 @@ public:
      * \return  void, none.
      */
     void setCubemap(const std::string&, std::vector<std::string>, bool);
+    /**
+     * \brief   The function queueTexture. 
+     * \details This function adds a texture to the batch imported by 
+     *          loadQueuedTextures, with the same arguments as setTexture.
+     * \param   assetId      ID name to serve as key in std::map textures.
+     * \param   texturePath  Relative path to texture asset.
+     * \param   repeat       To declare if repeated texture pattern desired.
+     * \param   gamma        To declare if gamma correction desired.
+     * \return  void, none.
+     */
+    void queueTexture(const std::string&, const char*, bool, bool);
+    /**
+     * \brief   The function queueCubemap. 
+     * \details This function adds a cubemap to the batch imported by 
+     *          loadQueuedTextures, with the same arguments as setCubemap.
+     * \param   assetId      ID name to serve as key in std::map cubemaps.
+     * \param   faces        std::vector of 6 texture filepaths (.jpg/.png)
+     * \param   gamma        To declare if gamma correction desired.
+     * \return  void, none.
+     */
+    void queueCubemap(const std::string&, std::vector<std::string>, bool);
+    /**
+     * \brief   The function loadQueuedTextures. 
+     * \details This function imports every queued texture and cubemap face.
+     *          The images are decoded across the job manager's workers, 
+     *          while the calling (GL) thread uploads each image as soon as
+     *          it has been decoded. Clears the queue.
+     * \param   jobManager   The job manager whose workers decode the images.
+     * \return  void, none.
+     */
+    void loadQueuedTextures(JobManager&);
+    /**
+     * \brief   The function streamQueuedTextures. 
+     * \details This function takes the queued 2D textures out of the batch, 
+     *          and hands them to the texture streamer instead. Each texture
+     *          is added to std::map textures at once, holding a 1x1 grey 
+     *          placeholder until updateStreaming swaps its image in. Queued
+     *          cubemaps are left for loadQueuedTextures.
+     * \return  void, none.
+     */
+    void streamQueuedTextures();
+    /**
+     * \brief   The function updateStreaming. 
+     * \details This function advances the texture streamer by one upload.
+     *          Called once per frame on the GL thread.
+     * \return  void, none.
+     */
+    void updateStreaming();
     /**
      * \brief   The function setVShader. 
      * \details This function imports a vertex shader file - .vert from the
      *          assets directory, assigns the shader an ID for OpenGL, and 
-     *          saves a copy of its ID in a std::map member variable.
+     *          saves a copy of its ID in a std::map member variable. The
+     *          shader is compiled by the first program linking it, unless
+     *          every program using it is found in the program cache.
      * \param   assetId      ID name to serve as key in std::map vshaders.
      * \param   vertexPath   Relative path to .vert shader asset.
      * \return  void, none.
@@ -77,7 +133,8 @@ public:
      * \brief   The function setFShader. 
      * \details This function imports a fragment shader file - .frag from the
      *          assets directory, assigns the shader an ID for OpenGL, and 
-     *          saves a copy of its ID in a std::map member variable.
+     *          saves a copy of its ID in a std::map member variable. Compiled
+     *          on first link, as with setVShader.
      * \param   assetId      ID name to serve as key in std::map fshaders.
      * \param   fragmentPath Relative path to .frag shader asset.
      * \return  void, none.
@@ -87,7 +144,8 @@ public:
      * \brief   The function setGShader. 
      * \details This function imports a geometry shader file - .geom from the
      *          assets directory, assigns the shader an ID for OpenGL, and 
-     *          saves a copy of its ID in a std::map member variable.
+     *          saves a copy of its ID in a std::map member variable. Compiled
+     *          on first link, as with setVShader.
      * \param   assetId      ID name to serve as key in std::map fshaders.
      * \param   geometryPath Relative path to .geom shader asset.
      * \return  void, none.
@@ -97,7 +155,9 @@ public:
      * \brief   The function setShaderProgram. 
      * \details This function combines a vertex and fragment shader, both 
      *          stored in OpenGL as an unsigned int (ID), into a shader 
-     *          program to be used in rendering. 
+     *          program to be used in rendering. The program binary is loaded
+     *          from the program cache if its sources and driver match, else
+     *          the shaders are compiled and linked, and the binary cached.
      * \param   assetId          ID name - key in std::map shaderPrograms.
      * \param   vertexShader     OpenGL's ID of vertex shader to combine.
      * \param   fragmentShader   OpenGL's ID of fragment shader to combine.
@@ -106,9 +166,9 @@ public:
     void setShaderProgram(const std::string&, unsigned int, unsigned int);
     /**
      * \brief   The function setShaderProgram. 
-     * \details This function combines a vertex and fragment shader, both 
-     *          stored in OpenGL as an unsigned int (ID), into a shader 
-     *          program to be used in rendering. 
+     * \details This function combines a vertex, geometry and fragment 
+     *          shader into a shader program, using the program cache like
+     *          the function above.
      * \param   assetId          ID name - key in std::map shaderPrograms.
      * \param   vertexShader     OpenGL's ID of vertex shader to link.
      * \param   geometryShader   OpenGL's ID of geometry shader to link.
@@ -116,6 +176,14 @@ public:
      * \return  void, none.
      */
     void setShaderProgram(const std::string&, unsigned int, unsigned int, unsigned int);
+    /**
+     * \brief   The function setProgramCacheDirectory. 
+     * \details This function sets the directory holding cached program 
+     *          binaries (default ../cache/shaders). Empty disables the cache.
+     * \param   directory    Relative path of the cache directory.
+     * \return  void, none.
+     */
+    void setProgramCacheDirectory(const std::string&);
 
     /**
      * \brief   The function getTexture. 
@@ -177,6 +245,24 @@ public:
      *               shader program asset.  
      */
     unsigned int getShaderProgram(const std::string&);
+    /**
+     * \brief   The function getUniform. 
+     * \details This function, given a shader program and the name of one of
+     *          its uniforms (e.g. "pointLights[1].position"), returns a handle
+     *          resolved from the uniforms reflected when the program linked.
+     *          Resolve handles once, then set them every frame without any
+     *          string work or glGetUniformLocation.
+     * \param   program      OpenGL's ID of the shader program.
+     * \param   name         Name of the uniform, as in GLSL.
+     * \retval  Uniform<T>   Handle, with location -1 if the uniform is not 
+     *                       active or its GLSL type does not accept T.
+     */
+    template <typename T>
+    Uniform<T> getUniform(unsigned int program, const std::string& name) const {
+        Uniform<T> uniform;
+        uniform.m_location = findUniform(program, name, &UniformType<T>::matches);
+        return uniform;
+    }
 
     /**
      * \brief   The function deleteAssets. 
@@ -208,9 +294,101 @@ public:
      * \return  void, none.
      */
     void checkShaderProgramErrors(unsigned int);
+    /**
+     * \brief   The function uploadImage. 
+     * \details This function specifies level 0 of the bound texture target
+     *          from decoded pixels, choosing formats from the channel count.
+     * \param   target       GL_TEXTURE_2D, or a face of a bound cubemap.
+     * \param   data         Pixels, or an offset into a bound unpack PBO.
+     * \param   width        Width of the image, in pixels.
+     * \param   height       Height of the image, in pixels.
+     * \param   nrChannels   Channels per pixel (1, 3 or 4).
+     * \param   gamma        To declare if gamma correction desired.
+     * \return  void, none.
+     */
+    static void uploadImage(GLenum, const unsigned char*, int, int, int, bool);
+    /**
+     * \brief   The function flipVertically. 
+     * \details This function flips decoded pixels on the y-axis in place, as
+     *          OpenGL expects the bottom row first.
+     * \param   data         Pixels to flip.
+     * \param   width        Width of the image, in pixels.
+     * \param   height       Height of the image, in pixels.
+     * \param   nrChannels   Channels per pixel.
+     * \return  void, none.
+     */
+    static void flipVertically(unsigned char*, int, int, int);
     
 
 private:
+    /**
+     * \brief   The QueuedTexture struct.
+     * \details A texture or cubemap waiting in the batch of loadQueuedTextures.
+     */
+    struct QueuedTexture {
+        std::string m_assetId;
+        /**
+         * \brief One path for a texture, six (one per face) for a cubemap.
+         */
+        std::vector<std::string> m_paths;
+        bool m_isCubemap = false;
+        bool m_repeat = false;
+        bool m_gamma = false;
+        /**
+         * \brief ID assigned by OpenGL when the batch starts.
+         */
+        unsigned int m_texture = 0;
+    };
+
+    /**
+     * \brief   The PendingShader struct.
+     * \details Source of a shader object, kept to key the program cache, and 
+     *          whether the shader has been compiled yet.
+     */
+    struct PendingShader {
+        std::string m_code;
+        std::string m_type;
+        bool m_isCompiled = false;
+    };
+
+    /**
+     * \brief   Create a shader object from source, compiled on first link.
+     */
+    unsigned int createShader(GLenum, const std::string&, const std::string&);
+    /**
+     * \brief   Link (or load from the program cache) a program of shaders.
+     */
+    void linkShaderProgram(const std::string&, const std::vector<unsigned int>&);
+    /**
+     * \brief   Record the location and type of every active uniform.
+     */
+    void reflectUniforms(unsigned int);
+    /**
+     * \brief   Bind the program's Camera and Lights blocks to their binding points.
+     */
+    void bindUniformBlocks(unsigned int);
+    /**
+     * \brief   Return the location of a reflected uniform of a matching type.
+     */
+    GLint findUniform(unsigned int, const std::string&, bool (*)(GLenum)) const;
+    /**
+     * \brief   Hash the shaders' sources and the driver, keying the cache.
+     */
+    std::uint64_t getProgramKey(const std::vector<unsigned int>&);
+    /**
+     * \brief   Load a program binary from the cache, true if it linked.
+     */
+    bool loadProgramBinary(unsigned int, const std::string&, std::uint64_t);
+    /**
+     * \brief   Write a linked program's binary to the cache.
+     */
+    void saveProgramBinary(unsigned int, const std::string&, std::uint64_t);
+
+    /**
+     * \brief   Create and configure an empty texture or cubemap for OpenGL.
+     */
+    unsigned int createTexture(bool, bool);
+
     /**
      * \brief std::map used to store texture IDs for easy lookup when creating
      *        new game entities.
@@ -242,6 +420,28 @@ private:
      *        creating new game entities.
      */
     std::map<std::string, unsigned int> shaderPrograms;
+    /**
+     * \brief std::map of shader program IDs to their active uniforms, by name.
+     */
+    std::map<unsigned int, std::map<std::string, ShaderUniform>> programUniforms;
+    /**
+     * \brief std::map of shader IDs to their source, for the program cache.
+     */
+    std::map<unsigned int, PendingShader> shaderSources;
+    /**
+     * \brief Directory of cached program binaries, empty if disabled.
+     */
+    std::string programCacheDirectory = "../cache/shaders";
+
+    /**
+     * \brief std::vector of textures and cubemaps waiting to be imported by
+     *        loadQueuedTextures.
+     */
+    std::vector<QueuedTexture> queuedTextures;
+    /**
+     * \brief Uploads streamed textures across frames.
+     */
+    TextureStreamer textureStreamer;
 };
 
 #endif // CORE_ASSET_MANAGER_H
\ No newline at end of file
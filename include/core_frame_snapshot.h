@@ -0,0 +1,313 @@
+// -----------------------------------------------------------------------------
+// Onset Engine
+// https://github.com/dylanafterall/OnsetEngine.git
+//
+// core_frame_snapshot.h
+//  header: render state captured from the registry, and its triple buffer
+// -----------------------------------------------------------------------------
+#ifndef CORE_FRAME_SNAPSHOT_H
+#define CORE_FRAME_SNAPSHOT_H
+
+#include "component_light.h"
+#include "component_material.h"
+#include "component_render_data.h"
+#include "component_shader_program.h"
+#include "component_shadow_framebuffer.h"
+#include "component_sprite.h"
+#include "component_text.h"
+#include "component_texture.h"
+
+#include "glm/glm.hpp"
+
+#include <atomic>
+#include <vector>
+
+/**
+ * \brief   The CameraSnapshot struct.
+ * \details Copy of the main camera's state needed to build view matrices.
+ */
+struct CameraSnapshot {
+    /**
+     * \brief Camera zoom (field of view, in degrees).
+     */
+    float m_zoom = 45.0f;
+    /**
+     * \brief Camera position in world space.
+     */
+    glm::vec3 m_position = glm::vec3(0.0f, 0.0f, 20.0f);
+    /**
+     * \brief Camera position after the previous update step.
+     */
+    glm::vec3 m_previousPosition = glm::vec3(0.0f, 0.0f, 20.0f);
+    /**
+     * \brief Camera front direction.
+     */
+    glm::vec3 m_front = glm::vec3(0.0f, 0.0f, -1.0f);
+    /**
+     * \brief Camera up direction.
+     */
+    glm::vec3 m_up = glm::vec3(0.0f, 1.0f, 0.0f);
+};
+
+/**
+ * \brief   The LightSnapshot struct.
+ * \details Copy of a light entity's components, and its body transform.
+ */
+struct LightSnapshot {
+    /**
+     * \brief Copy of the entity's LightComponent.
+     */
+    LightComponent m_light;
+    /**
+     * \brief Copy of the entity's ShaderProgramComponent.
+     */
+    ShaderProgramComponent m_shader;
+    /**
+     * \brief Copy of the entity's RenderDataComponent.
+     */
+    RenderDataComponent m_graphics;
+    /**
+     * \brief Copy of the entity's ShadowFramebufferComponent.
+     */
+    ShadowFramebufferComponent m_shadow;
+    /**
+     * \brief Position of the light's body (origin for lights without one).
+     */
+    glm::vec2 m_position;
+    /**
+     * \brief Angle of the light's body, in radians.
+     */
+    float m_angle;
+    /**
+     * \brief Position of the light's body after the previous step.
+     */
+    glm::vec2 m_previousPosition;
+    /**
+     * \brief Angle of the light's body after the previous step, in radians.
+     */
+    float m_previousAngle;
+    /**
+     * \brief Radius of the light's mesh about its position, for culling.
+     *        0 for lights without a body or of unknown bounds.
+     */
+    float m_boundingRadius;
+};
+
+/**
+ * \brief   The GameplaySnapshot struct.
+ * \details Copy of a lit, textured gameplay entity's components and transform.
+ */
+struct GameplaySnapshot {
+    /**
+     * \brief Copy of the entity's MaterialComponent.
+     */
+    MaterialComponent m_material;
+    /**
+     * \brief Copy of the entity's TextureComponent.
+     */
+    TextureComponent m_texture;
+    /**
+     * \brief Copy of the entity's ShaderProgramComponent.
+     */
+    ShaderProgramComponent m_shader;
+    /**
+     * \brief Copy of the entity's RenderDataComponent.
+     */
+    RenderDataComponent m_graphics;
+    /**
+     * \brief Position of the entity's body.
+     */
+    glm::vec2 m_position;
+    /**
+     * \brief Angle of the entity's body, in radians.
+     */
+    float m_angle;
+    /**
+     * \brief Position of the entity's body after the previous step.
+     */
+    glm::vec2 m_previousPosition;
+    /**
+     * \brief Angle of the entity's body after the previous step, in radians.
+     */
+    float m_previousAngle;
+    /**
+     * \brief Radius of the entity's mesh about its position, for culling.
+     *        0 for entities of unknown bounds.
+     */
+    float m_boundingRadius;
+};
+
+/**
+ * \brief   The SkyboxSnapshot struct.
+ * \details Copy of a skybox entity's components.
+ */
+struct SkyboxSnapshot {
+    /**
+     * \brief Copy of the entity's TextureComponent.
+     */
+    TextureComponent m_texture;
+    /**
+     * \brief Copy of the entity's ShaderProgramComponent.
+     */
+    ShaderProgramComponent m_shader;
+    /**
+     * \brief Copy of the entity's RenderDataComponent.
+     */
+    RenderDataComponent m_graphics;
+};
+
+/**
+ * \brief   The SpriteSnapshot struct.
+ * \details Copy of a sprite entity's components.
+ */
+struct SpriteSnapshot {
+    /**
+     * \brief Copy of the entity's SpriteComponent.
+     */
+    SpriteComponent m_sprite;
+    /**
+     * \brief Copy of the entity's TextureComponent.
+     */
+    TextureComponent m_texture;
+    /**
+     * \brief Copy of the entity's ShaderProgramComponent.
+     */
+    ShaderProgramComponent m_shader;
+    /**
+     * \brief Copy of the entity's RenderDataComponent.
+     */
+    RenderDataComponent m_graphics;
+};
+
+/**
+ * \brief   The TextSnapshot struct.
+ * \details Copy of a text entity's components.
+ */
+struct TextSnapshot {
+    /**
+     * \brief Copy of the entity's TextComponent.
+     */
+    TextComponent m_text;
+    /**
+     * \brief Copy of the entity's ShaderProgramComponent.
+     */
+    ShaderProgramComponent m_shader;
+    /**
+     * \brief Copy of the entity's RenderDataComponent.
+     */
+    RenderDataComponent m_graphics;
+};
+
+/**
+ * \brief   The FrameSnapshot struct.
+ * \details Everything the RenderSystem needs to draw a frame, captured from
+ *          the registry after a simulation step. Once published, a snapshot
+ *          is never modified while the render thread reads it.
+ */
+struct FrameSnapshot {
+    /**
+     * \brief Time (glfwGetTime seconds) of the simulation state captured.
+     */
+    double m_time = 0.0;
+
+    /**
+     * \brief State of the main camera.
+     */
+    CameraSnapshot m_camera;
+    /**
+     * \brief Directional, point and spot lights.
+     */
+    std::vector<LightSnapshot> m_lights;
+    /**
+     * \brief Lit gameplay entities, which also cast shadows.
+     */
+    std::vector<GameplaySnapshot> m_gameplay;
+    /**
+     * \brief Skybox entities.
+     */
+    std::vector<SkyboxSnapshot> m_skyboxes;
+    /**
+     * \brief Sprite entities.
+     */
+    std::vector<SpriteSnapshot> m_sprites;
+    /**
+     * \brief Text entities.
+     */
+    std::vector<TextSnapshot> m_texts;
+};
+
+/**
+ * \brief   The FrameSnapshotBuffer class.
+ * \details Lock-free triple buffer of FrameSnapshots, for a single writer (the
+ *          simulation) and a single reader (the renderer). The writer always
+ *          has a snapshot to fill, the reader always sees the latest complete
+ *          one, and neither ever waits on the other.
+ */
+class FrameSnapshotBuffer {
+public:
+    /**
+     * \brief   The default constructor.
+     */
+    FrameSnapshotBuffer() = default;
+    /**
+     * \brief   The default destructor.
+     */
+    ~FrameSnapshotBuffer() = default;
+
+    /**
+     * \brief   The function getWriteSnapshot.
+     * \details Writer only. Returns the snapshot to fill before publishing.
+     *          Its contents are stale, and must be overwritten entirely.
+     * \return  FrameSnapshot&, the snapshot owned by the writer.
+     */
+    FrameSnapshot& getWriteSnapshot();
+    /**
+     * \brief   The function publish.
+     * \details Writer only. Hands the filled snapshot to the reader, and takes
+     *          back a free one for the next write.
+     * \return  void, none.
+     */
+    void publish();
+    /**
+     * \brief   The function acquire.
+     * \details Reader only. Swaps in the latest published snapshot, if one was
+     *          published since the last call, and returns it.
+     * \return  const FrameSnapshot&, the snapshot owned by the reader.
+     */
+    const FrameSnapshot& acquire();
+    /**
+     * \brief   The function getReadSnapshot.
+     * \details Reader only. Returns the snapshot taken by the last acquire.
+     * \return  const FrameSnapshot&, the snapshot owned by the reader.
+     */
+    const FrameSnapshot& getReadSnapshot() const;
+
+private:
+    /**
+     * \brief Set in m_middleIndex when it holds a snapshot not yet acquired.
+     */
+    static const unsigned int FRESH_BIT = 4;
+    /**
+     * \brief Masks the snapshot index out of m_middleIndex.
+     */
+    static const unsigned int INDEX_MASK = 3;
+
+    /**
+     * \brief Storage for the three snapshots.
+     */
+    FrameSnapshot m_snapshots[3];
+    /**
+     * \brief Snapshot being filled by the writer.
+     */
+    unsigned int m_writeIndex = 0;
+    /**
+     * \brief Snapshot being drawn by the reader.
+     */
+    unsigned int m_readIndex = 1;
+    /**
+     * \brief Snapshot exchanged between writer and reader, with FRESH_BIT.
+     */
+    std::atomic<unsigned int> m_middleIndex{2};
+};
+
+#endif // CORE_FRAME_SNAPSHOT_H
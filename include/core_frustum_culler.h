@@ -0,0 +1,94 @@
+// -----------------------------------------------------------------------------
+// Onset Engine
+// https://github.com/dylanafterall/OnsetEngine.git
+//
+// core_frustum_culler.h
+//  header of FrustumCuller class, bounding spheres tested against a frustum
+// -----------------------------------------------------------------------------
+#ifndef CORE_FRUSTUM_CULLER_H
+#define CORE_FRUSTUM_CULLER_H
+
+#include "glm/glm.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * \brief   The FrustumCuller class.
+ * \details Collects the bounding spheres of a frame's objects, then tests
+ *          them against the six planes of a view-projection's frustum. The
+ *          spheres are stored as contiguous arrays of each coordinate, so the
+ *          test runs on four spheres at a time with SSE, where available.
+ *          Objects are numbered in the order they were added, and the test
+ *          lists the numbers of those in view.
+ */
+class FrustumCuller {
+public:
+    /**
+     * \brief   The default constructor.
+     */
+    FrustumCuller() = default;
+    /**
+     * \brief   The default destructor.
+     */
+    ~FrustumCuller() = default;
+
+    /**
+     * \brief   The function setFrustum.
+     * \details This function extracts the frustum planes of a view-projection
+     *          matrix (Gribb and Hartmann), normalized so that plane
+     *          equations give distances.
+     * \param   viewProjection  Projection times view matrix of the camera.
+     * \return  void, none.
+     */
+    void setFrustum(const glm::mat4&);
+    /**
+     * \brief   The function clear.
+     * \details This function removes every sphere, keeping the capacity.
+     * \return  void, none.
+     */
+    void clear();
+    /**
+     * \brief   The function addSphere.
+     * \param   center  Center of the bounding sphere, in world space.
+     * \param   radius  Radius of the sphere, infinity for objects never culled.
+     * \return  std::uint32_t, number of the object.
+     */
+    std::uint32_t addSphere(const glm::vec3&, float);
+    /**
+     * \brief   The function cull.
+     * \details This function lists the spheres at least partly inside the
+     *          frustum, in increasing order.
+     * \return  void, none.
+     */
+    void cull();
+    /**
+     * \brief   The function getVisible.
+     * \return  const std::vector<std::uint32_t>&, numbers of the objects in
+     *          view after the last cull.
+     */
+    const std::vector<std::uint32_t>& getVisible() const;
+    /**
+     * \brief   The function getCount.
+     * \return  std::size_t, number of spheres added since the last clear.
+     */
+    std::size_t getCount() const;
+
+private:
+    /**
+     * \brief Left, right, bottom, top, near and far planes, pointing inward.
+     */
+    glm::vec4 m_planes[6] = {};
+    /**
+     * \brief Sphere centers and radii, one array per coordinate.
+     */
+    std::vector<float> m_centerX;
+    std::vector<float> m_centerY;
+    std::vector<float> m_centerZ;
+    std::vector<float> m_radius;
+    std::size_t m_count = 0;
+    std::vector<std::uint32_t> m_visible;
+};
+
+#endif // CORE_FRUSTUM_CULLER_H
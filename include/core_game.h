@@ -14,8 +14,14 @@
 #include "core_asset_manager.h"
 #include "core_audio_manager.h"
 #include "core_input_invoker.h"
+#include "core_input_recorder.h"
+#include "core_gpu_profile_manager.h"
+#include "core_job_manager.h"
 #include "core_log_manager.h"
 #include "core_log_macros.h"
+#include "core_profile_manager.h"
+#include "core_profile_macros.h"
+#include "core_scene_manager.h"
 #include "core_text_manager.h"
 
 #include "component_all.h"
@@ -28,7 +34,23 @@
 #include "entt/entt.hpp"
 #include "box2d/box2d.h"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+/**
+ * \brief   The RunMode enum.
+ * \details singleThreaded steps and renders on the main thread, multiThreaded
+ *          steps the simulation on its own thread while the main thread 
+ *          renders the latest published FrameSnapshot. headless steps the 
+ *          simulation as fast as possible, without a window or GL context.
+ */
+enum RunMode{singleThreaded=0, multiThreaded, headless};
 
 /** 
  * \brief   The Game class.
@@ -48,6 +70,55 @@ public:
      */
     ~Game() = default;
 
+    /**
+     * \brief   The function setRunMode. 
+     * \details This function selects whether the simulation runs on its own
+     *          thread. Must be called before run.
+     * \param   runMode     singleThreaded (default), multiThreaded or headless.
+     * \return  void, none.
+     */
+    void setRunMode(RunMode);
+    /**
+     * \brief   The function setHeadlessSteps. 
+     * \details This function sets how many fixed time steps a headless run
+     *          simulates before returning.
+     * \param   headlessSteps   Number of steps to simulate.
+     * \return  void, none.
+     */
+    void setHeadlessSteps(unsigned int);
+    /**
+     * \brief   The function setInputRecordPath. 
+     * \details This function records every input command, with the step it
+     *          was dispatched before, to a file. Must be called before setup.
+     * \param   path    Path of the binary recording to write.
+     * \return  void, none.
+     */
+    void setInputRecordPath(const std::string&);
+    /**
+     * \brief   The function setInputReplayPath. 
+     * \details This function replays a recording made by setInputRecordPath,
+     *          in place of user input. Must be called before setup.
+     * \param   path    Path of the binary recording to read.
+     * \return  void, none.
+     */
+    void setInputReplayPath(const std::string&);
+    /**
+     * \brief   The function setScenePath. 
+     * \details This function selects the compiled scene loaded by setup().
+     * \param   path    Path of the binary scene (.onsc) to load.
+     * \return  void, none.
+     */
+    void setScenePath(const std::string&);
+    /**
+     * \brief   The function setStreamTextures. 
+     * \details This function streams the level's textures in across frames,
+     *          showing placeholders meanwhile, instead of loading them all
+     *          before the first frame. Must be called before setup.
+     * \param   streamTextures  True to stream textures.
+     * \return  void, none.
+     */
+    void setStreamTextures(bool);
+
     /**
      * \brief   The function initialize. 
      * \details This function creates the game's Window and InputInvoker class 
@@ -61,11 +132,20 @@ public:
     /**
      * \brief   The function setup.
      * \details This function loads assets via the AssetManager class and 
-     *          creates/registers entities.
-     *          for a given game level. 
+     *          creates/registers the entities of the level's compiled scene,
+     *          via the SceneManager class.
      * \return  void, none.
      */
     void setup();
+    /**
+     * \brief   The function setup.
+     * \details This function loads assets and connects event handlers like
+     *          setup(), but creates the level's entities with the given 
+     *          function instead of loading the scene.
+     * \param   createLevel     Creates and registers the level's entities.
+     * \return  void, none.
+     */
+    void setup(const std::function<void()>&);
 
     /**
      * \brief   The function run. 
@@ -73,7 +153,8 @@ public:
      *          divided into 3 parts: processInput, update, and render. It
      *          also calculates the deltaTime for use in determining the 
      *          number of calls to update per game loop iteration, and for 
-     *          rendering interpolation.
+     *          rendering interpolation. In multiThreaded mode, the simulation
+     *          loop runs on a second thread and this thread only renders.
      * \return  void, none.
      */
     void run();
@@ -92,7 +173,9 @@ public:
      *          status, based on a constant timeStep (as opposed to a variable 
      *          deltaTime). This is to ensure physics and similar simulations 
      *          update in fixed, discrete sized steps. Results in deterministic
-     *          behavior (decoupled from rendering).
+     *          behavior (decoupled from rendering). Systems are run as a graph
+     *          of jobs by the JobManager, so independent systems run in 
+     *          parallel once the Box2D world has stepped.
      * \param   timeStep            The amount of time to simulate. Fixed
      *                                 value (representing seconds).
      * \param   velocityIterations  For Box2D's velocity constraint solver.
@@ -104,13 +187,24 @@ public:
     /**
      * \brief   The function render. 
      * \details This function calls on OpenGL to fill its back buffer, then
-     *          calls the RenderSystem class to draw EnTT entities on the back
-     *          buffer, then swaps front and back buffers. 
+     *          calls the RenderSystem class to draw the latest acquired 
+     *          FrameSnapshot on the back buffer, then swaps front and back 
+     *          buffers. 
      * \param   renderFactor  For render interpolation (lag / timeStep).
      * \return  void, none.
      */
     void render(const float);
 
+    /**
+     * \brief   The function runFrame. 
+     * \details This function runs a single frame without looking at the 
+     *          clock: processInput, one fixed update step, then (unless 
+     *          headless) publishes and renders the stepped state. Used by 
+     *          tools driving the loop themselves, such as benchmarks.
+     * \return  void, none.
+     */
+    void runFrame();
+
     /**
      * \brief   The function destroy. 
      * \details This function ensures that all heap memory allocated for the
@@ -119,11 +213,110 @@ public:
      */
     void destroy();
 
+    /**
+     * \brief   The function getRegistry. 
+     * \return  entt::registry&, the game's EnTT registry.
+     */
+    entt::registry& getRegistry();
+    /**
+     * \brief   The function getWorld. 
+     * \return  b2World&, the game's Box2D world.
+     */
+    b2World& getWorld();
+    /**
+     * \brief   The function getRenderSystem. 
+     * \return  RenderSystem&, used to create the GL buffers of new entities.
+     */
+    RenderSystem& getRenderSystem();
+    /**
+     * \brief   The function getAssetManager. 
+     * \return  AssetManager&, holding the loaded shaders and textures.
+     */
+    AssetManager& getAssetManager();
+    /**
+     * \brief   The function getTextManager. 
+     * \return  TextManager&, holding the loaded font characters.
+     */
+    TextManager& getTextManager();
+    /**
+     * \brief   The function getProfileManager. 
+     * \return  ProfileManager&, holding the recorded CPU scopes.
+     */
+    ProfileManager& getProfileManager();
+    /**
+     * \brief   The function getGpuProfileManager. 
+     * \return  GpuProfileManager&, holding the GPU time of each pass.
+     */
+    GpuProfileManager& getGpuProfileManager();
+
 private:
     /**
-     * \brief Variable used to break the game loop.
+     * \brief   The function simulate. 
+     * \details This function is the multiThreaded simulation loop: it 
+     *          processes input, steps the world in fixed time steps, and 
+     *          publishes a FrameSnapshot, until the game stops running.
+     * \return  void, none.
+     */
+    void simulate();
+    /**
+     * \brief   The function publishSnapshot. 
+     * \details This function captures the registry into the snapshot buffer's
+     *          write snapshot, and publishes it to the renderer.
+     * \param   time    Time (glfwGetTime seconds) of the simulated state.
+     * \return  void, none.
      */
-    bool m_isRunning = false;
+    void publishSnapshot(double);
+    /**
+     * \brief   The function runHeadless. 
+     * \details This function is the headless game loop: it steps the world
+     *          m_headlessSteps times without waiting on the clock, then logs
+     *          the achieved step rate.
+     * \return  void, none.
+     */
+    void runHeadless();
+    /**
+     * \brief   The function loadGraphicsAssets. 
+     * \details This function loads fonts, shaders, textures and cubemaps, and
+     *          configures shader samplers. Needs a GL context.
+     * \return  void, none.
+     */
+    void loadGraphicsAssets();
+    /**
+     * \brief   The function buildUpdateGraph. 
+     * \details This function builds the graph of jobs run by every update,
+     *          once, so a step allocates no jobs.
+     * \return  void, none.
+     */
+    void buildUpdateGraph();
+
+    /**
+     * \brief Variable used to break the game loop, read by both threads.
+     */
+    std::atomic<bool> m_isRunning{false};
+    /**
+     * \brief Whether the simulation runs on its own thread.
+     */
+    RunMode m_runMode = singleThreaded;
+    /**
+     * \brief Number of steps simulated by a headless run.
+     */
+    unsigned int m_headlessSteps = 1000;
+    /**
+     * \brief Recording file to write, empty if not recording.
+     */
+    std::string m_inputRecordPath;
+    /**
+     * \brief Recording file to replay, empty if not replaying.
+     */
+    std::string m_inputReplayPath;
+    /**
+     * \brief Compiled scene loaded by setup().
+     */
+    std::string m_scenePath = "../assets/scenes/demo.onsc";
+    /**
+     * \brief Whether textures stream in across frames, instead of at setup.
+     */
+    bool m_streamTextures = false;
 
     /**
      * \brief Variable used to change game's aspect ratio.
@@ -153,6 +346,19 @@ private:
      */
     double lag = 0.0;
 
+    /**
+     * \brief Thread running simulate() in multiThreaded mode.
+     */
+    std::thread m_simulationThread;
+    /**
+     * \brief Guards the dispatcher between input callbacks and the simulation.
+     */
+    std::mutex m_dispatcherMutex;
+    /**
+     * \brief Render state handed from the simulation to the renderer.
+     */
+    FrameSnapshotBuffer m_snapshots;
+
     /**
      * \brief Object to manage the game's window using OpenGL API.
      */
@@ -178,6 +384,36 @@ private:
      * \brief Object to manage the game's sound/audio functionality.
      */
     AudioManager m_audioManager;
+    /**
+     * \brief Object to run independent systems in parallel each update.
+     */
+    JobManager m_jobManager;
+    /**
+     * \brief Jobs of a fixed step, built by setup and run by update.
+     */
+    JobGraph m_updateGraph;
+    /**
+     * \brief Arguments of the update running m_updateGraph, read by its jobs.
+     */
+    float m_stepTime = 0.0f;
+    int32 m_velocityIterations = 0;
+    int32 m_positionIterations = 0;
+    /**
+     * \brief Object to record scoped CPU timings, and write them as a trace.
+     */
+    ProfileManager m_profileManager;
+    /**
+     * \brief Object to time each render pass on the GPU.
+     */
+    GpuProfileManager m_gpuProfileManager;
+    /**
+     * \brief Object to record input commands, and replay them.
+     */
+    InputRecorder m_inputRecorder;
+    /**
+     * \brief Object to create level entities from compiled scenes.
+     */
+    SceneManager m_sceneManager;
 
     /**
      * \brief Object to translate/rotate the camera.
@@ -203,6 +439,14 @@ private:
      * \brief Object to control 'select mode' functionality.
      */
     SelectModeSystem m_selectModeSystem;
+    /**
+     * \brief Object to copy Box2D body transforms into the registry.
+     */
+    TransformSystem m_transformSystem;
+    /**
+     * \brief Object to capture renderable registry state into snapshots.
+     */
+    SnapshotSystem m_snapshotSystem;
 
     /**
      * \brief EnTT registry to manage all game entities.
@@ -0,0 +1,208 @@
+// -----------------------------------------------------------------------------
+// Onset Engine
+// https://github.com/dylanafterall/OnsetEngine.git
+//
+// core_gpu_profile_manager.h
+//  header of GpuProfileManager class, GPU time of each render pass
+// -----------------------------------------------------------------------------
+#ifndef CORE_GPU_PROFILE_MANAGER_H
+#define CORE_GPU_PROFILE_MANAGER_H
+
+#include "core_log_macros.h"
+
+#include <glad/glad.h>
+
+/**
+ * \brief   The GpuPass enum.
+ * \details Render passes of the RenderSystem timed on the GPU, in the order
+ *          they are drawn. gpuPassCount is the number of passes.
+ */
+enum GpuPass {
+    spotShadowPass = 0,
+    pointShadowPass,
+    lightPass,
+    skyboxPass,
+    gameplayPass,
+    spritePass,
+    textPass,
+    stencilPass,
+    gpuPassCount
+};
+
+/**
+ * \brief   The GpuProfileManager class.
+ * \details Times each GpuPass with GL_TIME_ELAPSED queries. Queries are double
+ *          buffered: a frame's results are read at the start of the next
+ *          frame, and only if the GPU has made them available, so reading
+ *          them never stalls the pipeline. Logs the average time of each pass
+ *          every summary interval.
+ */
+class GpuProfileManager {
+public:
+    /**
+     * \brief   The default constructor.
+     */
+    GpuProfileManager() = default;
+    /**
+     * \brief   The default destructor.
+     */
+    ~GpuProfileManager() = default;
+
+    /**
+     * \brief   The function initialize.
+     * \details This function generates the timer queries. Requires a current
+     *          GL context.
+     * \return  void, none.
+     */
+    void initialize();
+    /**
+     * \brief   The function destroy.
+     * \details This function deletes the timer queries.
+     * \return  void, none.
+     */
+    void destroy();
+
+    /**
+     * \brief   The function beginFrame.
+     * \details This function collects the results of the previous frame's
+     *          queries which are available.
+     * \return  void, none.
+     */
+    void beginFrame();
+    /**
+     * \brief   The function endFrame.
+     * \details This function swaps the query buffers, and logs a summary once
+     *          every summary interval.
+     * \return  void, none.
+     */
+    void endFrame();
+    /**
+     * \brief   The function beginPass.
+     * \details This function starts timing a pass. Passes may not overlap.
+     * \param   pass    The pass about to be drawn.
+     * \return  void, none.
+     */
+    void beginPass(GpuPass);
+    /**
+     * \brief   The function endPass.
+     * \details This function stops timing the pass started by beginPass.
+     * \param   pass    The pass just drawn.
+     * \return  void, none.
+     */
+    void endPass(GpuPass);
+
+    /**
+     * \brief   The function getPassMilliseconds.
+     * \param   pass    The pass to query.
+     * \return  double, GPU time of the pass in its latest collected frame.
+     */
+    double getPassMilliseconds(GpuPass) const;
+    /**
+     * \brief   The function getAverageMilliseconds.
+     * \param   pass    The pass to query.
+     * \return  double, average GPU time of the pass since the last summary.
+     */
+    double getAverageMilliseconds(GpuPass) const;
+    /**
+     * \brief   The function getPassName.
+     * \param   pass    The pass to name.
+     * \return  const char*, name of the pass used in summaries.
+     */
+    static const char* getPassName(GpuPass);
+    /**
+     * \brief   The function setSummaryInterval.
+     * \details This function sets how many frames are averaged per summary
+     *          logged. Zero disables summaries.
+     * \param   frames  Number of frames between summaries.
+     * \return  void, none.
+     */
+    void setSummaryInterval(unsigned int);
+    /**
+     * \brief   The function resetAverages.
+     * \details This function discards the times collected since the last
+     *          summary, restarting the averages (e.g. after a warmup).
+     * \return  void, none.
+     */
+    void resetAverages();
+
+private:
+    /**
+     * \brief Queries of the two frames in flight, per pass.
+     */
+    GLuint m_queries[2][gpuPassCount] = {};
+    /**
+     * \brief Whether each query was issued, and its result not yet collected.
+     */
+    bool m_pending[2][gpuPassCount] = {};
+    /**
+     * \brief Query set written by the current frame.
+     */
+    unsigned int m_frameIndex = 0;
+    /**
+     * \brief Boolean to represent whether the queries exist.
+     */
+    bool m_isInitialized = false;
+
+    /**
+     * \brief GPU time of each pass in its latest collected frame, in ms.
+     */
+    double m_lastMilliseconds[gpuPassCount] = {};
+    /**
+     * \brief Sum of collected times since the last summary, in ms.
+     */
+    double m_totalMilliseconds[gpuPassCount] = {};
+    /**
+     * \brief Number of collected times since the last summary.
+     */
+    unsigned int m_sampleCount[gpuPassCount] = {};
+    /**
+     * \brief Frames between summaries.
+     */
+    unsigned int m_summaryInterval = 600;
+    /**
+     * \brief Frames since the last summary.
+     */
+    unsigned int m_framesSinceSummary = 0;
+};
+
+/**
+ * \brief   The GpuProfileScope class.
+ * \details Times a render pass for its lifetime. Does nothing when given a
+ *          null GpuProfileManager.
+ */
+class GpuProfileScope {
+public:
+    /**
+     * \brief   The constructor, begins the pass.
+     * \param   manager     The GpuProfileManager, or null.
+     * \param   pass        The pass drawn inside the scope.
+     */
+    GpuProfileScope(GpuProfileManager* manager, GpuPass pass) : m_manager(manager), m_pass(pass) {
+        if (m_manager) {
+            m_manager->beginPass(m_pass);
+        }
+    }
+    /**
+     * \brief   The destructor, ends the pass.
+     */
+    ~GpuProfileScope() {
+        if (m_manager) {
+            m_manager->endPass(m_pass);
+        }
+    }
+
+    GpuProfileScope(const GpuProfileScope&) = delete;
+    GpuProfileScope& operator=(const GpuProfileScope&) = delete;
+
+private:
+    /**
+     * \brief The GpuProfileManager timing the pass.
+     */
+    GpuProfileManager* m_manager;
+    /**
+     * \brief The pass drawn inside the scope.
+     */
+    GpuPass m_pass;
+};
+
+#endif // CORE_GPU_PROFILE_MANAGER_H
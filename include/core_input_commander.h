@@ -332,4 +332,14 @@ public:
 	void execute(entt::dispatcher&) const override;
 };
 
+/** 
+ * \brief   The DumpProfileCommand class.
+ * \details Derived from IInputCommand. Pointed to by InputInvoker class.
+ * 			Writes the recorded profile scopes to a trace file.
+ */
+class DumpProfileCommand : public IInputCommand {
+public:
+	void execute(entt::dispatcher&) const override;
+};
+
 #endif // CORE_INPUT_COMMANDER_H
\ No newline at end of file
@@ -15,6 +15,9 @@
 #include "GLFW/glfw3.h"
 #include "entt/entt.hpp"
 
+#include <atomic>
+#include <mutex>
+
 
 /** 
  * \brief   The InputInvoker class.
@@ -54,6 +57,27 @@ public:
      * \return  void, none.
      */
     void destroy();
+    /**
+     * \brief   The function setDispatcherMutex. 
+     * \details This function sets a mutex to hold while commands enqueue 
+     *          events, for when the dispatcher is updated on another thread.
+     * \param   dispatcherMutex     Mutex guarding the dispatcher, or nullptr.
+     * \return  void, none.
+     */
+    void setDispatcherMutex(std::mutex*);
+    /**
+     * \brief   The function setCommandsEnabled. 
+     * \details This function sets whether input executes commands. Escape
+     *          still closes the window when disabled (e.g. during a replay).
+     * \param   enabled     Boolean representing if commands execute (true).
+     * \return  void, none.
+     */
+    void setCommandsEnabled(bool);
+    /**
+     * \brief   The function getCommandsEnabled. 
+     * \return  bool, true if input executes commands.
+     */
+    bool getCommandsEnabled() const;
     /**
      * \brief   The function handleKeyInput. 
      * \details This function processes user keyboard input, directing each 
@@ -285,6 +309,14 @@ public:
      * \return  void, none.
      */
     void set0KeyCommand(IInputCommand*);
+    /**
+     * \brief   The function setPKeyCommand. 
+     * \details This function assigns the key-P input a IInputCommand 
+     *          class.
+     * \param   command     The desired IInputCommand class to assign.
+     * \return  void, none.
+     */
+    void setPKeyCommand(IInputCommand*);
     /**
      * \brief   The function setShiftAKeyCommand. 
      * \details This function assigns the key-(shift)A input a IInputCommand 
@@ -327,6 +359,15 @@ private:
      * \brief Pointer to event system's dispatcher to pass to IInputCommand classes.
      */
     entt::dispatcher* m_dispatcherPtr;
+    /**
+     * \brief Mutex held while enqueueing events, nullptr if single threaded.
+     */
+    std::mutex* m_dispatcherMutex = nullptr;
+    /**
+     * \brief Whether input executes commands, see setCommandsEnabled. Set
+     *        from the update thread, read by input callbacks.
+     */
+    std::atomic<bool> m_commandsEnabled{true};
     /**
      * \brief The game's window width, for calculating initial mouse position.
      */
@@ -448,6 +489,10 @@ private:
      * \brief Pointer to the IInputCommand class for a key-0 input.
      */
     IInputCommand* m_key0;
+    /**
+     * \brief Pointer to the IInputCommand class for a key-P input.
+     */
+    IInputCommand* m_keyP;
     /**
      * \brief Pointer to the IInputCommand class for a key-(shift)A input.
      */
@@ -0,0 +1,213 @@
+// -----------------------------------------------------------------------------
+// Onset Engine
+// https://github.com/dylanafterall/OnsetEngine.git
+//
+// core_input_recorder.h
+//  header of InputRecorder class, records and replays dispatched input commands
+// -----------------------------------------------------------------------------
+#ifndef CORE_INPUT_RECORDER_H
+#define CORE_INPUT_RECORDER_H
+
+#include "core_input_commander.h"
+#include "core_input_invoker.h"
+#include "core_log_macros.h"
+
+#include "entt/entt.hpp"
+
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * \brief   The InputCommandId enum.
+ * \details Identifies each recordable IInputCommand in an input recording.
+ *          Values are stored in files, so new commands may only be appended.
+ *          inputCommandCount is the number of commands.
+ */
+enum InputCommandId : std::uint8_t {
+    leftCommandId = 0,
+    downCommandId,
+    rightCommandId,
+    upCommandId,
+    selectedLeftCommandId,
+    selectedDownCommandId,
+    selectedRightCommandId,
+    selectedUpCommandId,
+    toggleSelectModeCommandId,
+    cameraUpCommandId,
+    cameraDownCommandId,
+    cameraLeftCommandId,
+    cameraRightCommandId,
+    cameraForwardCommandId,
+    cameraBackwardCommandId,
+    cameraZoomInCommandId,
+    cameraZoomOutCommandId,
+    cameraPitchUpCommandId,
+    cameraPitchDownCommandId,
+    cameraYawLeftCommandId,
+    cameraYawRightCommandId,
+    dumpProfileCommandId,
+    inputCommandCount
+};
+
+/**
+ * \brief   The InputRecord struct.
+ * \details One command dispatched before a fixed time step.
+ */
+struct InputRecord {
+    /**
+     * \brief Index of the fixed time step the command was dispatched before.
+     */
+    std::uint64_t m_step = 0;
+    /**
+     * \brief The command dispatched.
+     */
+    InputCommandId m_command = leftCommandId;
+};
+
+/**
+ * \brief   The InputRecorder class.
+ * \details Records every input command as the dispatcher delivers it, tagged
+ *          with the index of the next fixed time step, to a compact binary
+ *          file. A recording is replayed by enqueueing its commands again
+ *          right before the same steps, so a session plays back identically
+ *          (e.g. headless, for benchmarks and offline profiling).
+ *
+ *          Live input is disabled while a replay runs, as it would diverge
+ *          from the recorded session, and enabled again once it finishes.
+ *
+ *          File layout: the 8 byte magic "ONSETINP", a little endian 32 bit
+ *          version, then per command a LEB128 varint of the step delta from
+ *          the previous command, followed by one InputCommandId byte.
+ */
+class InputRecorder {
+public:
+    /**
+     * \brief   The default constructor.
+     */
+    InputRecorder() = default;
+    /**
+     * \brief   The default destructor.
+     */
+    ~InputRecorder() = default;
+
+    /**
+     * \brief   The function connect.
+     * \details This function connects the recorder to the dispatcher sink of
+     *          every recordable command. Must follow the game's own sinks, so
+     *          a replay dispatches in the same order as the recorded session.
+     * \param   dispatcher  The game's event system dispatcher.
+     * \return  void, none.
+     */
+    void connect(entt::dispatcher&);
+    /**
+     * \brief   The function setInputInvoker.
+     * \details This function sets the invoker whose commands are disabled
+     *          while a replay runs.
+     * \param   inputInvoker    The game's input invoker, or nullptr if headless.
+     * \return  void, none.
+     */
+    void setInputInvoker(InputInvoker*);
+    /**
+     * \brief   The function startRecording.
+     * \details This function opens a recording file, truncating it.
+     * \param   path    Path of the binary file to write.
+     * \return  bool, true if the file was opened.
+     */
+    bool startRecording(const std::string&);
+    /**
+     * \brief   The function stopRecording.
+     * \details This function closes the recording file, if any.
+     * \return  void, none.
+     */
+    void stopRecording();
+    /**
+     * \brief   The function startReplay.
+     * \details This function loads a recording to replay from the current
+     *          step on, disabling live input until it finishes.
+     * \param   path    Path of the binary file to read.
+     * \return  bool, true if the file was read and valid.
+     */
+    bool startReplay(const std::string&);
+    /**
+     * \brief   The function replayStep.
+     * \details This function enqueues the commands recorded before the
+     *          current step, enabling live input again after the last one.
+     *          The caller updates the dispatcher.
+     * \param   dispatcher  The game's event system dispatcher.
+     * \return  void, none.
+     */
+    void replayStep(entt::dispatcher&);
+    /**
+     * \brief   The function endStep.
+     * \details This function advances the step index, after a fixed step.
+     * \return  void, none.
+     */
+    void endStep();
+
+    /**
+     * \brief   The function isRecording.
+     * \return  bool, true while a recording file is open.
+     */
+    bool isRecording() const;
+    /**
+     * \brief   The function isReplaying.
+     * \return  bool, true while a loaded recording has commands left.
+     */
+    bool isReplaying() const;
+
+private:
+    /**
+     * \brief   Connect one command type's sink, and keep a command to replay.
+     */
+    template<typename Command, InputCommandId Id>
+    void connectCommand(entt::dispatcher&);
+    /**
+     * \brief   Sink handler, records one command of the given id.
+     */
+    template<InputCommandId Id>
+    void recordCommand();
+    /**
+     * \brief   Append one command to the recording file.
+     */
+    void record(InputCommandId);
+
+    /**
+     * \brief Commands enqueued by replayStep, indexed by InputCommandId.
+     */
+    std::unique_ptr<IInputCommand> m_commands[inputCommandCount];
+    /**
+     * \brief The game's input invoker, disabled while replaying.
+     */
+    InputInvoker* m_inputInvoker = nullptr;
+    /**
+     * \brief Index of the next fixed time step.
+     */
+    std::uint64_t m_step = 0;
+
+    /**
+     * \brief The recording file, open while recording.
+     */
+    std::ofstream m_recordFile;
+    /**
+     * \brief Step of the last recorded command, base of the next step delta.
+     */
+    std::uint64_t m_lastRecordedStep = 0;
+    /**
+     * \brief Number of commands written to the recording file.
+     */
+    std::size_t m_recordCount = 0;
+
+    /**
+     * \brief Commands of the loaded recording, in dispatch order.
+     */
+    std::vector<InputRecord> m_replay;
+    /**
+     * \brief Index of the next command of m_replay to enqueue.
+     */
+    std::size_t m_replayIndex = 0;
+};
+
+#endif // CORE_INPUT_RECORDER_H
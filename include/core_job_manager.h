@@ -0,0 +1,261 @@
+// -----------------------------------------------------------------------------
+// Onset Engine
+// https://github.com/dylanafterall/OnsetEngine.git
+//
+// core_job_manager.h
+//  header of JobManager class, work-stealing scheduler for dependent jobs
+// -----------------------------------------------------------------------------
+#ifndef CORE_JOB_MANAGER_H
+#define CORE_JOB_MANAGER_H
+
+#include "core_log_macros.h"
+#include "core_profile_macros.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+class JobGraph;
+
+/**
+ * \brief   The Job struct.
+ * \details A single unit of work inside a JobGraph. Holds the function to
+ *          execute, and the jobs which may only start once it has finished.
+ */
+struct Job {
+    /**
+     * \brief Name of the job, used when reporting scheduling problems.
+     */
+    std::string m_name;
+    /**
+     * \brief The work to be executed by a worker thread.
+     */
+    std::function<void()> m_function;
+    /**
+     * \brief Indices (into the owning graph) of jobs depending on this job.
+     */
+    std::vector<unsigned int> m_successors;
+    /**
+     * \brief Number of jobs which must finish before this job may start.
+     */
+    unsigned int m_dependencyCount = 0;
+    /**
+     * \brief Dependencies still outstanding during the current graph run.
+     */
+    std::atomic<unsigned int> m_remaining{0};
+    /**
+     * \brief Pointer to the graph owning this job.
+     */
+    JobGraph* m_graph = nullptr;
+};
+
+/**
+ * \brief   The JobGraph class.
+ * \details A directed acyclic graph of jobs. Jobs without dependencies start
+ *          immediately when the graph is run by the JobManager, all others
+ *          start as soon as their last dependency finishes. A graph may be
+ *          run any number of times, so one built once can be run every frame
+ *          without allocating.
+ */
+class JobGraph {
+public:
+    /**
+     * \brief   The default constructor.
+     */
+    JobGraph() = default;
+    /**
+     * \brief   The default destructor.
+     */
+    ~JobGraph() = default;
+
+    /**
+     * \brief   The function addJob.
+     * \details This function adds a job to the graph, without dependencies.
+     * \param   name        Name of the job.
+     * \param   function    The work to execute.
+     * \return  unsigned int, handle of the job used to declare dependencies.
+     */
+    unsigned int addJob(const std::string&, std::function<void()>);
+    /**
+     * \brief   The function addDependency.
+     * \details This function declares that one job must finish before another
+     *          may start. The graph must remain acyclic.
+     * \param   before      Handle of the job which must finish first.
+     * \param   after       Handle of the job which waits on 'before'.
+     * \return  void, none.
+     */
+    void addDependency(unsigned int, unsigned int);
+    /**
+     * \brief   The function clear.
+     * \details This function removes all jobs from the graph.
+     * \return  void, none.
+     */
+    void clear();
+    /**
+     * \brief   The function size.
+     * \return  std::size_t, number of jobs in the graph.
+     */
+    std::size_t size() const;
+
+private:
+    friend class JobManager;
+
+    /**
+     * \brief Jobs of the graph. A deque, so jobs never move once added.
+     */
+    std::deque<Job> m_jobs;
+    /**
+     * \brief Number of jobs not yet finished during the current run.
+     */
+    std::atomic<unsigned int> m_pending{0};
+    /**
+     * \brief Set once a job of the current run has thrown, later jobs skip.
+     */
+    std::atomic<bool> m_failed{false};
+    /**
+     * \brief First exception thrown during the current run, and its guard.
+     */
+    std::exception_ptr m_exception;
+    std::mutex m_exceptionMutex;
+};
+
+/**
+ * \brief   The JobManager class.
+ * \details Owns a pool of worker threads, each with its own queue of ready
+ *          jobs. Workers pop from the back of their own queue, and steal from
+ *          the front of other queues when theirs runs dry. The thread running
+ *          a graph helps execute jobs until the graph has finished.
+ */
+class JobManager {
+public:
+    /**
+     * \brief   The default constructor.
+     */
+    JobManager() = default;
+    /**
+     * \brief   The default destructor.
+     */
+    ~JobManager() = default;
+
+    /**
+     * \brief   The function initialize.
+     * \details This function starts one worker per hardware thread, minus the
+     *          thread calling it (which takes part in running graphs).
+     * \return  void, none.
+     */
+    void initialize();
+    /**
+     * \brief   The function initialize.
+     * \details This function starts the given number of worker threads. With
+     *          zero workers, graphs run entirely on the calling thread.
+     * \param   workerCount     Number of worker threads to start.
+     * \return  void, none.
+     */
+    void initialize(unsigned int);
+    /**
+     * \brief   The function destroy.
+     * \details This function wakes and joins all worker threads.
+     * \return  void, none.
+     */
+    void destroy();
+
+    /**
+     * \brief   The function run.
+     * \details This function schedules every job of the graph, respecting
+     *          dependencies, and blocks until all of them have finished. The
+     *          calling thread executes jobs while it waits, so graphs may
+     *          also be run from inside a job. If a job throws, the jobs not
+     *          yet started are skipped, and the first exception is rethrown
+     *          here once the graph has finished.
+     * \param   graph   The graph of jobs to execute.
+     * \return  void, none.
+     */
+    void run(JobGraph&);
+    /**
+     * \brief   The function parallelFor.
+     * \details This function splits the range [0, count) into chunks of
+     *          grainSize elements and runs the chunks across all workers,
+     *          blocking until every chunk has finished. Rethrows the first
+     *          exception of a chunk, as run does.
+     * \param   count       Number of elements to process.
+     * \param   grainSize   Number of elements per job.
+     * \param   function    Called with the [begin, end) range of each chunk.
+     * \return  void, none.
+     */
+    void parallelFor(std::size_t, std::size_t, const std::function<void(std::size_t, std::size_t)>&);
+    /**
+     * \brief   The function getWorkerCount.
+     * \return  unsigned int, number of worker threads (not counting callers).
+     */
+    unsigned int getWorkerCount() const;
+
+private:
+    /**
+     * \brief   The WorkQueue struct.
+     * \details Queue of ready jobs belonging to a single thread.
+     */
+    struct WorkQueue {
+        /**
+         * \brief Guards m_jobs against the owner and stealing threads.
+         */
+        std::mutex m_mutex;
+        /**
+         * \brief Ready jobs: owner uses the back, thieves use the front.
+         */
+        std::deque<Job*> m_jobs;
+    };
+
+    /**
+     * \brief   Loop executed by each worker thread until destroy is called.
+     */
+    void workerLoop(unsigned int);
+    /**
+     * \brief   Push a ready job onto the queue of the calling thread.
+     */
+    void push(Job*);
+    /**
+     * \brief   Take a job from the calling thread's queue, or steal one.
+     */
+    Job* acquire();
+    /**
+     * \brief   Execute a job, then release any successors it unblocked. An
+     *          exception is kept in the graph, for run to rethrow.
+     */
+    void execute(Job*);
+
+    /**
+     * \brief Worker threads of the pool.
+     */
+    std::vector<std::thread> m_workers;
+    /**
+     * \brief One queue per worker, plus a final queue shared by outside threads.
+     */
+    std::vector<std::unique_ptr<WorkQueue>> m_queues;
+    /**
+     * \brief Mutex used by idle workers to sleep until new jobs are pushed.
+     */
+    std::mutex m_wakeMutex;
+    /**
+     * \brief Condition used to wake idle workers.
+     */
+    std::condition_variable m_wakeCondition;
+    /**
+     * \brief Number of jobs currently sitting in any queue.
+     */
+    std::atomic<unsigned int> m_queuedJobs{0};
+    /**
+     * \brief Cleared by destroy to stop the workers.
+     */
+    std::atomic<bool> m_isRunning{false};
+};
+
+#endif // CORE_JOB_MANAGER_H
@@ -0,0 +1,135 @@
+// -----------------------------------------------------------------------------
+// Onset Engine
+// https://github.com/dylanafterall/OnsetEngine.git
+//
+// core_mesh_file.h
+//  header of MeshFile class, a binary mesh file mapped into memory
+// -----------------------------------------------------------------------------
+#ifndef CORE_MESH_FILE_H
+#define CORE_MESH_FILE_H
+
+#include "core_log_macros.h"
+#include "core_mesh_format.h"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * \brief   The MeshFile class.
+ * \details A mesh file written by tools/formatter (layout in
+ *          core_mesh_format.h), mapped read only into memory. Its vertex and
+ *          index data are used in place, so uploading a mesh copies it once,
+ *          from the page cache to OpenGL. Platforms without mmap read the
+ *          file into a buffer instead. Assumes a little endian host.
+ */
+class MeshFile {
+public:
+    /**
+     * \brief   The default constructor.
+     */
+    MeshFile() = default;
+    /**
+     * \brief   The destructor, unmaps the file.
+     */
+    ~MeshFile();
+    MeshFile(const MeshFile&) = delete;
+    MeshFile& operator=(const MeshFile&) = delete;
+
+    /**
+     * \brief   The function getPath.
+     * \param   name    Name of the mesh, e.g. "sphere".
+     * \return  std::string, path of the mesh's file.
+     */
+    static std::string getPath(const std::string&);
+
+    /**
+     * \brief   The function open.
+     * \details This function maps a mesh file, and checks its header, its
+     *          size and its indices. Nothing stays mapped if any is wrong.
+     * \param   path    Path of the .onmesh file.
+     * \return  bool, true if the mesh can be used.
+     */
+    bool open(const std::string&);
+    /**
+     * \brief   The function close.
+     * \details This function unmaps the file, invalidating the data pointers.
+     * \return  void, none.
+     */
+    void close();
+
+    /**
+     * \brief   The function getVertexFormat.
+     * \return  int, a VertexFormat of component_render_data.h.
+     */
+    int getVertexFormat() const;
+    /**
+     * \brief   The function getStride.
+     * \return  int, number of floats of an unpacked vertex.
+     */
+    int getStride() const;
+    int getVertexCount() const;
+    /**
+     * \brief   The function getIndexCount.
+     * \return  int, number of indices of the full detail level.
+     */
+    int getIndexCount() const;
+    /**
+     * \brief   The function getBoundingRadius.
+     * \return  float, radius around the mesh's origin enclosing every vertex,
+     *          in mesh units.
+     */
+    float getBoundingRadius() const;
+    /**
+     * \brief   The function getLods.
+     * \return  const std::vector<MeshLod>&, the levels of detail, full detail 
+     *          first.
+     */
+    const std::vector<MeshLod>& getLods() const;
+    /**
+     * \brief   The function getVertices.
+     * \return  const void*, the interleaved vertex data, in the file.
+     */
+    const void* getVertices() const;
+    /**
+     * \brief   The function getVerticesSize.
+     * \return  int, size of the vertex data, in bytes.
+     */
+    int getVerticesSize() const;
+    /**
+     * \brief   The function getIndices.
+     * \return  const unsigned int*, the triangle lists of every level, in 
+     *          the file.
+     */
+    const unsigned int* getIndices() const;
+    /**
+     * \brief   The function getIndicesSize.
+     * \return  int, size of the index data of every level, in bytes.
+     */
+    int getIndicesSize() const;
+
+private:
+    /**
+     * \brief   Check the mapped file holds a well formed mesh.
+     */
+    bool validate(const std::string&);
+    /**
+     * \brief   Offset of the vertex data, past the header and level table.
+     */
+    std::size_t getVerticesOffset() const;
+
+    MeshFileHeader m_header = {};
+    std::vector<MeshLod> m_lods;
+    float m_boundingRadius = 0.0f;
+    /**
+     * \brief Start of the mapped file, nullptr when closed.
+     */
+    const unsigned char* m_data = nullptr;
+    std::size_t m_size = 0;
+    /**
+     * \brief Contents of the file, where it cannot be mapped.
+     */
+    std::vector<unsigned char> m_buffer;
+};
+
+#endif // CORE_MESH_FILE_H
@@ -0,0 +1,99 @@
+// -----------------------------------------------------------------------------
+// Onset Engine
+// https://github.com/dylanafterall/OnsetEngine.git
+//
+// core_mesh_format.h
+//  header: layout of binary mesh files, shared with the mesh formatter
+// -----------------------------------------------------------------------------
+#ifndef CORE_MESH_FORMAT_H
+#define CORE_MESH_FORMAT_H
+
+#include <cstdint>
+
+// A mesh file (.onmesh) is written by tools/formatter and mapped into memory
+// by MeshFile, its data uploaded to OpenGL straight from the mapping. All
+// values are little endian. The header is a multiple of 16 bytes and a vertex
+// a multiple of 4, so both data sections are aligned for in place use.
+//
+// File layout:
+//      MeshFileHeader
+//      level table     m_lodCount MeshLod, full detail first
+//      vertex data     m_vertexCount vertices of m_vertexSize bytes
+//      index data      m_indexCount 32-bit indices, three per triangle, the
+//                      triangles of every level one after the other
+//
+// The levels of detail share the vertex data, each a range of the indices
+// drawing the mesh with fewer triangles.
+
+/**
+ * \brief Magic bytes at the start of every mesh file.
+ */
+static const char MESH_MAGIC[8] = {'O', 'N', 'S', 'E', 'T', 'M', 'S', 'H'};
+/**
+ * \brief Version of the layout below, bumped on any change to it.
+ */
+const std::uint32_t MESH_VERSION = 2;
+/**
+ * \brief Directory of the mesh files, relative to the build directory, and
+ *        their extension. A mesh named "sphere" is meshes/sphere.onmesh.
+ */
+static const char MESH_DIRECTORY[] = "../assets/meshes/";
+static const char MESH_EXTENSION[] = ".onmesh";
+/**
+ * \brief Most levels of detail a mesh file holds, full detail included.
+ */
+const std::uint32_t MAX_MESH_LODS = 4;
+
+/**
+ * \brief   The MeshFileHeader struct.
+ * \details First 64 bytes of a mesh file.
+ */
+struct MeshFileHeader {
+    char m_magic[8];
+    std::uint32_t m_version;
+    /**
+     * \brief A VertexFormat of component_render_data.h, 0: float, 1: packed.
+     */
+    std::uint32_t m_vertexFormat;
+    std::uint32_t m_vertexCount;
+    /**
+     * \brief Size of a vertex, in bytes.
+     */
+    std::uint32_t m_vertexSize;
+    std::uint32_t m_indexCount;
+    /**
+     * \brief Number of vertex attributes, and their float counts as unpacked
+     *        (position, normal, tex coords: 3, 3, 2).
+     */
+    std::uint32_t m_attributeCount;
+    std::uint32_t m_attributes[4];
+    /**
+     * \brief Number of levels of detail, 1 to MAX_MESH_LODS.
+     */
+    std::uint32_t m_lodCount;
+    std::uint32_t m_reserved[3];
+};
+
+/**
+ * \brief   The MeshLod struct.
+ * \details One level of detail of a mesh, in the level table of its file and
+ *          in the MeshRegistry once uploaded.
+ */
+struct MeshLod {
+    /**
+     * \brief First index of the level, and its number of indices.
+     */
+    std::uint32_t m_indexOffset;
+    std::uint32_t m_indexCount;
+    /**
+     * \brief Distance the level's surface may stray from the full detail 
+     *        mesh, in mesh units. 0 for full detail.
+     */
+    float m_error;
+    std::uint32_t m_reserved;
+};
+
+static_assert(sizeof(MeshFileHeader) == 64, "MeshFileHeader layout");
+static_assert(sizeof(MeshLod) == 16, "MeshLod layout");
+
+#endif // CORE_MESH_FORMAT_H
@@ -0,0 +1,102 @@
+// -----------------------------------------------------------------------------
+// Onset Engine
+// https://github.com/dylanafterall/OnsetEngine.git
+//
+// core_mesh_registry.h
+//  header of MeshRegistry class, meshes resident on the GPU, shared by handle
+// -----------------------------------------------------------------------------
+#ifndef CORE_MESH_REGISTRY_H
+#define CORE_MESH_REGISTRY_H
+
+#include "core_log_macros.h"
+#include "core_mesh_format.h"
+
+#include <glad/glad.h>
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * \brief   The Mesh struct.
+ * \details OpenGL buffers of a mesh uploaded once, shared by every entity 
+ *          drawing it.
+ */
+struct Mesh {
+    unsigned int m_VAO = 0;
+    unsigned int m_VBO = 0;
+    unsigned int m_EBO = 0;
+    int m_vertexCount = 0;
+    /**
+     * \brief Number of indices in the EBO, of every level of detail.
+     */
+    int m_indexCount = 0;
+    /**
+     * \brief Levels of detail, ranges of the EBO, full detail first.
+     */
+    std::vector<MeshLod> m_lods;
+};
+
+/**
+ * \brief   The MeshRegistry class.
+ * \details Owns the meshes resident on the GPU, each stored under a key 
+ *          naming its geometry and vertex layout. Handles start at 1, so a
+ *          handle of 0 means no mesh, as with OpenGL IDs.
+ */
+class MeshRegistry {
+public:
+    /**
+     * \brief   The default constructor.
+     */
+    MeshRegistry() = default;
+    /**
+     * \brief   The default destructor.
+     */
+    ~MeshRegistry() = default;
+
+    /**
+     * \brief   The function find.
+     * \param   key     Name and vertex layout of the mesh.
+     * \return  unsigned int, handle of the mesh, 0 if not resident.
+     */
+    unsigned int find(const std::string&) const;
+    /**
+     * \brief   The function add.
+     * \details This function takes ownership of an uploaded mesh.
+     * \param   key     Name and vertex layout of the mesh.
+     * \param   mesh    OpenGL buffers of the mesh.
+     * \return  unsigned int, handle of the mesh.
+     */
+    unsigned int add(const std::string&, const Mesh&);
+    /**
+     * \brief   The function get.
+     * \param   handle  Handle returned by find or add.
+     * \return  const Mesh&, the mesh.
+     */
+    const Mesh& get(unsigned int) const;
+    /**
+     * \brief   The function getCount.
+     * \return  std::size_t, number of resident meshes.
+     */
+    std::size_t getCount() const;
+    /**
+     * \brief   The function destroy.
+     * \details This function deletes the buffers of every mesh, invalidating
+     *          all handles.
+     * \return  void, none.
+     */
+    void destroy();
+
+private:
+    /**
+     * \brief Meshes, by handle - 1.
+     */
+    std::vector<Mesh> m_meshes;
+    /**
+     * \brief Handle of each key.
+     */
+    std::unordered_map<std::string, unsigned int> m_handles;
+};
+
+#endif // CORE_MESH_REGISTRY_H
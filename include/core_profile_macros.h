@@ -0,0 +1,25 @@
+// -----------------------------------------------------------------------------
+// Onset Engine
+// https://github.com/dylanafterall/OnsetEngine.git
+//
+// core_profile_macros.h
+//  macros to be used for timing scopes with the ProfileManager class
+// -----------------------------------------------------------------------------
+#ifndef CORE_PROFILE_MACROS_H
+#define CORE_PROFILE_MACROS_H
+
+#include "core_profile_manager.h"
+
+#define ONSET_PROFILE_CONCAT_INNER(a, b) a##b
+#define ONSET_PROFILE_CONCAT(a, b) ONSET_PROFILE_CONCAT_INNER(a, b)
+
+// enable profiling unless explicitly compiled out
+#ifndef ONSET_CONFIG_NO_PROFILE
+#define ONSET_PROFILE_SCOPE(name) ProfileScope ONSET_PROFILE_CONCAT(onsetProfileScope, __LINE__)(name)
+#define ONSET_PROFILE_THREAD(name) ProfileManager::setThreadName(name)
+#else
+#define ONSET_PROFILE_SCOPE(name) (void)0
+#define ONSET_PROFILE_THREAD(name) (void)0
+#endif // ONSET_CONFIG_NO_PROFILE
+
+#endif // CORE_PROFILE_MACROS_H
@@ -0,0 +1,225 @@
+// -----------------------------------------------------------------------------
+// Onset Engine
+// https://github.com/dylanafterall/OnsetEngine.git
+//
+// core_profile_manager.h
+//  header of ProfileManager class, scoped CPU timers and Chrome trace export
+// -----------------------------------------------------------------------------
+#ifndef CORE_PROFILE_MANAGER_H
+#define CORE_PROFILE_MANAGER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * \brief   The ProfileEvent struct.
+ * \details One finished scope, as recorded by a ProfileScope.
+ */
+struct ProfileEvent {
+    /**
+     * \brief Name of the scope. Must be a string literal (never copied).
+     */
+    const char* m_name = nullptr;
+    /**
+     * \brief Time the scope was entered, in steady clock nanoseconds.
+     */
+    std::int64_t m_start = 0;
+    /**
+     * \brief Time the scope was left, in steady clock nanoseconds.
+     */
+    std::int64_t m_end = 0;
+};
+
+/**
+ * \brief   The ProfileThreadBuffer struct.
+ * \details Ring buffer of the events recorded by a single thread. Only its
+ *          owning thread writes to it, so recording never takes a lock. Once
+ *          full, the oldest events are overwritten.
+ */
+struct ProfileThreadBuffer {
+    /**
+     * \brief Number of events kept per thread (a power of two).
+     */
+    static const std::uint64_t CAPACITY = 1 << 16;
+
+    /**
+     * \brief Storage for the events, indexed by m_head modulo CAPACITY.
+     */
+    std::unique_ptr<ProfileEvent[]> m_events{new ProfileEvent[CAPACITY]};
+    /**
+     * \brief Total number of events ever recorded, published with release.
+     */
+    std::atomic<std::uint64_t> m_head{0};
+    /**
+     * \brief Trace thread id, in order of each thread's first event.
+     */
+    unsigned int m_threadId = 0;
+    /**
+     * \brief Name of the thread in the trace. Must be a string literal.
+     */
+    std::atomic<const char*> m_threadName{nullptr};
+};
+
+/**
+ * \brief   The ProfileManager class.
+ * \details Collects the ProfileEvents of every thread, and writes them out as
+ *          Chrome trace event JSON (loadable by chrome://tracing and Perfetto)
+ *          on demand. Scopes are timed through the macros of
+ *          core_profile_macros.h, which reach the manager through a static
+ *          instance pointer set by initialize.
+ */
+class ProfileManager {
+public:
+    /**
+     * \brief   The default constructor.
+     */
+    ProfileManager() = default;
+    /**
+     * \brief   The default destructor.
+     */
+    ~ProfileManager() = default;
+
+    /**
+     * \brief   The function initialize.
+     * \details This function makes this manager the one receiving events, and
+     *          marks the start of the trace.
+     * \return  void, none.
+     */
+    void initialize();
+    /**
+     * \brief   The function destroy.
+     * \details This function stops receiving events, and frees all thread
+     *          buffers. Threads recording events must have been joined.
+     * \return  void, none.
+     */
+    void destroy();
+
+    /**
+     * \brief   The function writeTrace.
+     * \details This function writes every event still held by the thread
+     *          buffers to a Chrome trace event JSON file. Threads may keep
+     *          recording meanwhile: events newer than the call are left out.
+     * \param   path    Path of the JSON file to write.
+     * \return  bool, true if the file was written.
+     */
+    bool writeTrace(const std::string&);
+    /**
+     * \brief   The function getEvents.
+     * \details This function appends every event still held by the thread
+     *          buffers to the given vector, thread by thread.
+     * \param   events  Vector receiving the events.
+     * \return  void, none.
+     */
+    void getEvents(std::vector<ProfileEvent>&);
+    /**
+     * \brief   The function setTracePath.
+     * \details This function sets the file written by handleDumpCommand.
+     * \param   path    Path of the JSON file to write.
+     * \return  void, none.
+     */
+    void setTracePath(const std::string&);
+    /**
+     * \brief   The function handleDumpCommand.
+     * \details This function is connected to the DumpProfileCommand event, and
+     *          writes the trace to the path set by setTracePath.
+     * \return  void, none.
+     */
+    void handleDumpCommand();
+
+    /**
+     * \brief   The function now.
+     * \return  std::int64_t, current steady clock time in nanoseconds.
+     */
+    static std::int64_t now();
+    /**
+     * \brief   The function record.
+     * \details This function appends an event to the calling thread's buffer.
+     *          Does nothing if no manager is initialized.
+     * \param   name    Name of the scope, a string literal.
+     * \param   start   Time the scope was entered, from now().
+     * \param   end     Time the scope was left, from now().
+     * \return  void, none.
+     */
+    static void record(const char*, std::int64_t, std::int64_t);
+    /**
+     * \brief   The function setThreadName.
+     * \details This function names the calling thread in the trace.
+     * \param   name    Name of the thread, a string literal.
+     * \return  void, none.
+     */
+    static void setThreadName(const char*);
+
+private:
+    /**
+     * \brief   Return the calling thread's buffer, registering it if needed.
+     */
+    ProfileThreadBuffer* getThreadBuffer();
+    /**
+     * \brief   Append the events still held by a buffer, oldest first.
+     */
+    static void copyEvents(const ProfileThreadBuffer&, std::vector<ProfileEvent>&);
+
+    /**
+     * \brief Manager receiving events, set by initialize.
+     */
+    static std::atomic<ProfileManager*> s_instance;
+    /**
+     * \brief Incremented by every initialize, invalidates cached thread buffers.
+     */
+    static std::atomic<unsigned int> s_generation;
+
+    /**
+     * \brief Guards m_buffers while a thread registers or the trace is written.
+     */
+    std::mutex m_buffersMutex;
+    /**
+     * \brief One buffer per thread which has recorded an event.
+     */
+    std::vector<std::unique_ptr<ProfileThreadBuffer>> m_buffers;
+    /**
+     * \brief Time of initialize, the zero of trace timestamps.
+     */
+    std::int64_t m_startTime = 0;
+    /**
+     * \brief File written by handleDumpCommand.
+     */
+    std::string m_tracePath = "../logs/profile_trace.json";
+};
+
+/**
+ * \brief   The ProfileScope class.
+ * \details Times its own lifetime, and records it with the ProfileManager
+ *          when destroyed. Created by the ONSET_PROFILE_SCOPE macro.
+ */
+class ProfileScope {
+public:
+    /**
+     * \brief   The constructor.
+     * \param   name    Name of the scope, a string literal.
+     */
+    explicit ProfileScope(const char* name) : m_name(name), m_start(ProfileManager::now()) {}
+    /**
+     * \brief   The destructor, records the event.
+     */
+    ~ProfileScope() { ProfileManager::record(m_name, m_start, ProfileManager::now()); }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    /**
+     * \brief Name of the scope.
+     */
+    const char* m_name;
+    /**
+     * \brief Time the scope was entered.
+     */
+    std::int64_t m_start;
+};
+
+#endif // CORE_PROFILE_MANAGER_H
@@ -0,0 +1,116 @@
+// -----------------------------------------------------------------------------
+// Onset Engine
+// https://github.com/dylanafterall/OnsetEngine.git
+//
+// core_render_queue.h
+//  header of RenderQueue class, draw commands sorted by GL state
+// -----------------------------------------------------------------------------
+#ifndef CORE_RENDER_QUEUE_H
+#define CORE_RENDER_QUEUE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * \brief   The RenderCommand struct.
+ * \details One draw of a frame: its sort key, and the index of the drawn
+ *          entity in the snapshot list of its pass.
+ */
+struct RenderCommand {
+    std::uint64_t m_key = 0;
+    std::uint32_t m_index = 0;
+};
+
+/**
+ * \brief   The RenderQueue class.
+ * \details Collects the draw commands of a frame, then radix sorts them by
+ *          key. A key packs, from the most significant bits down, the pass,
+ *          the shader program, the material (texture set) and the mesh, so
+ *          sorted draws sharing GL state are adjacent and the RenderSystem
+ *          binds each piece of state once per run. Each field is truncated
+ *          to its width, which at worst splits a run, never changes a draw.
+ */
+class RenderQueue {
+public:
+    /**
+     * \brief   The default constructor.
+     */
+    RenderQueue() = default;
+    /**
+     * \brief   The default destructor.
+     */
+    ~RenderQueue() = default;
+
+    /**
+     * \brief   The function makeKey.
+     * \details This function packs the GL state of a draw into a sort key.
+     * \param   pass        Pass of the draw, drawn in increasing order.
+     * \param   program     OpenGL's ID of the shader program.
+     * \param   material    Index of the draw's texture set.
+     * \param   mesh        OpenGL's ID of the VAO, with any level of detail
+     *                      in its low bits.
+     * \return  std::uint64_t, the sort key.
+     */
+    static std::uint64_t makeKey(unsigned int, unsigned int, unsigned int, unsigned int);
+    /**
+     * \brief   The function getPass.
+     * \param   key     Sort key made by makeKey.
+     * \return  unsigned int, the pass of the key.
+     */
+    static unsigned int getPass(std::uint64_t);
+
+    /**
+     * \brief   The function clear.
+     * \details This function drops the commands of the last frame, keeping
+     *          their storage.
+     * \return  void, none.
+     */
+    void clear();
+    /**
+     * \brief   The function push.
+     * \param   key     Sort key made by makeKey.
+     * \param   index   Index of the entity in the snapshot list of its pass.
+     * \return  void, none.
+     */
+    void push(std::uint64_t, std::uint32_t);
+    /**
+     * \brief   The function sort.
+     * \details This function sorts the commands by key, with a least
+     *          significant byte first radix sort. Bytes every key shares are
+     *          skipped. The sort is stable, so equal keys keep push order.
+     * \return  void, none.
+     */
+    void sort();
+    /**
+     * \brief   The function getPassRange.
+     * \details This function finds the commands of one pass, once sorted.
+     * \param   pass    Pass of the commands.
+     * \param   begin   Receives the index of the pass's first command.
+     * \param   end     Receives the index past the pass's last command.
+     * \return  void, none.
+     */
+    void getPassRange(unsigned int, std::size_t&, std::size_t&) const;
+    /**
+     * \brief   The function getCommands.
+     * \return  const std::vector<RenderCommand>&, the commands of the frame.
+     */
+    const std::vector<RenderCommand>& getCommands() const;
+
+    /**
+     * \brief Bit widths of the key's fields, summing to 64.
+     */
+    static constexpr unsigned int PASS_BITS = 4;
+    static constexpr unsigned int PROGRAM_BITS = 12;
+    static constexpr unsigned int MATERIAL_BITS = 24;
+    static constexpr unsigned int MESH_BITS = 24;
+
+private:
+    std::vector<RenderCommand> m_commands;
+    /**
+     * \brief Destination of each radix pass, swapped with m_commands.
+     */
+    std::vector<RenderCommand> m_scratch;
+};
+
+#endif // CORE_RENDER_QUEUE_H
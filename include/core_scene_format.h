@@ -0,0 +1,298 @@
+// -----------------------------------------------------------------------------
+// Onset Engine
+// https://github.com/dylanafterall/OnsetEngine.git
+//
+// core_scene_format.h
+//  header: layout of compiled binary scene files, shared with the compiler
+// -----------------------------------------------------------------------------
+#ifndef CORE_SCENE_FORMAT_H
+#define CORE_SCENE_FORMAT_H
+
+#include <cstdint>
+
+// A compiled scene (.onsc) is written by tools/scene_compiler and read back by
+// the SceneManager in a single read. All values are little endian, and every
+// record is a multiple of 4 bytes, so the loader reads them in place.
+//
+// File layout:
+//      SceneHeader
+//      string table        null terminated strings, referenced by byte offset
+//      SceneRecord[]       m_templateCount template records
+//      SceneRecord[]       m_entityCount entity records
+//      component data      per component a SceneComponentHeader, then its blob
+
+/**
+ * \brief Magic bytes at the start of every compiled scene.
+ */
+static const char SCENE_MAGIC[8] = {'O', 'N', 'S', 'E', 'T', 'S', 'C', 'N'};
+/**
+ * \brief Version of the layout below, bumped on any change to it.
+ */
+const std::uint32_t SCENE_VERSION = 1;
+/**
+ * \brief String offset of an absent string (e.g. no specular map).
+ */
+const std::uint32_t SCENE_NO_STRING = 0xFFFFFFFF;
+/**
+ * \brief Template index of an entity created from no template.
+ */
+const std::uint32_t SCENE_NO_TEMPLATE = 0xFFFFFFFF;
+
+/**
+ * \brief   The SceneComponentType enum.
+ * \details Identifies the blob following a SceneComponentHeader. Entities are
+ *          built in this order, so a body exists before its fixtures. Values
+ *          are stored in files, so new types may only be appended.
+ */
+enum SceneComponentType : std::uint16_t {
+    sceneCamera = 0,
+    sceneSkybox,
+    sceneLight,
+    sceneMaterial,
+    sceneTexture,
+    sceneShader,
+    sceneMesh,
+    sceneText,
+    sceneSprite,
+    scenePlayer,
+    sceneBody,
+    sceneCircle,
+    sceneBox,
+    sceneFixture,
+    sceneAudio,
+    sceneShadow,
+    sceneComponentCount
+};
+
+/**
+ * \brief   The SceneHeader struct.
+ * \details First 32 bytes of a compiled scene.
+ */
+struct SceneHeader {
+    char m_magic[8];
+    std::uint32_t m_version;
+    /**
+     * \brief Size of the string table, in bytes.
+     */
+    std::uint32_t m_stringTableSize;
+    std::uint32_t m_templateCount;
+    std::uint32_t m_entityCount;
+    /**
+     * \brief Size of the component data, in bytes.
+     */
+    std::uint32_t m_componentDataSize;
+    std::uint32_t m_reserved;
+};
+
+/**
+ * \brief   The SceneRecord struct.
+ * \details One template or entity: a run of components in the component data.
+ *          An entity starts from its template's components, and its own
+ *          components replace the template's of the same type.
+ */
+struct SceneRecord {
+    /**
+     * \brief String offset of the name, for diagnostics.
+     */
+    std::uint32_t m_name;
+    /**
+     * \brief Template index, or SCENE_NO_TEMPLATE (always so for templates).
+     */
+    std::uint32_t m_template;
+    /**
+     * \brief Byte offset of the first component in the component data.
+     */
+    std::uint32_t m_componentOffset;
+    std::uint32_t m_componentCount;
+};
+
+/**
+ * \brief   The SceneComponentHeader struct.
+ * \details Precedes each blob in the component data.
+ */
+struct SceneComponentHeader {
+    /**
+     * \brief A SceneComponentType.
+     */
+    std::uint16_t m_type;
+    /**
+     * \brief Size of the blob following this header, in bytes.
+     */
+    std::uint16_t m_size;
+};
+
+// component blobs
+// .............................................................................
+// fields named by a string offset hold SCENE_NO_STRING when absent
+
+struct SceneCameraBlob {
+    float m_position[3];
+    /**
+     * \brief A CameraType, 1 (first) designates the main camera.
+     */
+    std::uint32_t m_type;
+};
+
+struct SceneSkyboxBlob {
+    std::uint32_t m_id;
+};
+
+struct SceneLightBlob {
+    /**
+     * \brief 0: directional, 1: point, 2: spot.
+     */
+    std::uint32_t m_type;
+    float m_scale[3];
+    float m_direction[3];
+    /**
+     * \brief Cosines of the spot cone angles, computed by the compiler.
+     */
+    float m_cutOff;
+    float m_outerCutOff;
+    float m_constant;
+    float m_linear;
+    float m_quadratic;
+    float m_ambient[3];
+    float m_diffuse[3];
+    float m_specular[3];
+};
+
+struct SceneMaterialBlob {
+    float m_shininess;
+};
+
+struct SceneTextureBlob {
+    /**
+     * \brief String offsets of AssetManager texture and cubemap ids.
+     */
+    std::uint32_t m_diffuse;
+    std::uint32_t m_specular;
+    std::uint32_t m_normal;
+    std::uint32_t m_cubemap;
+};
+
+struct SceneShaderBlob {
+    /**
+     * \brief String offsets of AssetManager shader program ids.
+     */
+    std::uint32_t m_output;
+    std::uint32_t m_light;
+    std::uint32_t m_shadow;
+    std::uint32_t m_stencil;
+};
+
+struct SceneMeshBlob {
+    /**
+     * \brief String offset of the mesh name (cube, sphere, ground, ...).
+     */
+    std::uint32_t m_mesh;
+    /**
+     * \brief Number of vertex attributes bound, and their float counts.
+     */
+    std::uint32_t m_attributeCount;
+    std::uint32_t m_attributes[4];
+};
+
+struct SceneTextBlob {
+    float m_x;
+    float m_y;
+    float m_scale;
+    float m_color[3];
+    /**
+     * \brief String offset of the message.
+     */
+    std::uint32_t m_message;
+};
+
+struct SceneSpriteBlob {
+    float m_shininess;
+    float m_position[3];
+    float m_rotation;
+    float m_scale[3];
+};
+
+struct ScenePlayerBlob {
+    std::uint32_t m_id;
+};
+
+struct SceneBodyBlob {
+    /**
+     * \brief A b2BodyType, 0: static, 1: kinematic, 2: dynamic.
+     */
+    std::uint32_t m_type;
+    float m_position[2];
+    float m_angle;
+};
+
+struct SceneCircleBlob {
+    float m_center[2];
+    float m_radius;
+    float m_density;
+    float m_friction;
+    float m_restitution;
+};
+
+struct SceneBoxBlob {
+    float m_halfSize[2];
+    float m_center[2];
+    float m_angle;
+    float m_density;
+    float m_friction;
+    float m_restitution;
+};
+
+struct SceneFixtureBlob {
+    /**
+     * \brief FixtureUserDataComponent::m_fixtureType of the body's fixtures.
+     */
+    std::uint32_t m_fixtureType;
+};
+
+struct SceneAudioBlob {
+    /**
+     * \brief String offsets of AudioManager sound effect ids.
+     */
+    std::uint32_t m_collision;
+    std::uint32_t m_selectOn;
+    std::uint32_t m_selectOff;
+    float m_pitch;
+    float m_gain;
+    std::uint32_t m_loop;
+};
+
+struct SceneShadowBlob {
+    /**
+     * \brief 0: none, 1: mono-directional (spot), 2: omnidirectional (point).
+     */
+    std::uint32_t m_type;
+    std::uint32_t m_index;
+    float m_nearPlane;
+    float m_farPlane;
+};
+
+/**
+ * \brief Shadow maps of each type the lighting shader samples, so the bound
+ *        on a shadow's index (the RenderSystem's MAX_SPOT_LIGHTS and 
+ *        MAX_POINT_LIGHTS).
+ */
+const std::uint32_t SCENE_SPOT_SHADOWS = 3;
+const std::uint32_t SCENE_POINT_SHADOWS = 3;
+
+/**
+ * \brief   Whether a shadow's type is known and its index names one of the
+ *          shadow maps of that type. Lights casting no shadow (type 0) may
+ *          have any index.
+ */
+inline bool isValidShadow(const SceneShadowBlob& shadow) {
+    return shadow.m_type == 0
+        || (shadow.m_type == 1 && shadow.m_index < SCENE_SPOT_SHADOWS)
+        || (shadow.m_type == 2 && shadow.m_index < SCENE_POINT_SHADOWS);
+}
+
+static_assert(sizeof(SceneHeader) == 32, "SceneHeader layout");
+static_assert(sizeof(SceneRecord) == 16, "SceneRecord layout");
+static_assert(sizeof(SceneComponentHeader) == 4, "SceneComponentHeader layout");
+static_assert(sizeof(SceneLightBlob) == 84, "SceneLightBlob layout");
+static_assert(sizeof(SceneBoxBlob) == 32, "SceneBoxBlob layout");
+
+#endif // CORE_SCENE_FORMAT_H
@@ -0,0 +1,117 @@
+// -----------------------------------------------------------------------------
+// Onset Engine
+// https://github.com/dylanafterall/OnsetEngine.git
+//
+// core_scene_manager.h
+//  header of SceneManager class, creates level entities from compiled scenes
+// -----------------------------------------------------------------------------
+#ifndef CORE_SCENE_MANAGER_H
+#define CORE_SCENE_MANAGER_H
+
+#include "core_asset_manager.h"
+#include "core_audio_manager.h"
+#include "core_log_macros.h"
+#include "core_mesh_file.h"
+#include "core_profile_macros.h"
+#include "core_scene_format.h"
+#include "core_text_manager.h"
+
+#include "component_all.h"
+#include "system_render.h"
+
+#include "entt/entt.hpp"
+#include "box2d/box2d.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * \brief   The SceneManager class.
+ * \details Creates a level's entities from a binary scene compiled by
+ *          tools/scene_compiler (layout in core_scene_format.h). The file is
+ *          read with a single read and its records used in place: every
+ *          entity is created in one bulk registry call, then each gets its
+ *          template's component blobs, overridden by its own, turned into
+ *          components, Box2D bodies and fixtures, GL buffers and AL sources.
+ *          Assumes a little endian host.
+ */
+class SceneManager {
+public:
+    /**
+     * \brief   The default constructor.
+     */
+    SceneManager() = default;
+    /**
+     * \brief   The default destructor.
+     */
+    ~SceneManager() = default;
+
+    /**
+     * \brief   The function initialize.
+     * \details This function sets the registry and world receiving the
+     *          scene's entities, and the objects resolving its asset names.
+     * \param   registry        The game's EnTT registry.
+     * \param   world           The game's Box2D world.
+     * \param   renderSystem    Creates GL buffers and shadow framebuffers.
+     * \param   assetManager    Resolves shader, texture and cubemap names.
+     * \param   audioManager    Resolves sound effect names.
+     * \param   textManager     Supplies the glyphs of text messages.
+     * \return  void, none.
+     */
+    void initialize(entt::registry*, b2World*, RenderSystem*, AssetManager*, AudioManager*, TextManager*);
+    /**
+     * \brief   The function loadScene.
+     * \details This function reads a compiled scene, and creates its entities.
+     *          Nothing is created if the file is missing or malformed.
+     * \param   path    Path of the .onsc file to read.
+     * \return  bool, true if the scene was loaded.
+     */
+    bool loadScene(const std::string&);
+
+private:
+    /**
+     * \brief The vertices of every mesh a scene may name, defined in the .cpp.
+     *        Mesh files stay mapped until the end of the load.
+     */
+    struct MeshTable;
+
+    /**
+     * \brief   Check a record's components lie within the component data.
+     */
+    bool validateRecord(const SceneRecord&, const unsigned char*, std::uint32_t);
+    /**
+     * \brief   Point blobs[type] at each component blob of a record.
+     */
+    void collectBlobs(const SceneRecord&, const unsigned char*, const unsigned char**);
+    /**
+     * \brief   Create an entity's components from its blobs, by type.
+     */
+    void createEntity(entt::entity, const unsigned char* const*);
+    /**
+     * \brief   Return a string of the string table, empty if absent.
+     */
+    std::string getString(std::uint32_t) const;
+
+    entt::registry* m_registry = nullptr;
+    b2World* m_world = nullptr;
+    RenderSystem* m_renderSystem = nullptr;
+    AssetManager* m_assetManager = nullptr;
+    AudioManager* m_audioManager = nullptr;
+    TextManager* m_textManager = nullptr;
+
+    /**
+     * \brief Meshes of the scene being loaded.
+     */
+    MeshTable* m_meshes = nullptr;
+    /**
+     * \brief String table of the scene being loaded.
+     */
+    const char* m_strings = nullptr;
+    /**
+     * \brief Size of m_strings, in bytes.
+     */
+    std::uint32_t m_stringsSize = 0;
+};
+
+#endif // CORE_SCENE_MANAGER_H
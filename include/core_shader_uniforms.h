@@ -0,0 +1,212 @@
+// -----------------------------------------------------------------------------
+// Onset Engine
+// https://github.com/dylanafterall/OnsetEngine.git
+//
+// core_shader_uniforms.h
+//  header: typed uniform handles, and the layouts of shared uniform blocks
+// -----------------------------------------------------------------------------
+#ifndef CORE_SHADER_UNIFORMS_H
+#define CORE_SHADER_UNIFORMS_H
+
+#include "glad/glad.h"
+#include "glm/glm.hpp"
+
+#include <cstddef>
+
+/**
+ * \brief   The ShaderUniform struct.
+ * \details An active uniform of a linked program, as reflected by the
+ *          AssetManager. Each element of an array is reflected on its own.
+ */
+struct ShaderUniform {
+    /**
+     * \brief Location passed to glUniform*.
+     */
+    GLint m_location = -1;
+    /**
+     * \brief GLSL type, e.g. GL_FLOAT_MAT4.
+     */
+    GLenum m_type = 0;
+};
+
+/**
+ * \brief   The Uniform struct.
+ * \details A pre-resolved uniform location of a program, typed by the value
+ *          it accepts. A location of -1 (uniform inactive or missing) makes
+ *          setUniform a no-op, as with glUniform*.
+ */
+template <typename T>
+struct Uniform {
+    GLint m_location = -1;
+};
+
+/**
+ * \brief   The UniformType struct.
+ * \details Maps a C++ value type to the GLSL types it may be set on.
+ */
+template <typename T>
+struct UniformType;
+
+template <>
+struct UniformType<int> {
+    // samplers are set with their texture unit
+    static bool matches(GLenum type) {
+        return type == GL_INT || type == GL_BOOL || type == GL_SAMPLER_2D || type == GL_SAMPLER_CUBE;
+    }
+};
+
+template <>
+struct UniformType<float> {
+    static bool matches(GLenum type) { return type == GL_FLOAT; }
+};
+
+template <>
+struct UniformType<glm::vec3> {
+    static bool matches(GLenum type) { return type == GL_FLOAT_VEC3; }
+};
+
+template <>
+struct UniformType<glm::vec4> {
+    static bool matches(GLenum type) { return type == GL_FLOAT_VEC4; }
+};
+
+template <>
+struct UniformType<glm::mat3> {
+    static bool matches(GLenum type) { return type == GL_FLOAT_MAT3; }
+};
+
+template <>
+struct UniformType<glm::mat4> {
+    static bool matches(GLenum type) { return type == GL_FLOAT_MAT4; }
+};
+
+// setters of the program in use, one per handle type
+// .............................................................................
+inline void setUniform(Uniform<int> uniform, int value) {
+    glUniform1i(uniform.m_location, value);
+}
+
+inline void setUniform(Uniform<float> uniform, float value) {
+    glUniform1f(uniform.m_location, value);
+}
+
+inline void setUniform(Uniform<glm::vec3> uniform, const glm::vec3& value) {
+    glUniform3f(uniform.m_location, value[0], value[1], value[2]);
+}
+
+inline void setUniform(Uniform<glm::vec4> uniform, const glm::vec4& value) {
+    glUniform4f(uniform.m_location, value[0], value[1], value[2], value[3]);
+}
+
+inline void setUniform(Uniform<glm::mat3> uniform, const glm::mat3& value) {
+    glUniformMatrix3fv(uniform.m_location, 1, GL_FALSE, &value[0][0]);
+}
+
+inline void setUniform(Uniform<glm::mat4> uniform, const glm::mat4& value) {
+    glUniformMatrix4fv(uniform.m_location, 1, GL_FALSE, &value[0][0]);
+}
+
+// _____________________________________________________________________________
+// -----------------------------------------------------------------------------
+// uniform blocks
+// _____________________________________________________________________________
+// -----------------------------------------------------------------------------
+// per-frame data shared by every program, written once per frame by the 
+// RenderSystem. Each struct mirrors the std140 layout of its GLSL block, so 
+// vec3 members are followed by a float (or padding) filling their 16 bytes
+
+/**
+ * \brief Binding points of the uniform blocks, set on every linked program.
+ */
+static constexpr GLuint CAMERA_BLOCK_BINDING = 0;
+static constexpr GLuint LIGHTS_BLOCK_BINDING = 1;
+
+/**
+ * \brief Point and spot lights of the Lights block, as in basic_lighting.frag.
+ */
+static constexpr unsigned int MAX_POINT_LIGHTS = 3;
+static constexpr unsigned int MAX_SPOT_LIGHTS = 3;
+
+/**
+ * \brief   The CameraBlock struct.
+ * \details Layout of the Camera uniform block.
+ */
+struct CameraBlock {
+    glm::mat4 m_projection = glm::mat4(1.0f);
+    glm::mat4 m_view = glm::mat4(1.0f);
+    glm::vec3 m_viewPos = glm::vec3(0.0f);
+    float m_padding = 0.0f;
+};
+
+/**
+ * \brief   The DirLightBlock struct.
+ * \details Layout of the DirLight struct of the Lights uniform block.
+ */
+struct DirLightBlock {
+    glm::vec3 m_direction = glm::vec3(0.0f);
+    float m_padding0 = 0.0f;
+    glm::vec3 m_ambient = glm::vec3(0.0f);
+    float m_padding1 = 0.0f;
+    glm::vec3 m_diffuse = glm::vec3(0.0f);
+    float m_padding2 = 0.0f;
+    glm::vec3 m_specular = glm::vec3(0.0f);
+    float m_padding3 = 0.0f;
+};
+
+/**
+ * \brief   The PointLightBlock struct.
+ * \details Layout of the PointLight struct of the Lights uniform block. 
+ *          Lights not in the scene keep a constant attenuation of 1 and no 
+ *          color, so they add nothing.
+ */
+struct PointLightBlock {
+    glm::vec3 m_position = glm::vec3(0.0f);
+    float m_constant = 1.0f;
+    glm::vec3 m_ambient = glm::vec3(0.0f);
+    float m_linear = 0.0f;
+    glm::vec3 m_diffuse = glm::vec3(0.0f);
+    float m_quadratic = 0.0f;
+    glm::vec3 m_specular = glm::vec3(0.0f);
+    float m_farPlane = 1.0f;
+};
+
+/**
+ * \brief   The SpotLightBlock struct.
+ * \details Layout of the SpotLight struct of the Lights uniform block.
+ */
+struct SpotLightBlock {
+    glm::mat4 m_lightSpaceMatrix = glm::mat4(1.0f);
+    glm::vec3 m_position = glm::vec3(0.0f);
+    float m_cutOff = 0.0f;
+    glm::vec3 m_direction = glm::vec3(0.0f);
+    float m_outerCutOff = 0.0f;
+    glm::vec3 m_ambient = glm::vec3(0.0f);
+    float m_constant = 1.0f;
+    glm::vec3 m_diffuse = glm::vec3(0.0f);
+    float m_linear = 0.0f;
+    glm::vec3 m_specular = glm::vec3(0.0f);
+    float m_quadratic = 0.0f;
+    /**
+     * \brief Offset (xy) and scale (zw) of the light's tile in the shadow 
+     *        atlas, 0 for lights without one.
+     */
+    glm::vec4 m_atlasRect = glm::vec4(0.0f);
+};
+
+/**
+ * \brief   The LightsBlock struct.
+ * \details Layout of the Lights uniform block, indexed by shadow index.
+ */
+struct LightsBlock {
+    DirLightBlock m_dirLight;
+    PointLightBlock m_pointLights[MAX_POINT_LIGHTS];
+    SpotLightBlock m_spotLights[MAX_SPOT_LIGHTS];
+};
+
+static_assert(sizeof(CameraBlock) == 144, "CameraBlock must match the std140 Camera block");
+static_assert(sizeof(DirLightBlock) == 64, "DirLightBlock must match the std140 DirLight struct");
+static_assert(sizeof(PointLightBlock) == 64, "PointLightBlock must match the std140 PointLight struct");
+static_assert(sizeof(SpotLightBlock) == 160, "SpotLightBlock must match the std140 SpotLight struct");
+static_assert(offsetof(LightsBlock, m_spotLights) == 64 + 64 * MAX_POINT_LIGHTS, "LightsBlock must match the std140 Lights block");
+
+#endif // CORE_SHADER_UNIFORMS_H
@@ -0,0 +1,104 @@
+// -----------------------------------------------------------------------------
+// Onset Engine
+// https://github.com/dylanafterall/OnsetEngine.git
+//
+// core_shadow_atlas.h
+//  header of ShadowAtlas class, square shadow map tiles packed into one texture
+// -----------------------------------------------------------------------------
+#ifndef CORE_SHADOW_ATLAS_H
+#define CORE_SHADOW_ATLAS_H
+
+#include "glm/glm.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * \brief   The ShadowTile struct.
+ * \details Texel rectangle of one shadow map in the atlas.
+ */
+struct ShadowTile {
+    std::uint32_t m_x = 0;
+    std::uint32_t m_y = 0;
+    std::uint32_t m_size = 0;
+};
+
+/**
+ * \brief   The ShadowAtlas class.
+ * \details Lays out the square shadow maps of a frame in one texture. Tile
+ *          sides are powers of two, so tiles placed largest first along a
+ *          Morton (Z order) curve fill the atlas without gaps, and the atlas
+ *          is the smallest power of two square, or half square, holding them.
+ */
+class ShadowAtlas {
+public:
+    /**
+     * \brief   The default constructor.
+     */
+    ShadowAtlas() = default;
+    /**
+     * \brief   The default destructor.
+     */
+    ~ShadowAtlas() = default;
+
+    /**
+     * \brief   The function clear.
+     * \details This function removes every tile, keeping the capacity.
+     * \return  void, none.
+     */
+    void clear();
+    /**
+     * \brief   The function addTile.
+     * \param   size    Side of the tile in texels, rounded down to a power of
+     *                  two.
+     * \return  std::uint32_t, number of the tile.
+     */
+    std::uint32_t addTile(std::uint32_t);
+    /**
+     * \brief   The function pack.
+     * \details This function places the tiles added since the last clear.
+     *          Every tile is halved until the atlas fits in maxSize.
+     * \param   maxSize     Largest side of the atlas, in texels.
+     * \return  void, none.
+     */
+    void pack(std::uint32_t);
+    /**
+     * \brief   The function getTile.
+     * \param   tile    Number of the tile.
+     * \return  const ShadowTile&, texel rectangle of the tile after the last
+     *          pack.
+     */
+    const ShadowTile& getTile(std::uint32_t) const;
+    /**
+     * \brief   The function getRect.
+     * \param   tile            Number of the tile.
+     * \param   textureWidth    Width of the atlas texture, at least getWidth.
+     * \param   textureHeight   Height of the atlas texture, at least getHeight.
+     * \return  glm::vec4, offset (xy) and scale (zw) mapping a shadow map's
+     *          [0, 1] coordinates into the atlas texture.
+     */
+    glm::vec4 getRect(std::uint32_t, std::uint32_t, std::uint32_t) const;
+    /**
+     * \brief   The function getWidth.
+     * \return  std::uint32_t, width of the atlas after the last pack, 0 if
+     *          it holds no tile.
+     */
+    std::uint32_t getWidth() const;
+    /**
+     * \brief   The function getHeight.
+     * \return  std::uint32_t, height of the atlas after the last pack.
+     */
+    std::uint32_t getHeight() const;
+
+private:
+    std::vector<ShadowTile> m_tiles;
+    /**
+     * \brief Tile numbers, largest tile first.
+     */
+    std::vector<std::uint32_t> m_order;
+    std::uint32_t m_width = 0;
+    std::uint32_t m_height = 0;
+};
+
+#endif // CORE_SHADOW_ATLAS_H
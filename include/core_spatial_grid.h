@@ -0,0 +1,92 @@
+// -----------------------------------------------------------------------------
+// Onset Engine
+// https://github.com/dylanafterall/OnsetEngine.git
+//
+// core_spatial_grid.h
+//  header of SpatialGrid class, a uniform grid of points for range queries
+// -----------------------------------------------------------------------------
+#ifndef CORE_SPATIAL_GRID_H
+#define CORE_SPATIAL_GRID_H
+
+#include "glm/glm.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * \brief   The SpatialGrid class.
+ * \details Points of the world's plane, binned into square cells covering
+ *          their bounds. Rebuilt whole every frame: inserted points are
+ *          counting sorted by cell into one array, so a query reads the
+ *          contiguous items of the few cells its range overlaps instead of
+ *          every point.
+ */
+class SpatialGrid {
+public:
+    /**
+     * \brief   The default constructor.
+     */
+    SpatialGrid() = default;
+    /**
+     * \brief   The default destructor.
+     */
+    ~SpatialGrid() = default;
+
+    /**
+     * \brief   The function clear.
+     * \details This function removes every point, keeping the capacity.
+     * \return  void, none.
+     */
+    void clear();
+    /**
+     * \brief   The function insert.
+     * \param   item        Number the caller identifies the point by.
+     * \param   position    Position of the point.
+     * \return  void, none.
+     */
+    void insert(std::uint32_t, const glm::vec2&);
+    /**
+     * \brief   The function build.
+     * \details This function bins the points inserted since the last clear.
+     *          Cells grow past cellSize when the points are spread too far
+     *          apart for a grid of MAX_CELLS_PER_POINT cells per point.
+     * \param   cellSize    Side of a cell, ideally about the query radius.
+     * \return  void, none.
+     */
+    void build(float);
+    /**
+     * \brief   The function query.
+     * \details This function lists the points of every cell overlapping the
+     *          square around center, a superset of the points in range.
+     * \param   center      Center of the range.
+     * \param   radius      Half side of the range.
+     * \param   items       Receives the items of the points, in cell order.
+     * \return  void, none.
+     */
+    void query(const glm::vec2&, float, std::vector<std::uint32_t>&) const;
+
+    /**
+     * \brief Most cells of a grid, per point binned.
+     */
+    static constexpr std::size_t MAX_CELLS_PER_POINT = 4;
+
+private:
+    std::vector<std::uint32_t> m_items;
+    std::vector<glm::vec2> m_positions;
+    /**
+     * \brief Items sorted by cell, the items of cell c being
+     *        [m_cellStarts[c], m_cellStarts[c + 1]).
+     */
+    std::vector<std::uint32_t> m_cellItems;
+    std::vector<std::uint32_t> m_cellStarts;
+    /**
+     * \brief Lower corner of the grid, side of its cells and their number.
+     */
+    glm::vec2 m_origin = glm::vec2(0.0f, 0.0f);
+    float m_cellSize = 1.0f;
+    int m_columns = 0;
+    int m_rows = 0;
+};
+
+#endif // CORE_SPATIAL_GRID_H
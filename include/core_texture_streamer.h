@@ -0,0 +1,140 @@
+// -----------------------------------------------------------------------------
+// Onset Engine
+// https://github.com/dylanafterall/OnsetEngine.git
+//
+// core_texture_streamer.h
+//  header of TextureStreamer class, uploads textures across frames via PBOs
+// -----------------------------------------------------------------------------
+#ifndef CORE_TEXTURE_STREAMER_H
+#define CORE_TEXTURE_STREAMER_H
+
+#include "core_log_macros.h"
+#include "core_profile_macros.h"
+
+#include "glad/glad.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * \brief   The TextureStreamer class.
+ * \details Fills existing 2D textures with image files without blocking the
+ *          GL thread. A background thread decodes each image, then update
+ *          copies at most one decoded image per frame into the next pixel
+ *          buffer object (PBO) of a small ring, and specifies the texture
+ *          from it, so the driver copies the pixels asynchronously. A fence
+ *          placed after each upload tells when its PBO may be reused. The
+ *          texture keeps its OpenGL ID, so whatever it held before (e.g. a
+ *          placeholder) is swapped out in place.
+ */
+class TextureStreamer {
+public:
+    /**
+     * \brief   The default constructor.
+     */
+    TextureStreamer() = default;
+    /**
+     * \brief   The default destructor.
+     */
+    ~TextureStreamer() = default;
+
+    /**
+     * \brief   The function request.
+     * \details This function queues an image to be decoded and uploaded to a
+     *          2D texture, starting the decode thread and PBO ring on first
+     *          use. Must be called on the GL thread.
+     * \param   texture     OpenGL's ID of the texture to fill.
+     * \param   path        Relative path to the image (.png or .jpg).
+     * \param   gamma       To declare if gamma correction desired.
+     * \return  void, none.
+     */
+    void request(unsigned int, const std::string&, bool);
+    /**
+     * \brief   The function update.
+     * \details This function retires uploads whose fence has signaled, and
+     *          starts the upload of the next decoded image if a PBO is free.
+     *          Called once per frame on the GL thread.
+     * \return  void, none.
+     */
+    void update();
+    /**
+     * \brief   The function destroy.
+     * \details This function stops the decode thread, drops any images not
+     *          yet uploaded, and deletes the PBOs and fences.
+     * \return  void, none.
+     */
+    void destroy();
+    /**
+     * \brief   The function getPendingCount.
+     * \return  std::size_t, number of requested textures not yet streamed in.
+     */
+    std::size_t getPendingCount() const;
+
+private:
+    /**
+     * \brief   The StreamImage struct.
+     * \details An image on its way to a texture: requested, then decoded.
+     */
+    struct StreamImage {
+        unsigned int m_texture = 0;
+        std::string m_path;
+        bool m_gamma = false;
+        unsigned char* m_data = nullptr;
+        int m_width = 0;
+        int m_height = 0;
+        int m_channels = 0;
+    };
+    /**
+     * \brief   The PixelBuffer struct.
+     * \details One PBO of the ring, and the upload it is busy with.
+     */
+    struct PixelBuffer {
+        unsigned int m_buffer = 0;
+        /**
+         * \brief Signaled once the texture has been specified from m_buffer.
+         */
+        GLsync m_fence = nullptr;
+        std::string m_path;
+    };
+
+    /**
+     * \brief   Loop executed by the decode thread until destroy is called.
+     */
+    void decodeLoop();
+
+    /**
+     * \brief Number of PBOs, the most uploads in flight at once.
+     */
+    static constexpr std::size_t PIXEL_BUFFER_COUNT = 3;
+
+    std::thread m_decodeThread;
+    /**
+     * \brief Guards m_requested, m_decoded and m_isRunning.
+     */
+    std::mutex m_mutex;
+    /**
+     * \brief Wakes the decode thread when images are requested.
+     */
+    std::condition_variable m_condition;
+    std::deque<StreamImage> m_requested;
+    std::deque<StreamImage> m_decoded;
+    bool m_isRunning = false;
+
+    std::vector<PixelBuffer> m_pixelBuffers;
+    /**
+     * \brief Index of the PBO the next upload goes through.
+     */
+    std::size_t m_nextBuffer = 0;
+    /**
+     * \brief Requested textures not yet streamed in (or failed).
+     */
+    std::atomic<std::size_t> m_pendingCount{0};
+};
+
+#endif // CORE_TEXTURE_STREAMER_H
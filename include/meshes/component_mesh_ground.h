@@ -1,57 +0,0 @@
-// -----------------------------------------------------------------------------
-// Onset Engine
-// https://github.com/dylanafterall/OnsetEngine.git
-//
-// component_mesh_ground.h
-//  component to hold vertex (x,y,z / i,j,k / u,v) data for OpenGL rendering 
-// -----------------------------------------------------------------------------
-
-#ifndef COMPONENT_MESH_GROUND_H
-#define COMPONENT_MESH_GROUND_H
-
-struct MeshGroundComponent { 
-	float m_vertices[288] = { 
-		-50.000000f, 1.000000f, -5.000000f, -0.000000f, 1.000000f, -0.000000f, 0.875000f, 0.500000f, 
-		50.000000f, 1.000000f, 5.000000f, -0.000000f, 1.000000f, -0.000000f, 0.625000f, 0.750000f, 
-		50.000000f, 1.000000f, -5.000000f, -0.000000f, 1.000000f, -0.000000f, 0.625000f, 0.500000f, 
-		50.000000f, 1.000000f, 5.000000f, -0.000000f, -0.000000f, 1.000000f, 0.625000f, 0.750000f, 
-		-50.000000f, -1.000000f, 5.000000f, -0.000000f, -0.000000f, 1.000000f, 0.375000f, 1.000000f, 
-		50.000000f, -1.000000f, 5.000000f, -0.000000f, -0.000000f, 1.000000f, 0.375000f, 0.750000f, 
-		-50.000000f, 1.000000f, 5.000000f, -1.000000f, -0.000000f, -0.000000f, 0.625000f, 0.000000f, 
-		-50.000000f, -1.000000f, -5.000000f, -1.000000f, -0.000000f, -0.000000f, 0.375000f, 0.250000f, 
-		-50.000000f, -1.000000f, 5.000000f, -1.000000f, -0.000000f, -0.000000f, 0.375000f, 0.000000f, 
-		50.000000f, -1.000000f, -5.000000f, -0.000000f, -1.000000f, -0.000000f, 0.375000f, 0.500000f, 
-		-50.000000f, -1.000000f, 5.000000f, -0.000000f, -1.000000f, -0.000000f, 0.125000f, 0.750000f, 
-		-50.000000f, -1.000000f, -5.000000f, -0.000000f, -1.000000f, -0.000000f, 0.125000f, 0.500000f, 
-		50.000000f, 1.000000f, -5.000000f, 1.000000f, -0.000000f, -0.000000f, 0.625000f, 0.500000f, 
-		50.000000f, -1.000000f, 5.000000f, 1.000000f, -0.000000f, -0.000000f, 0.375000f, 0.750000f, 
-		50.000000f, -1.000000f, -5.000000f, 1.000000f, -0.000000f, -0.000000f, 0.375000f, 0.500000f, 
-		-50.000000f, 1.000000f, -5.000000f, -0.000000f, -0.000000f, -1.000000f, 0.625000f, 0.250000f, 
-		50.000000f, -1.000000f, -5.000000f, -0.000000f, -0.000000f, -1.000000f, 0.375000f, 0.500000f, 
-		-50.000000f, -1.000000f, -5.000000f, -0.000000f, -0.000000f, -1.000000f, 0.375000f, 0.250000f, 
-		-50.000000f, 1.000000f, -5.000000f, -0.000000f, 1.000000f, -0.000000f, 0.875000f, 0.500000f, 
-		-50.000000f, 1.000000f, 5.000000f, -0.000000f, 1.000000f, -0.000000f, 0.875000f, 0.750000f, 
-		50.000000f, 1.000000f, 5.000000f, -0.000000f, 1.000000f, -0.000000f, 0.625000f, 0.750000f, 
-		50.000000f, 1.000000f, 5.000000f, -0.000000f, -0.000000f, 1.000000f, 0.625000f, 0.750000f, 
-		-50.000000f, 1.000000f, 5.000000f, -0.000000f, -0.000000f, 1.000000f, 0.625000f, 1.000000f, 
-		-50.000000f, -1.000000f, 5.000000f, -0.000000f, -0.000000f, 1.000000f, 0.375000f, 1.000000f, 
-		-50.000000f, 1.000000f, 5.000000f, -1.000000f, -0.000000f, -0.000000f, 0.625000f, 0.000000f, 
-		-50.000000f, 1.000000f, -5.000000f, -1.000000f, -0.000000f, -0.000000f, 0.625000f, 0.250000f, 
-		-50.000000f, -1.000000f, -5.000000f, -1.000000f, -0.000000f, -0.000000f, 0.375000f, 0.250000f, 
-		50.000000f, -1.000000f, -5.000000f, -0.000000f, -1.000000f, -0.000000f, 0.375000f, 0.500000f, 
-		50.000000f, -1.000000f, 5.000000f, -0.000000f, -1.000000f, -0.000000f, 0.375000f, 0.750000f, 
-		-50.000000f, -1.000000f, 5.000000f, -0.000000f, -1.000000f, -0.000000f, 0.125000f, 0.750000f, 
-		50.000000f, 1.000000f, -5.000000f, 1.000000f, -0.000000f, -0.000000f, 0.625000f, 0.500000f, 
-		50.000000f, 1.000000f, 5.000000f, 1.000000f, -0.000000f, -0.000000f, 0.625000f, 0.750000f, 
-		50.000000f, -1.000000f, 5.000000f, 1.000000f, -0.000000f, -0.000000f, 0.375000f, 0.750000f, 
-		-50.000000f, 1.000000f, -5.000000f, -0.000000f, -0.000000f, -1.000000f, 0.625000f, 0.250000f, 
-		50.000000f, 1.000000f, -5.000000f, -0.000000f, -0.000000f, -1.000000f, 0.625000f, 0.500000f, 
-		50.000000f, -1.000000f, -5.000000f, -0.000000f, -0.000000f, -1.000000f, 0.375000f, 0.500000f
-	};
-
-	int m_verticesSize = 1152;
-
-	int m_vertexCount = 36;
-}; 
-
-#endif // COMPONENT_MESH_GROUND_H
@@ -10,53 +10,35 @@
 #define COMPONENT_MESH_SKYBOX_H
 
 struct MeshSkyboxComponent { 
-	float m_vertices[108] = { 
+	float m_vertices[24] = { 
         -1.0f,  1.0f, -1.0f,
         -1.0f, -1.0f, -1.0f,
-         1.0f, -1.0f, -1.0f,
          1.0f, -1.0f, -1.0f,
          1.0f,  1.0f, -1.0f,
-        -1.0f,  1.0f, -1.0f,
-
         -1.0f, -1.0f,  1.0f,
-        -1.0f, -1.0f, -1.0f,
-        -1.0f,  1.0f, -1.0f,
-        -1.0f,  1.0f, -1.0f,
         -1.0f,  1.0f,  1.0f,
-        -1.0f, -1.0f,  1.0f,
-
-         1.0f, -1.0f, -1.0f,
          1.0f, -1.0f,  1.0f,
-         1.0f,  1.0f,  1.0f,
-         1.0f,  1.0f,  1.0f,
-         1.0f,  1.0f, -1.0f,
-         1.0f, -1.0f, -1.0f,
+         1.0f,  1.0f,  1.0f
+    };
 
-        -1.0f, -1.0f,  1.0f,
-        -1.0f,  1.0f,  1.0f,
-         1.0f,  1.0f,  1.0f,
-         1.0f,  1.0f,  1.0f,
-         1.0f, -1.0f,  1.0f,
-        -1.0f, -1.0f,  1.0f,
+    unsigned int m_indices[36] = { 
+        0, 1, 2,    2, 3, 0,
+        4, 1, 0,    0, 5, 4,
+        2, 6, 7,    7, 3, 2,
+        4, 5, 7,    7, 6, 4,
+        0, 3, 7,    7, 5, 0,
+        1, 4, 2,    2, 4, 6
+    };
 
-        -1.0f,  1.0f, -1.0f,
-         1.0f,  1.0f, -1.0f,
-         1.0f,  1.0f,  1.0f,
-         1.0f,  1.0f,  1.0f,
-        -1.0f,  1.0f,  1.0f,
-        -1.0f,  1.0f, -1.0f,
+    int m_verticesSize = 96;
 
-        -1.0f, -1.0f, -1.0f,
-        -1.0f, -1.0f,  1.0f,
-         1.0f, -1.0f, -1.0f,
-         1.0f, -1.0f, -1.0f,
-        -1.0f, -1.0f,  1.0f,
-         1.0f, -1.0f,  1.0f
-    };
+    int m_indicesSize = 144;
+
+	int m_vertexCount = 8;
 
-    int m_verticesSize = 432;
+    int m_indexCount = 36;
 
-	int m_vertexCount = 36;
+    int m_vertexFormat = 0;
 };
 
 #endif // COMPONENT_MESH_SKYBOX_H
\ No newline at end of file
@@ -1,2901 +0,0 @@
-// -----------------------------------------------------------------------------
-// Onset Engine
-// https://github.com/dylanafterall/OnsetEngine.git
-//
-// component_mesh_sphere.h
-//  component to hold vertex (x,y,z / i,j,k / u,v) data for OpenGL rendering 
-// -----------------------------------------------------------------------------
-
-#ifndef COMPONENT_MESH_SPHERE_H
-#define COMPONENT_MESH_SPHERE_H
-
-struct MeshSphereComponent { 
-	float m_vertices[23040] = { 
-		0.000000f, -0.195090f, -0.980785f, -0.000000f, -0.193900f, -0.981000f, 0.750000f, 0.437500f, 
-		0.180240f, -0.382683f, -0.906127f, 0.180400f, -0.380500f, -0.907000f, 0.718750f, 0.375000f, 
-		0.000000f, -0.382683f, -0.923879f, -0.000000f, -0.380500f, -0.924800f, 0.750000f, 0.375000f, 
-		0.000000f, 0.831470f, -0.555570f, -0.000000f, 0.828600f, -0.559800f, 0.750000f, 0.812500f, 
-		0.074658f, 0.923880f, -0.375330f, 0.075700f, 0.921700f, -0.380400f, 0.718750f, 0.875000f, 
-		0.108386f, 0.831470f, -0.544895f, 0.109200f, 0.828600f, -0.549000f, 0.718750f, 0.812500f, 
-		0.000000f, -0.382683f, -0.923879f, -0.000000f, -0.380500f, -0.924800f, 0.750000f, 0.375000f, 
-		0.162212f, -0.555570f, -0.815493f, 0.162600f, -0.552800f, -0.817300f, 0.718750f, 0.312500f, 
-		0.000000f, -0.555570f, -0.831470f, -0.000000f, -0.552800f, -0.833300f, 0.750000f, 0.312500f, 
-		0.000000f, 0.707107f, -0.707107f, -0.000000f, 0.704100f, -0.710100f, 0.750000f, 0.750000f, 
-		0.108386f, 0.831470f, -0.544895f, 0.109200f, 0.828600f, -0.549000f, 0.718750f, 0.812500f, 
-		0.137950f, 0.707107f, -0.693520f, 0.138500f, 0.704100f, -0.696500f, 0.718750f, 0.750000f, 
-		0.000000f, -0.555570f, -0.831470f, -0.000000f, -0.552800f, -0.833300f, 0.750000f, 0.312500f, 
-		0.137950f, -0.707107f, -0.693520f, 0.138500f, -0.704100f, -0.696500f, 0.718750f, 0.250000f, 
-		0.000000f, -0.707107f, -0.707107f, -0.000000f, -0.704100f, -0.710100f, 0.750000f, 0.250000f, 
-		0.000000f, 0.555570f, -0.831470f, -0.000000f, 0.552800f, -0.833300f, 0.750000f, 0.687500f, 
-		0.137950f, 0.707107f, -0.693520f, 0.138500f, 0.704100f, -0.696500f, 0.718750f, 0.750000f, 
-		0.162212f, 0.555570f, -0.815493f, 0.162600f, 0.552800f, -0.817300f, 0.718750f, 0.687500f, 
-		0.000000f, -0.707107f, -0.707107f, -0.000000f, -0.704100f, -0.710100f, 0.750000f, 0.250000f, 
-		0.108386f, -0.831470f, -0.544895f, 0.109200f, -0.828600f, -0.549000f, 0.718750f, 0.187500f, 
-		0.000000f, -0.831470f, -0.555570f, -0.000000f, -0.828600f, -0.559800f, 0.750000f, 0.187500f, 
-		0.000000f, 0.382683f, -0.923879f, -0.000000f, 0.380500f, -0.924800f, 0.750000f, 0.625000f, 
-		0.162212f, 0.555570f, -0.815493f, 0.162600f, 0.552800f, -0.817300f, 0.718750f, 0.687500f, 
-		0.180240f, 0.382683f, -0.906127f, 0.180400f, 0.380500f, -0.907000f, 0.718750f, 0.625000f, 
-		0.000000f, -0.831470f, -0.555570f, -0.000000f, -0.828600f, -0.559800f, 0.750000f, 0.187500f, 
-		0.074658f, -0.923880f, -0.375330f, 0.075700f, -0.921700f, -0.380400f, 0.718750f, 0.125000f, 
-		0.000000f, -0.923880f, -0.382683f, -0.000000f, -0.921700f, -0.387900f, 0.750000f, 0.125000f, 
-		0.000000f, 0.195090f, -0.980785f, -0.000000f, 0.193900f, -0.981000f, 0.750000f, 0.562500f, 
-		0.180240f, 0.382683f, -0.906127f, 0.180400f, 0.380500f, -0.907000f, 0.718750f, 0.625000f, 
-		0.191342f, 0.195090f, -0.961940f, 0.191400f, 0.193900f, -0.962200f, 0.718750f, 0.562500f, 
-		0.000000f, -0.923880f, -0.382683f, -0.000000f, -0.921700f, -0.387900f, 0.750000f, 0.125000f, 
-		0.038060f, -0.980785f, -0.191342f, 0.039200f, -0.979600f, -0.197100f, 0.718750f, 0.062500f, 
-		0.000000f, -0.980785f, -0.195090f, -0.000000f, -0.979600f, -0.201000f, 0.750000f, 0.062500f, 
-		0.000000f, 0.195090f, -0.980785f, -0.000000f, 0.193900f, -0.981000f, 0.750000f, 0.562500f, 
-		0.195090f, 0.000000f, -0.980785f, 0.195100f, -0.000000f, -0.980800f, 0.718750f, 0.500000f, 
-		0.000000f, 0.000000f, -1.000000f, -0.000000f, -0.000000f, -1.000000f, 0.750000f, 0.500000f, 
-		0.000000f, 0.980785f, -0.195090f, -0.000000f, 0.979600f, -0.201000f, 0.750000f, 0.937500f, 
-		0.000000f, 1.000000f, 0.000000f, -0.000000f, 1.000000f, -0.000000f, 0.734375f, 1.000000f, 
-		0.038060f, 0.980785f, -0.191342f, 0.039200f, 0.979600f, -0.197100f, 0.718750f, 0.937500f, 
-		0.000000f, -1.000000f, 0.000000f, -0.000000f, -1.000000f, -0.000000f, 0.734375f, 0.000000f, 
-		0.000000f, -0.980785f, -0.195090f, -0.000000f, -0.979600f, -0.201000f, 0.750000f, 0.062500f, 
-		0.038060f, -0.980785f, -0.191342f, 0.039200f, -0.979600f, -0.197100f, 0.718750f, 0.062500f, 
-		0.000000f, 0.000000f, -1.000000f, -0.000000f, -0.000000f, -1.000000f, 0.750000f, 0.500000f, 
-		0.191342f, -0.195090f, -0.961940f, 0.191400f, -0.193900f, -0.962200f, 0.718750f, 0.437500f, 
-		0.000000f, -0.195090f, -0.980785f, -0.000000f, -0.193900f, -0.981000f, 0.750000f, 0.437500f, 
-		0.000000f, 0.923880f, -0.382683f, -0.000000f, 0.921700f, -0.387900f, 0.750000f, 0.875000f, 
-		0.038060f, 0.980785f, -0.191342f, 0.039200f, 0.979600f, -0.197100f, 0.718750f, 0.937500f, 
-		0.074658f, 0.923880f, -0.375330f, 0.075700f, 0.921700f, -0.380400f, 0.718750f, 0.875000f, 
-		0.000000f, -1.000000f, 0.000000f, -0.000000f, -1.000000f, -0.000000f, 0.703125f, 0.000000f, 
-		0.038060f, -0.980785f, -0.191342f, 0.039200f, -0.979600f, -0.197100f, 0.718750f, 0.062500f, 
-		0.074658f, -0.980785f, -0.180240f, 0.076900f, -0.979600f, -0.185700f, 0.687500f, 0.062500f, 
-		0.195090f, 0.000000f, -0.980785f, 0.195100f, -0.000000f, -0.980800f, 0.718750f, 0.500000f, 
-		0.375330f, -0.195090f, -0.906127f, 0.375400f, -0.193900f, -0.906300f, 0.687500f, 0.437500f, 
-		0.191342f, -0.195090f, -0.961940f, 0.191400f, -0.193900f, -0.962200f, 0.718750f, 0.437500f, 
-		0.038060f, 0.980785f, -0.191342f, 0.039200f, 0.979600f, -0.197100f, 0.718750f, 0.937500f, 
-		0.146447f, 0.923880f, -0.353553f, 0.148400f, 0.921700f, -0.358400f, 0.687500f, 0.875000f, 
-		0.074658f, 0.923880f, -0.375330f, 0.075700f, 0.921700f, -0.380400f, 0.718750f, 0.875000f, 
-		0.191342f, -0.195090f, -0.961940f, 0.191400f, -0.193900f, -0.962200f, 0.718750f, 0.437500f, 
-		0.353553f, -0.382683f, -0.853553f, 0.353900f, -0.380500f, -0.854400f, 0.687500f, 0.375000f, 
-		0.180240f, -0.382683f, -0.906127f, 0.180400f, -0.380500f, -0.907000f, 0.718750f, 0.375000f, 
-		0.074658f, 0.923880f, -0.375330f, 0.075700f, 0.921700f, -0.380400f, 0.718750f, 0.875000f, 
-		0.212608f, 0.831470f, -0.513280f, 0.214200f, 0.828600f, -0.517200f, 0.687500f, 0.812500f, 
-		0.108386f, 0.831470f, -0.544895f, 0.109200f, 0.828600f, -0.549000f, 0.718750f, 0.812500f, 
-		0.180240f, -0.382683f, -0.906127f, 0.180400f, -0.380500f, -0.907000f, 0.718750f, 0.375000f, 
-		0.318190f, -0.555570f, -0.768178f, 0.318900f, -0.552800f, -0.769900f, 0.687500f, 0.312500f, 
-		0.162212f, -0.555570f, -0.815493f, 0.162600f, -0.552800f, -0.817300f, 0.718750f, 0.312500f, 
-		0.108386f, 0.831470f, -0.544895f, 0.109200f, 0.828600f, -0.549000f, 0.718750f, 0.812500f, 
-		0.270598f, 0.707107f, -0.653281f, 0.271800f, 0.704100f, -0.656100f, 0.687500f, 0.750000f, 
-		0.137950f, 0.707107f, -0.693520f, 0.138500f, 0.704100f, -0.696500f, 0.718750f, 0.750000f, 
-		0.162212f, -0.555570f, -0.815493f, 0.162600f, -0.552800f, -0.817300f, 0.718750f, 0.312500f, 
-		0.270598f, -0.707107f, -0.653281f, 0.271800f, -0.704100f, -0.656100f, 0.687500f, 0.250000f, 
-		0.137950f, -0.707107f, -0.693520f, 0.138500f, -0.704100f, -0.696500f, 0.718750f, 0.250000f, 
-		0.137950f, 0.707107f, -0.693520f, 0.138500f, 0.704100f, -0.696500f, 0.718750f, 0.750000f, 
-		0.318190f, 0.555570f, -0.768178f, 0.318900f, 0.552800f, -0.769900f, 0.687500f, 0.687500f, 
-		0.162212f, 0.555570f, -0.815493f, 0.162600f, 0.552800f, -0.817300f, 0.718750f, 0.687500f, 
-		0.108386f, -0.831470f, -0.544895f, 0.109200f, -0.828600f, -0.549000f, 0.718750f, 0.187500f, 
-		0.270598f, -0.707107f, -0.653281f, 0.271800f, -0.704100f, -0.656100f, 0.687500f, 0.250000f, 
-		0.212608f, -0.831470f, -0.513280f, 0.214200f, -0.828600f, -0.517200f, 0.687500f, 0.187500f, 
-		0.162212f, 0.555570f, -0.815493f, 0.162600f, 0.552800f, -0.817300f, 0.718750f, 0.687500f, 
-		0.353553f, 0.382683f, -0.853553f, 0.353900f, 0.380500f, -0.854400f, 0.687500f, 0.625000f, 
-		0.180240f, 0.382683f, -0.906127f, 0.180400f, 0.380500f, -0.907000f, 0.718750f, 0.625000f, 
-		0.074658f, -0.923880f, -0.375330f, 0.075700f, -0.921700f, -0.380400f, 0.718750f, 0.125000f, 
-		0.212608f, -0.831470f, -0.513280f, 0.214200f, -0.828600f, -0.517200f, 0.687500f, 0.187500f, 
-		0.146447f, -0.923880f, -0.353553f, 0.148400f, -0.921700f, -0.358400f, 0.687500f, 0.125000f, 
-		0.191342f, 0.195090f, -0.961940f, 0.191400f, 0.193900f, -0.962200f, 0.718750f, 0.562500f, 
-		0.353553f, 0.382683f, -0.853553f, 0.353900f, 0.380500f, -0.854400f, 0.687500f, 0.625000f, 
-		0.375330f, 0.195090f, -0.906127f, 0.375400f, 0.193900f, -0.906300f, 0.687500f, 0.562500f, 
-		0.074658f, -0.923880f, -0.375330f, 0.075700f, -0.921700f, -0.380400f, 0.718750f, 0.125000f, 
-		0.074658f, -0.980785f, -0.180240f, 0.076900f, -0.979600f, -0.185700f, 0.687500f, 0.062500f, 
-		0.038060f, -0.980785f, -0.191342f, 0.039200f, -0.979600f, -0.197100f, 0.718750f, 0.062500f, 
-		0.191342f, 0.195090f, -0.961940f, 0.191400f, 0.193900f, -0.962200f, 0.718750f, 0.562500f, 
-		0.382683f, 0.000000f, -0.923879f, 0.382700f, -0.000000f, -0.923900f, 0.687500f, 0.500000f, 
-		0.195090f, 0.000000f, -0.980785f, 0.195100f, -0.000000f, -0.980800f, 0.718750f, 0.500000f, 
-		0.038060f, 0.980785f, -0.191342f, 0.039200f, 0.979600f, -0.197100f, 0.718750f, 0.937500f, 
-		0.000000f, 1.000000f, 0.000000f, -0.000000f, 1.000000f, -0.000000f, 0.703125f, 1.000000f, 
-		0.074658f, 0.980785f, -0.180240f, 0.076900f, 0.979600f, -0.185700f, 0.687500f, 0.937500f, 
-		0.212608f, -0.831470f, -0.513280f, 0.214200f, -0.828600f, -0.517200f, 0.687500f, 0.187500f, 
-		0.392847f, -0.707107f, -0.587938f, 0.394500f, -0.704100f, -0.590500f, 0.656250f, 0.250000f, 
-		0.308658f, -0.831470f, -0.461940f, 0.311000f, -0.828600f, -0.465400f, 0.656250f, 0.187500f, 
-		0.318190f, 0.555570f, -0.768178f, 0.318900f, 0.552800f, -0.769900f, 0.687500f, 0.687500f, 
-		0.513280f, 0.382683f, -0.768178f, 0.513800f, 0.380500f, -0.768900f, 0.656250f, 0.625000f, 
-		0.353553f, 0.382683f, -0.853553f, 0.353900f, 0.380500f, -0.854400f, 0.687500f, 0.625000f, 
-		0.212608f, -0.831470f, -0.513280f, 0.214200f, -0.828600f, -0.517200f, 0.687500f, 0.187500f, 
-		0.212608f, -0.923880f, -0.318190f, 0.215500f, -0.921700f, -0.322500f, 0.656250f, 0.125000f, 
-		0.146447f, -0.923880f, -0.353553f, 0.148400f, -0.921700f, -0.358400f, 0.687500f, 0.125000f, 
-		0.353553f, 0.382683f, -0.853553f, 0.353900f, 0.380500f, -0.854400f, 0.687500f, 0.625000f, 
-		0.544895f, 0.195090f, -0.815493f, 0.545000f, 0.193900f, -0.815700f, 0.656250f, 0.562500f, 
-		0.375330f, 0.195090f, -0.906127f, 0.375400f, 0.193900f, -0.906300f, 0.687500f, 0.562500f, 
-		0.146447f, -0.923880f, -0.353553f, 0.148400f, -0.921700f, -0.358400f, 0.687500f, 0.125000f, 
-		0.108386f, -0.980785f, -0.162212f, 0.111700f, -0.979600f, -0.167100f, 0.656250f, 0.062500f, 
-		0.074658f, -0.980785f, -0.180240f, 0.076900f, -0.979600f, -0.185700f, 0.687500f, 0.062500f, 
-		0.375330f, 0.195090f, -0.906127f, 0.375400f, 0.193900f, -0.906300f, 0.687500f, 0.562500f, 
-		0.555570f, 0.000000f, -0.831469f, 0.555600f, -0.000000f, -0.831500f, 0.656250f, 0.500000f, 
-		0.382683f, 0.000000f, -0.923879f, 0.382700f, -0.000000f, -0.923900f, 0.687500f, 0.500000f, 
-		0.074658f, 0.980785f, -0.180240f, 0.076900f, 0.979600f, -0.185700f, 0.687500f, 0.937500f, 
-		0.000000f, 1.000000f, 0.000000f, -0.000000f, 1.000000f, -0.000000f, 0.671875f, 1.000000f, 
-		0.108386f, 0.980785f, -0.162212f, 0.111700f, 0.979600f, -0.167100f, 0.656250f, 0.937500f, 
-		0.000000f, -1.000000f, 0.000000f, -0.000000f, -1.000000f, -0.000000f, 0.671875f, 0.000000f, 
-		0.074658f, -0.980785f, -0.180240f, 0.076900f, -0.979600f, -0.185700f, 0.687500f, 0.062500f, 
-		0.108386f, -0.980785f, -0.162212f, 0.111700f, -0.979600f, -0.167100f, 0.656250f, 0.062500f, 
-		0.375330f, -0.195090f, -0.906127f, 0.375400f, -0.193900f, -0.906300f, 0.687500f, 0.437500f, 
-		0.555570f, 0.000000f, -0.831469f, 0.555600f, -0.000000f, -0.831500f, 0.656250f, 0.500000f, 
-		0.544895f, -0.195090f, -0.815493f, 0.545000f, -0.193900f, -0.815700f, 0.656250f, 0.437500f, 
-		0.074658f, 0.980785f, -0.180240f, 0.076900f, 0.979600f, -0.185700f, 0.687500f, 0.937500f, 
-		0.212608f, 0.923880f, -0.318190f, 0.215500f, 0.921700f, -0.322500f, 0.656250f, 0.875000f, 
-		0.146447f, 0.923880f, -0.353553f, 0.148400f, 0.921700f, -0.358400f, 0.687500f, 0.875000f, 
-		0.375330f, -0.195090f, -0.906127f, 0.375400f, -0.193900f, -0.906300f, 0.687500f, 0.437500f, 
-		0.513280f, -0.382683f, -0.768178f, 0.513800f, -0.380500f, -0.768900f, 0.656250f, 0.375000f, 
-		0.353553f, -0.382683f, -0.853553f, 0.353900f, -0.380500f, -0.854400f, 0.687500f, 0.375000f, 
-		0.146447f, 0.923880f, -0.353553f, 0.148400f, 0.921700f, -0.358400f, 0.687500f, 0.875000f, 
-		0.308658f, 0.831470f, -0.461940f, 0.311000f, 0.828600f, -0.465400f, 0.656250f, 0.812500f, 
-		0.212608f, 0.831470f, -0.513280f, 0.214200f, 0.828600f, -0.517200f, 0.687500f, 0.812500f, 
-		0.318190f, -0.555570f, -0.768178f, 0.318900f, -0.552800f, -0.769900f, 0.687500f, 0.312500f, 
-		0.513280f, -0.382683f, -0.768178f, 0.513800f, -0.380500f, -0.768900f, 0.656250f, 0.375000f, 
-		0.461940f, -0.555570f, -0.691342f, 0.463000f, -0.552800f, -0.692900f, 0.656250f, 0.312500f, 
-		0.212608f, 0.831470f, -0.513280f, 0.214200f, 0.828600f, -0.517200f, 0.687500f, 0.812500f, 
-		0.392847f, 0.707107f, -0.587938f, 0.394500f, 0.704100f, -0.590500f, 0.656250f, 0.750000f, 
-		0.270598f, 0.707107f, -0.653281f, 0.271800f, 0.704100f, -0.656100f, 0.687500f, 0.750000f, 
-		0.270598f, -0.707107f, -0.653281f, 0.271800f, -0.704100f, -0.656100f, 0.687500f, 0.250000f, 
-		0.461940f, -0.555570f, -0.691342f, 0.463000f, -0.552800f, -0.692900f, 0.656250f, 0.312500f, 
-		0.392847f, -0.707107f, -0.587938f, 0.394500f, -0.704100f, -0.590500f, 0.656250f, 0.250000f, 
-		0.270598f, 0.707107f, -0.653281f, 0.271800f, 0.704100f, -0.656100f, 0.687500f, 0.750000f, 
-		0.461940f, 0.555570f, -0.691342f, 0.463000f, 0.552800f, -0.692900f, 0.656250f, 0.687500f, 
-		0.318190f, 0.555570f, -0.768178f, 0.318900f, 0.552800f, -0.769900f, 0.687500f, 0.687500f, 
-		0.108386f, 0.980785f, -0.162212f, 0.111700f, 0.979600f, -0.167100f, 0.656250f, 0.937500f, 
-		0.270598f, 0.923880f, -0.270598f, 0.274300f, 0.921700f, -0.274300f, 0.625000f, 0.875000f, 
-		0.212608f, 0.923880f, -0.318190f, 0.215500f, 0.921700f, -0.322500f, 0.656250f, 0.875000f, 
-		0.544895f, -0.195090f, -0.815493f, 0.545000f, -0.193900f, -0.815700f, 0.656250f, 0.437500f, 
-		0.653281f, -0.382683f, -0.653281f, 0.653900f, -0.380500f, -0.653900f, 0.625000f, 0.375000f, 
-		0.513280f, -0.382683f, -0.768178f, 0.513800f, -0.380500f, -0.768900f, 0.656250f, 0.375000f, 
-		0.212608f, 0.923880f, -0.318190f, 0.215500f, 0.921700f, -0.322500f, 0.656250f, 0.875000f, 
-		0.392847f, 0.831470f, -0.392847f, 0.395800f, 0.828600f, -0.395800f, 0.625000f, 0.812500f, 
-		0.308658f, 0.831470f, -0.461940f, 0.311000f, 0.828600f, -0.465400f, 0.656250f, 0.812500f, 
-		0.461940f, -0.555570f, -0.691342f, 0.463000f, -0.552800f, -0.692900f, 0.656250f, 0.312500f, 
-		0.653281f, -0.382683f, -0.653281f, 0.653900f, -0.380500f, -0.653900f, 0.625000f, 0.375000f, 
-		0.587938f, -0.555570f, -0.587938f, 0.589300f, -0.552800f, -0.589300f, 0.625000f, 0.312500f, 
-		0.308658f, 0.831470f, -0.461940f, 0.311000f, 0.828600f, -0.465400f, 0.656250f, 0.812500f, 
-		0.500000f, 0.707107f, -0.500000f, 0.502100f, 0.704100f, -0.502100f, 0.625000f, 0.750000f, 
-		0.392847f, 0.707107f, -0.587938f, 0.394500f, 0.704100f, -0.590500f, 0.656250f, 0.750000f, 
-		0.461940f, -0.555570f, -0.691342f, 0.463000f, -0.552800f, -0.692900f, 0.656250f, 0.312500f, 
-		0.500000f, -0.707107f, -0.500000f, 0.502100f, -0.704100f, -0.502100f, 0.625000f, 0.250000f, 
-		0.392847f, -0.707107f, -0.587938f, 0.394500f, -0.704100f, -0.590500f, 0.656250f, 0.250000f, 
-		0.392847f, 0.707107f, -0.587938f, 0.394500f, 0.704100f, -0.590500f, 0.656250f, 0.750000f, 
-		0.587938f, 0.555570f, -0.587938f, 0.589300f, 0.552800f, -0.589300f, 0.625000f, 0.687500f, 
-		0.461940f, 0.555570f, -0.691342f, 0.463000f, 0.552800f, -0.692900f, 0.656250f, 0.687500f, 
-		0.392847f, -0.707107f, -0.587938f, 0.394500f, -0.704100f, -0.590500f, 0.656250f, 0.250000f, 
-		0.392847f, -0.831470f, -0.392847f, 0.395800f, -0.828600f, -0.395800f, 0.625000f, 0.187500f, 
-		0.308658f, -0.831470f, -0.461940f, 0.311000f, -0.828600f, -0.465400f, 0.656250f, 0.187500f, 
-		0.461940f, 0.555570f, -0.691342f, 0.463000f, 0.552800f, -0.692900f, 0.656250f, 0.687500f, 
-		0.653281f, 0.382683f, -0.653281f, 0.653900f, 0.380500f, -0.653900f, 0.625000f, 0.625000f, 
-		0.513280f, 0.382683f, -0.768178f, 0.513800f, 0.380500f, -0.768900f, 0.656250f, 0.625000f, 
-		0.308658f, -0.831470f, -0.461940f, 0.311000f, -0.828600f, -0.465400f, 0.656250f, 0.187500f, 
-		0.270598f, -0.923880f, -0.270598f, 0.274300f, -0.921700f, -0.274300f, 0.625000f, 0.125000f, 
-		0.212608f, -0.923880f, -0.318190f, 0.215500f, -0.921700f, -0.322500f, 0.656250f, 0.125000f, 
-		0.544895f, 0.195090f, -0.815493f, 0.545000f, 0.193900f, -0.815700f, 0.656250f, 0.562500f, 
-		0.653281f, 0.382683f, -0.653281f, 0.653900f, 0.380500f, -0.653900f, 0.625000f, 0.625000f, 
-		0.693520f, 0.195090f, -0.693520f, 0.693700f, 0.193900f, -0.693700f, 0.625000f, 0.562500f, 
-		0.212608f, -0.923880f, -0.318190f, 0.215500f, -0.921700f, -0.322500f, 0.656250f, 0.125000f, 
-		0.137950f, -0.980785f, -0.137950f, 0.142100f, -0.979600f, -0.142100f, 0.625000f, 0.062500f, 
-		0.108386f, -0.980785f, -0.162212f, 0.111700f, -0.979600f, -0.167100f, 0.656250f, 0.062500f, 
-		0.555570f, 0.000000f, -0.831469f, 0.555600f, -0.000000f, -0.831500f, 0.656250f, 0.500000f, 
-		0.693520f, 0.195090f, -0.693520f, 0.693700f, 0.193900f, -0.693700f, 0.625000f, 0.562500f, 
-		0.707107f, 0.000000f, -0.707107f, 0.707100f, -0.000000f, -0.707100f, 0.625000f, 0.500000f, 
-		0.108386f, 0.980785f, -0.162212f, 0.111700f, 0.979600f, -0.167100f, 0.656250f, 0.937500f, 
-		0.000000f, 1.000000f, 0.000000f, -0.000000f, 1.000000f, -0.000000f, 0.640625f, 1.000000f, 
-		0.137950f, 0.980785f, -0.137950f, 0.142100f, 0.979600f, -0.142100f, 0.625000f, 0.937500f, 
-		0.000000f, -1.000000f, 0.000000f, -0.000000f, -1.000000f, -0.000000f, 0.640625f, 0.000000f, 
-		0.108386f, -0.980785f, -0.162212f, 0.111700f, -0.979600f, -0.167100f, 0.656250f, 0.062500f, 
-		0.137950f, -0.980785f, -0.137950f, 0.142100f, -0.979600f, -0.142100f, 0.625000f, 0.062500f, 
-		0.555570f, 0.000000f, -0.831469f, 0.555600f, -0.000000f, -0.831500f, 0.656250f, 0.500000f, 
-		0.693520f, -0.195090f, -0.693520f, 0.693700f, -0.193900f, -0.693700f, 0.625000f, 0.437500f, 
-		0.544895f, -0.195090f, -0.815493f, 0.545000f, -0.193900f, -0.815700f, 0.656250f, 0.437500f, 
-		0.587938f, 0.555570f, -0.587938f, 0.589300f, 0.552800f, -0.589300f, 0.625000f, 0.687500f, 
-		0.768178f, 0.382683f, -0.513280f, 0.768900f, 0.380500f, -0.513800f, 0.593750f, 0.625000f, 
-		0.653281f, 0.382683f, -0.653281f, 0.653900f, 0.380500f, -0.653900f, 0.625000f, 0.625000f, 
-		0.270598f, -0.923880f, -0.270598f, 0.274300f, -0.921700f, -0.274300f, 0.625000f, 0.125000f, 
-		0.461940f, -0.831470f, -0.308658f, 0.465400f, -0.828600f, -0.311000f, 0.593750f, 0.187500f, 
-		0.318190f, -0.923880f, -0.212608f, 0.322500f, -0.921700f, -0.215500f, 0.593750f, 0.125000f, 
-		0.693520f, 0.195090f, -0.693520f, 0.693700f, 0.193900f, -0.693700f, 0.625000f, 0.562500f, 
-		0.768178f, 0.382683f, -0.513280f, 0.768900f, 0.380500f, -0.513800f, 0.593750f, 0.625000f, 
-		0.815493f, 0.195090f, -0.544895f, 0.815700f, 0.193900f, -0.545000f, 0.593750f, 0.562500f, 
-		0.270598f, -0.923880f, -0.270598f, 0.274300f, -0.921700f, -0.274300f, 0.625000f, 0.125000f, 
-		0.162212f, -0.980785f, -0.108386f, 0.167100f, -0.979600f, -0.111700f, 0.593750f, 0.062500f, 
-		0.137950f, -0.980785f, -0.137950f, 0.142100f, -0.979600f, -0.142100f, 0.625000f, 0.062500f, 
-		0.707107f, 0.000000f, -0.707107f, 0.707100f, -0.000000f, -0.707100f, 0.625000f, 0.500000f, 
-		0.815493f, 0.195090f, -0.544895f, 0.815700f, 0.193900f, -0.545000f, 0.593750f, 0.562500f, 
-		0.831470f, 0.000000f, -0.555570f, 0.831500f, -0.000000f, -0.555600f, 0.593750f, 0.500000f, 
-		0.137950f, 0.980785f, -0.137950f, 0.142100f, 0.979600f, -0.142100f, 0.625000f, 0.937500f, 
-		0.000000f, 1.000000f, 0.000000f, -0.000000f, 1.000000f, -0.000000f, 0.609375f, 1.000000f, 
-		0.162212f, 0.980785f, -0.108386f, 0.167100f, 0.979600f, -0.111700f, 0.593750f, 0.937500f, 
-		0.000000f, -1.000000f, 0.000000f, -0.000000f, -1.000000f, -0.000000f, 0.609375f, 0.000000f, 
-		0.137950f, -0.980785f, -0.137950f, 0.142100f, -0.979600f, -0.142100f, 0.625000f, 0.062500f, 
-		0.162212f, -0.980785f, -0.108386f, 0.167100f, -0.979600f, -0.111700f, 0.593750f, 0.062500f, 
-		0.707107f, 0.000000f, -0.707107f, 0.707100f, -0.000000f, -0.707100f, 0.625000f, 0.500000f, 
-		0.815493f, -0.195090f, -0.544895f, 0.815700f, -0.193900f, -0.545000f, 0.593750f, 0.437500f, 
-		0.693520f, -0.195090f, -0.693520f, 0.693700f, -0.193900f, -0.693700f, 0.625000f, 0.437500f, 
-		0.137950f, 0.980785f, -0.137950f, 0.142100f, 0.979600f, -0.142100f, 0.625000f, 0.937500f, 
-		0.318190f, 0.923880f, -0.212608f, 0.322500f, 0.921700f, -0.215500f, 0.593750f, 0.875000f, 
-		0.270598f, 0.923880f, -0.270598f, 0.274300f, 0.921700f, -0.274300f, 0.625000f, 0.875000f, 
-		0.693520f, -0.195090f, -0.693520f, 0.693700f, -0.193900f, -0.693700f, 0.625000f, 0.437500f, 
-		0.768178f, -0.382683f, -0.513280f, 0.768900f, -0.380500f, -0.513800f, 0.593750f, 0.375000f, 
-		0.653281f, -0.382683f, -0.653281f, 0.653900f, -0.380500f, -0.653900f, 0.625000f, 0.375000f, 
-		0.270598f, 0.923880f, -0.270598f, 0.274300f, 0.921700f, -0.274300f, 0.625000f, 0.875000f, 
-		0.461940f, 0.831470f, -0.308658f, 0.465400f, 0.828600f, -0.311000f, 0.593750f, 0.812500f, 
-		0.392847f, 0.831470f, -0.392847f, 0.395800f, 0.828600f, -0.395800f, 0.625000f, 0.812500f, 
-		0.587938f, -0.555570f, -0.587938f, 0.589300f, -0.552800f, -0.589300f, 0.625000f, 0.312500f, 
-		0.768178f, -0.382683f, -0.513280f, 0.768900f, -0.380500f, -0.513800f, 0.593750f, 0.375000f, 
-		0.691342f, -0.555570f, -0.461940f, 0.692900f, -0.552800f, -0.463000f, 0.593750f, 0.312500f, 
-		0.392847f, 0.831470f, -0.392847f, 0.395800f, 0.828600f, -0.395800f, 0.625000f, 0.812500f, 
-		0.587938f, 0.707107f, -0.392847f, 0.590500f, 0.704100f, -0.394500f, 0.593750f, 0.750000f, 
-		0.500000f, 0.707107f, -0.500000f, 0.502100f, 0.704100f, -0.502100f, 0.625000f, 0.750000f, 
-		0.587938f, -0.555570f, -0.587938f, 0.589300f, -0.552800f, -0.589300f, 0.625000f, 0.312500f, 
-		0.587938f, -0.707107f, -0.392847f, 0.590500f, -0.704100f, -0.394500f, 0.593750f, 0.250000f, 
-		0.500000f, -0.707107f, -0.500000f, 0.502100f, -0.704100f, -0.502100f, 0.625000f, 0.250000f, 
-		0.587938f, 0.555570f, -0.587938f, 0.589300f, 0.552800f, -0.589300f, 0.625000f, 0.687500f, 
-		0.587938f, 0.707107f, -0.392847f, 0.590500f, 0.704100f, -0.394500f, 0.593750f, 0.750000f, 
-		0.691342f, 0.555570f, -0.461940f, 0.692900f, 0.552800f, -0.463000f, 0.593750f, 0.687500f, 
-		0.500000f, -0.707107f, -0.500000f, 0.502100f, -0.704100f, -0.502100f, 0.625000f, 0.250000f, 
-		0.461940f, -0.831470f, -0.308658f, 0.465400f, -0.828600f, -0.311000f, 0.593750f, 0.187500f, 
-		0.392847f, -0.831470f, -0.392847f, 0.395800f, -0.828600f, -0.395800f, 0.625000f, 0.187500f, 
-		0.815493f, -0.195090f, -0.544895f, 0.815700f, -0.193900f, -0.545000f, 0.593750f, 0.437500f, 
-		0.853553f, -0.382683f, -0.353553f, 0.854400f, -0.380500f, -0.353900f, 0.562500f, 0.375000f, 
-		0.768178f, -0.382683f, -0.513280f, 0.768900f, -0.380500f, -0.513800f, 0.593750f, 0.375000f, 
-		0.318190f, 0.923880f, -0.212608f, 0.322500f, 0.921700f, -0.215500f, 0.593750f, 0.875000f, 
-		0.513280f, 0.831470f, -0.212607f, 0.517200f, 0.828600f, -0.214200f, 0.562500f, 0.812500f, 
-		0.461940f, 0.831470f, -0.308658f, 0.465400f, 0.828600f, -0.311000f, 0.593750f, 0.812500f, 
-		0.691342f, -0.555570f, -0.461940f, 0.692900f, -0.552800f, -0.463000f, 0.593750f, 0.312500f, 
-		0.853553f, -0.382683f, -0.353553f, 0.854400f, -0.380500f, -0.353900f, 0.562500f, 0.375000f, 
-		0.768178f, -0.555570f, -0.318190f, 0.769900f, -0.552800f, -0.318900f, 0.562500f, 0.312500f, 
-		0.461940f, 0.831470f, -0.308658f, 0.465400f, 0.828600f, -0.311000f, 0.593750f, 0.812500f, 
-		0.653281f, 0.707107f, -0.270598f, 0.656100f, 0.704100f, -0.271800f, 0.562500f, 0.750000f, 
-		0.587938f, 0.707107f, -0.392847f, 0.590500f, 0.704100f, -0.394500f, 0.593750f, 0.750000f, 
-		0.691342f, -0.555570f, -0.461940f, 0.692900f, -0.552800f, -0.463000f, 0.593750f, 0.312500f, 
-		0.653281f, -0.707107f, -0.270598f, 0.656100f, -0.704100f, -0.271800f, 0.562500f, 0.250000f, 
-		0.587938f, -0.707107f, -0.392847f, 0.590500f, -0.704100f, -0.394500f, 0.593750f, 0.250000f, 
-		0.691342f, 0.555570f, -0.461940f, 0.692900f, 0.552800f, -0.463000f, 0.593750f, 0.687500f, 
-		0.653281f, 0.707107f, -0.270598f, 0.656100f, 0.704100f, -0.271800f, 0.562500f, 0.750000f, 
-		0.768178f, 0.555570f, -0.318190f, 0.769900f, 0.552800f, -0.318900f, 0.562500f, 0.687500f, 
-		0.587938f, -0.707107f, -0.392847f, 0.590500f, -0.704100f, -0.394500f, 0.593750f, 0.250000f, 
-		0.513280f, -0.831470f, -0.212607f, 0.517200f, -0.828600f, -0.214200f, 0.562500f, 0.187500f, 
-		0.461940f, -0.831470f, -0.308658f, 0.465400f, -0.828600f, -0.311000f, 0.593750f, 0.187500f, 
-		0.691342f, 0.555570f, -0.461940f, 0.692900f, 0.552800f, -0.463000f, 0.593750f, 0.687500f, 
-		0.853553f, 0.382683f, -0.353553f, 0.854400f, 0.380500f, -0.353900f, 0.562500f, 0.625000f, 
-		0.768178f, 0.382683f, -0.513280f, 0.768900f, 0.380500f, -0.513800f, 0.593750f, 0.625000f, 
-		0.461940f, -0.831470f, -0.308658f, 0.465400f, -0.828600f, -0.311000f, 0.593750f, 0.187500f, 
-		0.353553f, -0.923880f, -0.146447f, 0.358400f, -0.921700f, -0.148400f, 0.562500f, 0.125000f, 
-		0.318190f, -0.923880f, -0.212608f, 0.322500f, -0.921700f, -0.215500f, 0.593750f, 0.125000f, 
-		0.815493f, 0.195090f, -0.544895f, 0.815700f, 0.193900f, -0.545000f, 0.593750f, 0.562500f, 
-		0.853553f, 0.382683f, -0.353553f, 0.854400f, 0.380500f, -0.353900f, 0.562500f, 0.625000f, 
-		0.906127f, 0.195090f, -0.375330f, 0.906300f, 0.193900f, -0.375400f, 0.562500f, 0.562500f, 
-		0.162212f, -0.980785f, -0.108386f, 0.167100f, -0.979600f, -0.111700f, 0.593750f, 0.062500f, 
-		0.353553f, -0.923880f, -0.146447f, 0.358400f, -0.921700f, -0.148400f, 0.562500f, 0.125000f, 
-		0.180240f, -0.980785f, -0.074658f, 0.185700f, -0.979600f, -0.076900f, 0.562500f, 0.062500f, 
-		0.831470f, 0.000000f, -0.555570f, 0.831500f, -0.000000f, -0.555600f, 0.593750f, 0.500000f, 
-		0.906127f, 0.195090f, -0.375330f, 0.906300f, 0.193900f, -0.375400f, 0.562500f, 0.562500f, 
-		0.923879f, 0.000000f, -0.382683f, 0.923900f, -0.000000f, -0.382700f, 0.562500f, 0.500000f, 
-		0.162212f, 0.980785f, -0.108386f, 0.167100f, 0.979600f, -0.111700f, 0.593750f, 0.937500f, 
-		0.000000f, 1.000000f, 0.000000f, -0.000000f, 1.000000f, -0.000000f, 0.578125f, 1.000000f, 
-		0.180240f, 0.980785f, -0.074658f, 0.185700f, 0.979600f, -0.076900f, 0.562500f, 0.937500f, 
-		0.000000f, -1.000000f, 0.000000f, -0.000000f, -1.000000f, -0.000000f, 0.578125f, 0.000000f, 
-		0.162212f, -0.980785f, -0.108386f, 0.167100f, -0.979600f, -0.111700f, 0.593750f, 0.062500f, 
-		0.180240f, -0.980785f, -0.074658f, 0.185700f, -0.979600f, -0.076900f, 0.562500f, 0.062500f, 
-		0.831470f, 0.000000f, -0.555570f, 0.831500f, -0.000000f, -0.555600f, 0.593750f, 0.500000f, 
-		0.906127f, -0.195090f, -0.375330f, 0.906300f, -0.193900f, -0.375400f, 0.562500f, 0.437500f, 
-		0.815493f, -0.195090f, -0.544895f, 0.815700f, -0.193900f, -0.545000f, 0.593750f, 0.437500f, 
-		0.162212f, 0.980785f, -0.108386f, 0.167100f, 0.979600f, -0.111700f, 0.593750f, 0.937500f, 
-		0.353553f, 0.923880f, -0.146447f, 0.358400f, 0.921700f, -0.148400f, 0.562500f, 0.875000f, 
-		0.318190f, 0.923880f, -0.212608f, 0.322500f, 0.921700f, -0.215500f, 0.593750f, 0.875000f, 
-		0.353553f, -0.923880f, -0.146447f, 0.358400f, -0.921700f, -0.148400f, 0.562500f, 0.125000f, 
-		0.544895f, -0.831470f, -0.108386f, 0.549000f, -0.828600f, -0.109200f, 0.531250f, 0.187500f, 
-		0.375330f, -0.923880f, -0.074658f, 0.380400f, -0.921700f, -0.075700f, 0.531250f, 0.125000f, 
-		0.906127f, 0.195090f, -0.375330f, 0.906300f, 0.193900f, -0.375400f, 0.562500f, 0.562500f, 
-		0.906127f, 0.382683f, -0.180240f, 0.907000f, 0.380500f, -0.180400f, 0.531250f, 0.625000f, 
-		0.961940f, 0.195090f, -0.191342f, 0.962200f, 0.193900f, -0.191400f, 0.531250f, 0.562500f, 
-		0.353553f, -0.923880f, -0.146447f, 0.358400f, -0.921700f, -0.148400f, 0.562500f, 0.125000f, 
-		0.191342f, -0.980785f, -0.038060f, 0.197100f, -0.979600f, -0.039200f, 0.531250f, 0.062500f, 
-		0.180240f, -0.980785f, -0.074658f, 0.185700f, -0.979600f, -0.076900f, 0.562500f, 0.062500f, 
-		0.923879f, 0.000000f, -0.382683f, 0.923900f, -0.000000f, -0.382700f, 0.562500f, 0.500000f, 
-		0.961940f, 0.195090f, -0.191342f, 0.962200f, 0.193900f, -0.191400f, 0.531250f, 0.562500f, 
-		0.980785f, 0.000000f, -0.195090f, 0.980800f, -0.000000f, -0.195100f, 0.531250f, 0.500000f, 
-		0.180240f, 0.980785f, -0.074658f, 0.185700f, 0.979600f, -0.076900f, 0.562500f, 0.937500f, 
-		0.000000f, 1.000000f, 0.000000f, -0.000000f, 1.000000f, -0.000000f, 0.546875f, 1.000000f, 
-		0.191342f, 0.980785f, -0.038060f, 0.197100f, 0.979600f, -0.039200f, 0.531250f, 0.937500f, 
-		0.000000f, -1.000000f, 0.000000f, -0.000000f, -1.000000f, -0.000000f, 0.546875f, 0.000000f, 
-		0.180240f, -0.980785f, -0.074658f, 0.185700f, -0.979600f, -0.076900f, 0.562500f, 0.062500f, 
-		0.191342f, -0.980785f, -0.038060f, 0.197100f, -0.979600f, -0.039200f, 0.531250f, 0.062500f, 
-		0.923879f, 0.000000f, -0.382683f, 0.923900f, -0.000000f, -0.382700f, 0.562500f, 0.500000f, 
-		0.961940f, -0.195090f, -0.191342f, 0.962200f, -0.193900f, -0.191400f, 0.531250f, 0.437500f, 
-		0.906127f, -0.195090f, -0.375330f, 0.906300f, -0.193900f, -0.375400f, 0.562500f, 0.437500f, 
-		0.353553f, 0.923880f, -0.146447f, 0.358400f, 0.921700f, -0.148400f, 0.562500f, 0.875000f, 
-		0.191342f, 0.980785f, -0.038060f, 0.197100f, 0.979600f, -0.039200f, 0.531250f, 0.937500f, 
-		0.375330f, 0.923880f, -0.074658f, 0.380400f, 0.921700f, -0.075700f, 0.531250f, 0.875000f, 
-		0.906127f, -0.195090f, -0.375330f, 0.906300f, -0.193900f, -0.375400f, 0.562500f, 0.437500f, 
-		0.906127f, -0.382683f, -0.180240f, 0.907000f, -0.380500f, -0.180400f, 0.531250f, 0.375000f, 
-		0.853553f, -0.382683f, -0.353553f, 0.854400f, -0.380500f, -0.353900f, 0.562500f, 0.375000f, 
-		0.353553f, 0.923880f, -0.146447f, 0.358400f, 0.921700f, -0.148400f, 0.562500f, 0.875000f, 
-		0.544895f, 0.831470f, -0.108386f, 0.549000f, 0.828600f, -0.109200f, 0.531250f, 0.812500f, 
-		0.513280f, 0.831470f, -0.212607f, 0.517200f, 0.828600f, -0.214200f, 0.562500f, 0.812500f, 
-		0.768178f, -0.555570f, -0.318190f, 0.769900f, -0.552800f, -0.318900f, 0.562500f, 0.312500f, 
-		0.906127f, -0.382683f, -0.180240f, 0.907000f, -0.380500f, -0.180400f, 0.531250f, 0.375000f, 
-		0.815493f, -0.555570f, -0.162212f, 0.817300f, -0.552800f, -0.162600f, 0.531250f, 0.312500f, 
-		0.513280f, 0.831470f, -0.212607f, 0.517200f, 0.828600f, -0.214200f, 0.562500f, 0.812500f, 
-		0.693520f, 0.707107f, -0.137950f, 0.696500f, 0.704100f, -0.138500f, 0.531250f, 0.750000f, 
-		0.653281f, 0.707107f, -0.270598f, 0.656100f, 0.704100f, -0.271800f, 0.562500f, 0.750000f, 
-		0.768178f, -0.555570f, -0.318190f, 0.769900f, -0.552800f, -0.318900f, 0.562500f, 0.312500f, 
-		0.693520f, -0.707107f, -0.137950f, 0.696500f, -0.704100f, -0.138500f, 0.531250f, 0.250000f, 
-		0.653281f, -0.707107f, -0.270598f, 0.656100f, -0.704100f, -0.271800f, 0.562500f, 0.250000f, 
-		0.768178f, 0.555570f, -0.318190f, 0.769900f, 0.552800f, -0.318900f, 0.562500f, 0.687500f, 
-		0.693520f, 0.707107f, -0.137950f, 0.696500f, 0.704100f, -0.138500f, 0.531250f, 0.750000f, 
-		0.815493f, 0.555570f, -0.162212f, 0.817300f, 0.552800f, -0.162600f, 0.531250f, 0.687500f, 
-		0.513280f, -0.831470f, -0.212607f, 0.517200f, -0.828600f, -0.214200f, 0.562500f, 0.187500f, 
-		0.693520f, -0.707107f, -0.137950f, 0.696500f, -0.704100f, -0.138500f, 0.531250f, 0.250000f, 
-		0.544895f, -0.831470f, -0.108386f, 0.549000f, -0.828600f, -0.109200f, 0.531250f, 0.187500f, 
-		0.768178f, 0.555570f, -0.318190f, 0.769900f, 0.552800f, -0.318900f, 0.562500f, 0.687500f, 
-		0.906127f, 0.382683f, -0.180240f, 0.907000f, 0.380500f, -0.180400f, 0.531250f, 0.625000f, 
-		0.853553f, 0.382683f, -0.353553f, 0.854400f, 0.380500f, -0.353900f, 0.562500f, 0.625000f, 
-		0.375330f, 0.923880f, -0.074658f, 0.380400f, 0.921700f, -0.075700f, 0.531250f, 0.875000f, 
-		0.555570f, 0.831470f, 0.000000f, 0.559800f, 0.828600f, -0.000000f, 0.500000f, 0.812500f, 
-		0.544895f, 0.831470f, -0.108386f, 0.549000f, 0.828600f, -0.109200f, 0.531250f, 0.812500f, 
-		0.815493f, -0.555570f, -0.162212f, 0.817300f, -0.552800f, -0.162600f, 0.531250f, 0.312500f, 
-		0.923879f, -0.382683f, -0.000000f, 0.924800f, -0.380500f, -0.000000f, 0.500000f, 0.375000f, 
-		0.831469f, -0.555570f, 0.000000f, 0.833300f, -0.552800f, -0.000000f, 0.500000f, 0.312500f, 
-		0.544895f, 0.831470f, -0.108386f, 0.549000f, 0.828600f, -0.109200f, 0.531250f, 0.812500f, 
-		0.707107f, 0.707107f, -0.000000f, 0.710100f, 0.704100f, -0.000000f, 0.500000f, 0.750000f, 
-		0.693520f, 0.707107f, -0.137950f, 0.696500f, 0.704100f, -0.138500f, 0.531250f, 0.750000f, 
-		0.815493f, -0.555570f, -0.162212f, 0.817300f, -0.552800f, -0.162600f, 0.531250f, 0.312500f, 
-		0.707107f, -0.707107f, -0.000000f, 0.710100f, -0.704100f, -0.000000f, 0.500000f, 0.250000f, 
-		0.693520f, -0.707107f, -0.137950f, 0.696500f, -0.704100f, -0.138500f, 0.531250f, 0.250000f, 
-		0.815493f, 0.555570f, -0.162212f, 0.817300f, 0.552800f, -0.162600f, 0.531250f, 0.687500f, 
-		0.707107f, 0.707107f, -0.000000f, 0.710100f, 0.704100f, -0.000000f, 0.500000f, 0.750000f, 
-		0.831469f, 0.555570f, 0.000000f, 0.833300f, 0.552800f, -0.000000f, 0.500000f, 0.687500f, 
-		0.544895f, -0.831470f, -0.108386f, 0.549000f, -0.828600f, -0.109200f, 0.531250f, 0.187500f, 
-		0.707107f, -0.707107f, -0.000000f, 0.710100f, -0.704100f, -0.000000f, 0.500000f, 0.250000f, 
-		0.555570f, -0.831470f, 0.000000f, 0.559800f, -0.828600f, -0.000000f, 0.500000f, 0.187500f, 
-		0.815493f, 0.555570f, -0.162212f, 0.817300f, 0.552800f, -0.162600f, 0.531250f, 0.687500f, 
-		0.923879f, 0.382683f, -0.000000f, 0.924800f, 0.380500f, -0.000000f, 0.500000f, 0.625000f, 
-		0.906127f, 0.382683f, -0.180240f, 0.907000f, 0.380500f, -0.180400f, 0.531250f, 0.625000f, 
-		0.544895f, -0.831470f, -0.108386f, 0.549000f, -0.828600f, -0.109200f, 0.531250f, 0.187500f, 
-		0.382683f, -0.923880f, 0.000000f, 0.387900f, -0.921700f, -0.000000f, 0.500000f, 0.125000f, 
-		0.375330f, -0.923880f, -0.074658f, 0.380400f, -0.921700f, -0.075700f, 0.531250f, 0.125000f, 
-		0.961940f, 0.195090f, -0.191342f, 0.962200f, 0.193900f, -0.191400f, 0.531250f, 0.562500f, 
-		0.923879f, 0.382683f, -0.000000f, 0.924800f, 0.380500f, -0.000000f, 0.500000f, 0.625000f, 
-		0.980785f, 0.195090f, 0.000000f, 0.981000f, 0.193900f, -0.000000f, 0.500000f, 0.562500f, 
-		0.375330f, -0.923880f, -0.074658f, 0.380400f, -0.921700f, -0.075700f, 0.531250f, 0.125000f, 
-		0.195090f, -0.980785f, 0.000000f, 0.201000f, -0.979600f, -0.000000f, 0.500000f, 0.062500f, 
-		0.191342f, -0.980785f, -0.038060f, 0.197100f, -0.979600f, -0.039200f, 0.531250f, 0.062500f, 
-		0.980785f, 0.000000f, -0.195090f, 0.980800f, -0.000000f, -0.195100f, 0.531250f, 0.500000f, 
-		0.980785f, 0.195090f, 0.000000f, 0.981000f, 0.193900f, -0.000000f, 0.500000f, 0.562500f, 
-		1.000000f, 0.000000f, 0.000000f, 1.000000f, -0.000000f, -0.000000f, 0.500000f, 0.500000f, 
-		0.191342f, 0.980785f, -0.038060f, 0.197100f, 0.979600f, -0.039200f, 0.531250f, 0.937500f, 
-		0.000000f, 1.000000f, 0.000000f, -0.000000f, 1.000000f, -0.000000f, 0.515625f, 1.000000f, 
-		0.195090f, 0.980785f, 0.000000f, 0.201000f, 0.979600f, -0.000000f, 0.500000f, 0.937500f, 
-		0.000000f, -1.000000f, 0.000000f, -0.000000f, -1.000000f, -0.000000f, 0.515625f, 0.000000f, 
-		0.191342f, -0.980785f, -0.038060f, 0.197100f, -0.979600f, -0.039200f, 0.531250f, 0.062500f, 
-		0.195090f, -0.980785f, 0.000000f, 0.201000f, -0.979600f, -0.000000f, 0.500000f, 0.062500f, 
-		0.980785f, 0.000000f, -0.195090f, 0.980800f, -0.000000f, -0.195100f, 0.531250f, 0.500000f, 
-		0.980785f, -0.195090f, 0.000000f, 0.981000f, -0.193900f, -0.000000f, 0.500000f, 0.437500f, 
-		0.961940f, -0.195090f, -0.191342f, 0.962200f, -0.193900f, -0.191400f, 0.531250f, 0.437500f, 
-		0.375330f, 0.923880f, -0.074658f, 0.380400f, 0.921700f, -0.075700f, 0.531250f, 0.875000f, 
-		0.195090f, 0.980785f, 0.000000f, 0.201000f, 0.979600f, -0.000000f, 0.500000f, 0.937500f, 
-		0.382683f, 0.923880f, 0.000000f, 0.387900f, 0.921700f, -0.000000f, 0.500000f, 0.875000f, 
-		0.961940f, -0.195090f, -0.191342f, 0.962200f, -0.193900f, -0.191400f, 0.531250f, 0.437500f, 
-		0.923879f, -0.382683f, -0.000000f, 0.924800f, -0.380500f, -0.000000f, 0.500000f, 0.375000f, 
-		0.906127f, -0.382683f, -0.180240f, 0.907000f, -0.380500f, -0.180400f, 0.531250f, 0.375000f, 
-		0.980785f, 0.195090f, 0.000000f, 0.981000f, 0.193900f, -0.000000f, 0.500000f, 0.562500f, 
-		0.906127f, 0.382683f, 0.180240f, 0.907000f, 0.380500f, 0.180400f, 0.468750f, 0.625000f, 
-		0.961940f, 0.195090f, 0.191342f, 0.962200f, 0.193900f, 0.191400f, 0.468750f, 0.562500f, 
-		0.382683f, -0.923880f, 0.000000f, 0.387900f, -0.921700f, -0.000000f, 0.500000f, 0.125000f, 
-		0.191342f, -0.980785f, 0.038060f, 0.197100f, -0.979600f, 0.039200f, 0.468750f, 0.062500f, 
-		0.195090f, -0.980785f, 0.000000f, 0.201000f, -0.979600f, -0.000000f, 0.500000f, 0.062500f, 
-		1.000000f, 0.000000f, 0.000000f, 1.000000f, -0.000000f, -0.000000f, 0.500000f, 0.500000f, 
-		0.961940f, 0.195090f, 0.191342f, 0.962200f, 0.193900f, 0.191400f, 0.468750f, 0.562500f, 
-		0.980785f, 0.000000f, 0.195090f, 0.980800f, -0.000000f, 0.195100f, 0.468750f, 0.500000f, 
-		0.195090f, 0.980785f, 0.000000f, 0.201000f, 0.979600f, -0.000000f, 0.500000f, 0.937500f, 
-		0.000000f, 1.000000f, 0.000000f, -0.000000f, 1.000000f, -0.000000f, 0.484375f, 1.000000f, 
-		0.191342f, 0.980785f, 0.038060f, 0.197100f, 0.979600f, 0.039200f, 0.468750f, 0.937500f, 
-		0.000000f, -1.000000f, 0.000000f, -0.000000f, -1.000000f, -0.000000f, 0.484375f, 0.000000f, 
-		0.195090f, -0.980785f, 0.000000f, 0.201000f, -0.979600f, -0.000000f, 0.500000f, 0.062500f, 
-		0.191342f, -0.980785f, 0.038060f, 0.197100f, -0.979600f, 0.039200f, 0.468750f, 0.062500f, 
-		1.000000f, 0.000000f, 0.000000f, 1.000000f, -0.000000f, -0.000000f, 0.500000f, 0.500000f, 
-		0.961940f, -0.195090f, 0.191342f, 0.962200f, -0.193900f, 0.191400f, 0.468750f, 0.437500f, 
-		0.980785f, -0.195090f, 0.000000f, 0.981000f, -0.193900f, -0.000000f, 0.500000f, 0.437500f, 
-		0.195090f, 0.980785f, 0.000000f, 0.201000f, 0.979600f, -0.000000f, 0.500000f, 0.937500f, 
-		0.375330f, 0.923880f, 0.074658f, 0.380400f, 0.921700f, 0.075700f, 0.468750f, 0.875000f, 
-		0.382683f, 0.923880f, 0.000000f, 0.387900f, 0.921700f, -0.000000f, 0.500000f, 0.875000f, 
-		0.980785f, -0.195090f, 0.000000f, 0.981000f, -0.193900f, -0.000000f, 0.500000f, 0.437500f, 
-		0.906127f, -0.382683f, 0.180240f, 0.907000f, -0.380500f, 0.180400f, 0.468750f, 0.375000f, 
-		0.923879f, -0.382683f, -0.000000f, 0.924800f, -0.380500f, -0.000000f, 0.500000f, 0.375000f, 
-		0.382683f, 0.923880f, 0.000000f, 0.387900f, 0.921700f, -0.000000f, 0.500000f, 0.875000f, 
-		0.544895f, 0.831470f, 0.108386f, 0.549000f, 0.828600f, 0.109200f, 0.468750f, 0.812500f, 
-		0.555570f, 0.831470f, 0.000000f, 0.559800f, 0.828600f, -0.000000f, 0.500000f, 0.812500f, 
-		0.831469f, -0.555570f, 0.000000f, 0.833300f, -0.552800f, -0.000000f, 0.500000f, 0.312500f, 
-		0.906127f, -0.382683f, 0.180240f, 0.907000f, -0.380500f, 0.180400f, 0.468750f, 0.375000f, 
-		0.815493f, -0.555570f, 0.162212f, 0.817300f, -0.552800f, 0.162600f, 0.468750f, 0.312500f, 
-		0.555570f, 0.831470f, 0.000000f, 0.559800f, 0.828600f, -0.000000f, 0.500000f, 0.812500f, 
-		0.693520f, 0.707107f, 0.137950f, 0.696500f, 0.704100f, 0.138500f, 0.468750f, 0.750000f, 
-		0.707107f, 0.707107f, -0.000000f, 0.710100f, 0.704100f, -0.000000f, 0.500000f, 0.750000f, 
-		0.831469f, -0.555570f, 0.000000f, 0.833300f, -0.552800f, -0.000000f, 0.500000f, 0.312500f, 
-		0.693520f, -0.707107f, 0.137950f, 0.696500f, -0.704100f, 0.138500f, 0.468750f, 0.250000f, 
-		0.707107f, -0.707107f, -0.000000f, 0.710100f, -0.704100f, -0.000000f, 0.500000f, 0.250000f, 
-		0.831469f, 0.555570f, 0.000000f, 0.833300f, 0.552800f, -0.000000f, 0.500000f, 0.687500f, 
-		0.693520f, 0.707107f, 0.137950f, 0.696500f, 0.704100f, 0.138500f, 0.468750f, 0.750000f, 
-		0.815493f, 0.555570f, 0.162212f, 0.817300f, 0.552800f, 0.162600f, 0.468750f, 0.687500f, 
-		0.555570f, -0.831470f, 0.000000f, 0.559800f, -0.828600f, -0.000000f, 0.500000f, 0.187500f, 
-		0.693520f, -0.707107f, 0.137950f, 0.696500f, -0.704100f, 0.138500f, 0.468750f, 0.250000f, 
-		0.544895f, -0.831470f, 0.108386f, 0.549000f, -0.828600f, 0.109200f, 0.468750f, 0.187500f, 
-		0.831469f, 0.555570f, 0.000000f, 0.833300f, 0.552800f, -0.000000f, 0.500000f, 0.687500f, 
-		0.906127f, 0.382683f, 0.180240f, 0.907000f, 0.380500f, 0.180400f, 0.468750f, 0.625000f, 
-		0.923879f, 0.382683f, -0.000000f, 0.924800f, 0.380500f, -0.000000f, 0.500000f, 0.625000f, 
-		0.555570f, -0.831470f, 0.000000f, 0.559800f, -0.828600f, -0.000000f, 0.500000f, 0.187500f, 
-		0.375330f, -0.923880f, 0.074658f, 0.380400f, -0.921700f, 0.075700f, 0.468750f, 0.125000f, 
-		0.382683f, -0.923880f, 0.000000f, 0.387900f, -0.921700f, -0.000000f, 0.500000f, 0.125000f, 
-		0.815493f, -0.555570f, 0.162212f, 0.817300f, -0.552800f, 0.162600f, 0.468750f, 0.312500f, 
-		0.853553f, -0.382683f, 0.353553f, 0.854400f, -0.380500f, 0.353900f, 0.437500f, 0.375000f, 
-		0.768178f, -0.555570f, 0.318190f, 0.769900f, -0.552800f, 0.318900f, 0.437500f, 0.312500f, 
-		0.544895f, 0.831470f, 0.108386f, 0.549000f, 0.828600f, 0.109200f, 0.468750f, 0.812500f, 
-		0.653281f, 0.707107f, 0.270598f, 0.656100f, 0.704100f, 0.271800f, 0.437500f, 0.750000f, 
-		0.693520f, 0.707107f, 0.137950f, 0.696500f, 0.704100f, 0.138500f, 0.468750f, 0.750000f, 
-		0.815493f, -0.555570f, 0.162212f, 0.817300f, -0.552800f, 0.162600f, 0.468750f, 0.312500f, 
-		0.653281f, -0.707107f, 0.270598f, 0.656100f, -0.704100f, 0.271800f, 0.437500f, 0.250000f, 
-		0.693520f, -0.707107f, 0.137950f, 0.696500f, -0.704100f, 0.138500f, 0.468750f, 0.250000f, 
-		0.815493f, 0.555570f, 0.162212f, 0.817300f, 0.552800f, 0.162600f, 0.468750f, 0.687500f, 
-		0.653281f, 0.707107f, 0.270598f, 0.656100f, 0.704100f, 0.271800f, 0.437500f, 0.750000f, 
-		0.768178f, 0.555570f, 0.318190f, 0.769900f, 0.552800f, 0.318900f, 0.437500f, 0.687500f, 
-		0.544895f, -0.831470f, 0.108386f, 0.549000f, -0.828600f, 0.109200f, 0.468750f, 0.187500f, 
-		0.653281f, -0.707107f, 0.270598f, 0.656100f, -0.704100f, 0.271800f, 0.437500f, 0.250000f, 
-		0.513280f, -0.831470f, 0.212608f, 0.517200f, -0.828600f, 0.214200f, 0.437500f, 0.187500f, 
-		0.815493f, 0.555570f, 0.162212f, 0.817300f, 0.552800f, 0.162600f, 0.468750f, 0.687500f, 
-		0.853553f, 0.382683f, 0.353553f, 0.854400f, 0.380500f, 0.353900f, 0.437500f, 0.625000f, 
-		0.906127f, 0.382683f, 0.180240f, 0.907000f, 0.380500f, 0.180400f, 0.468750f, 0.625000f, 
-		0.544895f, -0.831470f, 0.108386f, 0.549000f, -0.828600f, 0.109200f, 0.468750f, 0.187500f, 
-		0.353553f, -0.923880f, 0.146447f, 0.358400f, -0.921700f, 0.148400f, 0.437500f, 0.125000f, 
-		0.375330f, -0.923880f, 0.074658f, 0.380400f, -0.921700f, 0.075700f, 0.468750f, 0.125000f, 
-		0.961940f, 0.195090f, 0.191342f, 0.962200f, 0.193900f, 0.191400f, 0.468750f, 0.562500f, 
-		0.853553f, 0.382683f, 0.353553f, 0.854400f, 0.380500f, 0.353900f, 0.437500f, 0.625000f, 
-		0.906127f, 0.195090f, 0.375330f, 0.906300f, 0.193900f, 0.375400f, 0.437500f, 0.562500f, 
-		0.191342f, -0.980785f, 0.038060f, 0.197100f, -0.979600f, 0.039200f, 0.468750f, 0.062500f, 
-		0.353553f, -0.923880f, 0.146447f, 0.358400f, -0.921700f, 0.148400f, 0.437500f, 0.125000f, 
-		0.180240f, -0.980785f, 0.074658f, 0.185700f, -0.979600f, 0.076900f, 0.437500f, 0.062500f, 
-		0.980785f, 0.000000f, 0.195090f, 0.980800f, -0.000000f, 0.195100f, 0.468750f, 0.500000f, 
-		0.906127f, 0.195090f, 0.375330f, 0.906300f, 0.193900f, 0.375400f, 0.437500f, 0.562500f, 
-		0.923879f, 0.000000f, 0.382683f, 0.923900f, -0.000000f, 0.382700f, 0.437500f, 0.500000f, 
-		0.191342f, 0.980785f, 0.038060f, 0.197100f, 0.979600f, 0.039200f, 0.468750f, 0.937500f, 
-		0.000000f, 1.000000f, 0.000000f, -0.000000f, 1.000000f, -0.000000f, 0.453125f, 1.000000f, 
-		0.180240f, 0.980785f, 0.074658f, 0.185700f, 0.979600f, 0.076900f, 0.437500f, 0.937500f, 
-		0.000000f, -1.000000f, 0.000000f, -0.000000f, -1.000000f, -0.000000f, 0.453125f, 0.000000f, 
-		0.191342f, -0.980785f, 0.038060f, 0.197100f, -0.979600f, 0.039200f, 0.468750f, 0.062500f, 
-		0.180240f, -0.980785f, 0.074658f, 0.185700f, -0.979600f, 0.076900f, 0.437500f, 0.062500f, 
-		0.980785f, 0.000000f, 0.195090f, 0.980800f, -0.000000f, 0.195100f, 0.468750f, 0.500000f, 
-		0.906127f, -0.195090f, 0.375330f, 0.906300f, -0.193900f, 0.375400f, 0.437500f, 0.437500f, 
-		0.961940f, -0.195090f, 0.191342f, 0.962200f, -0.193900f, 0.191400f, 0.468750f, 0.437500f, 
-		0.191342f, 0.980785f, 0.038060f, 0.197100f, 0.979600f, 0.039200f, 0.468750f, 0.937500f, 
-		0.353553f, 0.923880f, 0.146447f, 0.358400f, 0.921700f, 0.148400f, 0.437500f, 0.875000f, 
-		0.375330f, 0.923880f, 0.074658f, 0.380400f, 0.921700f, 0.075700f, 0.468750f, 0.875000f, 
-		0.961940f, -0.195090f, 0.191342f, 0.962200f, -0.193900f, 0.191400f, 0.468750f, 0.437500f, 
-		0.853553f, -0.382683f, 0.353553f, 0.854400f, -0.380500f, 0.353900f, 0.437500f, 0.375000f, 
-		0.906127f, -0.382683f, 0.180240f, 0.907000f, -0.380500f, 0.180400f, 0.468750f, 0.375000f, 
-		0.544895f, 0.831470f, 0.108386f, 0.549000f, 0.828600f, 0.109200f, 0.468750f, 0.812500f, 
-		0.353553f, 0.923880f, 0.146447f, 0.358400f, 0.921700f, 0.148400f, 0.437500f, 0.875000f, 
-		0.513280f, 0.831470f, 0.212608f, 0.517200f, 0.828600f, 0.214200f, 0.437500f, 0.812500f, 
-		0.353553f, -0.923880f, 0.146447f, 0.358400f, -0.921700f, 0.148400f, 0.437500f, 0.125000f, 
-		0.162212f, -0.980785f, 0.108386f, 0.167100f, -0.979600f, 0.111700f, 0.406250f, 0.062500f, 
-		0.180240f, -0.980785f, 0.074658f, 0.185700f, -0.979600f, 0.076900f, 0.437500f, 0.062500f, 
-		0.923879f, 0.000000f, 0.382683f, 0.923900f, -0.000000f, 0.382700f, 0.437500f, 0.500000f, 
-		0.815493f, 0.195090f, 0.544895f, 0.815700f, 0.193900f, 0.545000f, 0.406250f, 0.562500f, 
-		0.831469f, 0.000000f, 0.555570f, 0.831500f, -0.000000f, 0.555600f, 0.406250f, 0.500000f, 
-		0.180240f, 0.980785f, 0.074658f, 0.185700f, 0.979600f, 0.076900f, 0.437500f, 0.937500f, 
-		0.000000f, 1.000000f, 0.000000f, -0.000000f, 1.000000f, -0.000000f, 0.421875f, 1.000000f, 
-		0.162212f, 0.980785f, 0.108386f, 0.167100f, 0.979600f, 0.111700f, 0.406250f, 0.937500f, 
-		0.000000f, -1.000000f, 0.000000f, -0.000000f, -1.000000f, -0.000000f, 0.421875f, 0.000000f, 
-		0.180240f, -0.980785f, 0.074658f, 0.185700f, -0.979600f, 0.076900f, 0.437500f, 0.062500f, 
-		0.162212f, -0.980785f, 0.108386f, 0.167100f, -0.979600f, 0.111700f, 0.406250f, 0.062500f, 
-		0.923879f, 0.000000f, 0.382683f, 0.923900f, -0.000000f, 0.382700f, 0.437500f, 0.500000f, 
-		0.815493f, -0.195090f, 0.544895f, 0.815700f, -0.193900f, 0.545000f, 0.406250f, 0.437500f, 
-		0.906127f, -0.195090f, 0.375330f, 0.906300f, -0.193900f, 0.375400f, 0.437500f, 0.437500f, 
-		0.180240f, 0.980785f, 0.074658f, 0.185700f, 0.979600f, 0.076900f, 0.437500f, 0.937500f, 
-		0.318190f, 0.923880f, 0.212608f, 0.322500f, 0.921700f, 0.215500f, 0.406250f, 0.875000f, 
-		0.353553f, 0.923880f, 0.146447f, 0.358400f, 0.921700f, 0.148400f, 0.437500f, 0.875000f, 
-		0.906127f, -0.195090f, 0.375330f, 0.906300f, -0.193900f, 0.375400f, 0.437500f, 0.437500f, 
-		0.768178f, -0.382683f, 0.513280f, 0.768900f, -0.380500f, 0.513800f, 0.406250f, 0.375000f, 
-		0.853553f, -0.382683f, 0.353553f, 0.854400f, -0.380500f, 0.353900f, 0.437500f, 0.375000f, 
-		0.513280f, 0.831470f, 0.212608f, 0.517200f, 0.828600f, 0.214200f, 0.437500f, 0.812500f, 
-		0.318190f, 0.923880f, 0.212608f, 0.322500f, 0.921700f, 0.215500f, 0.406250f, 0.875000f, 
-		0.461940f, 0.831470f, 0.308658f, 0.465400f, 0.828600f, 0.311000f, 0.406250f, 0.812500f, 
-		0.768178f, -0.555570f, 0.318190f, 0.769900f, -0.552800f, 0.318900f, 0.437500f, 0.312500f, 
-		0.768178f, -0.382683f, 0.513280f, 0.768900f, -0.380500f, 0.513800f, 0.406250f, 0.375000f, 
-		0.691341f, -0.555570f, 0.461940f, 0.692900f, -0.552800f, 0.463000f, 0.406250f, 0.312500f, 
-		0.513280f, 0.831470f, 0.212608f, 0.517200f, 0.828600f, 0.214200f, 0.437500f, 0.812500f, 
-		0.587938f, 0.707107f, 0.392847f, 0.590500f, 0.704100f, 0.394500f, 0.406250f, 0.750000f, 
-		0.653281f, 0.707107f, 0.270598f, 0.656100f, 0.704100f, 0.271800f, 0.437500f, 0.750000f, 
-		0.768178f, -0.555570f, 0.318190f, 0.769900f, -0.552800f, 0.318900f, 0.437500f, 0.312500f, 
-		0.587938f, -0.707107f, 0.392847f, 0.590500f, -0.704100f, 0.394500f, 0.406250f, 0.250000f, 
-		0.653281f, -0.707107f, 0.270598f, 0.656100f, -0.704100f, 0.271800f, 0.437500f, 0.250000f, 
-		0.768178f, 0.555570f, 0.318190f, 0.769900f, 0.552800f, 0.318900f, 0.437500f, 0.687500f, 
-		0.587938f, 0.707107f, 0.392847f, 0.590500f, 0.704100f, 0.394500f, 0.406250f, 0.750000f, 
-		0.691341f, 0.555570f, 0.461940f, 0.692900f, 0.552800f, 0.463000f, 0.406250f, 0.687500f, 
-		0.513280f, -0.831470f, 0.212608f, 0.517200f, -0.828600f, 0.214200f, 0.437500f, 0.187500f, 
-		0.587938f, -0.707107f, 0.392847f, 0.590500f, -0.704100f, 0.394500f, 0.406250f, 0.250000f, 
-		0.461940f, -0.831470f, 0.308658f, 0.465400f, -0.828600f, 0.311000f, 0.406250f, 0.187500f, 
-		0.768178f, 0.555570f, 0.318190f, 0.769900f, 0.552800f, 0.318900f, 0.437500f, 0.687500f, 
-		0.768178f, 0.382683f, 0.513280f, 0.768900f, 0.380500f, 0.513800f, 0.406250f, 0.625000f, 
-		0.853553f, 0.382683f, 0.353553f, 0.854400f, 0.380500f, 0.353900f, 0.437500f, 0.625000f, 
-		0.513280f, -0.831470f, 0.212608f, 0.517200f, -0.828600f, 0.214200f, 0.437500f, 0.187500f, 
-		0.318190f, -0.923880f, 0.212608f, 0.322500f, -0.921700f, 0.215500f, 0.406250f, 0.125000f, 
-		0.353553f, -0.923880f, 0.146447f, 0.358400f, -0.921700f, 0.148400f, 0.437500f, 0.125000f, 
-		0.906127f, 0.195090f, 0.375330f, 0.906300f, 0.193900f, 0.375400f, 0.437500f, 0.562500f, 
-		0.768178f, 0.382683f, 0.513280f, 0.768900f, 0.380500f, 0.513800f, 0.406250f, 0.625000f, 
-		0.815493f, 0.195090f, 0.544895f, 0.815700f, 0.193900f, 0.545000f, 0.406250f, 0.562500f, 
-		0.691341f, -0.555570f, 0.461940f, 0.692900f, -0.552800f, 0.463000f, 0.406250f, 0.312500f, 
-		0.500000f, -0.707107f, 0.500000f, 0.502100f, -0.704100f, 0.502100f, 0.375000f, 0.250000f, 
-		0.587938f, -0.707107f, 0.392847f, 0.590500f, -0.704100f, 0.394500f, 0.406250f, 0.250000f, 
-		0.691341f, 0.555570f, 0.461940f, 0.692900f, 0.552800f, 0.463000f, 0.406250f, 0.687500f, 
-		0.500000f, 0.707107f, 0.500000f, 0.502100f, 0.704100f, 0.502100f, 0.375000f, 0.750000f, 
-		0.587938f, 0.555570f, 0.587938f, 0.589300f, 0.552800f, 0.589300f, 0.375000f, 0.687500f, 
-		0.587938f, -0.707107f, 0.392847f, 0.590500f, -0.704100f, 0.394500f, 0.406250f, 0.250000f, 
-		0.392847f, -0.831470f, 0.392847f, 0.395800f, -0.828600f, 0.395800f, 0.375000f, 0.187500f, 
-		0.461940f, -0.831470f, 0.308658f, 0.465400f, -0.828600f, 0.311000f, 0.406250f, 0.187500f, 
-		0.691341f, 0.555570f, 0.461940f, 0.692900f, 0.552800f, 0.463000f, 0.406250f, 0.687500f, 
-		0.653281f, 0.382683f, 0.653281f, 0.653900f, 0.380500f, 0.653900f, 0.375000f, 0.625000f, 
-		0.768178f, 0.382683f, 0.513280f, 0.768900f, 0.380500f, 0.513800f, 0.406250f, 0.625000f, 
-		0.318190f, -0.923880f, 0.212608f, 0.322500f, -0.921700f, 0.215500f, 0.406250f, 0.125000f, 
-		0.392847f, -0.831470f, 0.392847f, 0.395800f, -0.828600f, 0.395800f, 0.375000f, 0.187500f, 
-		0.270598f, -0.923880f, 0.270598f, 0.274300f, -0.921700f, 0.274300f, 0.375000f, 0.125000f, 
-		0.815493f, 0.195090f, 0.544895f, 0.815700f, 0.193900f, 0.545000f, 0.406250f, 0.562500f, 
-		0.653281f, 0.382683f, 0.653281f, 0.653900f, 0.380500f, 0.653900f, 0.375000f, 0.625000f, 
-		0.693520f, 0.195090f, 0.693520f, 0.693700f, 0.193900f, 0.693700f, 0.375000f, 0.562500f, 
-		0.162212f, -0.980785f, 0.108386f, 0.167100f, -0.979600f, 0.111700f, 0.406250f, 0.062500f, 
-		0.270598f, -0.923880f, 0.270598f, 0.274300f, -0.921700f, 0.274300f, 0.375000f, 0.125000f, 
-		0.137950f, -0.980785f, 0.137950f, 0.142100f, -0.979600f, 0.142100f, 0.375000f, 0.062500f, 
-		0.831469f, 0.000000f, 0.555570f, 0.831500f, -0.000000f, 0.555600f, 0.406250f, 0.500000f, 
-		0.693520f, 0.195090f, 0.693520f, 0.693700f, 0.193900f, 0.693700f, 0.375000f, 0.562500f, 
-		0.707106f, 0.000000f, 0.707107f, 0.707100f, -0.000000f, 0.707100f, 0.375000f, 0.500000f, 
-		0.162212f, 0.980785f, 0.108386f, 0.167100f, 0.979600f, 0.111700f, 0.406250f, 0.937500f, 
-		0.000000f, 1.000000f, 0.000000f, -0.000000f, 1.000000f, -0.000000f, 0.390625f, 1.000000f, 
-		0.137950f, 0.980785f, 0.137950f, 0.142100f, 0.979600f, 0.142100f, 0.375000f, 0.937500f, 
-		0.000000f, -1.000000f, 0.000000f, -0.000000f, -1.000000f, -0.000000f, 0.390625f, 0.000000f, 
-		0.162212f, -0.980785f, 0.108386f, 0.167100f, -0.979600f, 0.111700f, 0.406250f, 0.062500f, 
-		0.137950f, -0.980785f, 0.137950f, 0.142100f, -0.979600f, 0.142100f, 0.375000f, 0.062500f, 
-		0.831469f, 0.000000f, 0.555570f, 0.831500f, -0.000000f, 0.555600f, 0.406250f, 0.500000f, 
-		0.693520f, -0.195090f, 0.693520f, 0.693700f, -0.193900f, 0.693700f, 0.375000f, 0.437500f, 
-		0.815493f, -0.195090f, 0.544895f, 0.815700f, -0.193900f, 0.545000f, 0.406250f, 0.437500f, 
-		0.162212f, 0.980785f, 0.108386f, 0.167100f, 0.979600f, 0.111700f, 0.406250f, 0.937500f, 
-		0.270598f, 0.923880f, 0.270598f, 0.274300f, 0.921700f, 0.274300f, 0.375000f, 0.875000f, 
-		0.318190f, 0.923880f, 0.212608f, 0.322500f, 0.921700f, 0.215500f, 0.406250f, 0.875000f, 
-		0.815493f, -0.195090f, 0.544895f, 0.815700f, -0.193900f, 0.545000f, 0.406250f, 0.437500f, 
-		0.653281f, -0.382683f, 0.653281f, 0.653900f, -0.380500f, 0.653900f, 0.375000f, 0.375000f, 
-		0.768178f, -0.382683f, 0.513280f, 0.768900f, -0.380500f, 0.513800f, 0.406250f, 0.375000f, 
-		0.318190f, 0.923880f, 0.212608f, 0.322500f, 0.921700f, 0.215500f, 0.406250f, 0.875000f, 
-		0.392847f, 0.831470f, 0.392847f, 0.395800f, 0.828600f, 0.395800f, 0.375000f, 0.812500f, 
-		0.461940f, 0.831470f, 0.308658f, 0.465400f, 0.828600f, 0.311000f, 0.406250f, 0.812500f, 
-		0.691341f, -0.555570f, 0.461940f, 0.692900f, -0.552800f, 0.463000f, 0.406250f, 0.312500f, 
-		0.653281f, -0.382683f, 0.653281f, 0.653900f, -0.380500f, 0.653900f, 0.375000f, 0.375000f, 
-		0.587938f, -0.555570f, 0.587938f, 0.589300f, -0.552800f, 0.589300f, 0.375000f, 0.312500f, 
-		0.461940f, 0.831470f, 0.308658f, 0.465400f, 0.828600f, 0.311000f, 0.406250f, 0.812500f, 
-		0.500000f, 0.707107f, 0.500000f, 0.502100f, 0.704100f, 0.502100f, 0.375000f, 0.750000f, 
-		0.587938f, 0.707107f, 0.392847f, 0.590500f, 0.704100f, 0.394500f, 0.406250f, 0.750000f, 
-		0.137950f, 0.980785f, 0.137950f, 0.142100f, 0.979600f, 0.142100f, 0.375000f, 0.937500f, 
-		0.000000f, 1.000000f, 0.000000f, -0.000000f, 1.000000f, -0.000000f, 0.359375f, 1.000000f, 
-		0.108386f, 0.980785f, 0.162212f, 0.111700f, 0.979600f, 0.167100f, 0.343750f, 0.937500f, 
-		0.000000f, -1.000000f, 0.000000f, -0.000000f, -1.000000f, -0.000000f, 0.359375f, 0.000000f, 
-		0.137950f, -0.980785f, 0.137950f, 0.142100f, -0.979600f, 0.142100f, 0.375000f, 0.062500f, 
-		0.108386f, -0.980785f, 0.162212f, 0.111700f, -0.979600f, 0.167100f, 0.343750f, 0.062500f, 
-		0.707106f, 0.000000f, 0.707107f, 0.707100f, -0.000000f, 0.707100f, 0.375000f, 0.500000f, 
-		0.544895f, -0.195090f, 0.815493f, 0.545000f, -0.193900f, 0.815700f, 0.343750f, 0.437500f, 
-		0.693520f, -0.195090f, 0.693520f, 0.693700f, -0.193900f, 0.693700f, 0.375000f, 0.437500f, 
-		0.270598f, 0.923880f, 0.270598f, 0.274300f, 0.921700f, 0.274300f, 0.375000f, 0.875000f, 
-		0.108386f, 0.980785f, 0.162212f, 0.111700f, 0.979600f, 0.167100f, 0.343750f, 0.937500f, 
-		0.212607f, 0.923880f, 0.318190f, 0.215500f, 0.921700f, 0.322500f, 0.343750f, 0.875000f, 
-		0.693520f, -0.195090f, 0.693520f, 0.693700f, -0.193900f, 0.693700f, 0.375000f, 0.437500f, 
-		0.513280f, -0.382683f, 0.768178f, 0.513800f, -0.380500f, 0.768900f, 0.343750f, 0.375000f, 
-		0.653281f, -0.382683f, 0.653281f, 0.653900f, -0.380500f, 0.653900f, 0.375000f, 0.375000f, 
-		0.392847f, 0.831470f, 0.392847f, 0.395800f, 0.828600f, 0.395800f, 0.375000f, 0.812500f, 
-		0.212607f, 0.923880f, 0.318190f, 0.215500f, 0.921700f, 0.322500f, 0.343750f, 0.875000f, 
-		0.308658f, 0.831470f, 0.461940f, 0.311000f, 0.828600f, 0.465400f, 0.343750f, 0.812500f, 
-		0.587938f, -0.555570f, 0.587938f, 0.589300f, -0.552800f, 0.589300f, 0.375000f, 0.312500f, 
-		0.513280f, -0.382683f, 0.768178f, 0.513800f, -0.380500f, 0.768900f, 0.343750f, 0.375000f, 
-		0.461940f, -0.555570f, 0.691342f, 0.463000f, -0.552800f, 0.692900f, 0.343750f, 0.312500f, 
-		0.392847f, 0.831470f, 0.392847f, 0.395800f, 0.828600f, 0.395800f, 0.375000f, 0.812500f, 
-		0.392847f, 0.707107f, 0.587938f, 0.394500f, 0.704100f, 0.590500f, 0.343750f, 0.750000f, 
-		0.500000f, 0.707107f, 0.500000f, 0.502100f, 0.704100f, 0.502100f, 0.375000f, 0.750000f, 
-		0.587938f, -0.555570f, 0.587938f, 0.589300f, -0.552800f, 0.589300f, 0.375000f, 0.312500f, 
-		0.392847f, -0.707107f, 0.587938f, 0.394500f, -0.704100f, 0.590500f, 0.343750f, 0.250000f, 
-		0.500000f, -0.707107f, 0.500000f, 0.502100f, -0.704100f, 0.502100f, 0.375000f, 0.250000f, 
-		0.587938f, 0.555570f, 0.587938f, 0.589300f, 0.552800f, 0.589300f, 0.375000f, 0.687500f, 
-		0.392847f, 0.707107f, 0.587938f, 0.394500f, 0.704100f, 0.590500f, 0.343750f, 0.750000f, 
-		0.461940f, 0.555570f, 0.691342f, 0.463000f, 0.552800f, 0.692900f, 0.343750f, 0.687500f, 
-		0.392847f, -0.831470f, 0.392847f, 0.395800f, -0.828600f, 0.395800f, 0.375000f, 0.187500f, 
-		0.392847f, -0.707107f, 0.587938f, 0.394500f, -0.704100f, 0.590500f, 0.343750f, 0.250000f, 
-		0.308658f, -0.831470f, 0.461940f, 0.311000f, -0.828600f, 0.465400f, 0.343750f, 0.187500f, 
-		0.587938f, 0.555570f, 0.587938f, 0.589300f, 0.552800f, 0.589300f, 0.375000f, 0.687500f, 
-		0.513280f, 0.382683f, 0.768178f, 0.513800f, 0.380500f, 0.768900f, 0.343750f, 0.625000f, 
-		0.653281f, 0.382683f, 0.653281f, 0.653900f, 0.380500f, 0.653900f, 0.375000f, 0.625000f, 
-		0.392847f, -0.831470f, 0.392847f, 0.395800f, -0.828600f, 0.395800f, 0.375000f, 0.187500f, 
-		0.212607f, -0.923880f, 0.318190f, 0.215500f, -0.921700f, 0.322500f, 0.343750f, 0.125000f, 
-		0.270598f, -0.923880f, 0.270598f, 0.274300f, -0.921700f, 0.274300f, 0.375000f, 0.125000f, 
-		0.693520f, 0.195090f, 0.693520f, 0.693700f, 0.193900f, 0.693700f, 0.375000f, 0.562500f, 
-		0.513280f, 0.382683f, 0.768178f, 0.513800f, 0.380500f, 0.768900f, 0.343750f, 0.625000f, 
-		0.544895f, 0.195090f, 0.815493f, 0.545000f, 0.193900f, 0.815700f, 0.343750f, 0.562500f, 
-		0.270598f, -0.923880f, 0.270598f, 0.274300f, -0.921700f, 0.274300f, 0.375000f, 0.125000f, 
-		0.108386f, -0.980785f, 0.162212f, 0.111700f, -0.979600f, 0.167100f, 0.343750f, 0.062500f, 
-		0.137950f, -0.980785f, 0.137950f, 0.142100f, -0.979600f, 0.142100f, 0.375000f, 0.062500f, 
-		0.707106f, 0.000000f, 0.707107f, 0.707100f, -0.000000f, 0.707100f, 0.375000f, 0.500000f, 
-		0.544895f, 0.195090f, 0.815493f, 0.545000f, 0.193900f, 0.815700f, 0.343750f, 0.562500f, 
-		0.555570f, 0.000000f, 0.831469f, 0.555600f, -0.000000f, 0.831500f, 0.343750f, 0.500000f, 
-		0.461940f, 0.555570f, 0.691342f, 0.463000f, 0.552800f, 0.692900f, 0.343750f, 0.687500f, 
-		0.270598f, 0.707107f, 0.653281f, 0.271800f, 0.704100f, 0.656100f, 0.312500f, 0.750000f, 
-		0.318189f, 0.555570f, 0.768178f, 0.318900f, 0.552800f, 0.769900f, 0.312500f, 0.687500f, 
-		0.308658f, -0.831470f, 0.461940f, 0.311000f, -0.828600f, 0.465400f, 0.343750f, 0.187500f, 
-		0.270598f, -0.707107f, 0.653281f, 0.271800f, -0.704100f, 0.656100f, 0.312500f, 0.250000f, 
-		0.212607f, -0.831470f, 0.513280f, 0.214200f, -0.828600f, 0.517200f, 0.312500f, 0.187500f, 
-		0.461940f, 0.555570f, 0.691342f, 0.463000f, 0.552800f, 0.692900f, 0.343750f, 0.687500f, 
-		0.353553f, 0.382683f, 0.853553f, 0.353900f, 0.380500f, 0.854400f, 0.312500f, 0.625000f, 
-		0.513280f, 0.382683f, 0.768178f, 0.513800f, 0.380500f, 0.768900f, 0.343750f, 0.625000f, 
-		0.308658f, -0.831470f, 0.461940f, 0.311000f, -0.828600f, 0.465400f, 0.343750f, 0.187500f, 
-		0.146447f, -0.923880f, 0.353553f, 0.148400f, -0.921700f, 0.358400f, 0.312500f, 0.125000f, 
-		0.212607f, -0.923880f, 0.318190f, 0.215500f, -0.921700f, 0.322500f, 0.343750f, 0.125000f, 
-		0.544895f, 0.195090f, 0.815493f, 0.545000f, 0.193900f, 0.815700f, 0.343750f, 0.562500f, 
-		0.353553f, 0.382683f, 0.853553f, 0.353900f, 0.380500f, 0.854400f, 0.312500f, 0.625000f, 
-		0.375330f, 0.195090f, 0.906127f, 0.375400f, 0.193900f, 0.906300f, 0.312500f, 0.562500f, 
-		0.212607f, -0.923880f, 0.318190f, 0.215500f, -0.921700f, 0.322500f, 0.343750f, 0.125000f, 
-		0.074658f, -0.980785f, 0.180240f, 0.076900f, -0.979600f, 0.185700f, 0.312500f, 0.062500f, 
-		0.108386f, -0.980785f, 0.162212f, 0.111700f, -0.979600f, 0.167100f, 0.343750f, 0.062500f, 
-		0.555570f, 0.000000f, 0.831469f, 0.555600f, -0.000000f, 0.831500f, 0.343750f, 0.500000f, 
-		0.375330f, 0.195090f, 0.906127f, 0.375400f, 0.193900f, 0.906300f, 0.312500f, 0.562500f, 
-		0.382683f, 0.000000f, 0.923879f, 0.382700f, -0.000000f, 0.923900f, 0.312500f, 0.500000f, 
-		0.108386f, 0.980785f, 0.162212f, 0.111700f, 0.979600f, 0.167100f, 0.343750f, 0.937500f, 
-		0.000000f, 1.000000f, 0.000000f, -0.000000f, 1.000000f, -0.000000f, 0.328125f, 1.000000f, 
-		0.074658f, 0.980785f, 0.180240f, 0.076900f, 0.979600f, 0.185700f, 0.312500f, 0.937500f, 
-		0.000000f, -1.000000f, 0.000000f, -0.000000f, -1.000000f, -0.000000f, 0.328125f, 0.000000f, 
-		0.108386f, -0.980785f, 0.162212f, 0.111700f, -0.979600f, 0.167100f, 0.343750f, 0.062500f, 
-		0.074658f, -0.980785f, 0.180240f, 0.076900f, -0.979600f, 0.185700f, 0.312500f, 0.062500f, 
-		0.555570f, 0.000000f, 0.831469f, 0.555600f, -0.000000f, 0.831500f, 0.343750f, 0.500000f, 
-		0.375330f, -0.195090f, 0.906127f, 0.375400f, -0.193900f, 0.906300f, 0.312500f, 0.437500f, 
-		0.544895f, -0.195090f, 0.815493f, 0.545000f, -0.193900f, 0.815700f, 0.343750f, 0.437500f, 
-		0.108386f, 0.980785f, 0.162212f, 0.111700f, 0.979600f, 0.167100f, 0.343750f, 0.937500f, 
-		0.146447f, 0.923880f, 0.353553f, 0.148400f, 0.921700f, 0.358400f, 0.312500f, 0.875000f, 
-		0.212607f, 0.923880f, 0.318190f, 0.215500f, 0.921700f, 0.322500f, 0.343750f, 0.875000f, 
-		0.544895f, -0.195090f, 0.815493f, 0.545000f, -0.193900f, 0.815700f, 0.343750f, 0.437500f, 
-		0.353553f, -0.382683f, 0.853553f, 0.353900f, -0.380500f, 0.854400f, 0.312500f, 0.375000f, 
-		0.513280f, -0.382683f, 0.768178f, 0.513800f, -0.380500f, 0.768900f, 0.343750f, 0.375000f, 
-		0.212607f, 0.923880f, 0.318190f, 0.215500f, 0.921700f, 0.322500f, 0.343750f, 0.875000f, 
-		0.212607f, 0.831470f, 0.513280f, 0.214200f, 0.828600f, 0.517200f, 0.312500f, 0.812500f, 
-		0.308658f, 0.831470f, 0.461940f, 0.311000f, 0.828600f, 0.465400f, 0.343750f, 0.812500f, 
-		0.461940f, -0.555570f, 0.691342f, 0.463000f, -0.552800f, 0.692900f, 0.343750f, 0.312500f, 
-		0.353553f, -0.382683f, 0.853553f, 0.353900f, -0.380500f, 0.854400f, 0.312500f, 0.375000f, 
-		0.318189f, -0.555570f, 0.768178f, 0.318900f, -0.552800f, 0.769900f, 0.312500f, 0.312500f, 
-		0.308658f, 0.831470f, 0.461940f, 0.311000f, 0.828600f, 0.465400f, 0.343750f, 0.812500f, 
-		0.270598f, 0.707107f, 0.653281f, 0.271800f, 0.704100f, 0.656100f, 0.312500f, 0.750000f, 
-		0.392847f, 0.707107f, 0.587938f, 0.394500f, 0.704100f, 0.590500f, 0.343750f, 0.750000f, 
-		0.461940f, -0.555570f, 0.691342f, 0.463000f, -0.552800f, 0.692900f, 0.343750f, 0.312500f, 
-		0.270598f, -0.707107f, 0.653281f, 0.271800f, -0.704100f, 0.656100f, 0.312500f, 0.250000f, 
-		0.392847f, -0.707107f, 0.587938f, 0.394500f, -0.704100f, 0.590500f, 0.343750f, 0.250000f, 
-		0.382683f, 0.000000f, 0.923879f, 0.382700f, -0.000000f, 0.923900f, 0.312500f, 0.500000f, 
-		0.191342f, -0.195090f, 0.961939f, 0.191400f, -0.193900f, 0.962200f, 0.281250f, 0.437500f, 
-		0.375330f, -0.195090f, 0.906127f, 0.375400f, -0.193900f, 0.906300f, 0.312500f, 0.437500f, 
-		0.074658f, 0.980785f, 0.180240f, 0.076900f, 0.979600f, 0.185700f, 0.312500f, 0.937500f, 
-		0.074658f, 0.923880f, 0.375330f, 0.075700f, 0.921700f, 0.380400f, 0.281250f, 0.875000f, 
-		0.146447f, 0.923880f, 0.353553f, 0.148400f, 0.921700f, 0.358400f, 0.312500f, 0.875000f, 
-		0.375330f, -0.195090f, 0.906127f, 0.375400f, -0.193900f, 0.906300f, 0.312500f, 0.437500f, 
-		0.180240f, -0.382683f, 0.906127f, 0.180400f, -0.380500f, 0.907000f, 0.281250f, 0.375000f, 
-		0.353553f, -0.382683f, 0.853553f, 0.353900f, -0.380500f, 0.854400f, 0.312500f, 0.375000f, 
-		0.146447f, 0.923880f, 0.353553f, 0.148400f, 0.921700f, 0.358400f, 0.312500f, 0.875000f, 
-		0.108386f, 0.831470f, 0.544895f, 0.109200f, 0.828600f, 0.549000f, 0.281250f, 0.812500f, 
-		0.212607f, 0.831470f, 0.513280f, 0.214200f, 0.828600f, 0.517200f, 0.312500f, 0.812500f, 
-		0.318189f, -0.555570f, 0.768178f, 0.318900f, -0.552800f, 0.769900f, 0.312500f, 0.312500f, 
-		0.180240f, -0.382683f, 0.906127f, 0.180400f, -0.380500f, 0.907000f, 0.281250f, 0.375000f, 
-		0.162212f, -0.555570f, 0.815493f, 0.162600f, -0.552800f, 0.817300f, 0.281250f, 0.312500f, 
-		0.212607f, 0.831470f, 0.513280f, 0.214200f, 0.828600f, 0.517200f, 0.312500f, 0.812500f, 
-		0.137950f, 0.707107f, 0.693520f, 0.138500f, 0.704100f, 0.696500f, 0.281250f, 0.750000f, 
-		0.270598f, 0.707107f, 0.653281f, 0.271800f, 0.704100f, 0.656100f, 0.312500f, 0.750000f, 
-		0.318189f, -0.555570f, 0.768178f, 0.318900f, -0.552800f, 0.769900f, 0.312500f, 0.312500f, 
-		0.137950f, -0.707107f, 0.693520f, 0.138500f, -0.704100f, 0.696500f, 0.281250f, 0.250000f, 
-		0.270598f, -0.707107f, 0.653281f, 0.271800f, -0.704100f, 0.656100f, 0.312500f, 0.250000f, 
-		0.318189f, 0.555570f, 0.768178f, 0.318900f, 0.552800f, 0.769900f, 0.312500f, 0.687500f, 
-		0.137950f, 0.707107f, 0.693520f, 0.138500f, 0.704100f, 0.696500f, 0.281250f, 0.750000f, 
-		0.162212f, 0.555570f, 0.815493f, 0.162600f, 0.552800f, 0.817300f, 0.281250f, 0.687500f, 
-		0.212607f, -0.831470f, 0.513280f, 0.214200f, -0.828600f, 0.517200f, 0.312500f, 0.187500f, 
-		0.137950f, -0.707107f, 0.693520f, 0.138500f, -0.704100f, 0.696500f, 0.281250f, 0.250000f, 
-		0.108386f, -0.831470f, 0.544895f, 0.109200f, -0.828600f, 0.549000f, 0.281250f, 0.187500f, 
-		0.318189f, 0.555570f, 0.768178f, 0.318900f, 0.552800f, 0.769900f, 0.312500f, 0.687500f, 
-		0.180240f, 0.382683f, 0.906127f, 0.180400f, 0.380500f, 0.907000f, 0.281250f, 0.625000f, 
-		0.353553f, 0.382683f, 0.853553f, 0.353900f, 0.380500f, 0.854400f, 0.312500f, 0.625000f, 
-		0.212607f, -0.831470f, 0.513280f, 0.214200f, -0.828600f, 0.517200f, 0.312500f, 0.187500f, 
-		0.074658f, -0.923880f, 0.375330f, 0.075700f, -0.921700f, 0.380400f, 0.281250f, 0.125000f, 
-		0.146447f, -0.923880f, 0.353553f, 0.148400f, -0.921700f, 0.358400f, 0.312500f, 0.125000f, 
-		0.375330f, 0.195090f, 0.906127f, 0.375400f, 0.193900f, 0.906300f, 0.312500f, 0.562500f, 
-		0.180240f, 0.382683f, 0.906127f, 0.180400f, 0.380500f, 0.907000f, 0.281250f, 0.625000f, 
-		0.191342f, 0.195090f, 0.961939f, 0.191400f, 0.193900f, 0.962200f, 0.281250f, 0.562500f, 
-		0.146447f, -0.923880f, 0.353553f, 0.148400f, -0.921700f, 0.358400f, 0.312500f, 0.125000f, 
-		0.038060f, -0.980785f, 0.191342f, 0.039200f, -0.979600f, 0.197100f, 0.281250f, 0.062500f, 
-		0.074658f, -0.980785f, 0.180240f, 0.076900f, -0.979600f, 0.185700f, 0.312500f, 0.062500f, 
-		0.382683f, 0.000000f, 0.923879f, 0.382700f, -0.000000f, 0.923900f, 0.312500f, 0.500000f, 
-		0.191342f, 0.195090f, 0.961939f, 0.191400f, 0.193900f, 0.962200f, 0.281250f, 0.562500f, 
-		0.195090f, 0.000000f, 0.980785f, 0.195100f, -0.000000f, 0.980800f, 0.281250f, 0.500000f, 
-		0.074658f, 0.980785f, 0.180240f, 0.076900f, 0.979600f, 0.185700f, 0.312500f, 0.937500f, 
-		0.000000f, 1.000000f, 0.000000f, -0.000000f, 1.000000f, -0.000000f, 0.296875f, 1.000000f, 
-		0.038060f, 0.980785f, 0.191342f, 0.039200f, 0.979600f, 0.197100f, 0.281250f, 0.937500f, 
-		0.000000f, -1.000000f, 0.000000f, -0.000000f, -1.000000f, -0.000000f, 0.296875f, 0.000000f, 
-		0.074658f, -0.980785f, 0.180240f, 0.076900f, -0.979600f, 0.185700f, 0.312500f, 0.062500f, 
-		0.038060f, -0.980785f, 0.191342f, 0.039200f, -0.979600f, 0.197100f, 0.281250f, 0.062500f, 
-		0.108386f, -0.831470f, 0.544895f, 0.109200f, -0.828600f, 0.549000f, 0.281250f, 0.187500f, 
-		-0.000000f, -0.707107f, 0.707107f, -0.000000f, -0.704100f, 0.710100f, 0.250000f, 0.250000f, 
-		-0.000000f, -0.831470f, 0.555570f, -0.000000f, -0.828600f, 0.559800f, 0.250000f, 0.187500f, 
-		0.162212f, 0.555570f, 0.815493f, 0.162600f, 0.552800f, 0.817300f, 0.281250f, 0.687500f, 
-		0.000000f, 0.382683f, 0.923879f, -0.000000f, 0.380500f, 0.924800f, 0.250000f, 0.625000f, 
-		0.180240f, 0.382683f, 0.906127f, 0.180400f, 0.380500f, 0.907000f, 0.281250f, 0.625000f, 
-		0.108386f, -0.831470f, 0.544895f, 0.109200f, -0.828600f, 0.549000f, 0.281250f, 0.187500f, 
-		-0.000000f, -0.923880f, 0.382683f, -0.000000f, -0.921700f, 0.387900f, 0.250000f, 0.125000f, 
-		0.074658f, -0.923880f, 0.375330f, 0.075700f, -0.921700f, 0.380400f, 0.281250f, 0.125000f, 
-		0.191342f, 0.195090f, 0.961939f, 0.191400f, 0.193900f, 0.962200f, 0.281250f, 0.562500f, 
-		0.000000f, 0.382683f, 0.923879f, -0.000000f, 0.380500f, 0.924800f, 0.250000f, 0.625000f, 
-		-0.000000f, 0.195090f, 0.980785f, -0.000000f, 0.193900f, 0.981000f, 0.250000f, 0.562500f, 
-		0.038060f, -0.980785f, 0.191342f, 0.039200f, -0.979600f, 0.197100f, 0.281250f, 0.062500f, 
-		-0.000000f, -0.923880f, 0.382683f, -0.000000f, -0.921700f, 0.387900f, 0.250000f, 0.125000f, 
-		-0.000000f, -0.980785f, 0.195090f, -0.000000f, -0.979600f, 0.201000f, 0.250000f, 0.062500f, 
-		0.195090f, 0.000000f, 0.980785f, 0.195100f, -0.000000f, 0.980800f, 0.281250f, 0.500000f, 
-		-0.000000f, 0.195090f, 0.980785f, -0.000000f, 0.193900f, 0.981000f, 0.250000f, 0.562500f, 
-		-0.000000f, 0.000000f, 0.999999f, -0.000000f, -0.000000f, 1.000000f, 0.250000f, 0.500000f, 
-		0.038060f, 0.980785f, 0.191342f, 0.039200f, 0.979600f, 0.197100f, 0.281250f, 0.937500f, 
-		0.000000f, 1.000000f, 0.000000f, -0.000000f, 1.000000f, -0.000000f, 0.265625f, 1.000000f, 
-		-0.000000f, 0.980785f, 0.195090f, -0.000000f, 0.979600f, 0.201000f, 0.250000f, 0.937500f, 
-		0.000000f, -1.000000f, 0.000000f, -0.000000f, -1.000000f, -0.000000f, 0.265625f, 0.000000f, 
-		0.038060f, -0.980785f, 0.191342f, 0.039200f, -0.979600f, 0.197100f, 0.281250f, 0.062500f, 
-		-0.000000f, -0.980785f, 0.195090f, -0.000000f, -0.979600f, 0.201000f, 0.250000f, 0.062500f, 
-		0.195090f, 0.000000f, 0.980785f, 0.195100f, -0.000000f, 0.980800f, 0.281250f, 0.500000f, 
-		-0.000000f, -0.195090f, 0.980785f, -0.000000f, -0.193900f, 0.981000f, 0.250000f, 0.437500f, 
-		0.191342f, -0.195090f, 0.961939f, 0.191400f, -0.193900f, 0.962200f, 0.281250f, 0.437500f, 
-		0.038060f, 0.980785f, 0.191342f, 0.039200f, 0.979600f, 0.197100f, 0.281250f, 0.937500f, 
-		-0.000000f, 0.923880f, 0.382683f, -0.000000f, 0.921700f, 0.387900f, 0.250000f, 0.875000f, 
-		0.074658f, 0.923880f, 0.375330f, 0.075700f, 0.921700f, 0.380400f, 0.281250f, 0.875000f, 
-		0.191342f, -0.195090f, 0.961939f, 0.191400f, -0.193900f, 0.962200f, 0.281250f, 0.437500f, 
-		0.000000f, -0.382683f, 0.923879f, -0.000000f, -0.380500f, 0.924800f, 0.250000f, 0.375000f, 
-		0.180240f, -0.382683f, 0.906127f, 0.180400f, -0.380500f, 0.907000f, 0.281250f, 0.375000f, 
-		0.108386f, 0.831470f, 0.544895f, 0.109200f, 0.828600f, 0.549000f, 0.281250f, 0.812500f, 
-		-0.000000f, 0.923880f, 0.382683f, -0.000000f, 0.921700f, 0.387900f, 0.250000f, 0.875000f, 
-		-0.000000f, 0.831470f, 0.555570f, -0.000000f, 0.828600f, 0.559800f, 0.250000f, 0.812500f, 
-		0.162212f, -0.555570f, 0.815493f, 0.162600f, -0.552800f, 0.817300f, 0.281250f, 0.312500f, 
-		0.000000f, -0.382683f, 0.923879f, -0.000000f, -0.380500f, 0.924800f, 0.250000f, 0.375000f, 
-		-0.000000f, -0.555570f, 0.831469f, -0.000000f, -0.552800f, 0.833300f, 0.250000f, 0.312500f, 
-		0.108386f, 0.831470f, 0.544895f, 0.109200f, 0.828600f, 0.549000f, 0.281250f, 0.812500f, 
-		-0.000000f, 0.707107f, 0.707107f, -0.000000f, 0.704100f, 0.710100f, 0.250000f, 0.750000f, 
-		0.137950f, 0.707107f, 0.693520f, 0.138500f, 0.704100f, 0.696500f, 0.281250f, 0.750000f, 
-		0.162212f, -0.555570f, 0.815493f, 0.162600f, -0.552800f, 0.817300f, 0.281250f, 0.312500f, 
-		-0.000000f, -0.707107f, 0.707107f, -0.000000f, -0.704100f, 0.710100f, 0.250000f, 0.250000f, 
-		0.137950f, -0.707107f, 0.693520f, 0.138500f, -0.704100f, 0.696500f, 0.281250f, 0.250000f, 
-		0.162212f, 0.555570f, 0.815493f, 0.162600f, 0.552800f, 0.817300f, 0.281250f, 0.687500f, 
-		-0.000000f, 0.707107f, 0.707107f, -0.000000f, 0.704100f, 0.710100f, 0.250000f, 0.750000f, 
-		-0.000000f, 0.555570f, 0.831469f, -0.000000f, 0.552800f, 0.833300f, 0.250000f, 0.687500f, 
-		-0.000000f, 0.980785f, 0.195090f, -0.000000f, 0.979600f, 0.201000f, 0.250000f, 0.937500f, 
-		-0.074658f, 0.923880f, 0.375330f, -0.075700f, 0.921700f, 0.380400f, 0.218750f, 0.875000f, 
-		-0.000000f, 0.923880f, 0.382683f, -0.000000f, 0.921700f, 0.387900f, 0.250000f, 0.875000f, 
-		-0.000000f, -0.195090f, 0.980785f, -0.000000f, -0.193900f, 0.981000f, 0.250000f, 0.437500f, 
-		-0.180240f, -0.382683f, 0.906127f, -0.180400f, -0.380500f, 0.907000f, 0.218750f, 0.375000f, 
-		0.000000f, -0.382683f, 0.923879f, -0.000000f, -0.380500f, 0.924800f, 0.250000f, 0.375000f, 
-		-0.000000f, 0.923880f, 0.382683f, -0.000000f, 0.921700f, 0.387900f, 0.250000f, 0.875000f, 
-		-0.108386f, 0.831470f, 0.544895f, -0.109200f, 0.828600f, 0.549000f, 0.218750f, 0.812500f, 
-		-0.000000f, 0.831470f, 0.555570f, -0.000000f, 0.828600f, 0.559800f, 0.250000f, 0.812500f, 
-		-0.000000f, -0.555570f, 0.831469f, -0.000000f, -0.552800f, 0.833300f, 0.250000f, 0.312500f, 
-		-0.180240f, -0.382683f, 0.906127f, -0.180400f, -0.380500f, 0.907000f, 0.218750f, 0.375000f, 
-		-0.162212f, -0.555570f, 0.815493f, -0.162600f, -0.552800f, 0.817300f, 0.218750f, 0.312500f, 
-		-0.000000f, 0.831470f, 0.555570f, -0.000000f, 0.828600f, 0.559800f, 0.250000f, 0.812500f, 
-		-0.137950f, 0.707107f, 0.693520f, -0.138500f, 0.704100f, 0.696500f, 0.218750f, 0.750000f, 
-		-0.000000f, 0.707107f, 0.707107f, -0.000000f, 0.704100f, 0.710100f, 0.250000f, 0.750000f, 
-		-0.000000f, -0.555570f, 0.831469f, -0.000000f, -0.552800f, 0.833300f, 0.250000f, 0.312500f, 
-		-0.137950f, -0.707107f, 0.693520f, -0.138500f, -0.704100f, 0.696500f, 0.218750f, 0.250000f, 
-		-0.000000f, -0.707107f, 0.707107f, -0.000000f, -0.704100f, 0.710100f, 0.250000f, 0.250000f, 
-		-0.000000f, 0.555570f, 0.831469f, -0.000000f, 0.552800f, 0.833300f, 0.250000f, 0.687500f, 
-		-0.137950f, 0.707107f, 0.693520f, -0.138500f, 0.704100f, 0.696500f, 0.218750f, 0.750000f, 
-		-0.162212f, 0.555570f, 0.815493f, -0.162600f, 0.552800f, 0.817300f, 0.218750f, 0.687500f, 
-		-0.000000f, -0.831470f, 0.555570f, -0.000000f, -0.828600f, 0.559800f, 0.250000f, 0.187500f, 
-		-0.137950f, -0.707107f, 0.693520f, -0.138500f, -0.704100f, 0.696500f, 0.218750f, 0.250000f, 
-		-0.108386f, -0.831470f, 0.544895f, -0.109200f, -0.828600f, 0.549000f, 0.218750f, 0.187500f, 
-		-0.000000f, 0.555570f, 0.831469f, -0.000000f, 0.552800f, 0.833300f, 0.250000f, 0.687500f, 
-		-0.180240f, 0.382683f, 0.906127f, -0.180400f, 0.380500f, 0.907000f, 0.218750f, 0.625000f, 
-		0.000000f, 0.382683f, 0.923879f, -0.000000f, 0.380500f, 0.924800f, 0.250000f, 0.625000f, 
-		-0.000000f, -0.831470f, 0.555570f, -0.000000f, -0.828600f, 0.559800f, 0.250000f, 0.187500f, 
-		-0.074658f, -0.923880f, 0.375330f, -0.075700f, -0.921700f, 0.380400f, 0.218750f, 0.125000f, 
-		-0.000000f, -0.923880f, 0.382683f, -0.000000f, -0.921700f, 0.387900f, 0.250000f, 0.125000f, 
-		-0.000000f, 0.195090f, 0.980785f, -0.000000f, 0.193900f, 0.981000f, 0.250000f, 0.562500f, 
-		-0.180240f, 0.382683f, 0.906127f, -0.180400f, 0.380500f, 0.907000f, 0.218750f, 0.625000f, 
-		-0.191342f, 0.195090f, 0.961939f, -0.191400f, 0.193900f, 0.962200f, 0.218750f, 0.562500f, 
-		-0.000000f, -0.923880f, 0.382683f, -0.000000f, -0.921700f, 0.387900f, 0.250000f, 0.125000f, 
-		-0.038060f, -0.980785f, 0.191342f, -0.039200f, -0.979600f, 0.197100f, 0.218750f, 0.062500f, 
-		-0.000000f, -0.980785f, 0.195090f, -0.000000f, -0.979600f, 0.201000f, 0.250000f, 0.062500f, 
-		-0.000000f, 0.000000f, 0.999999f, -0.000000f, -0.000000f, 1.000000f, 0.250000f, 0.500000f, 
-		-0.191342f, 0.195090f, 0.961939f, -0.191400f, 0.193900f, 0.962200f, 0.218750f, 0.562500f, 
-		-0.195091f, 0.000000f, 0.980785f, -0.195100f, -0.000000f, 0.980800f, 0.218750f, 0.500000f, 
-		-0.000000f, 0.980785f, 0.195090f, -0.000000f, 0.979600f, 0.201000f, 0.250000f, 0.937500f, 
-		0.000000f, 1.000000f, 0.000000f, -0.000000f, 1.000000f, -0.000000f, 0.234375f, 1.000000f, 
-		-0.038060f, 0.980785f, 0.191342f, -0.039200f, 0.979600f, 0.197100f, 0.218750f, 0.937500f, 
-		0.000000f, -1.000000f, 0.000000f, -0.000000f, -1.000000f, -0.000000f, 0.234375f, 0.000000f, 
-		-0.000000f, -0.980785f, 0.195090f, -0.000000f, -0.979600f, 0.201000f, 0.250000f, 0.062500f, 
-		-0.038060f, -0.980785f, 0.191342f, -0.039200f, -0.979600f, 0.197100f, 0.218750f, 0.062500f, 
-		-0.000000f, 0.000000f, 0.999999f, -0.000000f, -0.000000f, 1.000000f, 0.250000f, 0.500000f, 
-		-0.191342f, -0.195090f, 0.961939f, -0.191400f, -0.193900f, 0.962200f, 0.218750f, 0.437500f, 
-		-0.000000f, -0.195090f, 0.980785f, -0.000000f, -0.193900f, 0.981000f, 0.250000f, 0.437500f, 
-		-0.162212f, 0.555570f, 0.815493f, -0.162600f, 0.552800f, 0.817300f, 0.218750f, 0.687500f, 
-		-0.353553f, 0.382683f, 0.853553f, -0.353900f, 0.380500f, 0.854400f, 0.187500f, 0.625000f, 
-		-0.180240f, 0.382683f, 0.906127f, -0.180400f, 0.380500f, 0.907000f, 0.218750f, 0.625000f, 
-		-0.108386f, -0.831470f, 0.544895f, -0.109200f, -0.828600f, 0.549000f, 0.218750f, 0.187500f, 
-		-0.146447f, -0.923880f, 0.353553f, -0.148400f, -0.921700f, 0.358400f, 0.187500f, 0.125000f, 
-		-0.074658f, -0.923880f, 0.375330f, -0.075700f, -0.921700f, 0.380400f, 0.218750f, 0.125000f, 
-		-0.191342f, 0.195090f, 0.961939f, -0.191400f, 0.193900f, 0.962200f, 0.218750f, 0.562500f, 
-		-0.353553f, 0.382683f, 0.853553f, -0.353900f, 0.380500f, 0.854400f, 0.187500f, 0.625000f, 
-		-0.375330f, 0.195090f, 0.906127f, -0.375400f, 0.193900f, 0.906300f, 0.187500f, 0.562500f, 
-		-0.074658f, -0.923880f, 0.375330f, -0.075700f, -0.921700f, 0.380400f, 0.218750f, 0.125000f, 
-		-0.074658f, -0.980785f, 0.180240f, -0.076900f, -0.979600f, 0.185700f, 0.187500f, 0.062500f, 
-		-0.038060f, -0.980785f, 0.191342f, -0.039200f, -0.979600f, 0.197100f, 0.218750f, 0.062500f, 
-		-0.195091f, 0.000000f, 0.980785f, -0.195100f, -0.000000f, 0.980800f, 0.218750f, 0.500000f, 
-		-0.375330f, 0.195090f, 0.906127f, -0.375400f, 0.193900f, 0.906300f, 0.187500f, 0.562500f, 
-		-0.382683f, 0.000000f, 0.923879f, -0.382700f, -0.000000f, 0.923900f, 0.187500f, 0.500000f, 
-		-0.038060f, 0.980785f, 0.191342f, -0.039200f, 0.979600f, 0.197100f, 0.218750f, 0.937500f, 
-		0.000000f, 1.000000f, 0.000000f, -0.000000f, 1.000000f, -0.000000f, 0.203125f, 1.000000f, 
-		-0.074658f, 0.980785f, 0.180240f, -0.076900f, 0.979600f, 0.185700f, 0.187500f, 0.937500f, 
-		0.000000f, -1.000000f, 0.000000f, -0.000000f, -1.000000f, -0.000000f, 0.203125f, 0.000000f, 
-		-0.038060f, -0.980785f, 0.191342f, -0.039200f, -0.979600f, 0.197100f, 0.218750f, 0.062500f, 
-		-0.074658f, -0.980785f, 0.180240f, -0.076900f, -0.979600f, 0.185700f, 0.187500f, 0.062500f, 
-		-0.195091f, 0.000000f, 0.980785f, -0.195100f, -0.000000f, 0.980800f, 0.218750f, 0.500000f, 
-		-0.375330f, -0.195090f, 0.906127f, -0.375400f, -0.193900f, 0.906300f, 0.187500f, 0.437500f, 
-		-0.191342f, -0.195090f, 0.961939f, -0.191400f, -0.193900f, 0.962200f, 0.218750f, 0.437500f, 
-		-0.074658f, 0.923880f, 0.375330f, -0.075700f, 0.921700f, 0.380400f, 0.218750f, 0.875000f, 
-		-0.074658f, 0.980785f, 0.180240f, -0.076900f, 0.979600f, 0.185700f, 0.187500f, 0.937500f, 
-		-0.146447f, 0.923880f, 0.353553f, -0.148400f, 0.921700f, 0.358400f, 0.187500f, 0.875000f, 
-		-0.191342f, -0.195090f, 0.961939f, -0.191400f, -0.193900f, 0.962200f, 0.218750f, 0.437500f, 
-		-0.353553f, -0.382683f, 0.853553f, -0.353900f, -0.380500f, 0.854400f, 0.187500f, 0.375000f, 
-		-0.180240f, -0.382683f, 0.906127f, -0.180400f, -0.380500f, 0.907000f, 0.218750f, 0.375000f, 
-		-0.074658f, 0.923880f, 0.375330f, -0.075700f, 0.921700f, 0.380400f, 0.218750f, 0.875000f, 
-		-0.212608f, 0.831470f, 0.513280f, -0.214200f, 0.828600f, 0.517200f, 0.187500f, 0.812500f, 
-		-0.108386f, 0.831470f, 0.544895f, -0.109200f, 0.828600f, 0.549000f, 0.218750f, 0.812500f, 
-		-0.162212f, -0.555570f, 0.815493f, -0.162600f, -0.552800f, 0.817300f, 0.218750f, 0.312500f, 
-		-0.353553f, -0.382683f, 0.853553f, -0.353900f, -0.380500f, 0.854400f, 0.187500f, 0.375000f, 
-		-0.318190f, -0.555570f, 0.768177f, -0.318900f, -0.552800f, 0.769900f, 0.187500f, 0.312500f, 
-		-0.108386f, 0.831470f, 0.544895f, -0.109200f, 0.828600f, 0.549000f, 0.218750f, 0.812500f, 
-		-0.270598f, 0.707107f, 0.653281f, -0.271800f, 0.704100f, 0.656100f, 0.187500f, 0.750000f, 
-		-0.137950f, 0.707107f, 0.693520f, -0.138500f, 0.704100f, 0.696500f, 0.218750f, 0.750000f, 
-		-0.162212f, -0.555570f, 0.815493f, -0.162600f, -0.552800f, 0.817300f, 0.218750f, 0.312500f, 
-		-0.270598f, -0.707107f, 0.653281f, -0.271800f, -0.704100f, 0.656100f, 0.187500f, 0.250000f, 
-		-0.137950f, -0.707107f, 0.693520f, -0.138500f, -0.704100f, 0.696500f, 0.218750f, 0.250000f, 
-		-0.162212f, 0.555570f, 0.815493f, -0.162600f, 0.552800f, 0.817300f, 0.218750f, 0.687500f, 
-		-0.270598f, 0.707107f, 0.653281f, -0.271800f, 0.704100f, 0.656100f, 0.187500f, 0.750000f, 
-		-0.318190f, 0.555570f, 0.768177f, -0.318900f, 0.552800f, 0.769900f, 0.187500f, 0.687500f, 
-		-0.108386f, -0.831470f, 0.544895f, -0.109200f, -0.828600f, 0.549000f, 0.218750f, 0.187500f, 
-		-0.270598f, -0.707107f, 0.653281f, -0.271800f, -0.704100f, 0.656100f, 0.187500f, 0.250000f, 
-		-0.212608f, -0.831470f, 0.513280f, -0.214200f, -0.828600f, 0.517200f, 0.187500f, 0.187500f, 
-		-0.375330f, -0.195090f, 0.906127f, -0.375400f, -0.193900f, 0.906300f, 0.187500f, 0.437500f, 
-		-0.513280f, -0.382683f, 0.768178f, -0.513800f, -0.380500f, 0.768900f, 0.156250f, 0.375000f, 
-		-0.353553f, -0.382683f, 0.853553f, -0.353900f, -0.380500f, 0.854400f, 0.187500f, 0.375000f, 
-		-0.146447f, 0.923880f, 0.353553f, -0.148400f, 0.921700f, 0.358400f, 0.187500f, 0.875000f, 
-		-0.308658f, 0.831470f, 0.461939f, -0.311000f, 0.828600f, 0.465400f, 0.156250f, 0.812500f, 
-		-0.212608f, 0.831470f, 0.513280f, -0.214200f, 0.828600f, 0.517200f, 0.187500f, 0.812500f, 
-		-0.318190f, -0.555570f, 0.768177f, -0.318900f, -0.552800f, 0.769900f, 0.187500f, 0.312500f, 
-		-0.513280f, -0.382683f, 0.768178f, -0.513800f, -0.380500f, 0.768900f, 0.156250f, 0.375000f, 
-		-0.461940f, -0.555570f, 0.691341f, -0.463000f, -0.552800f, 0.692900f, 0.156250f, 0.312500f, 
-		-0.212608f, 0.831470f, 0.513280f, -0.214200f, 0.828600f, 0.517200f, 0.187500f, 0.812500f, 
-		-0.392847f, 0.707107f, 0.587938f, -0.394500f, 0.704100f, 0.590500f, 0.156250f, 0.750000f, 
-		-0.270598f, 0.707107f, 0.653281f, -0.271800f, 0.704100f, 0.656100f, 0.187500f, 0.750000f, 
-		-0.318190f, -0.555570f, 0.768177f, -0.318900f, -0.552800f, 0.769900f, 0.187500f, 0.312500f, 
-		-0.392847f, -0.707107f, 0.587938f, -0.394500f, -0.704100f, 0.590500f, 0.156250f, 0.250000f, 
-		-0.270598f, -0.707107f, 0.653281f, -0.271800f, -0.704100f, 0.656100f, 0.187500f, 0.250000f, 
-		-0.318190f, 0.555570f, 0.768177f, -0.318900f, 0.552800f, 0.769900f, 0.187500f, 0.687500f, 
-		-0.392847f, 0.707107f, 0.587938f, -0.394500f, 0.704100f, 0.590500f, 0.156250f, 0.750000f, 
-		-0.461940f, 0.555570f, 0.691341f, -0.463000f, 0.552800f, 0.692900f, 0.156250f, 0.687500f, 
-		-0.212608f, -0.831470f, 0.513280f, -0.214200f, -0.828600f, 0.517200f, 0.187500f, 0.187500f, 
-		-0.392847f, -0.707107f, 0.587938f, -0.394500f, -0.704100f, 0.590500f, 0.156250f, 0.250000f, 
-		-0.308658f, -0.831470f, 0.461939f, -0.311000f, -0.828600f, 0.465400f, 0.156250f, 0.187500f, 
-		-0.318190f, 0.555570f, 0.768177f, -0.318900f, 0.552800f, 0.769900f, 0.187500f, 0.687500f, 
-		-0.513280f, 0.382683f, 0.768178f, -0.513800f, 0.380500f, 0.768900f, 0.156250f, 0.625000f, 
-		-0.353553f, 0.382683f, 0.853553f, -0.353900f, 0.380500f, 0.854400f, 0.187500f, 0.625000f, 
-		-0.212608f, -0.831470f, 0.513280f, -0.214200f, -0.828600f, 0.517200f, 0.187500f, 0.187500f, 
-		-0.212608f, -0.923880f, 0.318190f, -0.215500f, -0.921700f, 0.322500f, 0.156250f, 0.125000f, 
-		-0.146447f, -0.923880f, 0.353553f, -0.148400f, -0.921700f, 0.358400f, 0.187500f, 0.125000f, 
-		-0.375330f, 0.195090f, 0.906127f, -0.375400f, 0.193900f, 0.906300f, 0.187500f, 0.562500f, 
-		-0.513280f, 0.382683f, 0.768178f, -0.513800f, 0.380500f, 0.768900f, 0.156250f, 0.625000f, 
-		-0.544895f, 0.195090f, 0.815493f, -0.545000f, 0.193900f, 0.815700f, 0.156250f, 0.562500f, 
-		-0.074658f, -0.980785f, 0.180240f, -0.076900f, -0.979600f, 0.185700f, 0.187500f, 0.062500f, 
-		-0.212608f, -0.923880f, 0.318190f, -0.215500f, -0.921700f, 0.322500f, 0.156250f, 0.125000f, 
-		-0.108386f, -0.980785f, 0.162212f, -0.111700f, -0.979600f, 0.167100f, 0.156250f, 0.062500f, 
-		-0.382683f, 0.000000f, 0.923879f, -0.382700f, -0.000000f, 0.923900f, 0.187500f, 0.500000f, 
-		-0.544895f, 0.195090f, 0.815493f, -0.545000f, 0.193900f, 0.815700f, 0.156250f, 0.562500f, 
-		-0.555570f, 0.000000f, 0.831469f, -0.555600f, -0.000000f, 0.831500f, 0.156250f, 0.500000f, 
-		-0.074658f, 0.980785f, 0.180240f, -0.076900f, 0.979600f, 0.185700f, 0.187500f, 0.937500f, 
-		0.000000f, 1.000000f, 0.000000f, -0.000000f, 1.000000f, -0.000000f, 0.171875f, 1.000000f, 
-		-0.108386f, 0.980785f, 0.162212f, -0.111700f, 0.979600f, 0.167100f, 0.156250f, 0.937500f, 
-		0.000000f, -1.000000f, 0.000000f, -0.000000f, -1.000000f, -0.000000f, 0.171875f, 0.000000f, 
-		-0.074658f, -0.980785f, 0.180240f, -0.076900f, -0.979600f, 0.185700f, 0.187500f, 0.062500f, 
-		-0.108386f, -0.980785f, 0.162212f, -0.111700f, -0.979600f, 0.167100f, 0.156250f, 0.062500f, 
-		-0.382683f, 0.000000f, 0.923879f, -0.382700f, -0.000000f, 0.923900f, 0.187500f, 0.500000f, 
-		-0.544895f, -0.195090f, 0.815493f, -0.545000f, -0.193900f, 0.815700f, 0.156250f, 0.437500f, 
-		-0.375330f, -0.195090f, 0.906127f, -0.375400f, -0.193900f, 0.906300f, 0.187500f, 0.437500f, 
-		-0.146447f, 0.923880f, 0.353553f, -0.148400f, 0.921700f, 0.358400f, 0.187500f, 0.875000f, 
-		-0.108386f, 0.980785f, 0.162212f, -0.111700f, 0.979600f, 0.167100f, 0.156250f, 0.937500f, 
-		-0.212608f, 0.923880f, 0.318190f, -0.215500f, 0.921700f, 0.322500f, 0.156250f, 0.875000f, 
-		-0.308658f, -0.831470f, 0.461939f, -0.311000f, -0.828600f, 0.465400f, 0.156250f, 0.187500f, 
-		-0.270598f, -0.923880f, 0.270598f, -0.274300f, -0.921700f, 0.274300f, 0.125000f, 0.125000f, 
-		-0.212608f, -0.923880f, 0.318190f, -0.215500f, -0.921700f, 0.322500f, 0.156250f, 0.125000f, 
-		-0.544895f, 0.195090f, 0.815493f, -0.545000f, 0.193900f, 0.815700f, 0.156250f, 0.562500f, 
-		-0.653281f, 0.382683f, 0.653281f, -0.653900f, 0.380500f, 0.653900f, 0.125000f, 0.625000f, 
-		-0.693520f, 0.195090f, 0.693520f, -0.693700f, 0.193900f, 0.693700f, 0.125000f, 0.562500f, 
-		-0.108386f, -0.980785f, 0.162212f, -0.111700f, -0.979600f, 0.167100f, 0.156250f, 0.062500f, 
-		-0.270598f, -0.923880f, 0.270598f, -0.274300f, -0.921700f, 0.274300f, 0.125000f, 0.125000f, 
-		-0.137950f, -0.980785f, 0.137950f, -0.142100f, -0.979600f, 0.142100f, 0.125000f, 0.062500f, 
-		-0.555570f, 0.000000f, 0.831469f, -0.555600f, -0.000000f, 0.831500f, 0.156250f, 0.500000f, 
-		-0.693520f, 0.195090f, 0.693520f, -0.693700f, 0.193900f, 0.693700f, 0.125000f, 0.562500f, 
-		-0.707106f, 0.000000f, 0.707106f, -0.707100f, -0.000000f, 0.707100f, 0.125000f, 0.500000f, 
-		-0.108386f, 0.980785f, 0.162212f, -0.111700f, 0.979600f, 0.167100f, 0.156250f, 0.937500f, 
-		0.000000f, 1.000000f, 0.000000f, -0.000000f, 1.000000f, -0.000000f, 0.140625f, 1.000000f, 
-		-0.137950f, 0.980785f, 0.137950f, -0.142100f, 0.979600f, 0.142100f, 0.125000f, 0.937500f, 
-		0.000000f, -1.000000f, 0.000000f, -0.000000f, -1.000000f, -0.000000f, 0.140625f, 0.000000f, 
-		-0.108386f, -0.980785f, 0.162212f, -0.111700f, -0.979600f, 0.167100f, 0.156250f, 0.062500f, 
-		-0.137950f, -0.980785f, 0.137950f, -0.142100f, -0.979600f, 0.142100f, 0.125000f, 0.062500f, 
-		-0.555570f, 0.000000f, 0.831469f, -0.555600f, -0.000000f, 0.831500f, 0.156250f, 0.500000f, 
-		-0.693520f, -0.195090f, 0.693520f, -0.693700f, -0.193900f, 0.693700f, 0.125000f, 0.437500f, 
-		-0.544895f, -0.195090f, 0.815493f, -0.545000f, -0.193900f, 0.815700f, 0.156250f, 0.437500f, 
-		-0.108386f, 0.980785f, 0.162212f, -0.111700f, 0.979600f, 0.167100f, 0.156250f, 0.937500f, 
-		-0.270598f, 0.923880f, 0.270598f, -0.274300f, 0.921700f, 0.274300f, 0.125000f, 0.875000f, 
-		-0.212608f, 0.923880f, 0.318190f, -0.215500f, 0.921700f, 0.322500f, 0.156250f, 0.875000f, 
-		-0.544895f, -0.195090f, 0.815493f, -0.545000f, -0.193900f, 0.815700f, 0.156250f, 0.437500f, 
-		-0.653281f, -0.382683f, 0.653281f, -0.653900f, -0.380500f, 0.653900f, 0.125000f, 0.375000f, 
-		-0.513280f, -0.382683f, 0.768178f, -0.513800f, -0.380500f, 0.768900f, 0.156250f, 0.375000f, 
-		-0.212608f, 0.923880f, 0.318190f, -0.215500f, 0.921700f, 0.322500f, 0.156250f, 0.875000f, 
-		-0.392847f, 0.831470f, 0.392847f, -0.395800f, 0.828600f, 0.395800f, 0.125000f, 0.812500f, 
-		-0.308658f, 0.831470f, 0.461939f, -0.311000f, 0.828600f, 0.465400f, 0.156250f, 0.812500f, 
-		-0.461940f, -0.555570f, 0.691341f, -0.463000f, -0.552800f, 0.692900f, 0.156250f, 0.312500f, 
-		-0.653281f, -0.382683f, 0.653281f, -0.653900f, -0.380500f, 0.653900f, 0.125000f, 0.375000f, 
-		-0.587938f, -0.555570f, 0.587937f, -0.589300f, -0.552800f, 0.589300f, 0.125000f, 0.312500f, 
-		-0.308658f, 0.831470f, 0.461939f, -0.311000f, 0.828600f, 0.465400f, 0.156250f, 0.812500f, 
-		-0.500000f, 0.707107f, 0.500000f, -0.502100f, 0.704100f, 0.502100f, 0.125000f, 0.750000f, 
-		-0.392847f, 0.707107f, 0.587938f, -0.394500f, 0.704100f, 0.590500f, 0.156250f, 0.750000f, 
-		-0.461940f, -0.555570f, 0.691341f, -0.463000f, -0.552800f, 0.692900f, 0.156250f, 0.312500f, 
-		-0.500000f, -0.707107f, 0.500000f, -0.502100f, -0.704100f, 0.502100f, 0.125000f, 0.250000f, 
-		-0.392847f, -0.707107f, 0.587938f, -0.394500f, -0.704100f, 0.590500f, 0.156250f, 0.250000f, 
-		-0.461940f, 0.555570f, 0.691341f, -0.463000f, 0.552800f, 0.692900f, 0.156250f, 0.687500f, 
-		-0.500000f, 0.707107f, 0.500000f, -0.502100f, 0.704100f, 0.502100f, 0.125000f, 0.750000f, 
-		-0.587938f, 0.555570f, 0.587937f, -0.589300f, 0.552800f, 0.589300f, 0.125000f, 0.687500f, 
-		-0.308658f, -0.831470f, 0.461939f, -0.311000f, -0.828600f, 0.465400f, 0.156250f, 0.187500f, 
-		-0.500000f, -0.707107f, 0.500000f, -0.502100f, -0.704100f, 0.502100f, 0.125000f, 0.250000f, 
-		-0.392847f, -0.831470f, 0.392847f, -0.395800f, -0.828600f, 0.395800f, 0.125000f, 0.187500f, 
-		-0.461940f, 0.555570f, 0.691341f, -0.463000f, 0.552800f, 0.692900f, 0.156250f, 0.687500f, 
-		-0.653281f, 0.382683f, 0.653281f, -0.653900f, 0.380500f, 0.653900f, 0.125000f, 0.625000f, 
-		-0.513280f, 0.382683f, 0.768178f, -0.513800f, 0.380500f, 0.768900f, 0.156250f, 0.625000f, 
-		-0.587938f, -0.555570f, 0.587937f, -0.589300f, -0.552800f, 0.589300f, 0.125000f, 0.312500f, 
-		-0.768177f, -0.382683f, 0.513280f, -0.768900f, -0.380500f, 0.513800f, 0.093750f, 0.375000f, 
-		-0.691341f, -0.555570f, 0.461939f, -0.692900f, -0.552800f, 0.463000f, 0.093750f, 0.312500f, 
-		-0.392847f, 0.831470f, 0.392847f, -0.395800f, 0.828600f, 0.395800f, 0.125000f, 0.812500f, 
-		-0.587938f, 0.707107f, 0.392847f, -0.590500f, 0.704100f, 0.394500f, 0.093750f, 0.750000f, 
-		-0.500000f, 0.707107f, 0.500000f, -0.502100f, 0.704100f, 0.502100f, 0.125000f, 0.750000f, 
-		-0.587938f, -0.555570f, 0.587937f, -0.589300f, -0.552800f, 0.589300f, 0.125000f, 0.312500f, 
-		-0.587938f, -0.707107f, 0.392847f, -0.590500f, -0.704100f, 0.394500f, 0.093750f, 0.250000f, 
-		-0.500000f, -0.707107f, 0.500000f, -0.502100f, -0.704100f, 0.502100f, 0.125000f, 0.250000f, 
-		-0.587938f, 0.555570f, 0.587937f, -0.589300f, 0.552800f, 0.589300f, 0.125000f, 0.687500f, 
-		-0.587938f, 0.707107f, 0.392847f, -0.590500f, 0.704100f, 0.394500f, 0.093750f, 0.750000f, 
-		-0.691341f, 0.555570f, 0.461939f, -0.692900f, 0.552800f, 0.463000f, 0.093750f, 0.687500f, 
-		-0.392847f, -0.831470f, 0.392847f, -0.395800f, -0.828600f, 0.395800f, 0.125000f, 0.187500f, 
-		-0.587938f, -0.707107f, 0.392847f, -0.590500f, -0.704100f, 0.394500f, 0.093750f, 0.250000f, 
-		-0.461940f, -0.831470f, 0.308658f, -0.465400f, -0.828600f, 0.311000f, 0.093750f, 0.187500f, 
-		-0.587938f, 0.555570f, 0.587937f, -0.589300f, 0.552800f, 0.589300f, 0.125000f, 0.687500f, 
-		-0.768177f, 0.382683f, 0.513280f, -0.768900f, 0.380500f, 0.513800f, 0.093750f, 0.625000f, 
-		-0.653281f, 0.382683f, 0.653281f, -0.653900f, 0.380500f, 0.653900f, 0.125000f, 0.625000f, 
-		-0.392847f, -0.831470f, 0.392847f, -0.395800f, -0.828600f, 0.395800f, 0.125000f, 0.187500f, 
-		-0.318190f, -0.923880f, 0.212607f, -0.322500f, -0.921700f, 0.215500f, 0.093750f, 0.125000f, 
-		-0.270598f, -0.923880f, 0.270598f, -0.274300f, -0.921700f, 0.274300f, 0.125000f, 0.125000f, 
-		-0.693520f, 0.195090f, 0.693520f, -0.693700f, 0.193900f, 0.693700f, 0.125000f, 0.562500f, 
-		-0.768177f, 0.382683f, 0.513280f, -0.768900f, 0.380500f, 0.513800f, 0.093750f, 0.625000f, 
-		-0.815493f, 0.195090f, 0.544895f, -0.815700f, 0.193900f, 0.545000f, 0.093750f, 0.562500f, 
-		-0.270598f, -0.923880f, 0.270598f, -0.274300f, -0.921700f, 0.274300f, 0.125000f, 0.125000f, 
-		-0.162212f, -0.980785f, 0.108386f, -0.167100f, -0.979600f, 0.111700f, 0.093750f, 0.062500f, 
-		-0.137950f, -0.980785f, 0.137950f, -0.142100f, -0.979600f, 0.142100f, 0.125000f, 0.062500f, 
-		-0.707106f, 0.000000f, 0.707106f, -0.707100f, -0.000000f, 0.707100f, 0.125000f, 0.500000f, 
-		-0.815493f, 0.195090f, 0.544895f, -0.815700f, 0.193900f, 0.545000f, 0.093750f, 0.562500f, 
-		-0.831469f, 0.000000f, 0.555569f, -0.831500f, -0.000000f, 0.555600f, 0.093750f, 0.500000f, 
-		-0.137950f, 0.980785f, 0.137950f, -0.142100f, 0.979600f, 0.142100f, 0.125000f, 0.937500f, 
-		0.000000f, 1.000000f, 0.000000f, -0.000000f, 1.000000f, -0.000000f, 0.109375f, 1.000000f, 
-		-0.162212f, 0.980785f, 0.108386f, -0.167100f, 0.979600f, 0.111700f, 0.093750f, 0.937500f, 
-		0.000000f, -1.000000f, 0.000000f, -0.000000f, -1.000000f, -0.000000f, 0.109375f, 0.000000f, 
-		-0.137950f, -0.980785f, 0.137950f, -0.142100f, -0.979600f, 0.142100f, 0.125000f, 0.062500f, 
-		-0.162212f, -0.980785f, 0.108386f, -0.167100f, -0.979600f, 0.111700f, 0.093750f, 0.062500f, 
-		-0.707106f, 0.000000f, 0.707106f, -0.707100f, -0.000000f, 0.707100f, 0.125000f, 0.500000f, 
-		-0.815493f, -0.195090f, 0.544895f, -0.815700f, -0.193900f, 0.545000f, 0.093750f, 0.437500f, 
-		-0.693520f, -0.195090f, 0.693520f, -0.693700f, -0.193900f, 0.693700f, 0.125000f, 0.437500f, 
-		-0.137950f, 0.980785f, 0.137950f, -0.142100f, 0.979600f, 0.142100f, 0.125000f, 0.937500f, 
-		-0.318190f, 0.923880f, 0.212607f, -0.322500f, 0.921700f, 0.215500f, 0.093750f, 0.875000f, 
-		-0.270598f, 0.923880f, 0.270598f, -0.274300f, 0.921700f, 0.274300f, 0.125000f, 0.875000f, 
-		-0.693520f, -0.195090f, 0.693520f, -0.693700f, -0.193900f, 0.693700f, 0.125000f, 0.437500f, 
-		-0.768177f, -0.382683f, 0.513280f, -0.768900f, -0.380500f, 0.513800f, 0.093750f, 0.375000f, 
-		-0.653281f, -0.382683f, 0.653281f, -0.653900f, -0.380500f, 0.653900f, 0.125000f, 0.375000f, 
-		-0.270598f, 0.923880f, 0.270598f, -0.274300f, 0.921700f, 0.274300f, 0.125000f, 0.875000f, 
-		-0.461940f, 0.831470f, 0.308658f, -0.465400f, 0.828600f, 0.311000f, 0.093750f, 0.812500f, 
-		-0.392847f, 0.831470f, 0.392847f, -0.395800f, 0.828600f, 0.395800f, 0.125000f, 0.812500f, 
-		-0.318190f, -0.923880f, 0.212607f, -0.322500f, -0.921700f, 0.215500f, 0.093750f, 0.125000f, 
-		-0.180240f, -0.980785f, 0.074658f, -0.185700f, -0.979600f, 0.076900f, 0.062500f, 0.062500f, 
-		-0.162212f, -0.980785f, 0.108386f, -0.167100f, -0.979600f, 0.111700f, 0.093750f, 0.062500f, 
-		-0.831469f, 0.000000f, 0.555569f, -0.831500f, -0.000000f, 0.555600f, 0.093750f, 0.500000f, 
-		-0.906127f, 0.195090f, 0.375330f, -0.906300f, 0.193900f, 0.375400f, 0.062500f, 0.562500f, 
-		-0.923879f, 0.000000f, 0.382683f, -0.923900f, -0.000000f, 0.382700f, 0.062500f, 0.500000f, 
-		-0.162212f, 0.980785f, 0.108386f, -0.167100f, 0.979600f, 0.111700f, 0.093750f, 0.937500f, 
-		0.000000f, 1.000000f, 0.000000f, -0.000000f, 1.000000f, -0.000000f, 0.078125f, 1.000000f, 
-		-0.180240f, 0.980785f, 0.074658f, -0.185700f, 0.979600f, 0.076900f, 0.062500f, 0.937500f, 
-		0.000000f, -1.000000f, 0.000000f, -0.000000f, -1.000000f, -0.000000f, 0.078125f, 0.000000f, 
-		-0.162212f, -0.980785f, 0.108386f, -0.167100f, -0.979600f, 0.111700f, 0.093750f, 0.062500f, 
-		-0.180240f, -0.980785f, 0.074658f, -0.185700f, -0.979600f, 0.076900f, 0.062500f, 0.062500f, 
-		-0.831469f, 0.000000f, 0.555569f, -0.831500f, -0.000000f, 0.555600f, 0.093750f, 0.500000f, 
-		-0.906127f, -0.195090f, 0.375330f, -0.906300f, -0.193900f, 0.375400f, 0.062500f, 0.437500f, 
-		-0.815493f, -0.195090f, 0.544895f, -0.815700f, -0.193900f, 0.545000f, 0.093750f, 0.437500f, 
-		-0.162212f, 0.980785f, 0.108386f, -0.167100f, 0.979600f, 0.111700f, 0.093750f, 0.937500f, 
-		-0.353553f, 0.923880f, 0.146447f, -0.358400f, 0.921700f, 0.148400f, 0.062500f, 0.875000f, 
-		-0.318190f, 0.923880f, 0.212607f, -0.322500f, 0.921700f, 0.215500f, 0.093750f, 0.875000f, 
-		-0.815493f, -0.195090f, 0.544895f, -0.815700f, -0.193900f, 0.545000f, 0.093750f, 0.437500f, 
-		-0.853553f, -0.382683f, 0.353553f, -0.854400f, -0.380500f, 0.353900f, 0.062500f, 0.375000f, 
-		-0.768177f, -0.382683f, 0.513280f, -0.768900f, -0.380500f, 0.513800f, 0.093750f, 0.375000f, 
-		-0.318190f, 0.923880f, 0.212607f, -0.322500f, 0.921700f, 0.215500f, 0.093750f, 0.875000f, 
-		-0.513280f, 0.831470f, 0.212607f, -0.517200f, 0.828600f, 0.214200f, 0.062500f, 0.812500f, 
-		-0.461940f, 0.831470f, 0.308658f, -0.465400f, 0.828600f, 0.311000f, 0.093750f, 0.812500f, 
-		-0.691341f, -0.555570f, 0.461939f, -0.692900f, -0.552800f, 0.463000f, 0.093750f, 0.312500f, 
-		-0.853553f, -0.382683f, 0.353553f, -0.854400f, -0.380500f, 0.353900f, 0.062500f, 0.375000f, 
-		-0.768177f, -0.555570f, 0.318189f, -0.769900f, -0.552800f, 0.318900f, 0.062500f, 0.312500f, 
-		-0.461940f, 0.831470f, 0.308658f, -0.465400f, 0.828600f, 0.311000f, 0.093750f, 0.812500f, 
-		-0.653281f, 0.707107f, 0.270598f, -0.656100f, 0.704100f, 0.271800f, 0.062500f, 0.750000f, 
-		-0.587938f, 0.707107f, 0.392847f, -0.590500f, 0.704100f, 0.394500f, 0.093750f, 0.750000f, 
-		-0.691341f, -0.555570f, 0.461939f, -0.692900f, -0.552800f, 0.463000f, 0.093750f, 0.312500f, 
-		-0.653281f, -0.707107f, 0.270598f, -0.656100f, -0.704100f, 0.271800f, 0.062500f, 0.250000f, 
-		-0.587938f, -0.707107f, 0.392847f, -0.590500f, -0.704100f, 0.394500f, 0.093750f, 0.250000f, 
-		-0.587938f, 0.707107f, 0.392847f, -0.590500f, 0.704100f, 0.394500f, 0.093750f, 0.750000f, 
-		-0.768177f, 0.555570f, 0.318189f, -0.769900f, 0.552800f, 0.318900f, 0.062500f, 0.687500f, 
-		-0.691341f, 0.555570f, 0.461939f, -0.692900f, 0.552800f, 0.463000f, 0.093750f, 0.687500f, 
-		-0.461940f, -0.831470f, 0.308658f, -0.465400f, -0.828600f, 0.311000f, 0.093750f, 0.187500f, 
-		-0.653281f, -0.707107f, 0.270598f, -0.656100f, -0.704100f, 0.271800f, 0.062500f, 0.250000f, 
-		-0.513280f, -0.831470f, 0.212607f, -0.517200f, -0.828600f, 0.214200f, 0.062500f, 0.187500f, 
-		-0.691341f, 0.555570f, 0.461939f, -0.692900f, 0.552800f, 0.463000f, 0.093750f, 0.687500f, 
-		-0.853553f, 0.382683f, 0.353553f, -0.854400f, 0.380500f, 0.353900f, 0.062500f, 0.625000f, 
-		-0.768177f, 0.382683f, 0.513280f, -0.768900f, 0.380500f, 0.513800f, 0.093750f, 0.625000f, 
-		-0.461940f, -0.831470f, 0.308658f, -0.465400f, -0.828600f, 0.311000f, 0.093750f, 0.187500f, 
-		-0.353553f, -0.923880f, 0.146447f, -0.358400f, -0.921700f, 0.148400f, 0.062500f, 0.125000f, 
-		-0.318190f, -0.923880f, 0.212607f, -0.322500f, -0.921700f, 0.215500f, 0.093750f, 0.125000f, 
-		-0.815493f, 0.195090f, 0.544895f, -0.815700f, 0.193900f, 0.545000f, 0.093750f, 0.562500f, 
-		-0.853553f, 0.382683f, 0.353553f, -0.854400f, 0.380500f, 0.353900f, 0.062500f, 0.625000f, 
-		-0.906127f, 0.195090f, 0.375330f, -0.906300f, 0.193900f, 0.375400f, 0.062500f, 0.562500f, 
-		-0.513280f, 0.831470f, 0.212607f, -0.517200f, 0.828600f, 0.214200f, 0.062500f, 0.812500f, 
-		-0.693520f, 0.707107f, 0.137950f, -0.696500f, 0.704100f, 0.138500f, 0.031250f, 0.750000f, 
-		-0.653281f, 0.707107f, 0.270598f, -0.656100f, 0.704100f, 0.271800f, 0.062500f, 0.750000f, 
-		-0.768177f, -0.555570f, 0.318189f, -0.769900f, -0.552800f, 0.318900f, 0.062500f, 0.312500f, 
-		-0.693520f, -0.707107f, 0.137950f, -0.696500f, -0.704100f, 0.138500f, 0.031250f, 0.250000f, 
-		-0.653281f, -0.707107f, 0.270598f, -0.656100f, -0.704100f, 0.271800f, 0.062500f, 0.250000f, 
-		-0.768177f, 0.555570f, 0.318189f, -0.769900f, 0.552800f, 0.318900f, 0.062500f, 0.687500f, 
-		-0.693520f, 0.707107f, 0.137950f, -0.696500f, 0.704100f, 0.138500f, 0.031250f, 0.750000f, 
-		-0.815493f, 0.555570f, 0.162211f, -0.817300f, 0.552800f, 0.162600f, 0.031250f, 0.687500f, 
-		-0.513280f, -0.831470f, 0.212607f, -0.517200f, -0.828600f, 0.214200f, 0.062500f, 0.187500f, 
-		-0.693520f, -0.707107f, 0.137950f, -0.696500f, -0.704100f, 0.138500f, 0.031250f, 0.250000f, 
-		-0.544895f, -0.831470f, 0.108386f, -0.549000f, -0.828600f, 0.109200f, 0.031250f, 0.187500f, 
-		-0.768177f, 0.555570f, 0.318189f, -0.769900f, 0.552800f, 0.318900f, 0.062500f, 0.687500f, 
-		-0.906127f, 0.382683f, 0.180240f, -0.907000f, 0.380500f, 0.180400f, 0.031250f, 0.625000f, 
-		-0.853553f, 0.382683f, 0.353553f, -0.854400f, 0.380500f, 0.353900f, 0.062500f, 0.625000f, 
-		-0.513280f, -0.831470f, 0.212607f, -0.517200f, -0.828600f, 0.214200f, 0.062500f, 0.187500f, 
-		-0.375330f, -0.923880f, 0.074658f, -0.380400f, -0.921700f, 0.075700f, 0.031250f, 0.125000f, 
-		-0.353553f, -0.923880f, 0.146447f, -0.358400f, -0.921700f, 0.148400f, 0.062500f, 0.125000f, 
-		-0.906127f, 0.195090f, 0.375330f, -0.906300f, 0.193900f, 0.375400f, 0.062500f, 0.562500f, 
-		-0.906127f, 0.382683f, 0.180240f, -0.907000f, 0.380500f, 0.180400f, 0.031250f, 0.625000f, 
-		-0.961939f, 0.195090f, 0.191341f, -0.962200f, 0.193900f, 0.191400f, 0.031250f, 0.562500f, 
-		-0.353553f, -0.923880f, 0.146447f, -0.358400f, -0.921700f, 0.148400f, 0.062500f, 0.125000f, 
-		-0.191342f, -0.980785f, 0.038060f, -0.197100f, -0.979600f, 0.039200f, 0.031250f, 0.062500f, 
-		-0.180240f, -0.980785f, 0.074658f, -0.185700f, -0.979600f, 0.076900f, 0.062500f, 0.062500f, 
-		-0.923879f, 0.000000f, 0.382683f, -0.923900f, -0.000000f, 0.382700f, 0.062500f, 0.500000f, 
-		-0.961939f, 0.195090f, 0.191341f, -0.962200f, 0.193900f, 0.191400f, 0.031250f, 0.562500f, 
-		-0.980784f, 0.000000f, 0.195090f, -0.980800f, -0.000000f, 0.195100f, 0.031250f, 0.500000f, 
-		-0.180240f, 0.980785f, 0.074658f, -0.185700f, 0.979600f, 0.076900f, 0.062500f, 0.937500f, 
-		0.000000f, 1.000000f, 0.000000f, -0.000000f, 1.000000f, -0.000000f, 0.046875f, 1.000000f, 
-		-0.191342f, 0.980785f, 0.038060f, -0.197100f, 0.979600f, 0.039200f, 0.031250f, 0.937500f, 
-		0.000000f, -1.000000f, 0.000000f, -0.000000f, -1.000000f, -0.000000f, 0.046875f, 0.000000f, 
-		-0.180240f, -0.980785f, 0.074658f, -0.185700f, -0.979600f, 0.076900f, 0.062500f, 0.062500f, 
-		-0.191342f, -0.980785f, 0.038060f, -0.197100f, -0.979600f, 0.039200f, 0.031250f, 0.062500f, 
-		-0.923879f, 0.000000f, 0.382683f, -0.923900f, -0.000000f, 0.382700f, 0.062500f, 0.500000f, 
-		-0.961939f, -0.195090f, 0.191341f, -0.962200f, -0.193900f, 0.191400f, 0.031250f, 0.437500f, 
-		-0.906127f, -0.195090f, 0.375330f, -0.906300f, -0.193900f, 0.375400f, 0.062500f, 0.437500f, 
-		-0.180240f, 0.980785f, 0.074658f, -0.185700f, 0.979600f, 0.076900f, 0.062500f, 0.937500f, 
-		-0.375330f, 0.923880f, 0.074658f, -0.380400f, 0.921700f, 0.075700f, 0.031250f, 0.875000f, 
-		-0.353553f, 0.923880f, 0.146447f, -0.358400f, 0.921700f, 0.148400f, 0.062500f, 0.875000f, 
-		-0.906127f, -0.195090f, 0.375330f, -0.906300f, -0.193900f, 0.375400f, 0.062500f, 0.437500f, 
-		-0.906127f, -0.382683f, 0.180240f, -0.907000f, -0.380500f, 0.180400f, 0.031250f, 0.375000f, 
-		-0.853553f, -0.382683f, 0.353553f, -0.854400f, -0.380500f, 0.353900f, 0.062500f, 0.375000f, 
-		-0.353553f, 0.923880f, 0.146447f, -0.358400f, 0.921700f, 0.148400f, 0.062500f, 0.875000f, 
-		-0.544895f, 0.831470f, 0.108386f, -0.549000f, 0.828600f, 0.109200f, 0.031250f, 0.812500f, 
-		-0.513280f, 0.831470f, 0.212607f, -0.517200f, 0.828600f, 0.214200f, 0.062500f, 0.812500f, 
-		-0.768177f, -0.555570f, 0.318189f, -0.769900f, -0.552800f, 0.318900f, 0.062500f, 0.312500f, 
-		-0.906127f, -0.382683f, 0.180240f, -0.907000f, -0.380500f, 0.180400f, 0.031250f, 0.375000f, 
-		-0.815493f, -0.555570f, 0.162211f, -0.817300f, -0.552800f, 0.162600f, 0.031250f, 0.312500f, 
-		-0.980784f, 0.000000f, 0.195090f, -0.980800f, -0.000000f, 0.195100f, 0.031250f, 0.500000f, 
-		-0.980785f, 0.195090f, -0.000000f, -0.981000f, 0.193900f, -0.000000f, 0.000000f, 0.562500f, 
-		-0.999999f, 0.000000f, -0.000000f, -1.000000f, -0.000000f, -0.000000f, 0.000000f, 0.500000f, 
-		-0.191342f, 0.980785f, 0.038060f, -0.197100f, 0.979600f, 0.039200f, 0.031250f, 0.937500f, 
-		0.000000f, 1.000000f, 0.000000f, -0.000000f, 1.000000f, -0.000000f, 0.015625f, 1.000000f, 
-		-0.195090f, 0.980785f, -0.000000f, -0.201000f, 0.979600f, -0.000000f, 0.000000f, 0.937500f, 
-		0.000000f, -1.000000f, 0.000000f, -0.000000f, -1.000000f, -0.000000f, 0.015625f, 0.000000f, 
-		-0.191342f, -0.980785f, 0.038060f, -0.197100f, -0.979600f, 0.039200f, 0.031250f, 0.062500f, 
-		-0.195090f, -0.980785f, -0.000000f, -0.201000f, -0.979600f, -0.000000f, 0.000000f, 0.062500f, 
-		-0.980784f, 0.000000f, 0.195090f, -0.980800f, -0.000000f, 0.195100f, 0.031250f, 0.500000f, 
-		-0.980785f, -0.195090f, -0.000000f, -0.981000f, -0.193900f, -0.000000f, 0.000000f, 0.437500f, 
-		-0.961939f, -0.195090f, 0.191341f, -0.962200f, -0.193900f, 0.191400f, 0.031250f, 0.437500f, 
-		-0.191342f, 0.980785f, 0.038060f, -0.197100f, 0.979600f, 0.039200f, 0.031250f, 0.937500f, 
-		-0.382683f, 0.923880f, -0.000000f, -0.387900f, 0.921700f, -0.000000f, 0.000000f, 0.875000f, 
-		-0.375330f, 0.923880f, 0.074658f, -0.380400f, 0.921700f, 0.075700f, 0.031250f, 0.875000f, 
-		-0.961939f, -0.195090f, 0.191341f, -0.962200f, -0.193900f, 0.191400f, 0.031250f, 0.437500f, 
-		-0.923879f, -0.382683f, -0.000000f, -0.924800f, -0.380500f, -0.000000f, 0.000000f, 0.375000f, 
-		-0.906127f, -0.382683f, 0.180240f, -0.907000f, -0.380500f, 0.180400f, 0.031250f, 0.375000f, 
-		-0.544895f, 0.831470f, 0.108386f, -0.549000f, 0.828600f, 0.109200f, 0.031250f, 0.812500f, 
-		-0.382683f, 0.923880f, -0.000000f, -0.387900f, 0.921700f, -0.000000f, 0.000000f, 0.875000f, 
-		-0.555570f, 0.831470f, -0.000000f, -0.559800f, 0.828600f, -0.000000f, 0.000000f, 0.812500f, 
-		-0.815493f, -0.555570f, 0.162211f, -0.817300f, -0.552800f, 0.162600f, 0.031250f, 0.312500f, 
-		-0.923879f, -0.382683f, -0.000000f, -0.924800f, -0.380500f, -0.000000f, 0.000000f, 0.375000f, 
-		-0.831469f, -0.555570f, -0.000000f, -0.833300f, -0.552800f, -0.000000f, 0.000000f, 0.312500f, 
-		-0.544895f, 0.831470f, 0.108386f, -0.549000f, 0.828600f, 0.109200f, 0.031250f, 0.812500f, 
-		-0.707107f, 0.707107f, -0.000000f, -0.710100f, 0.704100f, -0.000000f, 0.000000f, 0.750000f, 
-		-0.693520f, 0.707107f, 0.137950f, -0.696500f, 0.704100f, 0.138500f, 0.031250f, 0.750000f, 
-		-0.815493f, -0.555570f, 0.162211f, -0.817300f, -0.552800f, 0.162600f, 0.031250f, 0.312500f, 
-		-0.707107f, -0.707107f, -0.000000f, -0.710100f, -0.704100f, -0.000000f, 0.000000f, 0.250000f, 
-		-0.693520f, -0.707107f, 0.137950f, -0.696500f, -0.704100f, 0.138500f, 0.031250f, 0.250000f, 
-		-0.815493f, 0.555570f, 0.162211f, -0.817300f, 0.552800f, 0.162600f, 0.031250f, 0.687500f, 
-		-0.707107f, 0.707107f, -0.000000f, -0.710100f, 0.704100f, -0.000000f, 0.000000f, 0.750000f, 
-		-0.831469f, 0.555570f, -0.000000f, -0.833300f, 0.552800f, -0.000000f, 0.000000f, 0.687500f, 
-		-0.544895f, -0.831470f, 0.108386f, -0.549000f, -0.828600f, 0.109200f, 0.031250f, 0.187500f, 
-		-0.707107f, -0.707107f, -0.000000f, -0.710100f, -0.704100f, -0.000000f, 0.000000f, 0.250000f, 
-		-0.555570f, -0.831470f, -0.000000f, -0.559800f, -0.828600f, -0.000000f, 0.000000f, 0.187500f, 
-		-0.815493f, 0.555570f, 0.162211f, -0.817300f, 0.552800f, 0.162600f, 0.031250f, 0.687500f, 
-		-0.923879f, 0.382683f, -0.000000f, -0.924800f, 0.380500f, -0.000000f, 0.000000f, 0.625000f, 
-		-0.906127f, 0.382683f, 0.180240f, -0.907000f, 0.380500f, 0.180400f, 0.031250f, 0.625000f, 
-		-0.544895f, -0.831470f, 0.108386f, -0.549000f, -0.828600f, 0.109200f, 0.031250f, 0.187500f, 
-		-0.382683f, -0.923880f, -0.000000f, -0.387900f, -0.921700f, -0.000000f, 0.000000f, 0.125000f, 
-		-0.375330f, -0.923880f, 0.074658f, -0.380400f, -0.921700f, 0.075700f, 0.031250f, 0.125000f, 
-		-0.961939f, 0.195090f, 0.191341f, -0.962200f, 0.193900f, 0.191400f, 0.031250f, 0.562500f, 
-		-0.923879f, 0.382683f, -0.000000f, -0.924800f, 0.380500f, -0.000000f, 0.000000f, 0.625000f, 
-		-0.980785f, 0.195090f, -0.000000f, -0.981000f, 0.193900f, -0.000000f, 0.000000f, 0.562500f, 
-		-0.375330f, -0.923880f, 0.074658f, -0.380400f, -0.921700f, 0.075700f, 0.031250f, 0.125000f, 
-		-0.195090f, -0.980785f, -0.000000f, -0.201000f, -0.979600f, -0.000000f, 0.000000f, 0.062500f, 
-		-0.191342f, -0.980785f, 0.038060f, -0.197100f, -0.979600f, 0.039200f, 0.031250f, 0.062500f, 
-		-0.831469f, -0.555570f, -0.000000f, -0.833300f, -0.552800f, -0.000000f, 1.000000f, 0.312500f, 
-		-0.693520f, -0.707107f, -0.137950f, -0.696500f, -0.704100f, -0.138500f, 0.968750f, 0.250000f, 
-		-0.707107f, -0.707107f, -0.000000f, -0.710100f, -0.704100f, -0.000000f, 1.000000f, 0.250000f, 
-		-0.831469f, 0.555570f, -0.000000f, -0.833300f, 0.552800f, -0.000000f, 1.000000f, 0.687500f, 
-		-0.693520f, 0.707107f, -0.137950f, -0.696500f, 0.704100f, -0.138500f, 0.968750f, 0.750000f, 
-		-0.815493f, 0.555570f, -0.162212f, -0.817300f, 0.552800f, -0.162600f, 0.968750f, 0.687500f, 
-		-0.555570f, -0.831470f, -0.000000f, -0.559800f, -0.828600f, -0.000000f, 1.000000f, 0.187500f, 
-		-0.693520f, -0.707107f, -0.137950f, -0.696500f, -0.704100f, -0.138500f, 0.968750f, 0.250000f, 
-		-0.544895f, -0.831470f, -0.108386f, -0.549000f, -0.828600f, -0.109200f, 0.968750f, 0.187500f, 
-		-0.831469f, 0.555570f, -0.000000f, -0.833300f, 0.552800f, -0.000000f, 1.000000f, 0.687500f, 
-		-0.906127f, 0.382683f, -0.180240f, -0.907000f, 0.380500f, -0.180400f, 0.968750f, 0.625000f, 
-		-0.923879f, 0.382683f, -0.000000f, -0.924800f, 0.380500f, -0.000000f, 1.000000f, 0.625000f, 
-		-0.555570f, -0.831470f, -0.000000f, -0.559800f, -0.828600f, -0.000000f, 1.000000f, 0.187500f, 
-		-0.375330f, -0.923880f, -0.074658f, -0.380400f, -0.921700f, -0.075700f, 0.968750f, 0.125000f, 
-		-0.382683f, -0.923880f, -0.000000f, -0.387900f, -0.921700f, -0.000000f, 1.000000f, 0.125000f, 
-		-0.980785f, 0.195090f, -0.000000f, -0.981000f, 0.193900f, -0.000000f, 1.000000f, 0.562500f, 
-		-0.906127f, 0.382683f, -0.180240f, -0.907000f, 0.380500f, -0.180400f, 0.968750f, 0.625000f, 
-		-0.961939f, 0.195090f, -0.191342f, -0.962200f, 0.193900f, -0.191400f, 0.968750f, 0.562500f, 
-		-0.382683f, -0.923880f, -0.000000f, -0.387900f, -0.921700f, -0.000000f, 1.000000f, 0.125000f, 
-		-0.191342f, -0.980785f, -0.038060f, -0.197100f, -0.979600f, -0.039200f, 0.968750f, 0.062500f, 
-		-0.195090f, -0.980785f, -0.000000f, -0.201000f, -0.979600f, -0.000000f, 1.000000f, 0.062500f, 
-		-0.999999f, 0.000000f, -0.000000f, -1.000000f, -0.000000f, -0.000000f, 1.000000f, 0.500000f, 
-		-0.961939f, 0.195090f, -0.191342f, -0.962200f, 0.193900f, -0.191400f, 0.968750f, 0.562500f, 
-		-0.980784f, 0.000000f, -0.195091f, -0.980800f, -0.000000f, -0.195100f, 0.968750f, 0.500000f, 
-		-0.195090f, 0.980785f, -0.000000f, -0.201000f, 0.979600f, -0.000000f, 1.000000f, 0.937500f, 
-		0.000000f, 1.000000f, 0.000000f, -0.000000f, 1.000000f, -0.000000f, 0.984375f, 1.000000f, 
-		-0.191342f, 0.980785f, -0.038060f, -0.197100f, 0.979600f, -0.039200f, 0.968750f, 0.937500f, 
-		0.000000f, -1.000000f, 0.000000f, -0.000000f, -1.000000f, -0.000000f, 0.984375f, 0.000000f, 
-		-0.195090f, -0.980785f, -0.000000f, -0.201000f, -0.979600f, -0.000000f, 1.000000f, 0.062500f, 
-		-0.191342f, -0.980785f, -0.038060f, -0.197100f, -0.979600f, -0.039200f, 0.968750f, 0.062500f, 
-		-0.999999f, 0.000000f, -0.000000f, -1.000000f, -0.000000f, -0.000000f, 1.000000f, 0.500000f, 
-		-0.961939f, -0.195090f, -0.191342f, -0.962200f, -0.193900f, -0.191400f, 0.968750f, 0.437500f, 
-		-0.980785f, -0.195090f, -0.000000f, -0.981000f, -0.193900f, -0.000000f, 1.000000f, 0.437500f, 
-		-0.195090f, 0.980785f, -0.000000f, -0.201000f, 0.979600f, -0.000000f, 1.000000f, 0.937500f, 
-		-0.375330f, 0.923880f, -0.074658f, -0.380400f, 0.921700f, -0.075700f, 0.968750f, 0.875000f, 
-		-0.382683f, 0.923880f, -0.000000f, -0.387900f, 0.921700f, -0.000000f, 1.000000f, 0.875000f, 
-		-0.980785f, -0.195090f, -0.000000f, -0.981000f, -0.193900f, -0.000000f, 1.000000f, 0.437500f, 
-		-0.906127f, -0.382683f, -0.180240f, -0.907000f, -0.380500f, -0.180400f, 0.968750f, 0.375000f, 
-		-0.923879f, -0.382683f, -0.000000f, -0.924800f, -0.380500f, -0.000000f, 1.000000f, 0.375000f, 
-		-0.555570f, 0.831470f, -0.000000f, -0.559800f, 0.828600f, -0.000000f, 1.000000f, 0.812500f, 
-		-0.375330f, 0.923880f, -0.074658f, -0.380400f, 0.921700f, -0.075700f, 0.968750f, 0.875000f, 
-		-0.544895f, 0.831470f, -0.108386f, -0.549000f, 0.828600f, -0.109200f, 0.968750f, 0.812500f, 
-		-0.831469f, -0.555570f, -0.000000f, -0.833300f, -0.552800f, -0.000000f, 1.000000f, 0.312500f, 
-		-0.906127f, -0.382683f, -0.180240f, -0.907000f, -0.380500f, -0.180400f, 0.968750f, 0.375000f, 
-		-0.815493f, -0.555570f, -0.162212f, -0.817300f, -0.552800f, -0.162600f, 0.968750f, 0.312500f, 
-		-0.555570f, 0.831470f, -0.000000f, -0.559800f, 0.828600f, -0.000000f, 1.000000f, 0.812500f, 
-		-0.693520f, 0.707107f, -0.137950f, -0.696500f, 0.704100f, -0.138500f, 0.968750f, 0.750000f, 
-		-0.707107f, 0.707107f, -0.000000f, -0.710100f, 0.704100f, -0.000000f, 1.000000f, 0.750000f, 
-		-0.191342f, 0.980785f, -0.038060f, -0.197100f, 0.979600f, -0.039200f, 0.968750f, 0.937500f, 
-		0.000000f, 1.000000f, 0.000000f, -0.000000f, 1.000000f, -0.000000f, 0.953125f, 1.000000f, 
-		-0.180240f, 0.980785f, -0.074658f, -0.185700f, 0.979600f, -0.076900f, 0.937500f, 0.937500f, 
-		0.000000f, -1.000000f, 0.000000f, -0.000000f, -1.000000f, -0.000000f, 0.953125f, 0.000000f, 
-		-0.191342f, -0.980785f, -0.038060f, -0.197100f, -0.979600f, -0.039200f, 0.968750f, 0.062500f, 
-		-0.180240f, -0.980785f, -0.074658f, -0.185700f, -0.979600f, -0.076900f, 0.937500f, 0.062500f, 
-		-0.980784f, 0.000000f, -0.195091f, -0.980800f, -0.000000f, -0.195100f, 0.968750f, 0.500000f, 
-		-0.906127f, -0.195090f, -0.375330f, -0.906300f, -0.193900f, -0.375400f, 0.937500f, 0.437500f, 
-		-0.961939f, -0.195090f, -0.191342f, -0.962200f, -0.193900f, -0.191400f, 0.968750f, 0.437500f, 
-		-0.191342f, 0.980785f, -0.038060f, -0.197100f, 0.979600f, -0.039200f, 0.968750f, 0.937500f, 
-		-0.353553f, 0.923880f, -0.146447f, -0.358400f, 0.921700f, -0.148400f, 0.937500f, 0.875000f, 
-		-0.375330f, 0.923880f, -0.074658f, -0.380400f, 0.921700f, -0.075700f, 0.968750f, 0.875000f, 
-		-0.961939f, -0.195090f, -0.191342f, -0.962200f, -0.193900f, -0.191400f, 0.968750f, 0.437500f, 
-		-0.853553f, -0.382683f, -0.353553f, -0.854400f, -0.380500f, -0.353900f, 0.937500f, 0.375000f, 
-		-0.906127f, -0.382683f, -0.180240f, -0.907000f, -0.380500f, -0.180400f, 0.968750f, 0.375000f, 
-		-0.544895f, 0.831470f, -0.108386f, -0.549000f, 0.828600f, -0.109200f, 0.968750f, 0.812500f, 
-		-0.353553f, 0.923880f, -0.146447f, -0.358400f, 0.921700f, -0.148400f, 0.937500f, 0.875000f, 
-		-0.513279f, 0.831470f, -0.212607f, -0.517200f, 0.828600f, -0.214200f, 0.937500f, 0.812500f, 
-		-0.815493f, -0.555570f, -0.162212f, -0.817300f, -0.552800f, -0.162600f, 0.968750f, 0.312500f, 
-		-0.853553f, -0.382683f, -0.353553f, -0.854400f, -0.380500f, -0.353900f, 0.937500f, 0.375000f, 
-		-0.768177f, -0.555570f, -0.318190f, -0.769900f, -0.552800f, -0.318900f, 0.937500f, 0.312500f, 
-		-0.544895f, 0.831470f, -0.108386f, -0.549000f, 0.828600f, -0.109200f, 0.968750f, 0.812500f, 
-		-0.653281f, 0.707107f, -0.270598f, -0.656100f, 0.704100f, -0.271800f, 0.937500f, 0.750000f, 
-		-0.693520f, 0.707107f, -0.137950f, -0.696500f, 0.704100f, -0.138500f, 0.968750f, 0.750000f, 
-		-0.815493f, -0.555570f, -0.162212f, -0.817300f, -0.552800f, -0.162600f, 0.968750f, 0.312500f, 
-		-0.653281f, -0.707107f, -0.270598f, -0.656100f, -0.704100f, -0.271800f, 0.937500f, 0.250000f, 
-		-0.693520f, -0.707107f, -0.137950f, -0.696500f, -0.704100f, -0.138500f, 0.968750f, 0.250000f, 
-		-0.815493f, 0.555570f, -0.162212f, -0.817300f, 0.552800f, -0.162600f, 0.968750f, 0.687500f, 
-		-0.653281f, 0.707107f, -0.270598f, -0.656100f, 0.704100f, -0.271800f, 0.937500f, 0.750000f, 
-		-0.768177f, 0.555570f, -0.318190f, -0.769900f, 0.552800f, -0.318900f, 0.937500f, 0.687500f, 
-		-0.544895f, -0.831470f, -0.108386f, -0.549000f, -0.828600f, -0.109200f, 0.968750f, 0.187500f, 
-		-0.653281f, -0.707107f, -0.270598f, -0.656100f, -0.704100f, -0.271800f, 0.937500f, 0.250000f, 
-		-0.513279f, -0.831470f, -0.212607f, -0.517200f, -0.828600f, -0.214200f, 0.937500f, 0.187500f, 
-		-0.815493f, 0.555570f, -0.162212f, -0.817300f, 0.552800f, -0.162600f, 0.968750f, 0.687500f, 
-		-0.853553f, 0.382683f, -0.353553f, -0.854400f, 0.380500f, -0.353900f, 0.937500f, 0.625000f, 
-		-0.906127f, 0.382683f, -0.180240f, -0.907000f, 0.380500f, -0.180400f, 0.968750f, 0.625000f, 
-		-0.544895f, -0.831470f, -0.108386f, -0.549000f, -0.828600f, -0.109200f, 0.968750f, 0.187500f, 
-		-0.353553f, -0.923880f, -0.146447f, -0.358400f, -0.921700f, -0.148400f, 0.937500f, 0.125000f, 
-		-0.375330f, -0.923880f, -0.074658f, -0.380400f, -0.921700f, -0.075700f, 0.968750f, 0.125000f, 
-		-0.961939f, 0.195090f, -0.191342f, -0.962200f, 0.193900f, -0.191400f, 0.968750f, 0.562500f, 
-		-0.853553f, 0.382683f, -0.353553f, -0.854400f, 0.380500f, -0.353900f, 0.937500f, 0.625000f, 
-		-0.906127f, 0.195090f, -0.375330f, -0.906300f, 0.193900f, -0.375400f, 0.937500f, 0.562500f, 
-		-0.375330f, -0.923880f, -0.074658f, -0.380400f, -0.921700f, -0.075700f, 0.968750f, 0.125000f, 
-		-0.180240f, -0.980785f, -0.074658f, -0.185700f, -0.979600f, -0.076900f, 0.937500f, 0.062500f, 
-		-0.191342f, -0.980785f, -0.038060f, -0.197100f, -0.979600f, -0.039200f, 0.968750f, 0.062500f, 
-		-0.980784f, 0.000000f, -0.195091f, -0.980800f, -0.000000f, -0.195100f, 0.968750f, 0.500000f, 
-		-0.906127f, 0.195090f, -0.375330f, -0.906300f, 0.193900f, -0.375400f, 0.937500f, 0.562500f, 
-		-0.923878f, 0.000000f, -0.382683f, -0.923900f, -0.000000f, -0.382700f, 0.937500f, 0.500000f, 
-		-0.768177f, 0.555570f, -0.318190f, -0.769900f, 0.552800f, -0.318900f, 0.937500f, 0.687500f, 
-		-0.587938f, 0.707107f, -0.392847f, -0.590500f, 0.704100f, -0.394500f, 0.906250f, 0.750000f, 
-		-0.691341f, 0.555570f, -0.461940f, -0.692900f, 0.552800f, -0.463000f, 0.906250f, 0.687500f, 
-		-0.513279f, -0.831470f, -0.212607f, -0.517200f, -0.828600f, -0.214200f, 0.937500f, 0.187500f, 
-		-0.587938f, -0.707107f, -0.392847f, -0.590500f, -0.704100f, -0.394500f, 0.906250f, 0.250000f, 
-		-0.461939f, -0.831470f, -0.308658f, -0.465400f, -0.828600f, -0.311000f, 0.906250f, 0.187500f, 
-		-0.768177f, 0.555570f, -0.318190f, -0.769900f, 0.552800f, -0.318900f, 0.937500f, 0.687500f, 
-		-0.768177f, 0.382683f, -0.513280f, -0.768900f, 0.380500f, -0.513800f, 0.906250f, 0.625000f, 
-		-0.853553f, 0.382683f, -0.353553f, -0.854400f, 0.380500f, -0.353900f, 0.937500f, 0.625000f, 
-		-0.353553f, -0.923880f, -0.146447f, -0.358400f, -0.921700f, -0.148400f, 0.937500f, 0.125000f, 
-		-0.461939f, -0.831470f, -0.308658f, -0.465400f, -0.828600f, -0.311000f, 0.906250f, 0.187500f, 
-		-0.318189f, -0.923880f, -0.212607f, -0.322500f, -0.921700f, -0.215500f, 0.906250f, 0.125000f, 
-		-0.906127f, 0.195090f, -0.375330f, -0.906300f, 0.193900f, -0.375400f, 0.937500f, 0.562500f, 
-		-0.768177f, 0.382683f, -0.513280f, -0.768900f, 0.380500f, -0.513800f, 0.906250f, 0.625000f, 
-		-0.815493f, 0.195090f, -0.544895f, -0.815700f, 0.193900f, -0.545000f, 0.906250f, 0.562500f, 
-		-0.353553f, -0.923880f, -0.146447f, -0.358400f, -0.921700f, -0.148400f, 0.937500f, 0.125000f, 
-		-0.162212f, -0.980785f, -0.108386f, -0.167100f, -0.979600f, -0.111700f, 0.906250f, 0.062500f, 
-		-0.180240f, -0.980785f, -0.074658f, -0.185700f, -0.979600f, -0.076900f, 0.937500f, 0.062500f, 
-		-0.923878f, 0.000000f, -0.382683f, -0.923900f, -0.000000f, -0.382700f, 0.937500f, 0.500000f, 
-		-0.815493f, 0.195090f, -0.544895f, -0.815700f, 0.193900f, -0.545000f, 0.906250f, 0.562500f, 
-		-0.831468f, 0.000000f, -0.555570f, -0.831500f, -0.000000f, -0.555600f, 0.906250f, 0.500000f, 
-		-0.180240f, 0.980785f, -0.074658f, -0.185700f, 0.979600f, -0.076900f, 0.937500f, 0.937500f, 
-		0.000000f, 1.000000f, 0.000000f, -0.000000f, 1.000000f, -0.000000f, 0.921875f, 1.000000f, 
-		-0.162212f, 0.980785f, -0.108386f, -0.167100f, 0.979600f, -0.111700f, 0.906250f, 0.937500f, 
-		0.000000f, -1.000000f, 0.000000f, -0.000000f, -1.000000f, -0.000000f, 0.921875f, 0.000000f, 
-		-0.180240f, -0.980785f, -0.074658f, -0.185700f, -0.979600f, -0.076900f, 0.937500f, 0.062500f, 
-		-0.162212f, -0.980785f, -0.108386f, -0.167100f, -0.979600f, -0.111700f, 0.906250f, 0.062500f, 
-		-0.923878f, 0.000000f, -0.382683f, -0.923900f, -0.000000f, -0.382700f, 0.937500f, 0.500000f, 
-		-0.815493f, -0.195090f, -0.544895f, -0.815700f, -0.193900f, -0.545000f, 0.906250f, 0.437500f, 
-		-0.906127f, -0.195090f, -0.375330f, -0.906300f, -0.193900f, -0.375400f, 0.937500f, 0.437500f, 
-		-0.353553f, 0.923880f, -0.146447f, -0.358400f, 0.921700f, -0.148400f, 0.937500f, 0.875000f, 
-		-0.162212f, 0.980785f, -0.108386f, -0.167100f, 0.979600f, -0.111700f, 0.906250f, 0.937500f, 
-		-0.318189f, 0.923880f, -0.212607f, -0.322500f, 0.921700f, -0.215500f, 0.906250f, 0.875000f, 
-		-0.906127f, -0.195090f, -0.375330f, -0.906300f, -0.193900f, -0.375400f, 0.937500f, 0.437500f, 
-		-0.768177f, -0.382683f, -0.513280f, -0.768900f, -0.380500f, -0.513800f, 0.906250f, 0.375000f, 
-		-0.853553f, -0.382683f, -0.353553f, -0.854400f, -0.380500f, -0.353900f, 0.937500f, 0.375000f, 
-		-0.353553f, 0.923880f, -0.146447f, -0.358400f, 0.921700f, -0.148400f, 0.937500f, 0.875000f, 
-		-0.461939f, 0.831470f, -0.308658f, -0.465400f, 0.828600f, -0.311000f, 0.906250f, 0.812500f, 
-		-0.513279f, 0.831470f, -0.212607f, -0.517200f, 0.828600f, -0.214200f, 0.937500f, 0.812500f, 
-		-0.768177f, -0.555570f, -0.318190f, -0.769900f, -0.552800f, -0.318900f, 0.937500f, 0.312500f, 
-		-0.768177f, -0.382683f, -0.513280f, -0.768900f, -0.380500f, -0.513800f, 0.906250f, 0.375000f, 
-		-0.691341f, -0.555570f, -0.461940f, -0.692900f, -0.552800f, -0.463000f, 0.906250f, 0.312500f, 
-		-0.513279f, 0.831470f, -0.212607f, -0.517200f, 0.828600f, -0.214200f, 0.937500f, 0.812500f, 
-		-0.587938f, 0.707107f, -0.392847f, -0.590500f, 0.704100f, -0.394500f, 0.906250f, 0.750000f, 
-		-0.653281f, 0.707107f, -0.270598f, -0.656100f, 0.704100f, -0.271800f, 0.937500f, 0.750000f, 
-		-0.768177f, -0.555570f, -0.318190f, -0.769900f, -0.552800f, -0.318900f, 0.937500f, 0.312500f, 
-		-0.587938f, -0.707107f, -0.392847f, -0.590500f, -0.704100f, -0.394500f, 0.906250f, 0.250000f, 
-		-0.653281f, -0.707107f, -0.270598f, -0.656100f, -0.704100f, -0.271800f, 0.937500f, 0.250000f, 
-		-0.831468f, 0.000000f, -0.555570f, -0.831500f, -0.000000f, -0.555600f, 0.906250f, 0.500000f, 
-		-0.693519f, -0.195090f, -0.693520f, -0.693700f, -0.193900f, -0.693700f, 0.875000f, 0.437500f, 
-		-0.815493f, -0.195090f, -0.544895f, -0.815700f, -0.193900f, -0.545000f, 0.906250f, 0.437500f, 
-		-0.162212f, 0.980785f, -0.108386f, -0.167100f, 0.979600f, -0.111700f, 0.906250f, 0.937500f, 
-		-0.270598f, 0.923880f, -0.270598f, -0.274300f, 0.921700f, -0.274300f, 0.875000f, 0.875000f, 
-		-0.318189f, 0.923880f, -0.212607f, -0.322500f, 0.921700f, -0.215500f, 0.906250f, 0.875000f, 
-		-0.815493f, -0.195090f, -0.544895f, -0.815700f, -0.193900f, -0.545000f, 0.906250f, 0.437500f, 
-		-0.653281f, -0.382683f, -0.653281f, -0.653900f, -0.380500f, -0.653900f, 0.875000f, 0.375000f, 
-		-0.768177f, -0.382683f, -0.513280f, -0.768900f, -0.380500f, -0.513800f, 0.906250f, 0.375000f, 
-		-0.461939f, 0.831470f, -0.308658f, -0.465400f, 0.828600f, -0.311000f, 0.906250f, 0.812500f, 
-		-0.270598f, 0.923880f, -0.270598f, -0.274300f, 0.921700f, -0.274300f, 0.875000f, 0.875000f, 
-		-0.392847f, 0.831470f, -0.392847f, -0.395800f, 0.828600f, -0.395800f, 0.875000f, 0.812500f, 
-		-0.691341f, -0.555570f, -0.461940f, -0.692900f, -0.552800f, -0.463000f, 0.906250f, 0.312500f, 
-		-0.653281f, -0.382683f, -0.653281f, -0.653900f, -0.380500f, -0.653900f, 0.875000f, 0.375000f, 
-		-0.587937f, -0.555570f, -0.587938f, -0.589300f, -0.552800f, -0.589300f, 0.875000f, 0.312500f, 
-		-0.461939f, 0.831470f, -0.308658f, -0.465400f, 0.828600f, -0.311000f, 0.906250f, 0.812500f, 
-		-0.500000f, 0.707107f, -0.500000f, -0.502100f, 0.704100f, -0.502100f, 0.875000f, 0.750000f, 
-		-0.587938f, 0.707107f, -0.392847f, -0.590500f, 0.704100f, -0.394500f, 0.906250f, 0.750000f, 
-		-0.691341f, -0.555570f, -0.461940f, -0.692900f, -0.552800f, -0.463000f, 0.906250f, 0.312500f, 
-		-0.500000f, -0.707107f, -0.500000f, -0.502100f, -0.704100f, -0.502100f, 0.875000f, 0.250000f, 
-		-0.587938f, -0.707107f, -0.392847f, -0.590500f, -0.704100f, -0.394500f, 0.906250f, 0.250000f, 
-		-0.691341f, 0.555570f, -0.461940f, -0.692900f, 0.552800f, -0.463000f, 0.906250f, 0.687500f, 
-		-0.500000f, 0.707107f, -0.500000f, -0.502100f, 0.704100f, -0.502100f, 0.875000f, 0.750000f, 
-		-0.587937f, 0.555570f, -0.587938f, -0.589300f, 0.552800f, -0.589300f, 0.875000f, 0.687500f, 
-		-0.461939f, -0.831470f, -0.308658f, -0.465400f, -0.828600f, -0.311000f, 0.906250f, 0.187500f, 
-		-0.500000f, -0.707107f, -0.500000f, -0.502100f, -0.704100f, -0.502100f, 0.875000f, 0.250000f, 
-		-0.392847f, -0.831470f, -0.392847f, -0.395800f, -0.828600f, -0.395800f, 0.875000f, 0.187500f, 
-		-0.691341f, 0.555570f, -0.461940f, -0.692900f, 0.552800f, -0.463000f, 0.906250f, 0.687500f, 
-		-0.653281f, 0.382683f, -0.653281f, -0.653900f, 0.380500f, -0.653900f, 0.875000f, 0.625000f, 
-		-0.768177f, 0.382683f, -0.513280f, -0.768900f, 0.380500f, -0.513800f, 0.906250f, 0.625000f, 
-		-0.461939f, -0.831470f, -0.308658f, -0.465400f, -0.828600f, -0.311000f, 0.906250f, 0.187500f, 
-		-0.270598f, -0.923880f, -0.270598f, -0.274300f, -0.921700f, -0.274300f, 0.875000f, 0.125000f, 
-		-0.318189f, -0.923880f, -0.212607f, -0.322500f, -0.921700f, -0.215500f, 0.906250f, 0.125000f, 
-		-0.815493f, 0.195090f, -0.544895f, -0.815700f, 0.193900f, -0.545000f, 0.906250f, 0.562500f, 
-		-0.653281f, 0.382683f, -0.653281f, -0.653900f, 0.380500f, -0.653900f, 0.875000f, 0.625000f, 
-		-0.693519f, 0.195090f, -0.693520f, -0.693700f, 0.193900f, -0.693700f, 0.875000f, 0.562500f, 
-		-0.318189f, -0.923880f, -0.212607f, -0.322500f, -0.921700f, -0.215500f, 0.906250f, 0.125000f, 
-		-0.137950f, -0.980785f, -0.137950f, -0.142100f, -0.979600f, -0.142100f, 0.875000f, 0.062500f, 
-		-0.162212f, -0.980785f, -0.108386f, -0.167100f, -0.979600f, -0.111700f, 0.906250f, 0.062500f, 
-		-0.831468f, 0.000000f, -0.555570f, -0.831500f, -0.000000f, -0.555600f, 0.906250f, 0.500000f, 
-		-0.693519f, 0.195090f, -0.693520f, -0.693700f, 0.193900f, -0.693700f, 0.875000f, 0.562500f, 
-		-0.707106f, 0.000000f, -0.707106f, -0.707100f, -0.000000f, -0.707100f, 0.875000f, 0.500000f, 
-		-0.162212f, 0.980785f, -0.108386f, -0.167100f, 0.979600f, -0.111700f, 0.906250f, 0.937500f, 
-		0.000000f, 1.000000f, 0.000000f, -0.000000f, 1.000000f, -0.000000f, 0.890625f, 1.000000f, 
-		-0.137950f, 0.980785f, -0.137950f, -0.142100f, 0.979600f, -0.142100f, 0.875000f, 0.937500f, 
-		0.000000f, -1.000000f, 0.000000f, -0.000000f, -1.000000f, -0.000000f, 0.890625f, 0.000000f, 
-		-0.162212f, -0.980785f, -0.108386f, -0.167100f, -0.979600f, -0.111700f, 0.906250f, 0.062500f, 
-		-0.137950f, -0.980785f, -0.137950f, -0.142100f, -0.979600f, -0.142100f, 0.875000f, 0.062500f, 
-		-0.392847f, -0.831470f, -0.392847f, -0.395800f, -0.828600f, -0.395800f, 0.875000f, 0.187500f, 
-		-0.392847f, -0.707107f, -0.587938f, -0.394500f, -0.704100f, -0.590500f, 0.843750f, 0.250000f, 
-		-0.308658f, -0.831470f, -0.461939f, -0.311000f, -0.828600f, -0.465400f, 0.843750f, 0.187500f, 
-		-0.587937f, 0.555570f, -0.587938f, -0.589300f, 0.552800f, -0.589300f, 0.875000f, 0.687500f, 
-		-0.513280f, 0.382683f, -0.768177f, -0.513800f, 0.380500f, -0.768900f, 0.843750f, 0.625000f, 
-		-0.653281f, 0.382683f, -0.653281f, -0.653900f, 0.380500f, -0.653900f, 0.875000f, 0.625000f, 
-		-0.392847f, -0.831470f, -0.392847f, -0.395800f, -0.828600f, -0.395800f, 0.875000f, 0.187500f, 
-		-0.212607f, -0.923880f, -0.318190f, -0.215500f, -0.921700f, -0.322500f, 0.843750f, 0.125000f, 
-		-0.270598f, -0.923880f, -0.270598f, -0.274300f, -0.921700f, -0.274300f, 0.875000f, 0.125000f, 
-		-0.693519f, 0.195090f, -0.693520f, -0.693700f, 0.193900f, -0.693700f, 0.875000f, 0.562500f, 
-		-0.513280f, 0.382683f, -0.768177f, -0.513800f, 0.380500f, -0.768900f, 0.843750f, 0.625000f, 
-		-0.544895f, 0.195090f, -0.815493f, -0.545000f, 0.193900f, -0.815700f, 0.843750f, 0.562500f, 
-		-0.270598f, -0.923880f, -0.270598f, -0.274300f, -0.921700f, -0.274300f, 0.875000f, 0.125000f, 
-		-0.108386f, -0.980785f, -0.162212f, -0.111700f, -0.979600f, -0.167100f, 0.843750f, 0.062500f, 
-		-0.137950f, -0.980785f, -0.137950f, -0.142100f, -0.979600f, -0.142100f, 0.875000f, 0.062500f, 
-		-0.707106f, 0.000000f, -0.707106f, -0.707100f, -0.000000f, -0.707100f, 0.875000f, 0.500000f, 
-		-0.544895f, 0.195090f, -0.815493f, -0.545000f, 0.193900f, -0.815700f, 0.843750f, 0.562500f, 
-		-0.555569f, 0.000000f, -0.831469f, -0.555600f, -0.000000f, -0.831500f, 0.843750f, 0.500000f, 
-		-0.137950f, 0.980785f, -0.137950f, -0.142100f, 0.979600f, -0.142100f, 0.875000f, 0.937500f, 
-		0.000000f, 1.000000f, 0.000000f, -0.000000f, 1.000000f, -0.000000f, 0.859375f, 1.000000f, 
-		-0.108386f, 0.980785f, -0.162212f, -0.111700f, 0.979600f, -0.167100f, 0.843750f, 0.937500f, 
-		0.000000f, -1.000000f, 0.000000f, -0.000000f, -1.000000f, -0.000000f, 0.859375f, 0.000000f, 
-		-0.137950f, -0.980785f, -0.137950f, -0.142100f, -0.979600f, -0.142100f, 0.875000f, 0.062500f, 
-		-0.108386f, -0.980785f, -0.162212f, -0.111700f, -0.979600f, -0.167100f, 0.843750f, 0.062500f, 
-		-0.707106f, 0.000000f, -0.707106f, -0.707100f, -0.000000f, -0.707100f, 0.875000f, 0.500000f, 
-		-0.544895f, -0.195090f, -0.815493f, -0.545000f, -0.193900f, -0.815700f, 0.843750f, 0.437500f, 
-		-0.693519f, -0.195090f, -0.693520f, -0.693700f, -0.193900f, -0.693700f, 0.875000f, 0.437500f, 
-		-0.137950f, 0.980785f, -0.137950f, -0.142100f, 0.979600f, -0.142100f, 0.875000f, 0.937500f, 
-		-0.212607f, 0.923880f, -0.318190f, -0.215500f, 0.921700f, -0.322500f, 0.843750f, 0.875000f, 
-		-0.270598f, 0.923880f, -0.270598f, -0.274300f, 0.921700f, -0.274300f, 0.875000f, 0.875000f, 
-		-0.693519f, -0.195090f, -0.693520f, -0.693700f, -0.193900f, -0.693700f, 0.875000f, 0.437500f, 
-		-0.513280f, -0.382683f, -0.768177f, -0.513800f, -0.380500f, -0.768900f, 0.843750f, 0.375000f, 
-		-0.653281f, -0.382683f, -0.653281f, -0.653900f, -0.380500f, -0.653900f, 0.875000f, 0.375000f, 
-		-0.392847f, 0.831470f, -0.392847f, -0.395800f, 0.828600f, -0.395800f, 0.875000f, 0.812500f, 
-		-0.212607f, 0.923880f, -0.318190f, -0.215500f, 0.921700f, -0.322500f, 0.843750f, 0.875000f, 
-		-0.308658f, 0.831470f, -0.461939f, -0.311000f, 0.828600f, -0.465400f, 0.843750f, 0.812500f, 
-		-0.587937f, -0.555570f, -0.587938f, -0.589300f, -0.552800f, -0.589300f, 0.875000f, 0.312500f, 
-		-0.513280f, -0.382683f, -0.768177f, -0.513800f, -0.380500f, -0.768900f, 0.843750f, 0.375000f, 
-		-0.461939f, -0.555570f, -0.691341f, -0.463000f, -0.552800f, -0.692900f, 0.843750f, 0.312500f, 
-		-0.392847f, 0.831470f, -0.392847f, -0.395800f, 0.828600f, -0.395800f, 0.875000f, 0.812500f, 
-		-0.392847f, 0.707107f, -0.587938f, -0.394500f, 0.704100f, -0.590500f, 0.843750f, 0.750000f, 
-		-0.500000f, 0.707107f, -0.500000f, -0.502100f, 0.704100f, -0.502100f, 0.875000f, 0.750000f, 
-		-0.587937f, -0.555570f, -0.587938f, -0.589300f, -0.552800f, -0.589300f, 0.875000f, 0.312500f, 
-		-0.392847f, -0.707107f, -0.587938f, -0.394500f, -0.704100f, -0.590500f, 0.843750f, 0.250000f, 
-		-0.500000f, -0.707107f, -0.500000f, -0.502100f, -0.704100f, -0.502100f, 0.875000f, 0.250000f, 
-		-0.587937f, 0.555570f, -0.587938f, -0.589300f, 0.552800f, -0.589300f, 0.875000f, 0.687500f, 
-		-0.392847f, 0.707107f, -0.587938f, -0.394500f, 0.704100f, -0.590500f, 0.843750f, 0.750000f, 
-		-0.461939f, 0.555570f, -0.691341f, -0.463000f, 0.552800f, -0.692900f, 0.843750f, 0.687500f, 
-		-0.544895f, -0.195090f, -0.815493f, -0.545000f, -0.193900f, -0.815700f, 0.843750f, 0.437500f, 
-		-0.353553f, -0.382683f, -0.853553f, -0.353900f, -0.380500f, -0.854400f, 0.812500f, 0.375000f, 
-		-0.513280f, -0.382683f, -0.768177f, -0.513800f, -0.380500f, -0.768900f, 0.843750f, 0.375000f, 
-		-0.212607f, 0.923880f, -0.318190f, -0.215500f, 0.921700f, -0.322500f, 0.843750f, 0.875000f, 
-		-0.212607f, 0.831470f, -0.513279f, -0.214200f, 0.828600f, -0.517200f, 0.812500f, 0.812500f, 
-		-0.308658f, 0.831470f, -0.461939f, -0.311000f, 0.828600f, -0.465400f, 0.843750f, 0.812500f, 
-		-0.461939f, -0.555570f, -0.691341f, -0.463000f, -0.552800f, -0.692900f, 0.843750f, 0.312500f, 
-		-0.353553f, -0.382683f, -0.853553f, -0.353900f, -0.380500f, -0.854400f, 0.812500f, 0.375000f, 
-		-0.318189f, -0.555570f, -0.768177f, -0.318900f, -0.552800f, -0.769900f, 0.812500f, 0.312500f, 
-		-0.308658f, 0.831470f, -0.461939f, -0.311000f, 0.828600f, -0.465400f, 0.843750f, 0.812500f, 
-		-0.270598f, 0.707107f, -0.653281f, -0.271800f, 0.704100f, -0.656100f, 0.812500f, 0.750000f, 
-		-0.392847f, 0.707107f, -0.587938f, -0.394500f, 0.704100f, -0.590500f, 0.843750f, 0.750000f, 
-		-0.461939f, -0.555570f, -0.691341f, -0.463000f, -0.552800f, -0.692900f, 0.843750f, 0.312500f, 
-		-0.270598f, -0.707107f, -0.653281f, -0.271800f, -0.704100f, -0.656100f, 0.812500f, 0.250000f, 
-		-0.392847f, -0.707107f, -0.587938f, -0.394500f, -0.704100f, -0.590500f, 0.843750f, 0.250000f, 
-		-0.461939f, 0.555570f, -0.691341f, -0.463000f, 0.552800f, -0.692900f, 0.843750f, 0.687500f, 
-		-0.270598f, 0.707107f, -0.653281f, -0.271800f, 0.704100f, -0.656100f, 0.812500f, 0.750000f, 
-		-0.318189f, 0.555570f, -0.768177f, -0.318900f, 0.552800f, -0.769900f, 0.812500f, 0.687500f, 
-		-0.308658f, -0.831470f, -0.461939f, -0.311000f, -0.828600f, -0.465400f, 0.843750f, 0.187500f, 
-		-0.270598f, -0.707107f, -0.653281f, -0.271800f, -0.704100f, -0.656100f, 0.812500f, 0.250000f, 
-		-0.212607f, -0.831470f, -0.513279f, -0.214200f, -0.828600f, -0.517200f, 0.812500f, 0.187500f, 
-		-0.461939f, 0.555570f, -0.691341f, -0.463000f, 0.552800f, -0.692900f, 0.843750f, 0.687500f, 
-		-0.353553f, 0.382683f, -0.853553f, -0.353900f, 0.380500f, -0.854400f, 0.812500f, 0.625000f, 
-		-0.513280f, 0.382683f, -0.768177f, -0.513800f, 0.380500f, -0.768900f, 0.843750f, 0.625000f, 
-		-0.308658f, -0.831470f, -0.461939f, -0.311000f, -0.828600f, -0.465400f, 0.843750f, 0.187500f, 
-		-0.146446f, -0.923880f, -0.353553f, -0.148400f, -0.921700f, -0.358400f, 0.812500f, 0.125000f, 
-		-0.212607f, -0.923880f, -0.318190f, -0.215500f, -0.921700f, -0.322500f, 0.843750f, 0.125000f, 
-		-0.544895f, 0.195090f, -0.815493f, -0.545000f, 0.193900f, -0.815700f, 0.843750f, 0.562500f, 
-		-0.353553f, 0.382683f, -0.853553f, -0.353900f, 0.380500f, -0.854400f, 0.812500f, 0.625000f, 
-		-0.375330f, 0.195090f, -0.906127f, -0.375400f, 0.193900f, -0.906300f, 0.812500f, 0.562500f, 
-		-0.212607f, -0.923880f, -0.318190f, -0.215500f, -0.921700f, -0.322500f, 0.843750f, 0.125000f, 
-		-0.074658f, -0.980785f, -0.180240f, -0.076900f, -0.979600f, -0.185700f, 0.812500f, 0.062500f, 
-		-0.108386f, -0.980785f, -0.162212f, -0.111700f, -0.979600f, -0.167100f, 0.843750f, 0.062500f, 
-		-0.555569f, 0.000000f, -0.831469f, -0.555600f, -0.000000f, -0.831500f, 0.843750f, 0.500000f, 
-		-0.375330f, 0.195090f, -0.906127f, -0.375400f, 0.193900f, -0.906300f, 0.812500f, 0.562500f, 
-		-0.382683f, 0.000000f, -0.923879f, -0.382700f, -0.000000f, -0.923900f, 0.812500f, 0.500000f, 
-		-0.108386f, 0.980785f, -0.162212f, -0.111700f, 0.979600f, -0.167100f, 0.843750f, 0.937500f, 
-		0.000000f, 1.000000f, 0.000000f, -0.000000f, 1.000000f, -0.000000f, 0.828125f, 1.000000f, 
-		-0.074658f, 0.980785f, -0.180240f, -0.076900f, 0.979600f, -0.185700f, 0.812500f, 0.937500f, 
-		0.000000f, -1.000000f, 0.000000f, -0.000000f, -1.000000f, -0.000000f, 0.828125f, 0.000000f, 
-		-0.108386f, -0.980785f, -0.162212f, -0.111700f, -0.979600f, -0.167100f, 0.843750f, 0.062500f, 
-		-0.074658f, -0.980785f, -0.180240f, -0.076900f, -0.979600f, -0.185700f, 0.812500f, 0.062500f, 
-		-0.555569f, 0.000000f, -0.831469f, -0.555600f, -0.000000f, -0.831500f, 0.843750f, 0.500000f, 
-		-0.375330f, -0.195090f, -0.906127f, -0.375400f, -0.193900f, -0.906300f, 0.812500f, 0.437500f, 
-		-0.544895f, -0.195090f, -0.815493f, -0.545000f, -0.193900f, -0.815700f, 0.843750f, 0.437500f, 
-		-0.212607f, 0.923880f, -0.318190f, -0.215500f, 0.921700f, -0.322500f, 0.843750f, 0.875000f, 
-		-0.074658f, 0.980785f, -0.180240f, -0.076900f, 0.979600f, -0.185700f, 0.812500f, 0.937500f, 
-		-0.146446f, 0.923880f, -0.353553f, -0.148400f, 0.921700f, -0.358400f, 0.812500f, 0.875000f, 
-		-0.212607f, -0.831470f, -0.513279f, -0.214200f, -0.828600f, -0.517200f, 0.812500f, 0.187500f, 
-		-0.074658f, -0.923880f, -0.375330f, -0.075700f, -0.921700f, -0.380400f, 0.781250f, 0.125000f, 
-		-0.146446f, -0.923880f, -0.353553f, -0.148400f, -0.921700f, -0.358400f, 0.812500f, 0.125000f, 
-		-0.375330f, 0.195090f, -0.906127f, -0.375400f, 0.193900f, -0.906300f, 0.812500f, 0.562500f, 
-		-0.180240f, 0.382683f, -0.906127f, -0.180400f, 0.380500f, -0.907000f, 0.781250f, 0.625000f, 
-		-0.191341f, 0.195090f, -0.961939f, -0.191400f, 0.193900f, -0.962200f, 0.781250f, 0.562500f, 
-		-0.074658f, -0.980785f, -0.180240f, -0.076900f, -0.979600f, -0.185700f, 0.812500f, 0.062500f, 
-		-0.074658f, -0.923880f, -0.375330f, -0.075700f, -0.921700f, -0.380400f, 0.781250f, 0.125000f, 
-		-0.038060f, -0.980785f, -0.191342f, -0.039200f, -0.979600f, -0.197100f, 0.781250f, 0.062500f, 
-		-0.382683f, 0.000000f, -0.923879f, -0.382700f, -0.000000f, -0.923900f, 0.812500f, 0.500000f, 
-		-0.191341f, 0.195090f, -0.961939f, -0.191400f, 0.193900f, -0.962200f, 0.781250f, 0.562500f, 
-		-0.195090f, 0.000000f, -0.980784f, -0.195100f, -0.000000f, -0.980800f, 0.781250f, 0.500000f, 
-		-0.074658f, 0.980785f, -0.180240f, -0.076900f, 0.979600f, -0.185700f, 0.812500f, 0.937500f, 
-		0.000000f, 1.000000f, 0.000000f, -0.000000f, 1.000000f, -0.000000f, 0.796875f, 1.000000f, 
-		-0.038060f, 0.980785f, -0.191342f, -0.039200f, 0.979600f, -0.197100f, 0.781250f, 0.937500f, 
-		0.000000f, -1.000000f, 0.000000f, -0.000000f, -1.000000f, -0.000000f, 0.796875f, 0.000000f, 
-		-0.074658f, -0.980785f, -0.180240f, -0.076900f, -0.979600f, -0.185700f, 0.812500f, 0.062500f, 
-		-0.038060f, -0.980785f, -0.191342f, -0.039200f, -0.979600f, -0.197100f, 0.781250f, 0.062500f, 
-		-0.382683f, 0.000000f, -0.923879f, -0.382700f, -0.000000f, -0.923900f, 0.812500f, 0.500000f, 
-		-0.191341f, -0.195090f, -0.961939f, -0.191400f, -0.193900f, -0.962200f, 0.781250f, 0.437500f, 
-		-0.375330f, -0.195090f, -0.906127f, -0.375400f, -0.193900f, -0.906300f, 0.812500f, 0.437500f, 
-		-0.074658f, 0.980785f, -0.180240f, -0.076900f, 0.979600f, -0.185700f, 0.812500f, 0.937500f, 
-		-0.074658f, 0.923880f, -0.375330f, -0.075700f, 0.921700f, -0.380400f, 0.781250f, 0.875000f, 
-		-0.146446f, 0.923880f, -0.353553f, -0.148400f, 0.921700f, -0.358400f, 0.812500f, 0.875000f, 
-		-0.375330f, -0.195090f, -0.906127f, -0.375400f, -0.193900f, -0.906300f, 0.812500f, 0.437500f, 
-		-0.180240f, -0.382683f, -0.906127f, -0.180400f, -0.380500f, -0.907000f, 0.781250f, 0.375000f, 
-		-0.353553f, -0.382683f, -0.853553f, -0.353900f, -0.380500f, -0.854400f, 0.812500f, 0.375000f, 
-		-0.212607f, 0.831470f, -0.513279f, -0.214200f, 0.828600f, -0.517200f, 0.812500f, 0.812500f, 
-		-0.074658f, 0.923880f, -0.375330f, -0.075700f, 0.921700f, -0.380400f, 0.781250f, 0.875000f, 
-		-0.108386f, 0.831470f, -0.544895f, -0.109200f, 0.828600f, -0.549000f, 0.781250f, 0.812500f, 
-		-0.318189f, -0.555570f, -0.768177f, -0.318900f, -0.552800f, -0.769900f, 0.812500f, 0.312500f, 
-		-0.180240f, -0.382683f, -0.906127f, -0.180400f, -0.380500f, -0.907000f, 0.781250f, 0.375000f, 
-		-0.162211f, -0.555570f, -0.815493f, -0.162600f, -0.552800f, -0.817300f, 0.781250f, 0.312500f, 
-		-0.212607f, 0.831470f, -0.513279f, -0.214200f, 0.828600f, -0.517200f, 0.812500f, 0.812500f, 
-		-0.137950f, 0.707107f, -0.693520f, -0.138500f, 0.704100f, -0.696500f, 0.781250f, 0.750000f, 
-		-0.270598f, 0.707107f, -0.653281f, -0.271800f, 0.704100f, -0.656100f, 0.812500f, 0.750000f, 
-		-0.318189f, -0.555570f, -0.768177f, -0.318900f, -0.552800f, -0.769900f, 0.812500f, 0.312500f, 
-		-0.137950f, -0.707107f, -0.693520f, -0.138500f, -0.704100f, -0.696500f, 0.781250f, 0.250000f, 
-		-0.270598f, -0.707107f, -0.653281f, -0.271800f, -0.704100f, -0.656100f, 0.812500f, 0.250000f, 
-		-0.318189f, 0.555570f, -0.768177f, -0.318900f, 0.552800f, -0.769900f, 0.812500f, 0.687500f, 
-		-0.137950f, 0.707107f, -0.693520f, -0.138500f, 0.704100f, -0.696500f, 0.781250f, 0.750000f, 
-		-0.162211f, 0.555570f, -0.815493f, -0.162600f, 0.552800f, -0.817300f, 0.781250f, 0.687500f, 
-		-0.212607f, -0.831470f, -0.513279f, -0.214200f, -0.828600f, -0.517200f, 0.812500f, 0.187500f, 
-		-0.137950f, -0.707107f, -0.693520f, -0.138500f, -0.704100f, -0.696500f, 0.781250f, 0.250000f, 
-		-0.108386f, -0.831470f, -0.544895f, -0.109200f, -0.828600f, -0.549000f, 0.781250f, 0.187500f, 
-		-0.318189f, 0.555570f, -0.768177f, -0.318900f, 0.552800f, -0.769900f, 0.812500f, 0.687500f, 
-		-0.180240f, 0.382683f, -0.906127f, -0.180400f, 0.380500f, -0.907000f, 0.781250f, 0.625000f, 
-		-0.353553f, 0.382683f, -0.853553f, -0.353900f, 0.380500f, -0.854400f, 0.812500f, 0.625000f, 
-		-0.108386f, 0.831470f, -0.544895f, -0.109200f, 0.828600f, -0.549000f, 0.781250f, 0.812500f, 
-		0.000000f, 0.923880f, -0.382683f, -0.000000f, 0.921700f, -0.387900f, 0.750000f, 0.875000f, 
-		0.000000f, 0.831470f, -0.555570f, -0.000000f, 0.828600f, -0.559800f, 0.750000f, 0.812500f, 
-		-0.180240f, -0.382683f, -0.906127f, -0.180400f, -0.380500f, -0.907000f, 0.781250f, 0.375000f, 
-		0.000000f, -0.555570f, -0.831470f, -0.000000f, -0.552800f, -0.833300f, 0.750000f, 0.312500f, 
-		-0.162211f, -0.555570f, -0.815493f, -0.162600f, -0.552800f, -0.817300f, 0.781250f, 0.312500f, 
-		-0.137950f, 0.707107f, -0.693520f, -0.138500f, 0.704100f, -0.696500f, 0.781250f, 0.750000f, 
-		0.000000f, 0.831470f, -0.555570f, -0.000000f, 0.828600f, -0.559800f, 0.750000f, 0.812500f, 
-		0.000000f, 0.707107f, -0.707107f, -0.000000f, 0.704100f, -0.710100f, 0.750000f, 0.750000f, 
-		-0.162211f, -0.555570f, -0.815493f, -0.162600f, -0.552800f, -0.817300f, 0.781250f, 0.312500f, 
-		0.000000f, -0.707107f, -0.707107f, -0.000000f, -0.704100f, -0.710100f, 0.750000f, 0.250000f, 
-		-0.137950f, -0.707107f, -0.693520f, -0.138500f, -0.704100f, -0.696500f, 0.781250f, 0.250000f, 
-		-0.162211f, 0.555570f, -0.815493f, -0.162600f, 0.552800f, -0.817300f, 0.781250f, 0.687500f, 
-		0.000000f, 0.707107f, -0.707107f, -0.000000f, 0.704100f, -0.710100f, 0.750000f, 0.750000f, 
-		0.000000f, 0.555570f, -0.831470f, -0.000000f, 0.552800f, -0.833300f, 0.750000f, 0.687500f, 
-		-0.108386f, -0.831470f, -0.544895f, -0.109200f, -0.828600f, -0.549000f, 0.781250f, 0.187500f, 
-		0.000000f, -0.707107f, -0.707107f, -0.000000f, -0.704100f, -0.710100f, 0.750000f, 0.250000f, 
-		0.000000f, -0.831470f, -0.555570f, -0.000000f, -0.828600f, -0.559800f, 0.750000f, 0.187500f, 
-		-0.180240f, 0.382683f, -0.906127f, -0.180400f, 0.380500f, -0.907000f, 0.781250f, 0.625000f, 
-		0.000000f, 0.555570f, -0.831470f, -0.000000f, 0.552800f, -0.833300f, 0.750000f, 0.687500f, 
-		0.000000f, 0.382683f, -0.923879f, -0.000000f, 0.380500f, -0.924800f, 0.750000f, 0.625000f, 
-		-0.108386f, -0.831470f, -0.544895f, -0.109200f, -0.828600f, -0.549000f, 0.781250f, 0.187500f, 
-		0.000000f, -0.923880f, -0.382683f, -0.000000f, -0.921700f, -0.387900f, 0.750000f, 0.125000f, 
-		-0.074658f, -0.923880f, -0.375330f, -0.075700f, -0.921700f, -0.380400f, 0.781250f, 0.125000f, 
-		-0.191341f, 0.195090f, -0.961939f, -0.191400f, 0.193900f, -0.962200f, 0.781250f, 0.562500f, 
-		0.000000f, 0.382683f, -0.923879f, -0.000000f, 0.380500f, -0.924800f, 0.750000f, 0.625000f, 
-		0.000000f, 0.195090f, -0.980785f, -0.000000f, 0.193900f, -0.981000f, 0.750000f, 0.562500f, 
-		-0.074658f, -0.923880f, -0.375330f, -0.075700f, -0.921700f, -0.380400f, 0.781250f, 0.125000f, 
-		0.000000f, -0.980785f, -0.195090f, -0.000000f, -0.979600f, -0.201000f, 0.750000f, 0.062500f, 
-		-0.038060f, -0.980785f, -0.191342f, -0.039200f, -0.979600f, -0.197100f, 0.781250f, 0.062500f, 
-		-0.195090f, 0.000000f, -0.980784f, -0.195100f, -0.000000f, -0.980800f, 0.781250f, 0.500000f, 
-		0.000000f, 0.195090f, -0.980785f, -0.000000f, 0.193900f, -0.981000f, 0.750000f, 0.562500f, 
-		0.000000f, 0.000000f, -1.000000f, -0.000000f, -0.000000f, -1.000000f, 0.750000f, 0.500000f, 
-		-0.038060f, 0.980785f, -0.191342f, -0.039200f, 0.979600f, -0.197100f, 0.781250f, 0.937500f, 
-		0.000000f, 1.000000f, 0.000000f, -0.000000f, 1.000000f, -0.000000f, 0.765625f, 1.000000f, 
-		0.000000f, 0.980785f, -0.195090f, -0.000000f, 0.979600f, -0.201000f, 0.750000f, 0.937500f, 
-		0.000000f, -1.000000f, 0.000000f, -0.000000f, -1.000000f, -0.000000f, 0.765625f, 0.000000f, 
-		-0.038060f, -0.980785f, -0.191342f, -0.039200f, -0.979600f, -0.197100f, 0.781250f, 0.062500f, 
-		0.000000f, -0.980785f, -0.195090f, -0.000000f, -0.979600f, -0.201000f, 0.750000f, 0.062500f, 
-		-0.195090f, 0.000000f, -0.980784f, -0.195100f, -0.000000f, -0.980800f, 0.781250f, 0.500000f, 
-		0.000000f, -0.195090f, -0.980785f, -0.000000f, -0.193900f, -0.981000f, 0.750000f, 0.437500f, 
-		-0.191341f, -0.195090f, -0.961939f, -0.191400f, -0.193900f, -0.962200f, 0.781250f, 0.437500f, 
-		-0.074658f, 0.923880f, -0.375330f, -0.075700f, 0.921700f, -0.380400f, 0.781250f, 0.875000f, 
-		0.000000f, 0.980785f, -0.195090f, -0.000000f, 0.979600f, -0.201000f, 0.750000f, 0.937500f, 
-		0.000000f, 0.923880f, -0.382683f, -0.000000f, 0.921700f, -0.387900f, 0.750000f, 0.875000f, 
-		-0.191341f, -0.195090f, -0.961939f, -0.191400f, -0.193900f, -0.962200f, 0.781250f, 0.437500f, 
-		0.000000f, -0.382683f, -0.923879f, -0.000000f, -0.380500f, -0.924800f, 0.750000f, 0.375000f, 
-		-0.180240f, -0.382683f, -0.906127f, -0.180400f, -0.380500f, -0.907000f, 0.781250f, 0.375000f, 
-		0.000000f, -0.195090f, -0.980785f, -0.000000f, -0.193900f, -0.981000f, 0.750000f, 0.437500f, 
-		0.191342f, -0.195090f, -0.961940f, 0.191400f, -0.193900f, -0.962200f, 0.718750f, 0.437500f, 
-		0.180240f, -0.382683f, -0.906127f, 0.180400f, -0.380500f, -0.907000f, 0.718750f, 0.375000f, 
-		0.000000f, 0.831470f, -0.555570f, -0.000000f, 0.828600f, -0.559800f, 0.750000f, 0.812500f, 
-		0.000000f, 0.923880f, -0.382683f, -0.000000f, 0.921700f, -0.387900f, 0.750000f, 0.875000f, 
-		0.074658f, 0.923880f, -0.375330f, 0.075700f, 0.921700f, -0.380400f, 0.718750f, 0.875000f, 
-		0.000000f, -0.382683f, -0.923879f, -0.000000f, -0.380500f, -0.924800f, 0.750000f, 0.375000f, 
-		0.180240f, -0.382683f, -0.906127f, 0.180400f, -0.380500f, -0.907000f, 0.718750f, 0.375000f, 
-		0.162212f, -0.555570f, -0.815493f, 0.162600f, -0.552800f, -0.817300f, 0.718750f, 0.312500f, 
-		0.000000f, 0.707107f, -0.707107f, -0.000000f, 0.704100f, -0.710100f, 0.750000f, 0.750000f, 
-		0.000000f, 0.831470f, -0.555570f, -0.000000f, 0.828600f, -0.559800f, 0.750000f, 0.812500f, 
-		0.108386f, 0.831470f, -0.544895f, 0.109200f, 0.828600f, -0.549000f, 0.718750f, 0.812500f, 
-		0.000000f, -0.555570f, -0.831470f, -0.000000f, -0.552800f, -0.833300f, 0.750000f, 0.312500f, 
-		0.162212f, -0.555570f, -0.815493f, 0.162600f, -0.552800f, -0.817300f, 0.718750f, 0.312500f, 
-		0.137950f, -0.707107f, -0.693520f, 0.138500f, -0.704100f, -0.696500f, 0.718750f, 0.250000f, 
-		0.000000f, 0.555570f, -0.831470f, -0.000000f, 0.552800f, -0.833300f, 0.750000f, 0.687500f, 
-		0.000000f, 0.707107f, -0.707107f, -0.000000f, 0.704100f, -0.710100f, 0.750000f, 0.750000f, 
-		0.137950f, 0.707107f, -0.693520f, 0.138500f, 0.704100f, -0.696500f, 0.718750f, 0.750000f, 
-		0.000000f, -0.707107f, -0.707107f, -0.000000f, -0.704100f, -0.710100f, 0.750000f, 0.250000f, 
-		0.137950f, -0.707107f, -0.693520f, 0.138500f, -0.704100f, -0.696500f, 0.718750f, 0.250000f, 
-		0.108386f, -0.831470f, -0.544895f, 0.109200f, -0.828600f, -0.549000f, 0.718750f, 0.187500f, 
-		0.000000f, 0.382683f, -0.923879f, -0.000000f, 0.380500f, -0.924800f, 0.750000f, 0.625000f, 
-		0.000000f, 0.555570f, -0.831470f, -0.000000f, 0.552800f, -0.833300f, 0.750000f, 0.687500f, 
-		0.162212f, 0.555570f, -0.815493f, 0.162600f, 0.552800f, -0.817300f, 0.718750f, 0.687500f, 
-		0.000000f, -0.831470f, -0.555570f, -0.000000f, -0.828600f, -0.559800f, 0.750000f, 0.187500f, 
-		0.108386f, -0.831470f, -0.544895f, 0.109200f, -0.828600f, -0.549000f, 0.718750f, 0.187500f, 
-		0.074658f, -0.923880f, -0.375330f, 0.075700f, -0.921700f, -0.380400f, 0.718750f, 0.125000f, 
-		0.000000f, 0.195090f, -0.980785f, -0.000000f, 0.193900f, -0.981000f, 0.750000f, 0.562500f, 
-		0.000000f, 0.382683f, -0.923879f, -0.000000f, 0.380500f, -0.924800f, 0.750000f, 0.625000f, 
-		0.180240f, 0.382683f, -0.906127f, 0.180400f, 0.380500f, -0.907000f, 0.718750f, 0.625000f, 
-		0.000000f, -0.923880f, -0.382683f, -0.000000f, -0.921700f, -0.387900f, 0.750000f, 0.125000f, 
-		0.074658f, -0.923880f, -0.375330f, 0.075700f, -0.921700f, -0.380400f, 0.718750f, 0.125000f, 
-		0.038060f, -0.980785f, -0.191342f, 0.039200f, -0.979600f, -0.197100f, 0.718750f, 0.062500f, 
-		0.000000f, 0.195090f, -0.980785f, -0.000000f, 0.193900f, -0.981000f, 0.750000f, 0.562500f, 
-		0.191342f, 0.195090f, -0.961940f, 0.191400f, 0.193900f, -0.962200f, 0.718750f, 0.562500f, 
-		0.195090f, 0.000000f, -0.980785f, 0.195100f, -0.000000f, -0.980800f, 0.718750f, 0.500000f, 
-		0.000000f, 0.000000f, -1.000000f, -0.000000f, -0.000000f, -1.000000f, 0.750000f, 0.500000f, 
-		0.195090f, 0.000000f, -0.980785f, 0.195100f, -0.000000f, -0.980800f, 0.718750f, 0.500000f, 
-		0.191342f, -0.195090f, -0.961940f, 0.191400f, -0.193900f, -0.962200f, 0.718750f, 0.437500f, 
-		0.000000f, 0.923880f, -0.382683f, -0.000000f, 0.921700f, -0.387900f, 0.750000f, 0.875000f, 
-		0.000000f, 0.980785f, -0.195090f, -0.000000f, 0.979600f, -0.201000f, 0.750000f, 0.937500f, 
-		0.038060f, 0.980785f, -0.191342f, 0.039200f, 0.979600f, -0.197100f, 0.718750f, 0.937500f, 
-		0.195090f, 0.000000f, -0.980785f, 0.195100f, -0.000000f, -0.980800f, 0.718750f, 0.500000f, 
-		0.382683f, 0.000000f, -0.923879f, 0.382700f, -0.000000f, -0.923900f, 0.687500f, 0.500000f, 
-		0.375330f, -0.195090f, -0.906127f, 0.375400f, -0.193900f, -0.906300f, 0.687500f, 0.437500f, 
-		0.038060f, 0.980785f, -0.191342f, 0.039200f, 0.979600f, -0.197100f, 0.718750f, 0.937500f, 
-		0.074658f, 0.980785f, -0.180240f, 0.076900f, 0.979600f, -0.185700f, 0.687500f, 0.937500f, 
-		0.146447f, 0.923880f, -0.353553f, 0.148400f, 0.921700f, -0.358400f, 0.687500f, 0.875000f, 
-		0.191342f, -0.195090f, -0.961940f, 0.191400f, -0.193900f, -0.962200f, 0.718750f, 0.437500f, 
-		0.375330f, -0.195090f, -0.906127f, 0.375400f, -0.193900f, -0.906300f, 0.687500f, 0.437500f, 
-		0.353553f, -0.382683f, -0.853553f, 0.353900f, -0.380500f, -0.854400f, 0.687500f, 0.375000f, 
-		0.074658f, 0.923880f, -0.375330f, 0.075700f, 0.921700f, -0.380400f, 0.718750f, 0.875000f, 
-		0.146447f, 0.923880f, -0.353553f, 0.148400f, 0.921700f, -0.358400f, 0.687500f, 0.875000f, 
-		0.212608f, 0.831470f, -0.513280f, 0.214200f, 0.828600f, -0.517200f, 0.687500f, 0.812500f, 
-		0.180240f, -0.382683f, -0.906127f, 0.180400f, -0.380500f, -0.907000f, 0.718750f, 0.375000f, 
-		0.353553f, -0.382683f, -0.853553f, 0.353900f, -0.380500f, -0.854400f, 0.687500f, 0.375000f, 
-		0.318190f, -0.555570f, -0.768178f, 0.318900f, -0.552800f, -0.769900f, 0.687500f, 0.312500f, 
-		0.108386f, 0.831470f, -0.544895f, 0.109200f, 0.828600f, -0.549000f, 0.718750f, 0.812500f, 
-		0.212608f, 0.831470f, -0.513280f, 0.214200f, 0.828600f, -0.517200f, 0.687500f, 0.812500f, 
-		0.270598f, 0.707107f, -0.653281f, 0.271800f, 0.704100f, -0.656100f, 0.687500f, 0.750000f, 
-		0.162212f, -0.555570f, -0.815493f, 0.162600f, -0.552800f, -0.817300f, 0.718750f, 0.312500f, 
-		0.318190f, -0.555570f, -0.768178f, 0.318900f, -0.552800f, -0.769900f, 0.687500f, 0.312500f, 
-		0.270598f, -0.707107f, -0.653281f, 0.271800f, -0.704100f, -0.656100f, 0.687500f, 0.250000f, 
-		0.137950f, 0.707107f, -0.693520f, 0.138500f, 0.704100f, -0.696500f, 0.718750f, 0.750000f, 
-		0.270598f, 0.707107f, -0.653281f, 0.271800f, 0.704100f, -0.656100f, 0.687500f, 0.750000f, 
-		0.318190f, 0.555570f, -0.768178f, 0.318900f, 0.552800f, -0.769900f, 0.687500f, 0.687500f, 
-		0.108386f, -0.831470f, -0.544895f, 0.109200f, -0.828600f, -0.549000f, 0.718750f, 0.187500f, 
-		0.137950f, -0.707107f, -0.693520f, 0.138500f, -0.704100f, -0.696500f, 0.718750f, 0.250000f, 
-		0.270598f, -0.707107f, -0.653281f, 0.271800f, -0.704100f, -0.656100f, 0.687500f, 0.250000f, 
-		0.162212f, 0.555570f, -0.815493f, 0.162600f, 0.552800f, -0.817300f, 0.718750f, 0.687500f, 
-		0.318190f, 0.555570f, -0.768178f, 0.318900f, 0.552800f, -0.769900f, 0.687500f, 0.687500f, 
-		0.353553f, 0.382683f, -0.853553f, 0.353900f, 0.380500f, -0.854400f, 0.687500f, 0.625000f, 
-		0.074658f, -0.923880f, -0.375330f, 0.075700f, -0.921700f, -0.380400f, 0.718750f, 0.125000f, 
-		0.108386f, -0.831470f, -0.544895f, 0.109200f, -0.828600f, -0.549000f, 0.718750f, 0.187500f, 
-		0.212608f, -0.831470f, -0.513280f, 0.214200f, -0.828600f, -0.517200f, 0.687500f, 0.187500f, 
-		0.191342f, 0.195090f, -0.961940f, 0.191400f, 0.193900f, -0.962200f, 0.718750f, 0.562500f, 
-		0.180240f, 0.382683f, -0.906127f, 0.180400f, 0.380500f, -0.907000f, 0.718750f, 0.625000f, 
-		0.353553f, 0.382683f, -0.853553f, 0.353900f, 0.380500f, -0.854400f, 0.687500f, 0.625000f, 
-		0.074658f, -0.923880f, -0.375330f, 0.075700f, -0.921700f, -0.380400f, 0.718750f, 0.125000f, 
-		0.146447f, -0.923880f, -0.353553f, 0.148400f, -0.921700f, -0.358400f, 0.687500f, 0.125000f, 
-		0.074658f, -0.980785f, -0.180240f, 0.076900f, -0.979600f, -0.185700f, 0.687500f, 0.062500f, 
-		0.191342f, 0.195090f, -0.961940f, 0.191400f, 0.193900f, -0.962200f, 0.718750f, 0.562500f, 
-		0.375330f, 0.195090f, -0.906127f, 0.375400f, 0.193900f, -0.906300f, 0.687500f, 0.562500f, 
-		0.382683f, 0.000000f, -0.923879f, 0.382700f, -0.000000f, -0.923900f, 0.687500f, 0.500000f, 
-		0.212608f, -0.831470f, -0.513280f, 0.214200f, -0.828600f, -0.517200f, 0.687500f, 0.187500f, 
-		0.270598f, -0.707107f, -0.653281f, 0.271800f, -0.704100f, -0.656100f, 0.687500f, 0.250000f, 
-		0.392847f, -0.707107f, -0.587938f, 0.394500f, -0.704100f, -0.590500f, 0.656250f, 0.250000f, 
-		0.318190f, 0.555570f, -0.768178f, 0.318900f, 0.552800f, -0.769900f, 0.687500f, 0.687500f, 
-		0.461940f, 0.555570f, -0.691342f, 0.463000f, 0.552800f, -0.692900f, 0.656250f, 0.687500f, 
-		0.513280f, 0.382683f, -0.768178f, 0.513800f, 0.380500f, -0.768900f, 0.656250f, 0.625000f, 
-		0.212608f, -0.831470f, -0.513280f, 0.214200f, -0.828600f, -0.517200f, 0.687500f, 0.187500f, 
-		0.308658f, -0.831470f, -0.461940f, 0.311000f, -0.828600f, -0.465400f, 0.656250f, 0.187500f, 
-		0.212608f, -0.923880f, -0.318190f, 0.215500f, -0.921700f, -0.322500f, 0.656250f, 0.125000f, 
-		0.353553f, 0.382683f, -0.853553f, 0.353900f, 0.380500f, -0.854400f, 0.687500f, 0.625000f, 
-		0.513280f, 0.382683f, -0.768178f, 0.513800f, 0.380500f, -0.768900f, 0.656250f, 0.625000f, 
-		0.544895f, 0.195090f, -0.815493f, 0.545000f, 0.193900f, -0.815700f, 0.656250f, 0.562500f, 
-		0.146447f, -0.923880f, -0.353553f, 0.148400f, -0.921700f, -0.358400f, 0.687500f, 0.125000f, 
-		0.212608f, -0.923880f, -0.318190f, 0.215500f, -0.921700f, -0.322500f, 0.656250f, 0.125000f, 
-		0.108386f, -0.980785f, -0.162212f, 0.111700f, -0.979600f, -0.167100f, 0.656250f, 0.062500f, 
-		0.375330f, 0.195090f, -0.906127f, 0.375400f, 0.193900f, -0.906300f, 0.687500f, 0.562500f, 
-		0.544895f, 0.195090f, -0.815493f, 0.545000f, 0.193900f, -0.815700f, 0.656250f, 0.562500f, 
-		0.555570f, 0.000000f, -0.831469f, 0.555600f, -0.000000f, -0.831500f, 0.656250f, 0.500000f, 
-		0.375330f, -0.195090f, -0.906127f, 0.375400f, -0.193900f, -0.906300f, 0.687500f, 0.437500f, 
-		0.382683f, 0.000000f, -0.923879f, 0.382700f, -0.000000f, -0.923900f, 0.687500f, 0.500000f, 
-		0.555570f, 0.000000f, -0.831469f, 0.555600f, -0.000000f, -0.831500f, 0.656250f, 0.500000f, 
-		0.074658f, 0.980785f, -0.180240f, 0.076900f, 0.979600f, -0.185700f, 0.687500f, 0.937500f, 
-		0.108386f, 0.980785f, -0.162212f, 0.111700f, 0.979600f, -0.167100f, 0.656250f, 0.937500f, 
-		0.212608f, 0.923880f, -0.318190f, 0.215500f, 0.921700f, -0.322500f, 0.656250f, 0.875000f, 
-		0.375330f, -0.195090f, -0.906127f, 0.375400f, -0.193900f, -0.906300f, 0.687500f, 0.437500f, 
-		0.544895f, -0.195090f, -0.815493f, 0.545000f, -0.193900f, -0.815700f, 0.656250f, 0.437500f, 
-		0.513280f, -0.382683f, -0.768178f, 0.513800f, -0.380500f, -0.768900f, 0.656250f, 0.375000f, 
-		0.146447f, 0.923880f, -0.353553f, 0.148400f, 0.921700f, -0.358400f, 0.687500f, 0.875000f, 
-		0.212608f, 0.923880f, -0.318190f, 0.215500f, 0.921700f, -0.322500f, 0.656250f, 0.875000f, 
-		0.308658f, 0.831470f, -0.461940f, 0.311000f, 0.828600f, -0.465400f, 0.656250f, 0.812500f, 
-		0.318190f, -0.555570f, -0.768178f, 0.318900f, -0.552800f, -0.769900f, 0.687500f, 0.312500f, 
-		0.353553f, -0.382683f, -0.853553f, 0.353900f, -0.380500f, -0.854400f, 0.687500f, 0.375000f, 
-		0.513280f, -0.382683f, -0.768178f, 0.513800f, -0.380500f, -0.768900f, 0.656250f, 0.375000f, 
-		0.212608f, 0.831470f, -0.513280f, 0.214200f, 0.828600f, -0.517200f, 0.687500f, 0.812500f, 
-		0.308658f, 0.831470f, -0.461940f, 0.311000f, 0.828600f, -0.465400f, 0.656250f, 0.812500f, 
-		0.392847f, 0.707107f, -0.587938f, 0.394500f, 0.704100f, -0.590500f, 0.656250f, 0.750000f, 
-		0.270598f, -0.707107f, -0.653281f, 0.271800f, -0.704100f, -0.656100f, 0.687500f, 0.250000f, 
-		0.318190f, -0.555570f, -0.768178f, 0.318900f, -0.552800f, -0.769900f, 0.687500f, 0.312500f, 
-		0.461940f, -0.555570f, -0.691342f, 0.463000f, -0.552800f, -0.692900f, 0.656250f, 0.312500f, 
-		0.270598f, 0.707107f, -0.653281f, 0.271800f, 0.704100f, -0.656100f, 0.687500f, 0.750000f, 
-		0.392847f, 0.707107f, -0.587938f, 0.394500f, 0.704100f, -0.590500f, 0.656250f, 0.750000f, 
-		0.461940f, 0.555570f, -0.691342f, 0.463000f, 0.552800f, -0.692900f, 0.656250f, 0.687500f, 
-		0.108386f, 0.980785f, -0.162212f, 0.111700f, 0.979600f, -0.167100f, 0.656250f, 0.937500f, 
-		0.137950f, 0.980785f, -0.137950f, 0.142100f, 0.979600f, -0.142100f, 0.625000f, 0.937500f, 
-		0.270598f, 0.923880f, -0.270598f, 0.274300f, 0.921700f, -0.274300f, 0.625000f, 0.875000f, 
-		0.544895f, -0.195090f, -0.815493f, 0.545000f, -0.193900f, -0.815700f, 0.656250f, 0.437500f, 
-		0.693520f, -0.195090f, -0.693520f, 0.693700f, -0.193900f, -0.693700f, 0.625000f, 0.437500f, 
-		0.653281f, -0.382683f, -0.653281f, 0.653900f, -0.380500f, -0.653900f, 0.625000f, 0.375000f, 
-		0.212608f, 0.923880f, -0.318190f, 0.215500f, 0.921700f, -0.322500f, 0.656250f, 0.875000f, 
-		0.270598f, 0.923880f, -0.270598f, 0.274300f, 0.921700f, -0.274300f, 0.625000f, 0.875000f, 
-		0.392847f, 0.831470f, -0.392847f, 0.395800f, 0.828600f, -0.395800f, 0.625000f, 0.812500f, 
-		0.461940f, -0.555570f, -0.691342f, 0.463000f, -0.552800f, -0.692900f, 0.656250f, 0.312500f, 
-		0.513280f, -0.382683f, -0.768178f, 0.513800f, -0.380500f, -0.768900f, 0.656250f, 0.375000f, 
-		0.653281f, -0.382683f, -0.653281f, 0.653900f, -0.380500f, -0.653900f, 0.625000f, 0.375000f, 
-		0.308658f, 0.831470f, -0.461940f, 0.311000f, 0.828600f, -0.465400f, 0.656250f, 0.812500f, 
-		0.392847f, 0.831470f, -0.392847f, 0.395800f, 0.828600f, -0.395800f, 0.625000f, 0.812500f, 
-		0.500000f, 0.707107f, -0.500000f, 0.502100f, 0.704100f, -0.502100f, 0.625000f, 0.750000f, 
-		0.461940f, -0.555570f, -0.691342f, 0.463000f, -0.552800f, -0.692900f, 0.656250f, 0.312500f, 
-		0.587938f, -0.555570f, -0.587938f, 0.589300f, -0.552800f, -0.589300f, 0.625000f, 0.312500f, 
-		0.500000f, -0.707107f, -0.500000f, 0.502100f, -0.704100f, -0.502100f, 0.625000f, 0.250000f, 
-		0.392847f, 0.707107f, -0.587938f, 0.394500f, 0.704100f, -0.590500f, 0.656250f, 0.750000f, 
-		0.500000f, 0.707107f, -0.500000f, 0.502100f, 0.704100f, -0.502100f, 0.625000f, 0.750000f, 
-		0.587938f, 0.555570f, -0.587938f, 0.589300f, 0.552800f, -0.589300f, 0.625000f, 0.687500f, 
-		0.392847f, -0.707107f, -0.587938f, 0.394500f, -0.704100f, -0.590500f, 0.656250f, 0.250000f, 
-		0.500000f, -0.707107f, -0.500000f, 0.502100f, -0.704100f, -0.502100f, 0.625000f, 0.250000f, 
-		0.392847f, -0.831470f, -0.392847f, 0.395800f, -0.828600f, -0.395800f, 0.625000f, 0.187500f, 
-		0.461940f, 0.555570f, -0.691342f, 0.463000f, 0.552800f, -0.692900f, 0.656250f, 0.687500f, 
-		0.587938f, 0.555570f, -0.587938f, 0.589300f, 0.552800f, -0.589300f, 0.625000f, 0.687500f, 
-		0.653281f, 0.382683f, -0.653281f, 0.653900f, 0.380500f, -0.653900f, 0.625000f, 0.625000f, 
-		0.308658f, -0.831470f, -0.461940f, 0.311000f, -0.828600f, -0.465400f, 0.656250f, 0.187500f, 
-		0.392847f, -0.831470f, -0.392847f, 0.395800f, -0.828600f, -0.395800f, 0.625000f, 0.187500f, 
-		0.270598f, -0.923880f, -0.270598f, 0.274300f, -0.921700f, -0.274300f, 0.625000f, 0.125000f, 
-		0.544895f, 0.195090f, -0.815493f, 0.545000f, 0.193900f, -0.815700f, 0.656250f, 0.562500f, 
-		0.513280f, 0.382683f, -0.768178f, 0.513800f, 0.380500f, -0.768900f, 0.656250f, 0.625000f, 
-		0.653281f, 0.382683f, -0.653281f, 0.653900f, 0.380500f, -0.653900f, 0.625000f, 0.625000f, 
-		0.212608f, -0.923880f, -0.318190f, 0.215500f, -0.921700f, -0.322500f, 0.656250f, 0.125000f, 
-		0.270598f, -0.923880f, -0.270598f, 0.274300f, -0.921700f, -0.274300f, 0.625000f, 0.125000f, 
-		0.137950f, -0.980785f, -0.137950f, 0.142100f, -0.979600f, -0.142100f, 0.625000f, 0.062500f, 
-		0.555570f, 0.000000f, -0.831469f, 0.555600f, -0.000000f, -0.831500f, 0.656250f, 0.500000f, 
-		0.544895f, 0.195090f, -0.815493f, 0.545000f, 0.193900f, -0.815700f, 0.656250f, 0.562500f, 
-		0.693520f, 0.195090f, -0.693520f, 0.693700f, 0.193900f, -0.693700f, 0.625000f, 0.562500f, 
-		0.555570f, 0.000000f, -0.831469f, 0.555600f, -0.000000f, -0.831500f, 0.656250f, 0.500000f, 
-		0.707107f, 0.000000f, -0.707107f, 0.707100f, -0.000000f, -0.707100f, 0.625000f, 0.500000f, 
-		0.693520f, -0.195090f, -0.693520f, 0.693700f, -0.193900f, -0.693700f, 0.625000f, 0.437500f, 
-		0.587938f, 0.555570f, -0.587938f, 0.589300f, 0.552800f, -0.589300f, 0.625000f, 0.687500f, 
-		0.691342f, 0.555570f, -0.461940f, 0.692900f, 0.552800f, -0.463000f, 0.593750f, 0.687500f, 
-		0.768178f, 0.382683f, -0.513280f, 0.768900f, 0.380500f, -0.513800f, 0.593750f, 0.625000f, 
-		0.270598f, -0.923880f, -0.270598f, 0.274300f, -0.921700f, -0.274300f, 0.625000f, 0.125000f, 
-		0.392847f, -0.831470f, -0.392847f, 0.395800f, -0.828600f, -0.395800f, 0.625000f, 0.187500f, 
-		0.461940f, -0.831470f, -0.308658f, 0.465400f, -0.828600f, -0.311000f, 0.593750f, 0.187500f, 
-		0.693520f, 0.195090f, -0.693520f, 0.693700f, 0.193900f, -0.693700f, 0.625000f, 0.562500f, 
-		0.653281f, 0.382683f, -0.653281f, 0.653900f, 0.380500f, -0.653900f, 0.625000f, 0.625000f, 
-		0.768178f, 0.382683f, -0.513280f, 0.768900f, 0.380500f, -0.513800f, 0.593750f, 0.625000f, 
-		0.270598f, -0.923880f, -0.270598f, 0.274300f, -0.921700f, -0.274300f, 0.625000f, 0.125000f, 
-		0.318190f, -0.923880f, -0.212608f, 0.322500f, -0.921700f, -0.215500f, 0.593750f, 0.125000f, 
-		0.162212f, -0.980785f, -0.108386f, 0.167100f, -0.979600f, -0.111700f, 0.593750f, 0.062500f, 
-		0.707107f, 0.000000f, -0.707107f, 0.707100f, -0.000000f, -0.707100f, 0.625000f, 0.500000f, 
-		0.693520f, 0.195090f, -0.693520f, 0.693700f, 0.193900f, -0.693700f, 0.625000f, 0.562500f, 
-		0.815493f, 0.195090f, -0.544895f, 0.815700f, 0.193900f, -0.545000f, 0.593750f, 0.562500f, 
-		0.707107f, 0.000000f, -0.707107f, 0.707100f, -0.000000f, -0.707100f, 0.625000f, 0.500000f, 
-		0.831470f, 0.000000f, -0.555570f, 0.831500f, -0.000000f, -0.555600f, 0.593750f, 0.500000f, 
-		0.815493f, -0.195090f, -0.544895f, 0.815700f, -0.193900f, -0.545000f, 0.593750f, 0.437500f, 
-		0.137950f, 0.980785f, -0.137950f, 0.142100f, 0.979600f, -0.142100f, 0.625000f, 0.937500f, 
-		0.162212f, 0.980785f, -0.108386f, 0.167100f, 0.979600f, -0.111700f, 0.593750f, 0.937500f, 
-		0.318190f, 0.923880f, -0.212608f, 0.322500f, 0.921700f, -0.215500f, 0.593750f, 0.875000f, 
-		0.693520f, -0.195090f, -0.693520f, 0.693700f, -0.193900f, -0.693700f, 0.625000f, 0.437500f, 
-		0.815493f, -0.195090f, -0.544895f, 0.815700f, -0.193900f, -0.545000f, 0.593750f, 0.437500f, 
-		0.768178f, -0.382683f, -0.513280f, 0.768900f, -0.380500f, -0.513800f, 0.593750f, 0.375000f, 
-		0.270598f, 0.923880f, -0.270598f, 0.274300f, 0.921700f, -0.274300f, 0.625000f, 0.875000f, 
-		0.318190f, 0.923880f, -0.212608f, 0.322500f, 0.921700f, -0.215500f, 0.593750f, 0.875000f, 
-		0.461940f, 0.831470f, -0.308658f, 0.465400f, 0.828600f, -0.311000f, 0.593750f, 0.812500f, 
-		0.587938f, -0.555570f, -0.587938f, 0.589300f, -0.552800f, -0.589300f, 0.625000f, 0.312500f, 
-		0.653281f, -0.382683f, -0.653281f, 0.653900f, -0.380500f, -0.653900f, 0.625000f, 0.375000f, 
-		0.768178f, -0.382683f, -0.513280f, 0.768900f, -0.380500f, -0.513800f, 0.593750f, 0.375000f, 
-		0.392847f, 0.831470f, -0.392847f, 0.395800f, 0.828600f, -0.395800f, 0.625000f, 0.812500f, 
-		0.461940f, 0.831470f, -0.308658f, 0.465400f, 0.828600f, -0.311000f, 0.593750f, 0.812500f, 
-		0.587938f, 0.707107f, -0.392847f, 0.590500f, 0.704100f, -0.394500f, 0.593750f, 0.750000f, 
-		0.587938f, -0.555570f, -0.587938f, 0.589300f, -0.552800f, -0.589300f, 0.625000f, 0.312500f, 
-		0.691342f, -0.555570f, -0.461940f, 0.692900f, -0.552800f, -0.463000f, 0.593750f, 0.312500f, 
-		0.587938f, -0.707107f, -0.392847f, 0.590500f, -0.704100f, -0.394500f, 0.593750f, 0.250000f, 
-		0.587938f, 0.555570f, -0.587938f, 0.589300f, 0.552800f, -0.589300f, 0.625000f, 0.687500f, 
-		0.500000f, 0.707107f, -0.500000f, 0.502100f, 0.704100f, -0.502100f, 0.625000f, 0.750000f, 
-		0.587938f, 0.707107f, -0.392847f, 0.590500f, 0.704100f, -0.394500f, 0.593750f, 0.750000f, 
-		0.500000f, -0.707107f, -0.500000f, 0.502100f, -0.704100f, -0.502100f, 0.625000f, 0.250000f, 
-		0.587938f, -0.707107f, -0.392847f, 0.590500f, -0.704100f, -0.394500f, 0.593750f, 0.250000f, 
-		0.461940f, -0.831470f, -0.308658f, 0.465400f, -0.828600f, -0.311000f, 0.593750f, 0.187500f, 
-		0.815493f, -0.195090f, -0.544895f, 0.815700f, -0.193900f, -0.545000f, 0.593750f, 0.437500f, 
-		0.906127f, -0.195090f, -0.375330f, 0.906300f, -0.193900f, -0.375400f, 0.562500f, 0.437500f, 
-		0.853553f, -0.382683f, -0.353553f, 0.854400f, -0.380500f, -0.353900f, 0.562500f, 0.375000f, 
-		0.318190f, 0.923880f, -0.212608f, 0.322500f, 0.921700f, -0.215500f, 0.593750f, 0.875000f, 
-		0.353553f, 0.923880f, -0.146447f, 0.358400f, 0.921700f, -0.148400f, 0.562500f, 0.875000f, 
-		0.513280f, 0.831470f, -0.212607f, 0.517200f, 0.828600f, -0.214200f, 0.562500f, 0.812500f, 
-		0.691342f, -0.555570f, -0.461940f, 0.692900f, -0.552800f, -0.463000f, 0.593750f, 0.312500f, 
-		0.768178f, -0.382683f, -0.513280f, 0.768900f, -0.380500f, -0.513800f, 0.593750f, 0.375000f, 
-		0.853553f, -0.382683f, -0.353553f, 0.854400f, -0.380500f, -0.353900f, 0.562500f, 0.375000f, 
-		0.461940f, 0.831470f, -0.308658f, 0.465400f, 0.828600f, -0.311000f, 0.593750f, 0.812500f, 
-		0.513280f, 0.831470f, -0.212607f, 0.517200f, 0.828600f, -0.214200f, 0.562500f, 0.812500f, 
-		0.653281f, 0.707107f, -0.270598f, 0.656100f, 0.704100f, -0.271800f, 0.562500f, 0.750000f, 
-		0.691342f, -0.555570f, -0.461940f, 0.692900f, -0.552800f, -0.463000f, 0.593750f, 0.312500f, 
-		0.768178f, -0.555570f, -0.318190f, 0.769900f, -0.552800f, -0.318900f, 0.562500f, 0.312500f, 
-		0.653281f, -0.707107f, -0.270598f, 0.656100f, -0.704100f, -0.271800f, 0.562500f, 0.250000f, 
-		0.691342f, 0.555570f, -0.461940f, 0.692900f, 0.552800f, -0.463000f, 0.593750f, 0.687500f, 
-		0.587938f, 0.707107f, -0.392847f, 0.590500f, 0.704100f, -0.394500f, 0.593750f, 0.750000f, 
-		0.653281f, 0.707107f, -0.270598f, 0.656100f, 0.704100f, -0.271800f, 0.562500f, 0.750000f, 
-		0.587938f, -0.707107f, -0.392847f, 0.590500f, -0.704100f, -0.394500f, 0.593750f, 0.250000f, 
-		0.653281f, -0.707107f, -0.270598f, 0.656100f, -0.704100f, -0.271800f, 0.562500f, 0.250000f, 
-		0.513280f, -0.831470f, -0.212607f, 0.517200f, -0.828600f, -0.214200f, 0.562500f, 0.187500f, 
-		0.691342f, 0.555570f, -0.461940f, 0.692900f, 0.552800f, -0.463000f, 0.593750f, 0.687500f, 
-		0.768178f, 0.555570f, -0.318190f, 0.769900f, 0.552800f, -0.318900f, 0.562500f, 0.687500f, 
-		0.853553f, 0.382683f, -0.353553f, 0.854400f, 0.380500f, -0.353900f, 0.562500f, 0.625000f, 
-		0.461940f, -0.831470f, -0.308658f, 0.465400f, -0.828600f, -0.311000f, 0.593750f, 0.187500f, 
-		0.513280f, -0.831470f, -0.212607f, 0.517200f, -0.828600f, -0.214200f, 0.562500f, 0.187500f, 
-		0.353553f, -0.923880f, -0.146447f, 0.358400f, -0.921700f, -0.148400f, 0.562500f, 0.125000f, 
-		0.815493f, 0.195090f, -0.544895f, 0.815700f, 0.193900f, -0.545000f, 0.593750f, 0.562500f, 
-		0.768178f, 0.382683f, -0.513280f, 0.768900f, 0.380500f, -0.513800f, 0.593750f, 0.625000f, 
-		0.853553f, 0.382683f, -0.353553f, 0.854400f, 0.380500f, -0.353900f, 0.562500f, 0.625000f, 
-		0.162212f, -0.980785f, -0.108386f, 0.167100f, -0.979600f, -0.111700f, 0.593750f, 0.062500f, 
-		0.318190f, -0.923880f, -0.212608f, 0.322500f, -0.921700f, -0.215500f, 0.593750f, 0.125000f, 
-		0.353553f, -0.923880f, -0.146447f, 0.358400f, -0.921700f, -0.148400f, 0.562500f, 0.125000f, 
-		0.831470f, 0.000000f, -0.555570f, 0.831500f, -0.000000f, -0.555600f, 0.593750f, 0.500000f, 
-		0.815493f, 0.195090f, -0.544895f, 0.815700f, 0.193900f, -0.545000f, 0.593750f, 0.562500f, 
-		0.906127f, 0.195090f, -0.375330f, 0.906300f, 0.193900f, -0.375400f, 0.562500f, 0.562500f, 
-		0.831470f, 0.000000f, -0.555570f, 0.831500f, -0.000000f, -0.555600f, 0.593750f, 0.500000f, 
-		0.923879f, 0.000000f, -0.382683f, 0.923900f, -0.000000f, -0.382700f, 0.562500f, 0.500000f, 
-		0.906127f, -0.195090f, -0.375330f, 0.906300f, -0.193900f, -0.375400f, 0.562500f, 0.437500f, 
-		0.162212f, 0.980785f, -0.108386f, 0.167100f, 0.979600f, -0.111700f, 0.593750f, 0.937500f, 
-		0.180240f, 0.980785f, -0.074658f, 0.185700f, 0.979600f, -0.076900f, 0.562500f, 0.937500f, 
-		0.353553f, 0.923880f, -0.146447f, 0.358400f, 0.921700f, -0.148400f, 0.562500f, 0.875000f, 
-		0.353553f, -0.923880f, -0.146447f, 0.358400f, -0.921700f, -0.148400f, 0.562500f, 0.125000f, 
-		0.513280f, -0.831470f, -0.212607f, 0.517200f, -0.828600f, -0.214200f, 0.562500f, 0.187500f, 
-		0.544895f, -0.831470f, -0.108386f, 0.549000f, -0.828600f, -0.109200f, 0.531250f, 0.187500f, 
-		0.906127f, 0.195090f, -0.375330f, 0.906300f, 0.193900f, -0.375400f, 0.562500f, 0.562500f, 
-		0.853553f, 0.382683f, -0.353553f, 0.854400f, 0.380500f, -0.353900f, 0.562500f, 0.625000f, 
-		0.906127f, 0.382683f, -0.180240f, 0.907000f, 0.380500f, -0.180400f, 0.531250f, 0.625000f, 
-		0.353553f, -0.923880f, -0.146447f, 0.358400f, -0.921700f, -0.148400f, 0.562500f, 0.125000f, 
-		0.375330f, -0.923880f, -0.074658f, 0.380400f, -0.921700f, -0.075700f, 0.531250f, 0.125000f, 
-		0.191342f, -0.980785f, -0.038060f, 0.197100f, -0.979600f, -0.039200f, 0.531250f, 0.062500f, 
-		0.923879f, 0.000000f, -0.382683f, 0.923900f, -0.000000f, -0.382700f, 0.562500f, 0.500000f, 
-		0.906127f, 0.195090f, -0.375330f, 0.906300f, 0.193900f, -0.375400f, 0.562500f, 0.562500f, 
-		0.961940f, 0.195090f, -0.191342f, 0.962200f, 0.193900f, -0.191400f, 0.531250f, 0.562500f, 
-		0.923879f, 0.000000f, -0.382683f, 0.923900f, -0.000000f, -0.382700f, 0.562500f, 0.500000f, 
-		0.980785f, 0.000000f, -0.195090f, 0.980800f, -0.000000f, -0.195100f, 0.531250f, 0.500000f, 
-		0.961940f, -0.195090f, -0.191342f, 0.962200f, -0.193900f, -0.191400f, 0.531250f, 0.437500f, 
-		0.353553f, 0.923880f, -0.146447f, 0.358400f, 0.921700f, -0.148400f, 0.562500f, 0.875000f, 
-		0.180240f, 0.980785f, -0.074658f, 0.185700f, 0.979600f, -0.076900f, 0.562500f, 0.937500f, 
-		0.191342f, 0.980785f, -0.038060f, 0.197100f, 0.979600f, -0.039200f, 0.531250f, 0.937500f, 
-		0.906127f, -0.195090f, -0.375330f, 0.906300f, -0.193900f, -0.375400f, 0.562500f, 0.437500f, 
-		0.961940f, -0.195090f, -0.191342f, 0.962200f, -0.193900f, -0.191400f, 0.531250f, 0.437500f, 
-		0.906127f, -0.382683f, -0.180240f, 0.907000f, -0.380500f, -0.180400f, 0.531250f, 0.375000f, 
-		0.353553f, 0.923880f, -0.146447f, 0.358400f, 0.921700f, -0.148400f, 0.562500f, 0.875000f, 
-		0.375330f, 0.923880f, -0.074658f, 0.380400f, 0.921700f, -0.075700f, 0.531250f, 0.875000f, 
-		0.544895f, 0.831470f, -0.108386f, 0.549000f, 0.828600f, -0.109200f, 0.531250f, 0.812500f, 
-		0.768178f, -0.555570f, -0.318190f, 0.769900f, -0.552800f, -0.318900f, 0.562500f, 0.312500f, 
-		0.853553f, -0.382683f, -0.353553f, 0.854400f, -0.380500f, -0.353900f, 0.562500f, 0.375000f, 
-		0.906127f, -0.382683f, -0.180240f, 0.907000f, -0.380500f, -0.180400f, 0.531250f, 0.375000f, 
-		0.513280f, 0.831470f, -0.212607f, 0.517200f, 0.828600f, -0.214200f, 0.562500f, 0.812500f, 
-		0.544895f, 0.831470f, -0.108386f, 0.549000f, 0.828600f, -0.109200f, 0.531250f, 0.812500f, 
-		0.693520f, 0.707107f, -0.137950f, 0.696500f, 0.704100f, -0.138500f, 0.531250f, 0.750000f, 
-		0.768178f, -0.555570f, -0.318190f, 0.769900f, -0.552800f, -0.318900f, 0.562500f, 0.312500f, 
-		0.815493f, -0.555570f, -0.162212f, 0.817300f, -0.552800f, -0.162600f, 0.531250f, 0.312500f, 
-		0.693520f, -0.707107f, -0.137950f, 0.696500f, -0.704100f, -0.138500f, 0.531250f, 0.250000f, 
-		0.768178f, 0.555570f, -0.318190f, 0.769900f, 0.552800f, -0.318900f, 0.562500f, 0.687500f, 
-		0.653281f, 0.707107f, -0.270598f, 0.656100f, 0.704100f, -0.271800f, 0.562500f, 0.750000f, 
-		0.693520f, 0.707107f, -0.137950f, 0.696500f, 0.704100f, -0.138500f, 0.531250f, 0.750000f, 
-		0.513280f, -0.831470f, -0.212607f, 0.517200f, -0.828600f, -0.214200f, 0.562500f, 0.187500f, 
-		0.653281f, -0.707107f, -0.270598f, 0.656100f, -0.704100f, -0.271800f, 0.562500f, 0.250000f, 
-		0.693520f, -0.707107f, -0.137950f, 0.696500f, -0.704100f, -0.138500f, 0.531250f, 0.250000f, 
-		0.768178f, 0.555570f, -0.318190f, 0.769900f, 0.552800f, -0.318900f, 0.562500f, 0.687500f, 
-		0.815493f, 0.555570f, -0.162212f, 0.817300f, 0.552800f, -0.162600f, 0.531250f, 0.687500f, 
-		0.906127f, 0.382683f, -0.180240f, 0.907000f, 0.380500f, -0.180400f, 0.531250f, 0.625000f, 
-		0.375330f, 0.923880f, -0.074658f, 0.380400f, 0.921700f, -0.075700f, 0.531250f, 0.875000f, 
-		0.382683f, 0.923880f, 0.000000f, 0.387900f, 0.921700f, -0.000000f, 0.500000f, 0.875000f, 
-		0.555570f, 0.831470f, 0.000000f, 0.559800f, 0.828600f, -0.000000f, 0.500000f, 0.812500f, 
-		0.815493f, -0.555570f, -0.162212f, 0.817300f, -0.552800f, -0.162600f, 0.531250f, 0.312500f, 
-		0.906127f, -0.382683f, -0.180240f, 0.907000f, -0.380500f, -0.180400f, 0.531250f, 0.375000f, 
-		0.923879f, -0.382683f, -0.000000f, 0.924800f, -0.380500f, -0.000000f, 0.500000f, 0.375000f, 
-		0.544895f, 0.831470f, -0.108386f, 0.549000f, 0.828600f, -0.109200f, 0.531250f, 0.812500f, 
-		0.555570f, 0.831470f, 0.000000f, 0.559800f, 0.828600f, -0.000000f, 0.500000f, 0.812500f, 
-		0.707107f, 0.707107f, -0.000000f, 0.710100f, 0.704100f, -0.000000f, 0.500000f, 0.750000f, 
-		0.815493f, -0.555570f, -0.162212f, 0.817300f, -0.552800f, -0.162600f, 0.531250f, 0.312500f, 
-		0.831469f, -0.555570f, 0.000000f, 0.833300f, -0.552800f, -0.000000f, 0.500000f, 0.312500f, 
-		0.707107f, -0.707107f, -0.000000f, 0.710100f, -0.704100f, -0.000000f, 0.500000f, 0.250000f, 
-		0.815493f, 0.555570f, -0.162212f, 0.817300f, 0.552800f, -0.162600f, 0.531250f, 0.687500f, 
-		0.693520f, 0.707107f, -0.137950f, 0.696500f, 0.704100f, -0.138500f, 0.531250f, 0.750000f, 
-		0.707107f, 0.707107f, -0.000000f, 0.710100f, 0.704100f, -0.000000f, 0.500000f, 0.750000f, 
-		0.544895f, -0.831470f, -0.108386f, 0.549000f, -0.828600f, -0.109200f, 0.531250f, 0.187500f, 
-		0.693520f, -0.707107f, -0.137950f, 0.696500f, -0.704100f, -0.138500f, 0.531250f, 0.250000f, 
-		0.707107f, -0.707107f, -0.000000f, 0.710100f, -0.704100f, -0.000000f, 0.500000f, 0.250000f, 
-		0.815493f, 0.555570f, -0.162212f, 0.817300f, 0.552800f, -0.162600f, 0.531250f, 0.687500f, 
-		0.831469f, 0.555570f, 0.000000f, 0.833300f, 0.552800f, -0.000000f, 0.500000f, 0.687500f, 
-		0.923879f, 0.382683f, -0.000000f, 0.924800f, 0.380500f, -0.000000f, 0.500000f, 0.625000f, 
-		0.544895f, -0.831470f, -0.108386f, 0.549000f, -0.828600f, -0.109200f, 0.531250f, 0.187500f, 
-		0.555570f, -0.831470f, 0.000000f, 0.559800f, -0.828600f, -0.000000f, 0.500000f, 0.187500f, 
-		0.382683f, -0.923880f, 0.000000f, 0.387900f, -0.921700f, -0.000000f, 0.500000f, 0.125000f, 
-		0.961940f, 0.195090f, -0.191342f, 0.962200f, 0.193900f, -0.191400f, 0.531250f, 0.562500f, 
-		0.906127f, 0.382683f, -0.180240f, 0.907000f, 0.380500f, -0.180400f, 0.531250f, 0.625000f, 
-		0.923879f, 0.382683f, -0.000000f, 0.924800f, 0.380500f, -0.000000f, 0.500000f, 0.625000f, 
-		0.375330f, -0.923880f, -0.074658f, 0.380400f, -0.921700f, -0.075700f, 0.531250f, 0.125000f, 
-		0.382683f, -0.923880f, 0.000000f, 0.387900f, -0.921700f, -0.000000f, 0.500000f, 0.125000f, 
-		0.195090f, -0.980785f, 0.000000f, 0.201000f, -0.979600f, -0.000000f, 0.500000f, 0.062500f, 
-		0.980785f, 0.000000f, -0.195090f, 0.980800f, -0.000000f, -0.195100f, 0.531250f, 0.500000f, 
-		0.961940f, 0.195090f, -0.191342f, 0.962200f, 0.193900f, -0.191400f, 0.531250f, 0.562500f, 
-		0.980785f, 0.195090f, 0.000000f, 0.981000f, 0.193900f, -0.000000f, 0.500000f, 0.562500f, 
-		0.980785f, 0.000000f, -0.195090f, 0.980800f, -0.000000f, -0.195100f, 0.531250f, 0.500000f, 
-		1.000000f, 0.000000f, 0.000000f, 1.000000f, -0.000000f, -0.000000f, 0.500000f, 0.500000f, 
-		0.980785f, -0.195090f, 0.000000f, 0.981000f, -0.193900f, -0.000000f, 0.500000f, 0.437500f, 
-		0.375330f, 0.923880f, -0.074658f, 0.380400f, 0.921700f, -0.075700f, 0.531250f, 0.875000f, 
-		0.191342f, 0.980785f, -0.038060f, 0.197100f, 0.979600f, -0.039200f, 0.531250f, 0.937500f, 
-		0.195090f, 0.980785f, 0.000000f, 0.201000f, 0.979600f, -0.000000f, 0.500000f, 0.937500f, 
-		0.961940f, -0.195090f, -0.191342f, 0.962200f, -0.193900f, -0.191400f, 0.531250f, 0.437500f, 
-		0.980785f, -0.195090f, 0.000000f, 0.981000f, -0.193900f, -0.000000f, 0.500000f, 0.437500f, 
-		0.923879f, -0.382683f, -0.000000f, 0.924800f, -0.380500f, -0.000000f, 0.500000f, 0.375000f, 
-		0.980785f, 0.195090f, 0.000000f, 0.981000f, 0.193900f, -0.000000f, 0.500000f, 0.562500f, 
-		0.923879f, 0.382683f, -0.000000f, 0.924800f, 0.380500f, -0.000000f, 0.500000f, 0.625000f, 
-		0.906127f, 0.382683f, 0.180240f, 0.907000f, 0.380500f, 0.180400f, 0.468750f, 0.625000f, 
-		0.382683f, -0.923880f, 0.000000f, 0.387900f, -0.921700f, -0.000000f, 0.500000f, 0.125000f, 
-		0.375330f, -0.923880f, 0.074658f, 0.380400f, -0.921700f, 0.075700f, 0.468750f, 0.125000f, 
-		0.191342f, -0.980785f, 0.038060f, 0.197100f, -0.979600f, 0.039200f, 0.468750f, 0.062500f, 
-		1.000000f, 0.000000f, 0.000000f, 1.000000f, -0.000000f, -0.000000f, 0.500000f, 0.500000f, 
-		0.980785f, 0.195090f, 0.000000f, 0.981000f, 0.193900f, -0.000000f, 0.500000f, 0.562500f, 
-		0.961940f, 0.195090f, 0.191342f, 0.962200f, 0.193900f, 0.191400f, 0.468750f, 0.562500f, 
-		1.000000f, 0.000000f, 0.000000f, 1.000000f, -0.000000f, -0.000000f, 0.500000f, 0.500000f, 
-		0.980785f, 0.000000f, 0.195090f, 0.980800f, -0.000000f, 0.195100f, 0.468750f, 0.500000f, 
-		0.961940f, -0.195090f, 0.191342f, 0.962200f, -0.193900f, 0.191400f, 0.468750f, 0.437500f, 
-		0.195090f, 0.980785f, 0.000000f, 0.201000f, 0.979600f, -0.000000f, 0.500000f, 0.937500f, 
-		0.191342f, 0.980785f, 0.038060f, 0.197100f, 0.979600f, 0.039200f, 0.468750f, 0.937500f, 
-		0.375330f, 0.923880f, 0.074658f, 0.380400f, 0.921700f, 0.075700f, 0.468750f, 0.875000f, 
-		0.980785f, -0.195090f, 0.000000f, 0.981000f, -0.193900f, -0.000000f, 0.500000f, 0.437500f, 
-		0.961940f, -0.195090f, 0.191342f, 0.962200f, -0.193900f, 0.191400f, 0.468750f, 0.437500f, 
-		0.906127f, -0.382683f, 0.180240f, 0.907000f, -0.380500f, 0.180400f, 0.468750f, 0.375000f, 
-		0.382683f, 0.923880f, 0.000000f, 0.387900f, 0.921700f, -0.000000f, 0.500000f, 0.875000f, 
-		0.375330f, 0.923880f, 0.074658f, 0.380400f, 0.921700f, 0.075700f, 0.468750f, 0.875000f, 
-		0.544895f, 0.831470f, 0.108386f, 0.549000f, 0.828600f, 0.109200f, 0.468750f, 0.812500f, 
-		0.831469f, -0.555570f, 0.000000f, 0.833300f, -0.552800f, -0.000000f, 0.500000f, 0.312500f, 
-		0.923879f, -0.382683f, -0.000000f, 0.924800f, -0.380500f, -0.000000f, 0.500000f, 0.375000f, 
-		0.906127f, -0.382683f, 0.180240f, 0.907000f, -0.380500f, 0.180400f, 0.468750f, 0.375000f, 
-		0.555570f, 0.831470f, 0.000000f, 0.559800f, 0.828600f, -0.000000f, 0.500000f, 0.812500f, 
-		0.544895f, 0.831470f, 0.108386f, 0.549000f, 0.828600f, 0.109200f, 0.468750f, 0.812500f, 
-		0.693520f, 0.707107f, 0.137950f, 0.696500f, 0.704100f, 0.138500f, 0.468750f, 0.750000f, 
-		0.831469f, -0.555570f, 0.000000f, 0.833300f, -0.552800f, -0.000000f, 0.500000f, 0.312500f, 
-		0.815493f, -0.555570f, 0.162212f, 0.817300f, -0.552800f, 0.162600f, 0.468750f, 0.312500f, 
-		0.693520f, -0.707107f, 0.137950f, 0.696500f, -0.704100f, 0.138500f, 0.468750f, 0.250000f, 
-		0.831469f, 0.555570f, 0.000000f, 0.833300f, 0.552800f, -0.000000f, 0.500000f, 0.687500f, 
-		0.707107f, 0.707107f, -0.000000f, 0.710100f, 0.704100f, -0.000000f, 0.500000f, 0.750000f, 
-		0.693520f, 0.707107f, 0.137950f, 0.696500f, 0.704100f, 0.138500f, 0.468750f, 0.750000f, 
-		0.555570f, -0.831470f, 0.000000f, 0.559800f, -0.828600f, -0.000000f, 0.500000f, 0.187500f, 
-		0.707107f, -0.707107f, -0.000000f, 0.710100f, -0.704100f, -0.000000f, 0.500000f, 0.250000f, 
-		0.693520f, -0.707107f, 0.137950f, 0.696500f, -0.704100f, 0.138500f, 0.468750f, 0.250000f, 
-		0.831469f, 0.555570f, 0.000000f, 0.833300f, 0.552800f, -0.000000f, 0.500000f, 0.687500f, 
-		0.815493f, 0.555570f, 0.162212f, 0.817300f, 0.552800f, 0.162600f, 0.468750f, 0.687500f, 
-		0.906127f, 0.382683f, 0.180240f, 0.907000f, 0.380500f, 0.180400f, 0.468750f, 0.625000f, 
-		0.555570f, -0.831470f, 0.000000f, 0.559800f, -0.828600f, -0.000000f, 0.500000f, 0.187500f, 
-		0.544895f, -0.831470f, 0.108386f, 0.549000f, -0.828600f, 0.109200f, 0.468750f, 0.187500f, 
-		0.375330f, -0.923880f, 0.074658f, 0.380400f, -0.921700f, 0.075700f, 0.468750f, 0.125000f, 
-		0.815493f, -0.555570f, 0.162212f, 0.817300f, -0.552800f, 0.162600f, 0.468750f, 0.312500f, 
-		0.906127f, -0.382683f, 0.180240f, 0.907000f, -0.380500f, 0.180400f, 0.468750f, 0.375000f, 
-		0.853553f, -0.382683f, 0.353553f, 0.854400f, -0.380500f, 0.353900f, 0.437500f, 0.375000f, 
-		0.544895f, 0.831470f, 0.108386f, 0.549000f, 0.828600f, 0.109200f, 0.468750f, 0.812500f, 
-		0.513280f, 0.831470f, 0.212608f, 0.517200f, 0.828600f, 0.214200f, 0.437500f, 0.812500f, 
-		0.653281f, 0.707107f, 0.270598f, 0.656100f, 0.704100f, 0.271800f, 0.437500f, 0.750000f, 
-		0.815493f, -0.555570f, 0.162212f, 0.817300f, -0.552800f, 0.162600f, 0.468750f, 0.312500f, 
-		0.768178f, -0.555570f, 0.318190f, 0.769900f, -0.552800f, 0.318900f, 0.437500f, 0.312500f, 
-		0.653281f, -0.707107f, 0.270598f, 0.656100f, -0.704100f, 0.271800f, 0.437500f, 0.250000f, 
-		0.815493f, 0.555570f, 0.162212f, 0.817300f, 0.552800f, 0.162600f, 0.468750f, 0.687500f, 
-		0.693520f, 0.707107f, 0.137950f, 0.696500f, 0.704100f, 0.138500f, 0.468750f, 0.750000f, 
-		0.653281f, 0.707107f, 0.270598f, 0.656100f, 0.704100f, 0.271800f, 0.437500f, 0.750000f, 
-		0.544895f, -0.831470f, 0.108386f, 0.549000f, -0.828600f, 0.109200f, 0.468750f, 0.187500f, 
-		0.693520f, -0.707107f, 0.137950f, 0.696500f, -0.704100f, 0.138500f, 0.468750f, 0.250000f, 
-		0.653281f, -0.707107f, 0.270598f, 0.656100f, -0.704100f, 0.271800f, 0.437500f, 0.250000f, 
-		0.815493f, 0.555570f, 0.162212f, 0.817300f, 0.552800f, 0.162600f, 0.468750f, 0.687500f, 
-		0.768178f, 0.555570f, 0.318190f, 0.769900f, 0.552800f, 0.318900f, 0.437500f, 0.687500f, 
-		0.853553f, 0.382683f, 0.353553f, 0.854400f, 0.380500f, 0.353900f, 0.437500f, 0.625000f, 
-		0.544895f, -0.831470f, 0.108386f, 0.549000f, -0.828600f, 0.109200f, 0.468750f, 0.187500f, 
-		0.513280f, -0.831470f, 0.212608f, 0.517200f, -0.828600f, 0.214200f, 0.437500f, 0.187500f, 
-		0.353553f, -0.923880f, 0.146447f, 0.358400f, -0.921700f, 0.148400f, 0.437500f, 0.125000f, 
-		0.961940f, 0.195090f, 0.191342f, 0.962200f, 0.193900f, 0.191400f, 0.468750f, 0.562500f, 
-		0.906127f, 0.382683f, 0.180240f, 0.907000f, 0.380500f, 0.180400f, 0.468750f, 0.625000f, 
-		0.853553f, 0.382683f, 0.353553f, 0.854400f, 0.380500f, 0.353900f, 0.437500f, 0.625000f, 
-		0.191342f, -0.980785f, 0.038060f, 0.197100f, -0.979600f, 0.039200f, 0.468750f, 0.062500f, 
-		0.375330f, -0.923880f, 0.074658f, 0.380400f, -0.921700f, 0.075700f, 0.468750f, 0.125000f, 
-		0.353553f, -0.923880f, 0.146447f, 0.358400f, -0.921700f, 0.148400f, 0.437500f, 0.125000f, 
-		0.980785f, 0.000000f, 0.195090f, 0.980800f, -0.000000f, 0.195100f, 0.468750f, 0.500000f, 
-		0.961940f, 0.195090f, 0.191342f, 0.962200f, 0.193900f, 0.191400f, 0.468750f, 0.562500f, 
-		0.906127f, 0.195090f, 0.375330f, 0.906300f, 0.193900f, 0.375400f, 0.437500f, 0.562500f, 
-		0.980785f, 0.000000f, 0.195090f, 0.980800f, -0.000000f, 0.195100f, 0.468750f, 0.500000f, 
-		0.923879f, 0.000000f, 0.382683f, 0.923900f, -0.000000f, 0.382700f, 0.437500f, 0.500000f, 
-		0.906127f, -0.195090f, 0.375330f, 0.906300f, -0.193900f, 0.375400f, 0.437500f, 0.437500f, 
-		0.191342f, 0.980785f, 0.038060f, 0.197100f, 0.979600f, 0.039200f, 0.468750f, 0.937500f, 
-		0.180240f, 0.980785f, 0.074658f, 0.185700f, 0.979600f, 0.076900f, 0.437500f, 0.937500f, 
-		0.353553f, 0.923880f, 0.146447f, 0.358400f, 0.921700f, 0.148400f, 0.437500f, 0.875000f, 
-		0.961940f, -0.195090f, 0.191342f, 0.962200f, -0.193900f, 0.191400f, 0.468750f, 0.437500f, 
-		0.906127f, -0.195090f, 0.375330f, 0.906300f, -0.193900f, 0.375400f, 0.437500f, 0.437500f, 
-		0.853553f, -0.382683f, 0.353553f, 0.854400f, -0.380500f, 0.353900f, 0.437500f, 0.375000f, 
-		0.544895f, 0.831470f, 0.108386f, 0.549000f, 0.828600f, 0.109200f, 0.468750f, 0.812500f, 
-		0.375330f, 0.923880f, 0.074658f, 0.380400f, 0.921700f, 0.075700f, 0.468750f, 0.875000f, 
-		0.353553f, 0.923880f, 0.146447f, 0.358400f, 0.921700f, 0.148400f, 0.437500f, 0.875000f, 
-		0.353553f, -0.923880f, 0.146447f, 0.358400f, -0.921700f, 0.148400f, 0.437500f, 0.125000f, 
-		0.318190f, -0.923880f, 0.212608f, 0.322500f, -0.921700f, 0.215500f, 0.406250f, 0.125000f, 
-		0.162212f, -0.980785f, 0.108386f, 0.167100f, -0.979600f, 0.111700f, 0.406250f, 0.062500f, 
-		0.923879f, 0.000000f, 0.382683f, 0.923900f, -0.000000f, 0.382700f, 0.437500f, 0.500000f, 
-		0.906127f, 0.195090f, 0.375330f, 0.906300f, 0.193900f, 0.375400f, 0.437500f, 0.562500f, 
-		0.815493f, 0.195090f, 0.544895f, 0.815700f, 0.193900f, 0.545000f, 0.406250f, 0.562500f, 
-		0.923879f, 0.000000f, 0.382683f, 0.923900f, -0.000000f, 0.382700f, 0.437500f, 0.500000f, 
-		0.831469f, 0.000000f, 0.555570f, 0.831500f, -0.000000f, 0.555600f, 0.406250f, 0.500000f, 
-		0.815493f, -0.195090f, 0.544895f, 0.815700f, -0.193900f, 0.545000f, 0.406250f, 0.437500f, 
-		0.180240f, 0.980785f, 0.074658f, 0.185700f, 0.979600f, 0.076900f, 0.437500f, 0.937500f, 
-		0.162212f, 0.980785f, 0.108386f, 0.167100f, 0.979600f, 0.111700f, 0.406250f, 0.937500f, 
-		0.318190f, 0.923880f, 0.212608f, 0.322500f, 0.921700f, 0.215500f, 0.406250f, 0.875000f, 
-		0.906127f, -0.195090f, 0.375330f, 0.906300f, -0.193900f, 0.375400f, 0.437500f, 0.437500f, 
-		0.815493f, -0.195090f, 0.544895f, 0.815700f, -0.193900f, 0.545000f, 0.406250f, 0.437500f, 
-		0.768178f, -0.382683f, 0.513280f, 0.768900f, -0.380500f, 0.513800f, 0.406250f, 0.375000f, 
-		0.513280f, 0.831470f, 0.212608f, 0.517200f, 0.828600f, 0.214200f, 0.437500f, 0.812500f, 
-		0.353553f, 0.923880f, 0.146447f, 0.358400f, 0.921700f, 0.148400f, 0.437500f, 0.875000f, 
-		0.318190f, 0.923880f, 0.212608f, 0.322500f, 0.921700f, 0.215500f, 0.406250f, 0.875000f, 
-		0.768178f, -0.555570f, 0.318190f, 0.769900f, -0.552800f, 0.318900f, 0.437500f, 0.312500f, 
-		0.853553f, -0.382683f, 0.353553f, 0.854400f, -0.380500f, 0.353900f, 0.437500f, 0.375000f, 
-		0.768178f, -0.382683f, 0.513280f, 0.768900f, -0.380500f, 0.513800f, 0.406250f, 0.375000f, 
-		0.513280f, 0.831470f, 0.212608f, 0.517200f, 0.828600f, 0.214200f, 0.437500f, 0.812500f, 
-		0.461940f, 0.831470f, 0.308658f, 0.465400f, 0.828600f, 0.311000f, 0.406250f, 0.812500f, 
-		0.587938f, 0.707107f, 0.392847f, 0.590500f, 0.704100f, 0.394500f, 0.406250f, 0.750000f, 
-		0.768178f, -0.555570f, 0.318190f, 0.769900f, -0.552800f, 0.318900f, 0.437500f, 0.312500f, 
-		0.691341f, -0.555570f, 0.461940f, 0.692900f, -0.552800f, 0.463000f, 0.406250f, 0.312500f, 
-		0.587938f, -0.707107f, 0.392847f, 0.590500f, -0.704100f, 0.394500f, 0.406250f, 0.250000f, 
-		0.768178f, 0.555570f, 0.318190f, 0.769900f, 0.552800f, 0.318900f, 0.437500f, 0.687500f, 
-		0.653281f, 0.707107f, 0.270598f, 0.656100f, 0.704100f, 0.271800f, 0.437500f, 0.750000f, 
-		0.587938f, 0.707107f, 0.392847f, 0.590500f, 0.704100f, 0.394500f, 0.406250f, 0.750000f, 
-		0.513280f, -0.831470f, 0.212608f, 0.517200f, -0.828600f, 0.214200f, 0.437500f, 0.187500f, 
-		0.653281f, -0.707107f, 0.270598f, 0.656100f, -0.704100f, 0.271800f, 0.437500f, 0.250000f, 
-		0.587938f, -0.707107f, 0.392847f, 0.590500f, -0.704100f, 0.394500f, 0.406250f, 0.250000f, 
-		0.768178f, 0.555570f, 0.318190f, 0.769900f, 0.552800f, 0.318900f, 0.437500f, 0.687500f, 
-		0.691341f, 0.555570f, 0.461940f, 0.692900f, 0.552800f, 0.463000f, 0.406250f, 0.687500f, 
-		0.768178f, 0.382683f, 0.513280f, 0.768900f, 0.380500f, 0.513800f, 0.406250f, 0.625000f, 
-		0.513280f, -0.831470f, 0.212608f, 0.517200f, -0.828600f, 0.214200f, 0.437500f, 0.187500f, 
-		0.461940f, -0.831470f, 0.308658f, 0.465400f, -0.828600f, 0.311000f, 0.406250f, 0.187500f, 
-		0.318190f, -0.923880f, 0.212608f, 0.322500f, -0.921700f, 0.215500f, 0.406250f, 0.125000f, 
-		0.906127f, 0.195090f, 0.375330f, 0.906300f, 0.193900f, 0.375400f, 0.437500f, 0.562500f, 
-		0.853553f, 0.382683f, 0.353553f, 0.854400f, 0.380500f, 0.353900f, 0.437500f, 0.625000f, 
-		0.768178f, 0.382683f, 0.513280f, 0.768900f, 0.380500f, 0.513800f, 0.406250f, 0.625000f, 
-		0.691341f, -0.555570f, 0.461940f, 0.692900f, -0.552800f, 0.463000f, 0.406250f, 0.312500f, 
-		0.587938f, -0.555570f, 0.587938f, 0.589300f, -0.552800f, 0.589300f, 0.375000f, 0.312500f, 
-		0.500000f, -0.707107f, 0.500000f, 0.502100f, -0.704100f, 0.502100f, 0.375000f, 0.250000f, 
-		0.691341f, 0.555570f, 0.461940f, 0.692900f, 0.552800f, 0.463000f, 0.406250f, 0.687500f, 
-		0.587938f, 0.707107f, 0.392847f, 0.590500f, 0.704100f, 0.394500f, 0.406250f, 0.750000f, 
-		0.500000f, 0.707107f, 0.500000f, 0.502100f, 0.704100f, 0.502100f, 0.375000f, 0.750000f, 
-		0.587938f, -0.707107f, 0.392847f, 0.590500f, -0.704100f, 0.394500f, 0.406250f, 0.250000f, 
-		0.500000f, -0.707107f, 0.500000f, 0.502100f, -0.704100f, 0.502100f, 0.375000f, 0.250000f, 
-		0.392847f, -0.831470f, 0.392847f, 0.395800f, -0.828600f, 0.395800f, 0.375000f, 0.187500f, 
-		0.691341f, 0.555570f, 0.461940f, 0.692900f, 0.552800f, 0.463000f, 0.406250f, 0.687500f, 
-		0.587938f, 0.555570f, 0.587938f, 0.589300f, 0.552800f, 0.589300f, 0.375000f, 0.687500f, 
-		0.653281f, 0.382683f, 0.653281f, 0.653900f, 0.380500f, 0.653900f, 0.375000f, 0.625000f, 
-		0.318190f, -0.923880f, 0.212608f, 0.322500f, -0.921700f, 0.215500f, 0.406250f, 0.125000f, 
-		0.461940f, -0.831470f, 0.308658f, 0.465400f, -0.828600f, 0.311000f, 0.406250f, 0.187500f, 
-		0.392847f, -0.831470f, 0.392847f, 0.395800f, -0.828600f, 0.395800f, 0.375000f, 0.187500f, 
-		0.815493f, 0.195090f, 0.544895f, 0.815700f, 0.193900f, 0.545000f, 0.406250f, 0.562500f, 
-		0.768178f, 0.382683f, 0.513280f, 0.768900f, 0.380500f, 0.513800f, 0.406250f, 0.625000f, 
-		0.653281f, 0.382683f, 0.653281f, 0.653900f, 0.380500f, 0.653900f, 0.375000f, 0.625000f, 
-		0.162212f, -0.980785f, 0.108386f, 0.167100f, -0.979600f, 0.111700f, 0.406250f, 0.062500f, 
-		0.318190f, -0.923880f, 0.212608f, 0.322500f, -0.921700f, 0.215500f, 0.406250f, 0.125000f, 
-		0.270598f, -0.923880f, 0.270598f, 0.274300f, -0.921700f, 0.274300f, 0.375000f, 0.125000f, 
-		0.831469f, 0.000000f, 0.555570f, 0.831500f, -0.000000f, 0.555600f, 0.406250f, 0.500000f, 
-		0.815493f, 0.195090f, 0.544895f, 0.815700f, 0.193900f, 0.545000f, 0.406250f, 0.562500f, 
-		0.693520f, 0.195090f, 0.693520f, 0.693700f, 0.193900f, 0.693700f, 0.375000f, 0.562500f, 
-		0.831469f, 0.000000f, 0.555570f, 0.831500f, -0.000000f, 0.555600f, 0.406250f, 0.500000f, 
-		0.707106f, 0.000000f, 0.707107f, 0.707100f, -0.000000f, 0.707100f, 0.375000f, 0.500000f, 
-		0.693520f, -0.195090f, 0.693520f, 0.693700f, -0.193900f, 0.693700f, 0.375000f, 0.437500f, 
-		0.162212f, 0.980785f, 0.108386f, 0.167100f, 0.979600f, 0.111700f, 0.406250f, 0.937500f, 
-		0.137950f, 0.980785f, 0.137950f, 0.142100f, 0.979600f, 0.142100f, 0.375000f, 0.937500f, 
-		0.270598f, 0.923880f, 0.270598f, 0.274300f, 0.921700f, 0.274300f, 0.375000f, 0.875000f, 
-		0.815493f, -0.195090f, 0.544895f, 0.815700f, -0.193900f, 0.545000f, 0.406250f, 0.437500f, 
-		0.693520f, -0.195090f, 0.693520f, 0.693700f, -0.193900f, 0.693700f, 0.375000f, 0.437500f, 
-		0.653281f, -0.382683f, 0.653281f, 0.653900f, -0.380500f, 0.653900f, 0.375000f, 0.375000f, 
-		0.318190f, 0.923880f, 0.212608f, 0.322500f, 0.921700f, 0.215500f, 0.406250f, 0.875000f, 
-		0.270598f, 0.923880f, 0.270598f, 0.274300f, 0.921700f, 0.274300f, 0.375000f, 0.875000f, 
-		0.392847f, 0.831470f, 0.392847f, 0.395800f, 0.828600f, 0.395800f, 0.375000f, 0.812500f, 
-		0.691341f, -0.555570f, 0.461940f, 0.692900f, -0.552800f, 0.463000f, 0.406250f, 0.312500f, 
-		0.768178f, -0.382683f, 0.513280f, 0.768900f, -0.380500f, 0.513800f, 0.406250f, 0.375000f, 
-		0.653281f, -0.382683f, 0.653281f, 0.653900f, -0.380500f, 0.653900f, 0.375000f, 0.375000f, 
-		0.461940f, 0.831470f, 0.308658f, 0.465400f, 0.828600f, 0.311000f, 0.406250f, 0.812500f, 
-		0.392847f, 0.831470f, 0.392847f, 0.395800f, 0.828600f, 0.395800f, 0.375000f, 0.812500f, 
-		0.500000f, 0.707107f, 0.500000f, 0.502100f, 0.704100f, 0.502100f, 0.375000f, 0.750000f, 
-		0.707106f, 0.000000f, 0.707107f, 0.707100f, -0.000000f, 0.707100f, 0.375000f, 0.500000f, 
-		0.555570f, 0.000000f, 0.831469f, 0.555600f, -0.000000f, 0.831500f, 0.343750f, 0.500000f, 
-		0.544895f, -0.195090f, 0.815493f, 0.545000f, -0.193900f, 0.815700f, 0.343750f, 0.437500f, 
-		0.270598f, 0.923880f, 0.270598f, 0.274300f, 0.921700f, 0.274300f, 0.375000f, 0.875000f, 
-		0.137950f, 0.980785f, 0.137950f, 0.142100f, 0.979600f, 0.142100f, 0.375000f, 0.937500f, 
-		0.108386f, 0.980785f, 0.162212f, 0.111700f, 0.979600f, 0.167100f, 0.343750f, 0.937500f, 
-		0.693520f, -0.195090f, 0.693520f, 0.693700f, -0.193900f, 0.693700f, 0.375000f, 0.437500f, 
-		0.544895f, -0.195090f, 0.815493f, 0.545000f, -0.193900f, 0.815700f, 0.343750f, 0.437500f, 
-		0.513280f, -0.382683f, 0.768178f, 0.513800f, -0.380500f, 0.768900f, 0.343750f, 0.375000f, 
-		0.392847f, 0.831470f, 0.392847f, 0.395800f, 0.828600f, 0.395800f, 0.375000f, 0.812500f, 
-		0.270598f, 0.923880f, 0.270598f, 0.274300f, 0.921700f, 0.274300f, 0.375000f, 0.875000f, 
-		0.212607f, 0.923880f, 0.318190f, 0.215500f, 0.921700f, 0.322500f, 0.343750f, 0.875000f, 
-		0.587938f, -0.555570f, 0.587938f, 0.589300f, -0.552800f, 0.589300f, 0.375000f, 0.312500f, 
-		0.653281f, -0.382683f, 0.653281f, 0.653900f, -0.380500f, 0.653900f, 0.375000f, 0.375000f, 
-		0.513280f, -0.382683f, 0.768178f, 0.513800f, -0.380500f, 0.768900f, 0.343750f, 0.375000f, 
-		0.392847f, 0.831470f, 0.392847f, 0.395800f, 0.828600f, 0.395800f, 0.375000f, 0.812500f, 
-		0.308658f, 0.831470f, 0.461940f, 0.311000f, 0.828600f, 0.465400f, 0.343750f, 0.812500f, 
-		0.392847f, 0.707107f, 0.587938f, 0.394500f, 0.704100f, 0.590500f, 0.343750f, 0.750000f, 
-		0.587938f, -0.555570f, 0.587938f, 0.589300f, -0.552800f, 0.589300f, 0.375000f, 0.312500f, 
-		0.461940f, -0.555570f, 0.691342f, 0.463000f, -0.552800f, 0.692900f, 0.343750f, 0.312500f, 
-		0.392847f, -0.707107f, 0.587938f, 0.394500f, -0.704100f, 0.590500f, 0.343750f, 0.250000f, 
-		0.587938f, 0.555570f, 0.587938f, 0.589300f, 0.552800f, 0.589300f, 0.375000f, 0.687500f, 
-		0.500000f, 0.707107f, 0.500000f, 0.502100f, 0.704100f, 0.502100f, 0.375000f, 0.750000f, 
-		0.392847f, 0.707107f, 0.587938f, 0.394500f, 0.704100f, 0.590500f, 0.343750f, 0.750000f, 
-		0.392847f, -0.831470f, 0.392847f, 0.395800f, -0.828600f, 0.395800f, 0.375000f, 0.187500f, 
-		0.500000f, -0.707107f, 0.500000f, 0.502100f, -0.704100f, 0.502100f, 0.375000f, 0.250000f, 
-		0.392847f, -0.707107f, 0.587938f, 0.394500f, -0.704100f, 0.590500f, 0.343750f, 0.250000f, 
-		0.587938f, 0.555570f, 0.587938f, 0.589300f, 0.552800f, 0.589300f, 0.375000f, 0.687500f, 
-		0.461940f, 0.555570f, 0.691342f, 0.463000f, 0.552800f, 0.692900f, 0.343750f, 0.687500f, 
-		0.513280f, 0.382683f, 0.768178f, 0.513800f, 0.380500f, 0.768900f, 0.343750f, 0.625000f, 
-		0.392847f, -0.831470f, 0.392847f, 0.395800f, -0.828600f, 0.395800f, 0.375000f, 0.187500f, 
-		0.308658f, -0.831470f, 0.461940f, 0.311000f, -0.828600f, 0.465400f, 0.343750f, 0.187500f, 
-		0.212607f, -0.923880f, 0.318190f, 0.215500f, -0.921700f, 0.322500f, 0.343750f, 0.125000f, 
-		0.693520f, 0.195090f, 0.693520f, 0.693700f, 0.193900f, 0.693700f, 0.375000f, 0.562500f, 
-		0.653281f, 0.382683f, 0.653281f, 0.653900f, 0.380500f, 0.653900f, 0.375000f, 0.625000f, 
-		0.513280f, 0.382683f, 0.768178f, 0.513800f, 0.380500f, 0.768900f, 0.343750f, 0.625000f, 
-		0.270598f, -0.923880f, 0.270598f, 0.274300f, -0.921700f, 0.274300f, 0.375000f, 0.125000f, 
-		0.212607f, -0.923880f, 0.318190f, 0.215500f, -0.921700f, 0.322500f, 0.343750f, 0.125000f, 
-		0.108386f, -0.980785f, 0.162212f, 0.111700f, -0.979600f, 0.167100f, 0.343750f, 0.062500f, 
-		0.707106f, 0.000000f, 0.707107f, 0.707100f, -0.000000f, 0.707100f, 0.375000f, 0.500000f, 
-		0.693520f, 0.195090f, 0.693520f, 0.693700f, 0.193900f, 0.693700f, 0.375000f, 0.562500f, 
-		0.544895f, 0.195090f, 0.815493f, 0.545000f, 0.193900f, 0.815700f, 0.343750f, 0.562500f, 
-		0.461940f, 0.555570f, 0.691342f, 0.463000f, 0.552800f, 0.692900f, 0.343750f, 0.687500f, 
-		0.392847f, 0.707107f, 0.587938f, 0.394500f, 0.704100f, 0.590500f, 0.343750f, 0.750000f, 
-		0.270598f, 0.707107f, 0.653281f, 0.271800f, 0.704100f, 0.656100f, 0.312500f, 0.750000f, 
-		0.308658f, -0.831470f, 0.461940f, 0.311000f, -0.828600f, 0.465400f, 0.343750f, 0.187500f, 
-		0.392847f, -0.707107f, 0.587938f, 0.394500f, -0.704100f, 0.590500f, 0.343750f, 0.250000f, 
-		0.270598f, -0.707107f, 0.653281f, 0.271800f, -0.704100f, 0.656100f, 0.312500f, 0.250000f, 
-		0.461940f, 0.555570f, 0.691342f, 0.463000f, 0.552800f, 0.692900f, 0.343750f, 0.687500f, 
-		0.318189f, 0.555570f, 0.768178f, 0.318900f, 0.552800f, 0.769900f, 0.312500f, 0.687500f, 
-		0.353553f, 0.382683f, 0.853553f, 0.353900f, 0.380500f, 0.854400f, 0.312500f, 0.625000f, 
-		0.308658f, -0.831470f, 0.461940f, 0.311000f, -0.828600f, 0.465400f, 0.343750f, 0.187500f, 
-		0.212607f, -0.831470f, 0.513280f, 0.214200f, -0.828600f, 0.517200f, 0.312500f, 0.187500f, 
-		0.146447f, -0.923880f, 0.353553f, 0.148400f, -0.921700f, 0.358400f, 0.312500f, 0.125000f, 
-		0.544895f, 0.195090f, 0.815493f, 0.545000f, 0.193900f, 0.815700f, 0.343750f, 0.562500f, 
-		0.513280f, 0.382683f, 0.768178f, 0.513800f, 0.380500f, 0.768900f, 0.343750f, 0.625000f, 
-		0.353553f, 0.382683f, 0.853553f, 0.353900f, 0.380500f, 0.854400f, 0.312500f, 0.625000f, 
-		0.212607f, -0.923880f, 0.318190f, 0.215500f, -0.921700f, 0.322500f, 0.343750f, 0.125000f, 
-		0.146447f, -0.923880f, 0.353553f, 0.148400f, -0.921700f, 0.358400f, 0.312500f, 0.125000f, 
-		0.074658f, -0.980785f, 0.180240f, 0.076900f, -0.979600f, 0.185700f, 0.312500f, 0.062500f, 
-		0.555570f, 0.000000f, 0.831469f, 0.555600f, -0.000000f, 0.831500f, 0.343750f, 0.500000f, 
-		0.544895f, 0.195090f, 0.815493f, 0.545000f, 0.193900f, 0.815700f, 0.343750f, 0.562500f, 
-		0.375330f, 0.195090f, 0.906127f, 0.375400f, 0.193900f, 0.906300f, 0.312500f, 0.562500f, 
-		0.555570f, 0.000000f, 0.831469f, 0.555600f, -0.000000f, 0.831500f, 0.343750f, 0.500000f, 
-		0.382683f, 0.000000f, 0.923879f, 0.382700f, -0.000000f, 0.923900f, 0.312500f, 0.500000f, 
-		0.375330f, -0.195090f, 0.906127f, 0.375400f, -0.193900f, 0.906300f, 0.312500f, 0.437500f, 
-		0.108386f, 0.980785f, 0.162212f, 0.111700f, 0.979600f, 0.167100f, 0.343750f, 0.937500f, 
-		0.074658f, 0.980785f, 0.180240f, 0.076900f, 0.979600f, 0.185700f, 0.312500f, 0.937500f, 
-		0.146447f, 0.923880f, 0.353553f, 0.148400f, 0.921700f, 0.358400f, 0.312500f, 0.875000f, 
-		0.544895f, -0.195090f, 0.815493f, 0.545000f, -0.193900f, 0.815700f, 0.343750f, 0.437500f, 
-		0.375330f, -0.195090f, 0.906127f, 0.375400f, -0.193900f, 0.906300f, 0.312500f, 0.437500f, 
-		0.353553f, -0.382683f, 0.853553f, 0.353900f, -0.380500f, 0.854400f, 0.312500f, 0.375000f, 
-		0.212607f, 0.923880f, 0.318190f, 0.215500f, 0.921700f, 0.322500f, 0.343750f, 0.875000f, 
-		0.146447f, 0.923880f, 0.353553f, 0.148400f, 0.921700f, 0.358400f, 0.312500f, 0.875000f, 
-		0.212607f, 0.831470f, 0.513280f, 0.214200f, 0.828600f, 0.517200f, 0.312500f, 0.812500f, 
-		0.461940f, -0.555570f, 0.691342f, 0.463000f, -0.552800f, 0.692900f, 0.343750f, 0.312500f, 
-		0.513280f, -0.382683f, 0.768178f, 0.513800f, -0.380500f, 0.768900f, 0.343750f, 0.375000f, 
-		0.353553f, -0.382683f, 0.853553f, 0.353900f, -0.380500f, 0.854400f, 0.312500f, 0.375000f, 
-		0.308658f, 0.831470f, 0.461940f, 0.311000f, 0.828600f, 0.465400f, 0.343750f, 0.812500f, 
-		0.212607f, 0.831470f, 0.513280f, 0.214200f, 0.828600f, 0.517200f, 0.312500f, 0.812500f, 
-		0.270598f, 0.707107f, 0.653281f, 0.271800f, 0.704100f, 0.656100f, 0.312500f, 0.750000f, 
-		0.461940f, -0.555570f, 0.691342f, 0.463000f, -0.552800f, 0.692900f, 0.343750f, 0.312500f, 
-		0.318189f, -0.555570f, 0.768178f, 0.318900f, -0.552800f, 0.769900f, 0.312500f, 0.312500f, 
-		0.270598f, -0.707107f, 0.653281f, 0.271800f, -0.704100f, 0.656100f, 0.312500f, 0.250000f, 
-		0.382683f, 0.000000f, 0.923879f, 0.382700f, -0.000000f, 0.923900f, 0.312500f, 0.500000f, 
-		0.195090f, 0.000000f, 0.980785f, 0.195100f, -0.000000f, 0.980800f, 0.281250f, 0.500000f, 
-		0.191342f, -0.195090f, 0.961939f, 0.191400f, -0.193900f, 0.962200f, 0.281250f, 0.437500f, 
-		0.074658f, 0.980785f, 0.180240f, 0.076900f, 0.979600f, 0.185700f, 0.312500f, 0.937500f, 
-		0.038060f, 0.980785f, 0.191342f, 0.039200f, 0.979600f, 0.197100f, 0.281250f, 0.937500f, 
-		0.074658f, 0.923880f, 0.375330f, 0.075700f, 0.921700f, 0.380400f, 0.281250f, 0.875000f, 
-		0.375330f, -0.195090f, 0.906127f, 0.375400f, -0.193900f, 0.906300f, 0.312500f, 0.437500f, 
-		0.191342f, -0.195090f, 0.961939f, 0.191400f, -0.193900f, 0.962200f, 0.281250f, 0.437500f, 
-		0.180240f, -0.382683f, 0.906127f, 0.180400f, -0.380500f, 0.907000f, 0.281250f, 0.375000f, 
-		0.146447f, 0.923880f, 0.353553f, 0.148400f, 0.921700f, 0.358400f, 0.312500f, 0.875000f, 
-		0.074658f, 0.923880f, 0.375330f, 0.075700f, 0.921700f, 0.380400f, 0.281250f, 0.875000f, 
-		0.108386f, 0.831470f, 0.544895f, 0.109200f, 0.828600f, 0.549000f, 0.281250f, 0.812500f, 
-		0.318189f, -0.555570f, 0.768178f, 0.318900f, -0.552800f, 0.769900f, 0.312500f, 0.312500f, 
-		0.353553f, -0.382683f, 0.853553f, 0.353900f, -0.380500f, 0.854400f, 0.312500f, 0.375000f, 
-		0.180240f, -0.382683f, 0.906127f, 0.180400f, -0.380500f, 0.907000f, 0.281250f, 0.375000f, 
-		0.212607f, 0.831470f, 0.513280f, 0.214200f, 0.828600f, 0.517200f, 0.312500f, 0.812500f, 
-		0.108386f, 0.831470f, 0.544895f, 0.109200f, 0.828600f, 0.549000f, 0.281250f, 0.812500f, 
-		0.137950f, 0.707107f, 0.693520f, 0.138500f, 0.704100f, 0.696500f, 0.281250f, 0.750000f, 
-		0.318189f, -0.555570f, 0.768178f, 0.318900f, -0.552800f, 0.769900f, 0.312500f, 0.312500f, 
-		0.162212f, -0.555570f, 0.815493f, 0.162600f, -0.552800f, 0.817300f, 0.281250f, 0.312500f, 
-		0.137950f, -0.707107f, 0.693520f, 0.138500f, -0.704100f, 0.696500f, 0.281250f, 0.250000f, 
-		0.318189f, 0.555570f, 0.768178f, 0.318900f, 0.552800f, 0.769900f, 0.312500f, 0.687500f, 
-		0.270598f, 0.707107f, 0.653281f, 0.271800f, 0.704100f, 0.656100f, 0.312500f, 0.750000f, 
-		0.137950f, 0.707107f, 0.693520f, 0.138500f, 0.704100f, 0.696500f, 0.281250f, 0.750000f, 
-		0.212607f, -0.831470f, 0.513280f, 0.214200f, -0.828600f, 0.517200f, 0.312500f, 0.187500f, 
-		0.270598f, -0.707107f, 0.653281f, 0.271800f, -0.704100f, 0.656100f, 0.312500f, 0.250000f, 
-		0.137950f, -0.707107f, 0.693520f, 0.138500f, -0.704100f, 0.696500f, 0.281250f, 0.250000f, 
-		0.318189f, 0.555570f, 0.768178f, 0.318900f, 0.552800f, 0.769900f, 0.312500f, 0.687500f, 
-		0.162212f, 0.555570f, 0.815493f, 0.162600f, 0.552800f, 0.817300f, 0.281250f, 0.687500f, 
-		0.180240f, 0.382683f, 0.906127f, 0.180400f, 0.380500f, 0.907000f, 0.281250f, 0.625000f, 
-		0.212607f, -0.831470f, 0.513280f, 0.214200f, -0.828600f, 0.517200f, 0.312500f, 0.187500f, 
-		0.108386f, -0.831470f, 0.544895f, 0.109200f, -0.828600f, 0.549000f, 0.281250f, 0.187500f, 
-		0.074658f, -0.923880f, 0.375330f, 0.075700f, -0.921700f, 0.380400f, 0.281250f, 0.125000f, 
-		0.375330f, 0.195090f, 0.906127f, 0.375400f, 0.193900f, 0.906300f, 0.312500f, 0.562500f, 
-		0.353553f, 0.382683f, 0.853553f, 0.353900f, 0.380500f, 0.854400f, 0.312500f, 0.625000f, 
-		0.180240f, 0.382683f, 0.906127f, 0.180400f, 0.380500f, 0.907000f, 0.281250f, 0.625000f, 
-		0.146447f, -0.923880f, 0.353553f, 0.148400f, -0.921700f, 0.358400f, 0.312500f, 0.125000f, 
-		0.074658f, -0.923880f, 0.375330f, 0.075700f, -0.921700f, 0.380400f, 0.281250f, 0.125000f, 
-		0.038060f, -0.980785f, 0.191342f, 0.039200f, -0.979600f, 0.197100f, 0.281250f, 0.062500f, 
-		0.382683f, 0.000000f, 0.923879f, 0.382700f, -0.000000f, 0.923900f, 0.312500f, 0.500000f, 
-		0.375330f, 0.195090f, 0.906127f, 0.375400f, 0.193900f, 0.906300f, 0.312500f, 0.562500f, 
-		0.191342f, 0.195090f, 0.961939f, 0.191400f, 0.193900f, 0.962200f, 0.281250f, 0.562500f, 
-		0.108386f, -0.831470f, 0.544895f, 0.109200f, -0.828600f, 0.549000f, 0.281250f, 0.187500f, 
-		0.137950f, -0.707107f, 0.693520f, 0.138500f, -0.704100f, 0.696500f, 0.281250f, 0.250000f, 
-		-0.000000f, -0.707107f, 0.707107f, -0.000000f, -0.704100f, 0.710100f, 0.250000f, 0.250000f, 
-		0.162212f, 0.555570f, 0.815493f, 0.162600f, 0.552800f, 0.817300f, 0.281250f, 0.687500f, 
-		-0.000000f, 0.555570f, 0.831469f, -0.000000f, 0.552800f, 0.833300f, 0.250000f, 0.687500f, 
-		0.000000f, 0.382683f, 0.923879f, -0.000000f, 0.380500f, 0.924800f, 0.250000f, 0.625000f, 
-		0.108386f, -0.831470f, 0.544895f, 0.109200f, -0.828600f, 0.549000f, 0.281250f, 0.187500f, 
-		-0.000000f, -0.831470f, 0.555570f, -0.000000f, -0.828600f, 0.559800f, 0.250000f, 0.187500f, 
-		-0.000000f, -0.923880f, 0.382683f, -0.000000f, -0.921700f, 0.387900f, 0.250000f, 0.125000f, 
-		0.191342f, 0.195090f, 0.961939f, 0.191400f, 0.193900f, 0.962200f, 0.281250f, 0.562500f, 
-		0.180240f, 0.382683f, 0.906127f, 0.180400f, 0.380500f, 0.907000f, 0.281250f, 0.625000f, 
-		0.000000f, 0.382683f, 0.923879f, -0.000000f, 0.380500f, 0.924800f, 0.250000f, 0.625000f, 
-		0.038060f, -0.980785f, 0.191342f, 0.039200f, -0.979600f, 0.197100f, 0.281250f, 0.062500f, 
-		0.074658f, -0.923880f, 0.375330f, 0.075700f, -0.921700f, 0.380400f, 0.281250f, 0.125000f, 
-		-0.000000f, -0.923880f, 0.382683f, -0.000000f, -0.921700f, 0.387900f, 0.250000f, 0.125000f, 
-		0.195090f, 0.000000f, 0.980785f, 0.195100f, -0.000000f, 0.980800f, 0.281250f, 0.500000f, 
-		0.191342f, 0.195090f, 0.961939f, 0.191400f, 0.193900f, 0.962200f, 0.281250f, 0.562500f, 
-		-0.000000f, 0.195090f, 0.980785f, -0.000000f, 0.193900f, 0.981000f, 0.250000f, 0.562500f, 
-		0.195090f, 0.000000f, 0.980785f, 0.195100f, -0.000000f, 0.980800f, 0.281250f, 0.500000f, 
-		-0.000000f, 0.000000f, 0.999999f, -0.000000f, -0.000000f, 1.000000f, 0.250000f, 0.500000f, 
-		-0.000000f, -0.195090f, 0.980785f, -0.000000f, -0.193900f, 0.981000f, 0.250000f, 0.437500f, 
-		0.038060f, 0.980785f, 0.191342f, 0.039200f, 0.979600f, 0.197100f, 0.281250f, 0.937500f, 
-		-0.000000f, 0.980785f, 0.195090f, -0.000000f, 0.979600f, 0.201000f, 0.250000f, 0.937500f, 
-		-0.000000f, 0.923880f, 0.382683f, -0.000000f, 0.921700f, 0.387900f, 0.250000f, 0.875000f, 
-		0.191342f, -0.195090f, 0.961939f, 0.191400f, -0.193900f, 0.962200f, 0.281250f, 0.437500f, 
-		-0.000000f, -0.195090f, 0.980785f, -0.000000f, -0.193900f, 0.981000f, 0.250000f, 0.437500f, 
-		0.000000f, -0.382683f, 0.923879f, -0.000000f, -0.380500f, 0.924800f, 0.250000f, 0.375000f, 
-		0.108386f, 0.831470f, 0.544895f, 0.109200f, 0.828600f, 0.549000f, 0.281250f, 0.812500f, 
-		0.074658f, 0.923880f, 0.375330f, 0.075700f, 0.921700f, 0.380400f, 0.281250f, 0.875000f, 
-		-0.000000f, 0.923880f, 0.382683f, -0.000000f, 0.921700f, 0.387900f, 0.250000f, 0.875000f, 
-		0.162212f, -0.555570f, 0.815493f, 0.162600f, -0.552800f, 0.817300f, 0.281250f, 0.312500f, 
-		0.180240f, -0.382683f, 0.906127f, 0.180400f, -0.380500f, 0.907000f, 0.281250f, 0.375000f, 
-		0.000000f, -0.382683f, 0.923879f, -0.000000f, -0.380500f, 0.924800f, 0.250000f, 0.375000f, 
-		0.108386f, 0.831470f, 0.544895f, 0.109200f, 0.828600f, 0.549000f, 0.281250f, 0.812500f, 
-		-0.000000f, 0.831470f, 0.555570f, -0.000000f, 0.828600f, 0.559800f, 0.250000f, 0.812500f, 
-		-0.000000f, 0.707107f, 0.707107f, -0.000000f, 0.704100f, 0.710100f, 0.250000f, 0.750000f, 
-		0.162212f, -0.555570f, 0.815493f, 0.162600f, -0.552800f, 0.817300f, 0.281250f, 0.312500f, 
-		-0.000000f, -0.555570f, 0.831469f, -0.000000f, -0.552800f, 0.833300f, 0.250000f, 0.312500f, 
-		-0.000000f, -0.707107f, 0.707107f, -0.000000f, -0.704100f, 0.710100f, 0.250000f, 0.250000f, 
-		0.162212f, 0.555570f, 0.815493f, 0.162600f, 0.552800f, 0.817300f, 0.281250f, 0.687500f, 
-		0.137950f, 0.707107f, 0.693520f, 0.138500f, 0.704100f, 0.696500f, 0.281250f, 0.750000f, 
-		-0.000000f, 0.707107f, 0.707107f, -0.000000f, 0.704100f, 0.710100f, 0.250000f, 0.750000f, 
-		-0.000000f, 0.980785f, 0.195090f, -0.000000f, 0.979600f, 0.201000f, 0.250000f, 0.937500f, 
-		-0.038060f, 0.980785f, 0.191342f, -0.039200f, 0.979600f, 0.197100f, 0.218750f, 0.937500f, 
-		-0.074658f, 0.923880f, 0.375330f, -0.075700f, 0.921700f, 0.380400f, 0.218750f, 0.875000f, 
-		-0.000000f, -0.195090f, 0.980785f, -0.000000f, -0.193900f, 0.981000f, 0.250000f, 0.437500f, 
-		-0.191342f, -0.195090f, 0.961939f, -0.191400f, -0.193900f, 0.962200f, 0.218750f, 0.437500f, 
-		-0.180240f, -0.382683f, 0.906127f, -0.180400f, -0.380500f, 0.907000f, 0.218750f, 0.375000f, 
-		-0.000000f, 0.923880f, 0.382683f, -0.000000f, 0.921700f, 0.387900f, 0.250000f, 0.875000f, 
-		-0.074658f, 0.923880f, 0.375330f, -0.075700f, 0.921700f, 0.380400f, 0.218750f, 0.875000f, 
-		-0.108386f, 0.831470f, 0.544895f, -0.109200f, 0.828600f, 0.549000f, 0.218750f, 0.812500f, 
-		-0.000000f, -0.555570f, 0.831469f, -0.000000f, -0.552800f, 0.833300f, 0.250000f, 0.312500f, 
-		0.000000f, -0.382683f, 0.923879f, -0.000000f, -0.380500f, 0.924800f, 0.250000f, 0.375000f, 
-		-0.180240f, -0.382683f, 0.906127f, -0.180400f, -0.380500f, 0.907000f, 0.218750f, 0.375000f, 
-		-0.000000f, 0.831470f, 0.555570f, -0.000000f, 0.828600f, 0.559800f, 0.250000f, 0.812500f, 
-		-0.108386f, 0.831470f, 0.544895f, -0.109200f, 0.828600f, 0.549000f, 0.218750f, 0.812500f, 
-		-0.137950f, 0.707107f, 0.693520f, -0.138500f, 0.704100f, 0.696500f, 0.218750f, 0.750000f, 
-		-0.000000f, -0.555570f, 0.831469f, -0.000000f, -0.552800f, 0.833300f, 0.250000f, 0.312500f, 
-		-0.162212f, -0.555570f, 0.815493f, -0.162600f, -0.552800f, 0.817300f, 0.218750f, 0.312500f, 
-		-0.137950f, -0.707107f, 0.693520f, -0.138500f, -0.704100f, 0.696500f, 0.218750f, 0.250000f, 
-		-0.000000f, 0.555570f, 0.831469f, -0.000000f, 0.552800f, 0.833300f, 0.250000f, 0.687500f, 
-		-0.000000f, 0.707107f, 0.707107f, -0.000000f, 0.704100f, 0.710100f, 0.250000f, 0.750000f, 
-		-0.137950f, 0.707107f, 0.693520f, -0.138500f, 0.704100f, 0.696500f, 0.218750f, 0.750000f, 
-		-0.000000f, -0.831470f, 0.555570f, -0.000000f, -0.828600f, 0.559800f, 0.250000f, 0.187500f, 
-		-0.000000f, -0.707107f, 0.707107f, -0.000000f, -0.704100f, 0.710100f, 0.250000f, 0.250000f, 
-		-0.137950f, -0.707107f, 0.693520f, -0.138500f, -0.704100f, 0.696500f, 0.218750f, 0.250000f, 
-		-0.000000f, 0.555570f, 0.831469f, -0.000000f, 0.552800f, 0.833300f, 0.250000f, 0.687500f, 
-		-0.162212f, 0.555570f, 0.815493f, -0.162600f, 0.552800f, 0.817300f, 0.218750f, 0.687500f, 
-		-0.180240f, 0.382683f, 0.906127f, -0.180400f, 0.380500f, 0.907000f, 0.218750f, 0.625000f, 
-		-0.000000f, -0.831470f, 0.555570f, -0.000000f, -0.828600f, 0.559800f, 0.250000f, 0.187500f, 
-		-0.108386f, -0.831470f, 0.544895f, -0.109200f, -0.828600f, 0.549000f, 0.218750f, 0.187500f, 
-		-0.074658f, -0.923880f, 0.375330f, -0.075700f, -0.921700f, 0.380400f, 0.218750f, 0.125000f, 
-		-0.000000f, 0.195090f, 0.980785f, -0.000000f, 0.193900f, 0.981000f, 0.250000f, 0.562500f, 
-		0.000000f, 0.382683f, 0.923879f, -0.000000f, 0.380500f, 0.924800f, 0.250000f, 0.625000f, 
-		-0.180240f, 0.382683f, 0.906127f, -0.180400f, 0.380500f, 0.907000f, 0.218750f, 0.625000f, 
-		-0.000000f, -0.923880f, 0.382683f, -0.000000f, -0.921700f, 0.387900f, 0.250000f, 0.125000f, 
-		-0.074658f, -0.923880f, 0.375330f, -0.075700f, -0.921700f, 0.380400f, 0.218750f, 0.125000f, 
-		-0.038060f, -0.980785f, 0.191342f, -0.039200f, -0.979600f, 0.197100f, 0.218750f, 0.062500f, 
-		-0.000000f, 0.000000f, 0.999999f, -0.000000f, -0.000000f, 1.000000f, 0.250000f, 0.500000f, 
-		-0.000000f, 0.195090f, 0.980785f, -0.000000f, 0.193900f, 0.981000f, 0.250000f, 0.562500f, 
-		-0.191342f, 0.195090f, 0.961939f, -0.191400f, 0.193900f, 0.962200f, 0.218750f, 0.562500f, 
-		-0.000000f, 0.000000f, 0.999999f, -0.000000f, -0.000000f, 1.000000f, 0.250000f, 0.500000f, 
-		-0.195091f, 0.000000f, 0.980785f, -0.195100f, -0.000000f, 0.980800f, 0.218750f, 0.500000f, 
-		-0.191342f, -0.195090f, 0.961939f, -0.191400f, -0.193900f, 0.962200f, 0.218750f, 0.437500f, 
-		-0.162212f, 0.555570f, 0.815493f, -0.162600f, 0.552800f, 0.817300f, 0.218750f, 0.687500f, 
-		-0.318190f, 0.555570f, 0.768177f, -0.318900f, 0.552800f, 0.769900f, 0.187500f, 0.687500f, 
-		-0.353553f, 0.382683f, 0.853553f, -0.353900f, 0.380500f, 0.854400f, 0.187500f, 0.625000f, 
-		-0.108386f, -0.831470f, 0.544895f, -0.109200f, -0.828600f, 0.549000f, 0.218750f, 0.187500f, 
-		-0.212608f, -0.831470f, 0.513280f, -0.214200f, -0.828600f, 0.517200f, 0.187500f, 0.187500f, 
-		-0.146447f, -0.923880f, 0.353553f, -0.148400f, -0.921700f, 0.358400f, 0.187500f, 0.125000f, 
-		-0.191342f, 0.195090f, 0.961939f, -0.191400f, 0.193900f, 0.962200f, 0.218750f, 0.562500f, 
-		-0.180240f, 0.382683f, 0.906127f, -0.180400f, 0.380500f, 0.907000f, 0.218750f, 0.625000f, 
-		-0.353553f, 0.382683f, 0.853553f, -0.353900f, 0.380500f, 0.854400f, 0.187500f, 0.625000f, 
-		-0.074658f, -0.923880f, 0.375330f, -0.075700f, -0.921700f, 0.380400f, 0.218750f, 0.125000f, 
-		-0.146447f, -0.923880f, 0.353553f, -0.148400f, -0.921700f, 0.358400f, 0.187500f, 0.125000f, 
-		-0.074658f, -0.980785f, 0.180240f, -0.076900f, -0.979600f, 0.185700f, 0.187500f, 0.062500f, 
-		-0.195091f, 0.000000f, 0.980785f, -0.195100f, -0.000000f, 0.980800f, 0.218750f, 0.500000f, 
-		-0.191342f, 0.195090f, 0.961939f, -0.191400f, 0.193900f, 0.962200f, 0.218750f, 0.562500f, 
-		-0.375330f, 0.195090f, 0.906127f, -0.375400f, 0.193900f, 0.906300f, 0.187500f, 0.562500f, 
-		-0.195091f, 0.000000f, 0.980785f, -0.195100f, -0.000000f, 0.980800f, 0.218750f, 0.500000f, 
-		-0.382683f, 0.000000f, 0.923879f, -0.382700f, -0.000000f, 0.923900f, 0.187500f, 0.500000f, 
-		-0.375330f, -0.195090f, 0.906127f, -0.375400f, -0.193900f, 0.906300f, 0.187500f, 0.437500f, 
-		-0.074658f, 0.923880f, 0.375330f, -0.075700f, 0.921700f, 0.380400f, 0.218750f, 0.875000f, 
-		-0.038060f, 0.980785f, 0.191342f, -0.039200f, 0.979600f, 0.197100f, 0.218750f, 0.937500f, 
-		-0.074658f, 0.980785f, 0.180240f, -0.076900f, 0.979600f, 0.185700f, 0.187500f, 0.937500f, 
-		-0.191342f, -0.195090f, 0.961939f, -0.191400f, -0.193900f, 0.962200f, 0.218750f, 0.437500f, 
-		-0.375330f, -0.195090f, 0.906127f, -0.375400f, -0.193900f, 0.906300f, 0.187500f, 0.437500f, 
-		-0.353553f, -0.382683f, 0.853553f, -0.353900f, -0.380500f, 0.854400f, 0.187500f, 0.375000f, 
-		-0.074658f, 0.923880f, 0.375330f, -0.075700f, 0.921700f, 0.380400f, 0.218750f, 0.875000f, 
-		-0.146447f, 0.923880f, 0.353553f, -0.148400f, 0.921700f, 0.358400f, 0.187500f, 0.875000f, 
-		-0.212608f, 0.831470f, 0.513280f, -0.214200f, 0.828600f, 0.517200f, 0.187500f, 0.812500f, 
-		-0.162212f, -0.555570f, 0.815493f, -0.162600f, -0.552800f, 0.817300f, 0.218750f, 0.312500f, 
-		-0.180240f, -0.382683f, 0.906127f, -0.180400f, -0.380500f, 0.907000f, 0.218750f, 0.375000f, 
-		-0.353553f, -0.382683f, 0.853553f, -0.353900f, -0.380500f, 0.854400f, 0.187500f, 0.375000f, 
-		-0.108386f, 0.831470f, 0.544895f, -0.109200f, 0.828600f, 0.549000f, 0.218750f, 0.812500f, 
-		-0.212608f, 0.831470f, 0.513280f, -0.214200f, 0.828600f, 0.517200f, 0.187500f, 0.812500f, 
-		-0.270598f, 0.707107f, 0.653281f, -0.271800f, 0.704100f, 0.656100f, 0.187500f, 0.750000f, 
-		-0.162212f, -0.555570f, 0.815493f, -0.162600f, -0.552800f, 0.817300f, 0.218750f, 0.312500f, 
-		-0.318190f, -0.555570f, 0.768177f, -0.318900f, -0.552800f, 0.769900f, 0.187500f, 0.312500f, 
-		-0.270598f, -0.707107f, 0.653281f, -0.271800f, -0.704100f, 0.656100f, 0.187500f, 0.250000f, 
-		-0.162212f, 0.555570f, 0.815493f, -0.162600f, 0.552800f, 0.817300f, 0.218750f, 0.687500f, 
-		-0.137950f, 0.707107f, 0.693520f, -0.138500f, 0.704100f, 0.696500f, 0.218750f, 0.750000f, 
-		-0.270598f, 0.707107f, 0.653281f, -0.271800f, 0.704100f, 0.656100f, 0.187500f, 0.750000f, 
-		-0.108386f, -0.831470f, 0.544895f, -0.109200f, -0.828600f, 0.549000f, 0.218750f, 0.187500f, 
-		-0.137950f, -0.707107f, 0.693520f, -0.138500f, -0.704100f, 0.696500f, 0.218750f, 0.250000f, 
-		-0.270598f, -0.707107f, 0.653281f, -0.271800f, -0.704100f, 0.656100f, 0.187500f, 0.250000f, 
-		-0.375330f, -0.195090f, 0.906127f, -0.375400f, -0.193900f, 0.906300f, 0.187500f, 0.437500f, 
-		-0.544895f, -0.195090f, 0.815493f, -0.545000f, -0.193900f, 0.815700f, 0.156250f, 0.437500f, 
-		-0.513280f, -0.382683f, 0.768178f, -0.513800f, -0.380500f, 0.768900f, 0.156250f, 0.375000f, 
-		-0.146447f, 0.923880f, 0.353553f, -0.148400f, 0.921700f, 0.358400f, 0.187500f, 0.875000f, 
-		-0.212608f, 0.923880f, 0.318190f, -0.215500f, 0.921700f, 0.322500f, 0.156250f, 0.875000f, 
-		-0.308658f, 0.831470f, 0.461939f, -0.311000f, 0.828600f, 0.465400f, 0.156250f, 0.812500f, 
-		-0.318190f, -0.555570f, 0.768177f, -0.318900f, -0.552800f, 0.769900f, 0.187500f, 0.312500f, 
-		-0.353553f, -0.382683f, 0.853553f, -0.353900f, -0.380500f, 0.854400f, 0.187500f, 0.375000f, 
-		-0.513280f, -0.382683f, 0.768178f, -0.513800f, -0.380500f, 0.768900f, 0.156250f, 0.375000f, 
-		-0.212608f, 0.831470f, 0.513280f, -0.214200f, 0.828600f, 0.517200f, 0.187500f, 0.812500f, 
-		-0.308658f, 0.831470f, 0.461939f, -0.311000f, 0.828600f, 0.465400f, 0.156250f, 0.812500f, 
-		-0.392847f, 0.707107f, 0.587938f, -0.394500f, 0.704100f, 0.590500f, 0.156250f, 0.750000f, 
-		-0.318190f, -0.555570f, 0.768177f, -0.318900f, -0.552800f, 0.769900f, 0.187500f, 0.312500f, 
-		-0.461940f, -0.555570f, 0.691341f, -0.463000f, -0.552800f, 0.692900f, 0.156250f, 0.312500f, 
-		-0.392847f, -0.707107f, 0.587938f, -0.394500f, -0.704100f, 0.590500f, 0.156250f, 0.250000f, 
-		-0.318190f, 0.555570f, 0.768177f, -0.318900f, 0.552800f, 0.769900f, 0.187500f, 0.687500f, 
-		-0.270598f, 0.707107f, 0.653281f, -0.271800f, 0.704100f, 0.656100f, 0.187500f, 0.750000f, 
-		-0.392847f, 0.707107f, 0.587938f, -0.394500f, 0.704100f, 0.590500f, 0.156250f, 0.750000f, 
-		-0.212608f, -0.831470f, 0.513280f, -0.214200f, -0.828600f, 0.517200f, 0.187500f, 0.187500f, 
-		-0.270598f, -0.707107f, 0.653281f, -0.271800f, -0.704100f, 0.656100f, 0.187500f, 0.250000f, 
-		-0.392847f, -0.707107f, 0.587938f, -0.394500f, -0.704100f, 0.590500f, 0.156250f, 0.250000f, 
-		-0.318190f, 0.555570f, 0.768177f, -0.318900f, 0.552800f, 0.769900f, 0.187500f, 0.687500f, 
-		-0.461940f, 0.555570f, 0.691341f, -0.463000f, 0.552800f, 0.692900f, 0.156250f, 0.687500f, 
-		-0.513280f, 0.382683f, 0.768178f, -0.513800f, 0.380500f, 0.768900f, 0.156250f, 0.625000f, 
-		-0.212608f, -0.831470f, 0.513280f, -0.214200f, -0.828600f, 0.517200f, 0.187500f, 0.187500f, 
-		-0.308658f, -0.831470f, 0.461939f, -0.311000f, -0.828600f, 0.465400f, 0.156250f, 0.187500f, 
-		-0.212608f, -0.923880f, 0.318190f, -0.215500f, -0.921700f, 0.322500f, 0.156250f, 0.125000f, 
-		-0.375330f, 0.195090f, 0.906127f, -0.375400f, 0.193900f, 0.906300f, 0.187500f, 0.562500f, 
-		-0.353553f, 0.382683f, 0.853553f, -0.353900f, 0.380500f, 0.854400f, 0.187500f, 0.625000f, 
-		-0.513280f, 0.382683f, 0.768178f, -0.513800f, 0.380500f, 0.768900f, 0.156250f, 0.625000f, 
-		-0.074658f, -0.980785f, 0.180240f, -0.076900f, -0.979600f, 0.185700f, 0.187500f, 0.062500f, 
-		-0.146447f, -0.923880f, 0.353553f, -0.148400f, -0.921700f, 0.358400f, 0.187500f, 0.125000f, 
-		-0.212608f, -0.923880f, 0.318190f, -0.215500f, -0.921700f, 0.322500f, 0.156250f, 0.125000f, 
-		-0.382683f, 0.000000f, 0.923879f, -0.382700f, -0.000000f, 0.923900f, 0.187500f, 0.500000f, 
-		-0.375330f, 0.195090f, 0.906127f, -0.375400f, 0.193900f, 0.906300f, 0.187500f, 0.562500f, 
-		-0.544895f, 0.195090f, 0.815493f, -0.545000f, 0.193900f, 0.815700f, 0.156250f, 0.562500f, 
-		-0.382683f, 0.000000f, 0.923879f, -0.382700f, -0.000000f, 0.923900f, 0.187500f, 0.500000f, 
-		-0.555570f, 0.000000f, 0.831469f, -0.555600f, -0.000000f, 0.831500f, 0.156250f, 0.500000f, 
-		-0.544895f, -0.195090f, 0.815493f, -0.545000f, -0.193900f, 0.815700f, 0.156250f, 0.437500f, 
-		-0.146447f, 0.923880f, 0.353553f, -0.148400f, 0.921700f, 0.358400f, 0.187500f, 0.875000f, 
-		-0.074658f, 0.980785f, 0.180240f, -0.076900f, 0.979600f, 0.185700f, 0.187500f, 0.937500f, 
-		-0.108386f, 0.980785f, 0.162212f, -0.111700f, 0.979600f, 0.167100f, 0.156250f, 0.937500f, 
-		-0.308658f, -0.831470f, 0.461939f, -0.311000f, -0.828600f, 0.465400f, 0.156250f, 0.187500f, 
-		-0.392847f, -0.831470f, 0.392847f, -0.395800f, -0.828600f, 0.395800f, 0.125000f, 0.187500f, 
-		-0.270598f, -0.923880f, 0.270598f, -0.274300f, -0.921700f, 0.274300f, 0.125000f, 0.125000f, 
-		-0.544895f, 0.195090f, 0.815493f, -0.545000f, 0.193900f, 0.815700f, 0.156250f, 0.562500f, 
-		-0.513280f, 0.382683f, 0.768178f, -0.513800f, 0.380500f, 0.768900f, 0.156250f, 0.625000f, 
-		-0.653281f, 0.382683f, 0.653281f, -0.653900f, 0.380500f, 0.653900f, 0.125000f, 0.625000f, 
-		-0.108386f, -0.980785f, 0.162212f, -0.111700f, -0.979600f, 0.167100f, 0.156250f, 0.062500f, 
-		-0.212608f, -0.923880f, 0.318190f, -0.215500f, -0.921700f, 0.322500f, 0.156250f, 0.125000f, 
-		-0.270598f, -0.923880f, 0.270598f, -0.274300f, -0.921700f, 0.274300f, 0.125000f, 0.125000f, 
-		-0.555570f, 0.000000f, 0.831469f, -0.555600f, -0.000000f, 0.831500f, 0.156250f, 0.500000f, 
-		-0.544895f, 0.195090f, 0.815493f, -0.545000f, 0.193900f, 0.815700f, 0.156250f, 0.562500f, 
-		-0.693520f, 0.195090f, 0.693520f, -0.693700f, 0.193900f, 0.693700f, 0.125000f, 0.562500f, 
-		-0.555570f, 0.000000f, 0.831469f, -0.555600f, -0.000000f, 0.831500f, 0.156250f, 0.500000f, 
-		-0.707106f, 0.000000f, 0.707106f, -0.707100f, -0.000000f, 0.707100f, 0.125000f, 0.500000f, 
-		-0.693520f, -0.195090f, 0.693520f, -0.693700f, -0.193900f, 0.693700f, 0.125000f, 0.437500f, 
-		-0.108386f, 0.980785f, 0.162212f, -0.111700f, 0.979600f, 0.167100f, 0.156250f, 0.937500f, 
-		-0.137950f, 0.980785f, 0.137950f, -0.142100f, 0.979600f, 0.142100f, 0.125000f, 0.937500f, 
-		-0.270598f, 0.923880f, 0.270598f, -0.274300f, 0.921700f, 0.274300f, 0.125000f, 0.875000f, 
-		-0.544895f, -0.195090f, 0.815493f, -0.545000f, -0.193900f, 0.815700f, 0.156250f, 0.437500f, 
-		-0.693520f, -0.195090f, 0.693520f, -0.693700f, -0.193900f, 0.693700f, 0.125000f, 0.437500f, 
-		-0.653281f, -0.382683f, 0.653281f, -0.653900f, -0.380500f, 0.653900f, 0.125000f, 0.375000f, 
-		-0.212608f, 0.923880f, 0.318190f, -0.215500f, 0.921700f, 0.322500f, 0.156250f, 0.875000f, 
-		-0.270598f, 0.923880f, 0.270598f, -0.274300f, 0.921700f, 0.274300f, 0.125000f, 0.875000f, 
-		-0.392847f, 0.831470f, 0.392847f, -0.395800f, 0.828600f, 0.395800f, 0.125000f, 0.812500f, 
-		-0.461940f, -0.555570f, 0.691341f, -0.463000f, -0.552800f, 0.692900f, 0.156250f, 0.312500f, 
-		-0.513280f, -0.382683f, 0.768178f, -0.513800f, -0.380500f, 0.768900f, 0.156250f, 0.375000f, 
-		-0.653281f, -0.382683f, 0.653281f, -0.653900f, -0.380500f, 0.653900f, 0.125000f, 0.375000f, 
-		-0.308658f, 0.831470f, 0.461939f, -0.311000f, 0.828600f, 0.465400f, 0.156250f, 0.812500f, 
-		-0.392847f, 0.831470f, 0.392847f, -0.395800f, 0.828600f, 0.395800f, 0.125000f, 0.812500f, 
-		-0.500000f, 0.707107f, 0.500000f, -0.502100f, 0.704100f, 0.502100f, 0.125000f, 0.750000f, 
-		-0.461940f, -0.555570f, 0.691341f, -0.463000f, -0.552800f, 0.692900f, 0.156250f, 0.312500f, 
-		-0.587938f, -0.555570f, 0.587937f, -0.589300f, -0.552800f, 0.589300f, 0.125000f, 0.312500f, 
-		-0.500000f, -0.707107f, 0.500000f, -0.502100f, -0.704100f, 0.502100f, 0.125000f, 0.250000f, 
-		-0.461940f, 0.555570f, 0.691341f, -0.463000f, 0.552800f, 0.692900f, 0.156250f, 0.687500f, 
-		-0.392847f, 0.707107f, 0.587938f, -0.394500f, 0.704100f, 0.590500f, 0.156250f, 0.750000f, 
-		-0.500000f, 0.707107f, 0.500000f, -0.502100f, 0.704100f, 0.502100f, 0.125000f, 0.750000f, 
-		-0.308658f, -0.831470f, 0.461939f, -0.311000f, -0.828600f, 0.465400f, 0.156250f, 0.187500f, 
-		-0.392847f, -0.707107f, 0.587938f, -0.394500f, -0.704100f, 0.590500f, 0.156250f, 0.250000f, 
-		-0.500000f, -0.707107f, 0.500000f, -0.502100f, -0.704100f, 0.502100f, 0.125000f, 0.250000f, 
-		-0.461940f, 0.555570f, 0.691341f, -0.463000f, 0.552800f, 0.692900f, 0.156250f, 0.687500f, 
-		-0.587938f, 0.555570f, 0.587937f, -0.589300f, 0.552800f, 0.589300f, 0.125000f, 0.687500f, 
-		-0.653281f, 0.382683f, 0.653281f, -0.653900f, 0.380500f, 0.653900f, 0.125000f, 0.625000f, 
-		-0.587938f, -0.555570f, 0.587937f, -0.589300f, -0.552800f, 0.589300f, 0.125000f, 0.312500f, 
-		-0.653281f, -0.382683f, 0.653281f, -0.653900f, -0.380500f, 0.653900f, 0.125000f, 0.375000f, 
-		-0.768177f, -0.382683f, 0.513280f, -0.768900f, -0.380500f, 0.513800f, 0.093750f, 0.375000f, 
-		-0.392847f, 0.831470f, 0.392847f, -0.395800f, 0.828600f, 0.395800f, 0.125000f, 0.812500f, 
-		-0.461940f, 0.831470f, 0.308658f, -0.465400f, 0.828600f, 0.311000f, 0.093750f, 0.812500f, 
-		-0.587938f, 0.707107f, 0.392847f, -0.590500f, 0.704100f, 0.394500f, 0.093750f, 0.750000f, 
-		-0.587938f, -0.555570f, 0.587937f, -0.589300f, -0.552800f, 0.589300f, 0.125000f, 0.312500f, 
-		-0.691341f, -0.555570f, 0.461939f, -0.692900f, -0.552800f, 0.463000f, 0.093750f, 0.312500f, 
-		-0.587938f, -0.707107f, 0.392847f, -0.590500f, -0.704100f, 0.394500f, 0.093750f, 0.250000f, 
-		-0.587938f, 0.555570f, 0.587937f, -0.589300f, 0.552800f, 0.589300f, 0.125000f, 0.687500f, 
-		-0.500000f, 0.707107f, 0.500000f, -0.502100f, 0.704100f, 0.502100f, 0.125000f, 0.750000f, 
-		-0.587938f, 0.707107f, 0.392847f, -0.590500f, 0.704100f, 0.394500f, 0.093750f, 0.750000f, 
-		-0.392847f, -0.831470f, 0.392847f, -0.395800f, -0.828600f, 0.395800f, 0.125000f, 0.187500f, 
-		-0.500000f, -0.707107f, 0.500000f, -0.502100f, -0.704100f, 0.502100f, 0.125000f, 0.250000f, 
-		-0.587938f, -0.707107f, 0.392847f, -0.590500f, -0.704100f, 0.394500f, 0.093750f, 0.250000f, 
-		-0.587938f, 0.555570f, 0.587937f, -0.589300f, 0.552800f, 0.589300f, 0.125000f, 0.687500f, 
-		-0.691341f, 0.555570f, 0.461939f, -0.692900f, 0.552800f, 0.463000f, 0.093750f, 0.687500f, 
-		-0.768177f, 0.382683f, 0.513280f, -0.768900f, 0.380500f, 0.513800f, 0.093750f, 0.625000f, 
-		-0.392847f, -0.831470f, 0.392847f, -0.395800f, -0.828600f, 0.395800f, 0.125000f, 0.187500f, 
-		-0.461940f, -0.831470f, 0.308658f, -0.465400f, -0.828600f, 0.311000f, 0.093750f, 0.187500f, 
-		-0.318190f, -0.923880f, 0.212607f, -0.322500f, -0.921700f, 0.215500f, 0.093750f, 0.125000f, 
-		-0.693520f, 0.195090f, 0.693520f, -0.693700f, 0.193900f, 0.693700f, 0.125000f, 0.562500f, 
-		-0.653281f, 0.382683f, 0.653281f, -0.653900f, 0.380500f, 0.653900f, 0.125000f, 0.625000f, 
-		-0.768177f, 0.382683f, 0.513280f, -0.768900f, 0.380500f, 0.513800f, 0.093750f, 0.625000f, 
-		-0.270598f, -0.923880f, 0.270598f, -0.274300f, -0.921700f, 0.274300f, 0.125000f, 0.125000f, 
-		-0.318190f, -0.923880f, 0.212607f, -0.322500f, -0.921700f, 0.215500f, 0.093750f, 0.125000f, 
-		-0.162212f, -0.980785f, 0.108386f, -0.167100f, -0.979600f, 0.111700f, 0.093750f, 0.062500f, 
-		-0.707106f, 0.000000f, 0.707106f, -0.707100f, -0.000000f, 0.707100f, 0.125000f, 0.500000f, 
-		-0.693520f, 0.195090f, 0.693520f, -0.693700f, 0.193900f, 0.693700f, 0.125000f, 0.562500f, 
-		-0.815493f, 0.195090f, 0.544895f, -0.815700f, 0.193900f, 0.545000f, 0.093750f, 0.562500f, 
-		-0.707106f, 0.000000f, 0.707106f, -0.707100f, -0.000000f, 0.707100f, 0.125000f, 0.500000f, 
-		-0.831469f, 0.000000f, 0.555569f, -0.831500f, -0.000000f, 0.555600f, 0.093750f, 0.500000f, 
-		-0.815493f, -0.195090f, 0.544895f, -0.815700f, -0.193900f, 0.545000f, 0.093750f, 0.437500f, 
-		-0.137950f, 0.980785f, 0.137950f, -0.142100f, 0.979600f, 0.142100f, 0.125000f, 0.937500f, 
-		-0.162212f, 0.980785f, 0.108386f, -0.167100f, 0.979600f, 0.111700f, 0.093750f, 0.937500f, 
-		-0.318190f, 0.923880f, 0.212607f, -0.322500f, 0.921700f, 0.215500f, 0.093750f, 0.875000f, 
-		-0.693520f, -0.195090f, 0.693520f, -0.693700f, -0.193900f, 0.693700f, 0.125000f, 0.437500f, 
-		-0.815493f, -0.195090f, 0.544895f, -0.815700f, -0.193900f, 0.545000f, 0.093750f, 0.437500f, 
-		-0.768177f, -0.382683f, 0.513280f, -0.768900f, -0.380500f, 0.513800f, 0.093750f, 0.375000f, 
-		-0.270598f, 0.923880f, 0.270598f, -0.274300f, 0.921700f, 0.274300f, 0.125000f, 0.875000f, 
-		-0.318190f, 0.923880f, 0.212607f, -0.322500f, 0.921700f, 0.215500f, 0.093750f, 0.875000f, 
-		-0.461940f, 0.831470f, 0.308658f, -0.465400f, 0.828600f, 0.311000f, 0.093750f, 0.812500f, 
-		-0.318190f, -0.923880f, 0.212607f, -0.322500f, -0.921700f, 0.215500f, 0.093750f, 0.125000f, 
-		-0.353553f, -0.923880f, 0.146447f, -0.358400f, -0.921700f, 0.148400f, 0.062500f, 0.125000f, 
-		-0.180240f, -0.980785f, 0.074658f, -0.185700f, -0.979600f, 0.076900f, 0.062500f, 0.062500f, 
-		-0.831469f, 0.000000f, 0.555569f, -0.831500f, -0.000000f, 0.555600f, 0.093750f, 0.500000f, 
-		-0.815493f, 0.195090f, 0.544895f, -0.815700f, 0.193900f, 0.545000f, 0.093750f, 0.562500f, 
-		-0.906127f, 0.195090f, 0.375330f, -0.906300f, 0.193900f, 0.375400f, 0.062500f, 0.562500f, 
-		-0.831469f, 0.000000f, 0.555569f, -0.831500f, -0.000000f, 0.555600f, 0.093750f, 0.500000f, 
-		-0.923879f, 0.000000f, 0.382683f, -0.923900f, -0.000000f, 0.382700f, 0.062500f, 0.500000f, 
-		-0.906127f, -0.195090f, 0.375330f, -0.906300f, -0.193900f, 0.375400f, 0.062500f, 0.437500f, 
-		-0.162212f, 0.980785f, 0.108386f, -0.167100f, 0.979600f, 0.111700f, 0.093750f, 0.937500f, 
-		-0.180240f, 0.980785f, 0.074658f, -0.185700f, 0.979600f, 0.076900f, 0.062500f, 0.937500f, 
-		-0.353553f, 0.923880f, 0.146447f, -0.358400f, 0.921700f, 0.148400f, 0.062500f, 0.875000f, 
-		-0.815493f, -0.195090f, 0.544895f, -0.815700f, -0.193900f, 0.545000f, 0.093750f, 0.437500f, 
-		-0.906127f, -0.195090f, 0.375330f, -0.906300f, -0.193900f, 0.375400f, 0.062500f, 0.437500f, 
-		-0.853553f, -0.382683f, 0.353553f, -0.854400f, -0.380500f, 0.353900f, 0.062500f, 0.375000f, 
-		-0.318190f, 0.923880f, 0.212607f, -0.322500f, 0.921700f, 0.215500f, 0.093750f, 0.875000f, 
-		-0.353553f, 0.923880f, 0.146447f, -0.358400f, 0.921700f, 0.148400f, 0.062500f, 0.875000f, 
-		-0.513280f, 0.831470f, 0.212607f, -0.517200f, 0.828600f, 0.214200f, 0.062500f, 0.812500f, 
-		-0.691341f, -0.555570f, 0.461939f, -0.692900f, -0.552800f, 0.463000f, 0.093750f, 0.312500f, 
-		-0.768177f, -0.382683f, 0.513280f, -0.768900f, -0.380500f, 0.513800f, 0.093750f, 0.375000f, 
-		-0.853553f, -0.382683f, 0.353553f, -0.854400f, -0.380500f, 0.353900f, 0.062500f, 0.375000f, 
-		-0.461940f, 0.831470f, 0.308658f, -0.465400f, 0.828600f, 0.311000f, 0.093750f, 0.812500f, 
-		-0.513280f, 0.831470f, 0.212607f, -0.517200f, 0.828600f, 0.214200f, 0.062500f, 0.812500f, 
-		-0.653281f, 0.707107f, 0.270598f, -0.656100f, 0.704100f, 0.271800f, 0.062500f, 0.750000f, 
-		-0.691341f, -0.555570f, 0.461939f, -0.692900f, -0.552800f, 0.463000f, 0.093750f, 0.312500f, 
-		-0.768177f, -0.555570f, 0.318189f, -0.769900f, -0.552800f, 0.318900f, 0.062500f, 0.312500f, 
-		-0.653281f, -0.707107f, 0.270598f, -0.656100f, -0.704100f, 0.271800f, 0.062500f, 0.250000f, 
-		-0.587938f, 0.707107f, 0.392847f, -0.590500f, 0.704100f, 0.394500f, 0.093750f, 0.750000f, 
-		-0.653281f, 0.707107f, 0.270598f, -0.656100f, 0.704100f, 0.271800f, 0.062500f, 0.750000f, 
-		-0.768177f, 0.555570f, 0.318189f, -0.769900f, 0.552800f, 0.318900f, 0.062500f, 0.687500f, 
-		-0.461940f, -0.831470f, 0.308658f, -0.465400f, -0.828600f, 0.311000f, 0.093750f, 0.187500f, 
-		-0.587938f, -0.707107f, 0.392847f, -0.590500f, -0.704100f, 0.394500f, 0.093750f, 0.250000f, 
-		-0.653281f, -0.707107f, 0.270598f, -0.656100f, -0.704100f, 0.271800f, 0.062500f, 0.250000f, 
-		-0.691341f, 0.555570f, 0.461939f, -0.692900f, 0.552800f, 0.463000f, 0.093750f, 0.687500f, 
-		-0.768177f, 0.555570f, 0.318189f, -0.769900f, 0.552800f, 0.318900f, 0.062500f, 0.687500f, 
-		-0.853553f, 0.382683f, 0.353553f, -0.854400f, 0.380500f, 0.353900f, 0.062500f, 0.625000f, 
-		-0.461940f, -0.831470f, 0.308658f, -0.465400f, -0.828600f, 0.311000f, 0.093750f, 0.187500f, 
-		-0.513280f, -0.831470f, 0.212607f, -0.517200f, -0.828600f, 0.214200f, 0.062500f, 0.187500f, 
-		-0.353553f, -0.923880f, 0.146447f, -0.358400f, -0.921700f, 0.148400f, 0.062500f, 0.125000f, 
-		-0.815493f, 0.195090f, 0.544895f, -0.815700f, 0.193900f, 0.545000f, 0.093750f, 0.562500f, 
-		-0.768177f, 0.382683f, 0.513280f, -0.768900f, 0.380500f, 0.513800f, 0.093750f, 0.625000f, 
-		-0.853553f, 0.382683f, 0.353553f, -0.854400f, 0.380500f, 0.353900f, 0.062500f, 0.625000f, 
-		-0.513280f, 0.831470f, 0.212607f, -0.517200f, 0.828600f, 0.214200f, 0.062500f, 0.812500f, 
-		-0.544895f, 0.831470f, 0.108386f, -0.549000f, 0.828600f, 0.109200f, 0.031250f, 0.812500f, 
-		-0.693520f, 0.707107f, 0.137950f, -0.696500f, 0.704100f, 0.138500f, 0.031250f, 0.750000f, 
-		-0.768177f, -0.555570f, 0.318189f, -0.769900f, -0.552800f, 0.318900f, 0.062500f, 0.312500f, 
-		-0.815493f, -0.555570f, 0.162211f, -0.817300f, -0.552800f, 0.162600f, 0.031250f, 0.312500f, 
-		-0.693520f, -0.707107f, 0.137950f, -0.696500f, -0.704100f, 0.138500f, 0.031250f, 0.250000f, 
-		-0.768177f, 0.555570f, 0.318189f, -0.769900f, 0.552800f, 0.318900f, 0.062500f, 0.687500f, 
-		-0.653281f, 0.707107f, 0.270598f, -0.656100f, 0.704100f, 0.271800f, 0.062500f, 0.750000f, 
-		-0.693520f, 0.707107f, 0.137950f, -0.696500f, 0.704100f, 0.138500f, 0.031250f, 0.750000f, 
-		-0.513280f, -0.831470f, 0.212607f, -0.517200f, -0.828600f, 0.214200f, 0.062500f, 0.187500f, 
-		-0.653281f, -0.707107f, 0.270598f, -0.656100f, -0.704100f, 0.271800f, 0.062500f, 0.250000f, 
-		-0.693520f, -0.707107f, 0.137950f, -0.696500f, -0.704100f, 0.138500f, 0.031250f, 0.250000f, 
-		-0.768177f, 0.555570f, 0.318189f, -0.769900f, 0.552800f, 0.318900f, 0.062500f, 0.687500f, 
-		-0.815493f, 0.555570f, 0.162211f, -0.817300f, 0.552800f, 0.162600f, 0.031250f, 0.687500f, 
-		-0.906127f, 0.382683f, 0.180240f, -0.907000f, 0.380500f, 0.180400f, 0.031250f, 0.625000f, 
-		-0.513280f, -0.831470f, 0.212607f, -0.517200f, -0.828600f, 0.214200f, 0.062500f, 0.187500f, 
-		-0.544895f, -0.831470f, 0.108386f, -0.549000f, -0.828600f, 0.109200f, 0.031250f, 0.187500f, 
-		-0.375330f, -0.923880f, 0.074658f, -0.380400f, -0.921700f, 0.075700f, 0.031250f, 0.125000f, 
-		-0.906127f, 0.195090f, 0.375330f, -0.906300f, 0.193900f, 0.375400f, 0.062500f, 0.562500f, 
-		-0.853553f, 0.382683f, 0.353553f, -0.854400f, 0.380500f, 0.353900f, 0.062500f, 0.625000f, 
-		-0.906127f, 0.382683f, 0.180240f, -0.907000f, 0.380500f, 0.180400f, 0.031250f, 0.625000f, 
-		-0.353553f, -0.923880f, 0.146447f, -0.358400f, -0.921700f, 0.148400f, 0.062500f, 0.125000f, 
-		-0.375330f, -0.923880f, 0.074658f, -0.380400f, -0.921700f, 0.075700f, 0.031250f, 0.125000f, 
-		-0.191342f, -0.980785f, 0.038060f, -0.197100f, -0.979600f, 0.039200f, 0.031250f, 0.062500f, 
-		-0.923879f, 0.000000f, 0.382683f, -0.923900f, -0.000000f, 0.382700f, 0.062500f, 0.500000f, 
-		-0.906127f, 0.195090f, 0.375330f, -0.906300f, 0.193900f, 0.375400f, 0.062500f, 0.562500f, 
-		-0.961939f, 0.195090f, 0.191341f, -0.962200f, 0.193900f, 0.191400f, 0.031250f, 0.562500f, 
-		-0.923879f, 0.000000f, 0.382683f, -0.923900f, -0.000000f, 0.382700f, 0.062500f, 0.500000f, 
-		-0.980784f, 0.000000f, 0.195090f, -0.980800f, -0.000000f, 0.195100f, 0.031250f, 0.500000f, 
-		-0.961939f, -0.195090f, 0.191341f, -0.962200f, -0.193900f, 0.191400f, 0.031250f, 0.437500f, 
-		-0.180240f, 0.980785f, 0.074658f, -0.185700f, 0.979600f, 0.076900f, 0.062500f, 0.937500f, 
-		-0.191342f, 0.980785f, 0.038060f, -0.197100f, 0.979600f, 0.039200f, 0.031250f, 0.937500f, 
-		-0.375330f, 0.923880f, 0.074658f, -0.380400f, 0.921700f, 0.075700f, 0.031250f, 0.875000f, 
-		-0.906127f, -0.195090f, 0.375330f, -0.906300f, -0.193900f, 0.375400f, 0.062500f, 0.437500f, 
-		-0.961939f, -0.195090f, 0.191341f, -0.962200f, -0.193900f, 0.191400f, 0.031250f, 0.437500f, 
-		-0.906127f, -0.382683f, 0.180240f, -0.907000f, -0.380500f, 0.180400f, 0.031250f, 0.375000f, 
-		-0.353553f, 0.923880f, 0.146447f, -0.358400f, 0.921700f, 0.148400f, 0.062500f, 0.875000f, 
-		-0.375330f, 0.923880f, 0.074658f, -0.380400f, 0.921700f, 0.075700f, 0.031250f, 0.875000f, 
-		-0.544895f, 0.831470f, 0.108386f, -0.549000f, 0.828600f, 0.109200f, 0.031250f, 0.812500f, 
-		-0.768177f, -0.555570f, 0.318189f, -0.769900f, -0.552800f, 0.318900f, 0.062500f, 0.312500f, 
-		-0.853553f, -0.382683f, 0.353553f, -0.854400f, -0.380500f, 0.353900f, 0.062500f, 0.375000f, 
-		-0.906127f, -0.382683f, 0.180240f, -0.907000f, -0.380500f, 0.180400f, 0.031250f, 0.375000f, 
-		-0.980784f, 0.000000f, 0.195090f, -0.980800f, -0.000000f, 0.195100f, 0.031250f, 0.500000f, 
-		-0.961939f, 0.195090f, 0.191341f, -0.962200f, 0.193900f, 0.191400f, 0.031250f, 0.562500f, 
-		-0.980785f, 0.195090f, -0.000000f, -0.981000f, 0.193900f, -0.000000f, 0.000000f, 0.562500f, 
-		-0.980784f, 0.000000f, 0.195090f, -0.980800f, -0.000000f, 0.195100f, 0.031250f, 0.500000f, 
-		-0.999999f, 0.000000f, -0.000000f, -1.000000f, -0.000000f, -0.000000f, 0.000000f, 0.500000f, 
-		-0.980785f, -0.195090f, -0.000000f, -0.981000f, -0.193900f, -0.000000f, 0.000000f, 0.437500f, 
-		-0.191342f, 0.980785f, 0.038060f, -0.197100f, 0.979600f, 0.039200f, 0.031250f, 0.937500f, 
-		-0.195090f, 0.980785f, -0.000000f, -0.201000f, 0.979600f, -0.000000f, 0.000000f, 0.937500f, 
-		-0.382683f, 0.923880f, -0.000000f, -0.387900f, 0.921700f, -0.000000f, 0.000000f, 0.875000f, 
-		-0.961939f, -0.195090f, 0.191341f, -0.962200f, -0.193900f, 0.191400f, 0.031250f, 0.437500f, 
-		-0.980785f, -0.195090f, -0.000000f, -0.981000f, -0.193900f, -0.000000f, 0.000000f, 0.437500f, 
-		-0.923879f, -0.382683f, -0.000000f, -0.924800f, -0.380500f, -0.000000f, 0.000000f, 0.375000f, 
-		-0.544895f, 0.831470f, 0.108386f, -0.549000f, 0.828600f, 0.109200f, 0.031250f, 0.812500f, 
-		-0.375330f, 0.923880f, 0.074658f, -0.380400f, 0.921700f, 0.075700f, 0.031250f, 0.875000f, 
-		-0.382683f, 0.923880f, -0.000000f, -0.387900f, 0.921700f, -0.000000f, 0.000000f, 0.875000f, 
-		-0.815493f, -0.555570f, 0.162211f, -0.817300f, -0.552800f, 0.162600f, 0.031250f, 0.312500f, 
-		-0.906127f, -0.382683f, 0.180240f, -0.907000f, -0.380500f, 0.180400f, 0.031250f, 0.375000f, 
-		-0.923879f, -0.382683f, -0.000000f, -0.924800f, -0.380500f, -0.000000f, 0.000000f, 0.375000f, 
-		-0.544895f, 0.831470f, 0.108386f, -0.549000f, 0.828600f, 0.109200f, 0.031250f, 0.812500f, 
-		-0.555570f, 0.831470f, -0.000000f, -0.559800f, 0.828600f, -0.000000f, 0.000000f, 0.812500f, 
-		-0.707107f, 0.707107f, -0.000000f, -0.710100f, 0.704100f, -0.000000f, 0.000000f, 0.750000f, 
-		-0.815493f, -0.555570f, 0.162211f, -0.817300f, -0.552800f, 0.162600f, 0.031250f, 0.312500f, 
-		-0.831469f, -0.555570f, -0.000000f, -0.833300f, -0.552800f, -0.000000f, 0.000000f, 0.312500f, 
-		-0.707107f, -0.707107f, -0.000000f, -0.710100f, -0.704100f, -0.000000f, 0.000000f, 0.250000f, 
-		-0.815493f, 0.555570f, 0.162211f, -0.817300f, 0.552800f, 0.162600f, 0.031250f, 0.687500f, 
-		-0.693520f, 0.707107f, 0.137950f, -0.696500f, 0.704100f, 0.138500f, 0.031250f, 0.750000f, 
-		-0.707107f, 0.707107f, -0.000000f, -0.710100f, 0.704100f, -0.000000f, 0.000000f, 0.750000f, 
-		-0.544895f, -0.831470f, 0.108386f, -0.549000f, -0.828600f, 0.109200f, 0.031250f, 0.187500f, 
-		-0.693520f, -0.707107f, 0.137950f, -0.696500f, -0.704100f, 0.138500f, 0.031250f, 0.250000f, 
-		-0.707107f, -0.707107f, -0.000000f, -0.710100f, -0.704100f, -0.000000f, 0.000000f, 0.250000f, 
-		-0.815493f, 0.555570f, 0.162211f, -0.817300f, 0.552800f, 0.162600f, 0.031250f, 0.687500f, 
-		-0.831469f, 0.555570f, -0.000000f, -0.833300f, 0.552800f, -0.000000f, 0.000000f, 0.687500f, 
-		-0.923879f, 0.382683f, -0.000000f, -0.924800f, 0.380500f, -0.000000f, 0.000000f, 0.625000f, 
-		-0.544895f, -0.831470f, 0.108386f, -0.549000f, -0.828600f, 0.109200f, 0.031250f, 0.187500f, 
-		-0.555570f, -0.831470f, -0.000000f, -0.559800f, -0.828600f, -0.000000f, 0.000000f, 0.187500f, 
-		-0.382683f, -0.923880f, -0.000000f, -0.387900f, -0.921700f, -0.000000f, 0.000000f, 0.125000f, 
-		-0.961939f, 0.195090f, 0.191341f, -0.962200f, 0.193900f, 0.191400f, 0.031250f, 0.562500f, 
-		-0.906127f, 0.382683f, 0.180240f, -0.907000f, 0.380500f, 0.180400f, 0.031250f, 0.625000f, 
-		-0.923879f, 0.382683f, -0.000000f, -0.924800f, 0.380500f, -0.000000f, 0.000000f, 0.625000f, 
-		-0.375330f, -0.923880f, 0.074658f, -0.380400f, -0.921700f, 0.075700f, 0.031250f, 0.125000f, 
-		-0.382683f, -0.923880f, -0.000000f, -0.387900f, -0.921700f, -0.000000f, 0.000000f, 0.125000f, 
-		-0.195090f, -0.980785f, -0.000000f, -0.201000f, -0.979600f, -0.000000f, 0.000000f, 0.062500f, 
-		-0.831469f, -0.555570f, -0.000000f, -0.833300f, -0.552800f, -0.000000f, 1.000000f, 0.312500f, 
-		-0.815493f, -0.555570f, -0.162212f, -0.817300f, -0.552800f, -0.162600f, 0.968750f, 0.312500f, 
-		-0.693520f, -0.707107f, -0.137950f, -0.696500f, -0.704100f, -0.138500f, 0.968750f, 0.250000f, 
-		-0.831469f, 0.555570f, -0.000000f, -0.833300f, 0.552800f, -0.000000f, 1.000000f, 0.687500f, 
-		-0.707107f, 0.707107f, -0.000000f, -0.710100f, 0.704100f, -0.000000f, 1.000000f, 0.750000f, 
-		-0.693520f, 0.707107f, -0.137950f, -0.696500f, 0.704100f, -0.138500f, 0.968750f, 0.750000f, 
-		-0.555570f, -0.831470f, -0.000000f, -0.559800f, -0.828600f, -0.000000f, 1.000000f, 0.187500f, 
-		-0.707107f, -0.707107f, -0.000000f, -0.710100f, -0.704100f, -0.000000f, 1.000000f, 0.250000f, 
-		-0.693520f, -0.707107f, -0.137950f, -0.696500f, -0.704100f, -0.138500f, 0.968750f, 0.250000f, 
-		-0.831469f, 0.555570f, -0.000000f, -0.833300f, 0.552800f, -0.000000f, 1.000000f, 0.687500f, 
-		-0.815493f, 0.555570f, -0.162212f, -0.817300f, 0.552800f, -0.162600f, 0.968750f, 0.687500f, 
-		-0.906127f, 0.382683f, -0.180240f, -0.907000f, 0.380500f, -0.180400f, 0.968750f, 0.625000f, 
-		-0.555570f, -0.831470f, -0.000000f, -0.559800f, -0.828600f, -0.000000f, 1.000000f, 0.187500f, 
-		-0.544895f, -0.831470f, -0.108386f, -0.549000f, -0.828600f, -0.109200f, 0.968750f, 0.187500f, 
-		-0.375330f, -0.923880f, -0.074658f, -0.380400f, -0.921700f, -0.075700f, 0.968750f, 0.125000f, 
-		-0.980785f, 0.195090f, -0.000000f, -0.981000f, 0.193900f, -0.000000f, 1.000000f, 0.562500f, 
-		-0.923879f, 0.382683f, -0.000000f, -0.924800f, 0.380500f, -0.000000f, 1.000000f, 0.625000f, 
-		-0.906127f, 0.382683f, -0.180240f, -0.907000f, 0.380500f, -0.180400f, 0.968750f, 0.625000f, 
-		-0.382683f, -0.923880f, -0.000000f, -0.387900f, -0.921700f, -0.000000f, 1.000000f, 0.125000f, 
-		-0.375330f, -0.923880f, -0.074658f, -0.380400f, -0.921700f, -0.075700f, 0.968750f, 0.125000f, 
-		-0.191342f, -0.980785f, -0.038060f, -0.197100f, -0.979600f, -0.039200f, 0.968750f, 0.062500f, 
-		-0.999999f, 0.000000f, -0.000000f, -1.000000f, -0.000000f, -0.000000f, 1.000000f, 0.500000f, 
-		-0.980785f, 0.195090f, -0.000000f, -0.981000f, 0.193900f, -0.000000f, 1.000000f, 0.562500f, 
-		-0.961939f, 0.195090f, -0.191342f, -0.962200f, 0.193900f, -0.191400f, 0.968750f, 0.562500f, 
-		-0.999999f, 0.000000f, -0.000000f, -1.000000f, -0.000000f, -0.000000f, 1.000000f, 0.500000f, 
-		-0.980784f, 0.000000f, -0.195091f, -0.980800f, -0.000000f, -0.195100f, 0.968750f, 0.500000f, 
-		-0.961939f, -0.195090f, -0.191342f, -0.962200f, -0.193900f, -0.191400f, 0.968750f, 0.437500f, 
-		-0.195090f, 0.980785f, -0.000000f, -0.201000f, 0.979600f, -0.000000f, 1.000000f, 0.937500f, 
-		-0.191342f, 0.980785f, -0.038060f, -0.197100f, 0.979600f, -0.039200f, 0.968750f, 0.937500f, 
-		-0.375330f, 0.923880f, -0.074658f, -0.380400f, 0.921700f, -0.075700f, 0.968750f, 0.875000f, 
-		-0.980785f, -0.195090f, -0.000000f, -0.981000f, -0.193900f, -0.000000f, 1.000000f, 0.437500f, 
-		-0.961939f, -0.195090f, -0.191342f, -0.962200f, -0.193900f, -0.191400f, 0.968750f, 0.437500f, 
-		-0.906127f, -0.382683f, -0.180240f, -0.907000f, -0.380500f, -0.180400f, 0.968750f, 0.375000f, 
-		-0.555570f, 0.831470f, -0.000000f, -0.559800f, 0.828600f, -0.000000f, 1.000000f, 0.812500f, 
-		-0.382683f, 0.923880f, -0.000000f, -0.387900f, 0.921700f, -0.000000f, 1.000000f, 0.875000f, 
-		-0.375330f, 0.923880f, -0.074658f, -0.380400f, 0.921700f, -0.075700f, 0.968750f, 0.875000f, 
-		-0.831469f, -0.555570f, -0.000000f, -0.833300f, -0.552800f, -0.000000f, 1.000000f, 0.312500f, 
-		-0.923879f, -0.382683f, -0.000000f, -0.924800f, -0.380500f, -0.000000f, 1.000000f, 0.375000f, 
-		-0.906127f, -0.382683f, -0.180240f, -0.907000f, -0.380500f, -0.180400f, 0.968750f, 0.375000f, 
-		-0.555570f, 0.831470f, -0.000000f, -0.559800f, 0.828600f, -0.000000f, 1.000000f, 0.812500f, 
-		-0.544895f, 0.831470f, -0.108386f, -0.549000f, 0.828600f, -0.109200f, 0.968750f, 0.812500f, 
-		-0.693520f, 0.707107f, -0.137950f, -0.696500f, 0.704100f, -0.138500f, 0.968750f, 0.750000f, 
-		-0.980784f, 0.000000f, -0.195091f, -0.980800f, -0.000000f, -0.195100f, 0.968750f, 0.500000f, 
-		-0.923878f, 0.000000f, -0.382683f, -0.923900f, -0.000000f, -0.382700f, 0.937500f, 0.500000f, 
-		-0.906127f, -0.195090f, -0.375330f, -0.906300f, -0.193900f, -0.375400f, 0.937500f, 0.437500f, 
-		-0.191342f, 0.980785f, -0.038060f, -0.197100f, 0.979600f, -0.039200f, 0.968750f, 0.937500f, 
-		-0.180240f, 0.980785f, -0.074658f, -0.185700f, 0.979600f, -0.076900f, 0.937500f, 0.937500f, 
-		-0.353553f, 0.923880f, -0.146447f, -0.358400f, 0.921700f, -0.148400f, 0.937500f, 0.875000f, 
-		-0.961939f, -0.195090f, -0.191342f, -0.962200f, -0.193900f, -0.191400f, 0.968750f, 0.437500f, 
-		-0.906127f, -0.195090f, -0.375330f, -0.906300f, -0.193900f, -0.375400f, 0.937500f, 0.437500f, 
-		-0.853553f, -0.382683f, -0.353553f, -0.854400f, -0.380500f, -0.353900f, 0.937500f, 0.375000f, 
-		-0.544895f, 0.831470f, -0.108386f, -0.549000f, 0.828600f, -0.109200f, 0.968750f, 0.812500f, 
-		-0.375330f, 0.923880f, -0.074658f, -0.380400f, 0.921700f, -0.075700f, 0.968750f, 0.875000f, 
-		-0.353553f, 0.923880f, -0.146447f, -0.358400f, 0.921700f, -0.148400f, 0.937500f, 0.875000f, 
-		-0.815493f, -0.555570f, -0.162212f, -0.817300f, -0.552800f, -0.162600f, 0.968750f, 0.312500f, 
-		-0.906127f, -0.382683f, -0.180240f, -0.907000f, -0.380500f, -0.180400f, 0.968750f, 0.375000f, 
-		-0.853553f, -0.382683f, -0.353553f, -0.854400f, -0.380500f, -0.353900f, 0.937500f, 0.375000f, 
-		-0.544895f, 0.831470f, -0.108386f, -0.549000f, 0.828600f, -0.109200f, 0.968750f, 0.812500f, 
-		-0.513279f, 0.831470f, -0.212607f, -0.517200f, 0.828600f, -0.214200f, 0.937500f, 0.812500f, 
-		-0.653281f, 0.707107f, -0.270598f, -0.656100f, 0.704100f, -0.271800f, 0.937500f, 0.750000f, 
-		-0.815493f, -0.555570f, -0.162212f, -0.817300f, -0.552800f, -0.162600f, 0.968750f, 0.312500f, 
-		-0.768177f, -0.555570f, -0.318190f, -0.769900f, -0.552800f, -0.318900f, 0.937500f, 0.312500f, 
-		-0.653281f, -0.707107f, -0.270598f, -0.656100f, -0.704100f, -0.271800f, 0.937500f, 0.250000f, 
-		-0.815493f, 0.555570f, -0.162212f, -0.817300f, 0.552800f, -0.162600f, 0.968750f, 0.687500f, 
-		-0.693520f, 0.707107f, -0.137950f, -0.696500f, 0.704100f, -0.138500f, 0.968750f, 0.750000f, 
-		-0.653281f, 0.707107f, -0.270598f, -0.656100f, 0.704100f, -0.271800f, 0.937500f, 0.750000f, 
-		-0.544895f, -0.831470f, -0.108386f, -0.549000f, -0.828600f, -0.109200f, 0.968750f, 0.187500f, 
-		-0.693520f, -0.707107f, -0.137950f, -0.696500f, -0.704100f, -0.138500f, 0.968750f, 0.250000f, 
-		-0.653281f, -0.707107f, -0.270598f, -0.656100f, -0.704100f, -0.271800f, 0.937500f, 0.250000f, 
-		-0.815493f, 0.555570f, -0.162212f, -0.817300f, 0.552800f, -0.162600f, 0.968750f, 0.687500f, 
-		-0.768177f, 0.555570f, -0.318190f, -0.769900f, 0.552800f, -0.318900f, 0.937500f, 0.687500f, 
-		-0.853553f, 0.382683f, -0.353553f, -0.854400f, 0.380500f, -0.353900f, 0.937500f, 0.625000f, 
-		-0.544895f, -0.831470f, -0.108386f, -0.549000f, -0.828600f, -0.109200f, 0.968750f, 0.187500f, 
-		-0.513279f, -0.831470f, -0.212607f, -0.517200f, -0.828600f, -0.214200f, 0.937500f, 0.187500f, 
-		-0.353553f, -0.923880f, -0.146447f, -0.358400f, -0.921700f, -0.148400f, 0.937500f, 0.125000f, 
-		-0.961939f, 0.195090f, -0.191342f, -0.962200f, 0.193900f, -0.191400f, 0.968750f, 0.562500f, 
-		-0.906127f, 0.382683f, -0.180240f, -0.907000f, 0.380500f, -0.180400f, 0.968750f, 0.625000f, 
-		-0.853553f, 0.382683f, -0.353553f, -0.854400f, 0.380500f, -0.353900f, 0.937500f, 0.625000f, 
-		-0.375330f, -0.923880f, -0.074658f, -0.380400f, -0.921700f, -0.075700f, 0.968750f, 0.125000f, 
-		-0.353553f, -0.923880f, -0.146447f, -0.358400f, -0.921700f, -0.148400f, 0.937500f, 0.125000f, 
-		-0.180240f, -0.980785f, -0.074658f, -0.185700f, -0.979600f, -0.076900f, 0.937500f, 0.062500f, 
-		-0.980784f, 0.000000f, -0.195091f, -0.980800f, -0.000000f, -0.195100f, 0.968750f, 0.500000f, 
-		-0.961939f, 0.195090f, -0.191342f, -0.962200f, 0.193900f, -0.191400f, 0.968750f, 0.562500f, 
-		-0.906127f, 0.195090f, -0.375330f, -0.906300f, 0.193900f, -0.375400f, 0.937500f, 0.562500f, 
-		-0.768177f, 0.555570f, -0.318190f, -0.769900f, 0.552800f, -0.318900f, 0.937500f, 0.687500f, 
-		-0.653281f, 0.707107f, -0.270598f, -0.656100f, 0.704100f, -0.271800f, 0.937500f, 0.750000f, 
-		-0.587938f, 0.707107f, -0.392847f, -0.590500f, 0.704100f, -0.394500f, 0.906250f, 0.750000f, 
-		-0.513279f, -0.831470f, -0.212607f, -0.517200f, -0.828600f, -0.214200f, 0.937500f, 0.187500f, 
-		-0.653281f, -0.707107f, -0.270598f, -0.656100f, -0.704100f, -0.271800f, 0.937500f, 0.250000f, 
-		-0.587938f, -0.707107f, -0.392847f, -0.590500f, -0.704100f, -0.394500f, 0.906250f, 0.250000f, 
-		-0.768177f, 0.555570f, -0.318190f, -0.769900f, 0.552800f, -0.318900f, 0.937500f, 0.687500f, 
-		-0.691341f, 0.555570f, -0.461940f, -0.692900f, 0.552800f, -0.463000f, 0.906250f, 0.687500f, 
-		-0.768177f, 0.382683f, -0.513280f, -0.768900f, 0.380500f, -0.513800f, 0.906250f, 0.625000f, 
-		-0.353553f, -0.923880f, -0.146447f, -0.358400f, -0.921700f, -0.148400f, 0.937500f, 0.125000f, 
-		-0.513279f, -0.831470f, -0.212607f, -0.517200f, -0.828600f, -0.214200f, 0.937500f, 0.187500f, 
-		-0.461939f, -0.831470f, -0.308658f, -0.465400f, -0.828600f, -0.311000f, 0.906250f, 0.187500f, 
-		-0.906127f, 0.195090f, -0.375330f, -0.906300f, 0.193900f, -0.375400f, 0.937500f, 0.562500f, 
-		-0.853553f, 0.382683f, -0.353553f, -0.854400f, 0.380500f, -0.353900f, 0.937500f, 0.625000f, 
-		-0.768177f, 0.382683f, -0.513280f, -0.768900f, 0.380500f, -0.513800f, 0.906250f, 0.625000f, 
-		-0.353553f, -0.923880f, -0.146447f, -0.358400f, -0.921700f, -0.148400f, 0.937500f, 0.125000f, 
-		-0.318189f, -0.923880f, -0.212607f, -0.322500f, -0.921700f, -0.215500f, 0.906250f, 0.125000f, 
-		-0.162212f, -0.980785f, -0.108386f, -0.167100f, -0.979600f, -0.111700f, 0.906250f, 0.062500f, 
-		-0.923878f, 0.000000f, -0.382683f, -0.923900f, -0.000000f, -0.382700f, 0.937500f, 0.500000f, 
-		-0.906127f, 0.195090f, -0.375330f, -0.906300f, 0.193900f, -0.375400f, 0.937500f, 0.562500f, 
-		-0.815493f, 0.195090f, -0.544895f, -0.815700f, 0.193900f, -0.545000f, 0.906250f, 0.562500f, 
-		-0.923878f, 0.000000f, -0.382683f, -0.923900f, -0.000000f, -0.382700f, 0.937500f, 0.500000f, 
-		-0.831468f, 0.000000f, -0.555570f, -0.831500f, -0.000000f, -0.555600f, 0.906250f, 0.500000f, 
-		-0.815493f, -0.195090f, -0.544895f, -0.815700f, -0.193900f, -0.545000f, 0.906250f, 0.437500f, 
-		-0.353553f, 0.923880f, -0.146447f, -0.358400f, 0.921700f, -0.148400f, 0.937500f, 0.875000f, 
-		-0.180240f, 0.980785f, -0.074658f, -0.185700f, 0.979600f, -0.076900f, 0.937500f, 0.937500f, 
-		-0.162212f, 0.980785f, -0.108386f, -0.167100f, 0.979600f, -0.111700f, 0.906250f, 0.937500f, 
-		-0.906127f, -0.195090f, -0.375330f, -0.906300f, -0.193900f, -0.375400f, 0.937500f, 0.437500f, 
-		-0.815493f, -0.195090f, -0.544895f, -0.815700f, -0.193900f, -0.545000f, 0.906250f, 0.437500f, 
-		-0.768177f, -0.382683f, -0.513280f, -0.768900f, -0.380500f, -0.513800f, 0.906250f, 0.375000f, 
-		-0.353553f, 0.923880f, -0.146447f, -0.358400f, 0.921700f, -0.148400f, 0.937500f, 0.875000f, 
-		-0.318189f, 0.923880f, -0.212607f, -0.322500f, 0.921700f, -0.215500f, 0.906250f, 0.875000f, 
-		-0.461939f, 0.831470f, -0.308658f, -0.465400f, 0.828600f, -0.311000f, 0.906250f, 0.812500f, 
-		-0.768177f, -0.555570f, -0.318190f, -0.769900f, -0.552800f, -0.318900f, 0.937500f, 0.312500f, 
-		-0.853553f, -0.382683f, -0.353553f, -0.854400f, -0.380500f, -0.353900f, 0.937500f, 0.375000f, 
-		-0.768177f, -0.382683f, -0.513280f, -0.768900f, -0.380500f, -0.513800f, 0.906250f, 0.375000f, 
-		-0.513279f, 0.831470f, -0.212607f, -0.517200f, 0.828600f, -0.214200f, 0.937500f, 0.812500f, 
-		-0.461939f, 0.831470f, -0.308658f, -0.465400f, 0.828600f, -0.311000f, 0.906250f, 0.812500f, 
-		-0.587938f, 0.707107f, -0.392847f, -0.590500f, 0.704100f, -0.394500f, 0.906250f, 0.750000f, 
-		-0.768177f, -0.555570f, -0.318190f, -0.769900f, -0.552800f, -0.318900f, 0.937500f, 0.312500f, 
-		-0.691341f, -0.555570f, -0.461940f, -0.692900f, -0.552800f, -0.463000f, 0.906250f, 0.312500f, 
-		-0.587938f, -0.707107f, -0.392847f, -0.590500f, -0.704100f, -0.394500f, 0.906250f, 0.250000f, 
-		-0.831468f, 0.000000f, -0.555570f, -0.831500f, -0.000000f, -0.555600f, 0.906250f, 0.500000f, 
-		-0.707106f, 0.000000f, -0.707106f, -0.707100f, -0.000000f, -0.707100f, 0.875000f, 0.500000f, 
-		-0.693519f, -0.195090f, -0.693520f, -0.693700f, -0.193900f, -0.693700f, 0.875000f, 0.437500f, 
-		-0.162212f, 0.980785f, -0.108386f, -0.167100f, 0.979600f, -0.111700f, 0.906250f, 0.937500f, 
-		-0.137950f, 0.980785f, -0.137950f, -0.142100f, 0.979600f, -0.142100f, 0.875000f, 0.937500f, 
-		-0.270598f, 0.923880f, -0.270598f, -0.274300f, 0.921700f, -0.274300f, 0.875000f, 0.875000f, 
-		-0.815493f, -0.195090f, -0.544895f, -0.815700f, -0.193900f, -0.545000f, 0.906250f, 0.437500f, 
-		-0.693519f, -0.195090f, -0.693520f, -0.693700f, -0.193900f, -0.693700f, 0.875000f, 0.437500f, 
-		-0.653281f, -0.382683f, -0.653281f, -0.653900f, -0.380500f, -0.653900f, 0.875000f, 0.375000f, 
-		-0.461939f, 0.831470f, -0.308658f, -0.465400f, 0.828600f, -0.311000f, 0.906250f, 0.812500f, 
-		-0.318189f, 0.923880f, -0.212607f, -0.322500f, 0.921700f, -0.215500f, 0.906250f, 0.875000f, 
-		-0.270598f, 0.923880f, -0.270598f, -0.274300f, 0.921700f, -0.274300f, 0.875000f, 0.875000f, 
-		-0.691341f, -0.555570f, -0.461940f, -0.692900f, -0.552800f, -0.463000f, 0.906250f, 0.312500f, 
-		-0.768177f, -0.382683f, -0.513280f, -0.768900f, -0.380500f, -0.513800f, 0.906250f, 0.375000f, 
-		-0.653281f, -0.382683f, -0.653281f, -0.653900f, -0.380500f, -0.653900f, 0.875000f, 0.375000f, 
-		-0.461939f, 0.831470f, -0.308658f, -0.465400f, 0.828600f, -0.311000f, 0.906250f, 0.812500f, 
-		-0.392847f, 0.831470f, -0.392847f, -0.395800f, 0.828600f, -0.395800f, 0.875000f, 0.812500f, 
-		-0.500000f, 0.707107f, -0.500000f, -0.502100f, 0.704100f, -0.502100f, 0.875000f, 0.750000f, 
-		-0.691341f, -0.555570f, -0.461940f, -0.692900f, -0.552800f, -0.463000f, 0.906250f, 0.312500f, 
-		-0.587937f, -0.555570f, -0.587938f, -0.589300f, -0.552800f, -0.589300f, 0.875000f, 0.312500f, 
-		-0.500000f, -0.707107f, -0.500000f, -0.502100f, -0.704100f, -0.502100f, 0.875000f, 0.250000f, 
-		-0.691341f, 0.555570f, -0.461940f, -0.692900f, 0.552800f, -0.463000f, 0.906250f, 0.687500f, 
-		-0.587938f, 0.707107f, -0.392847f, -0.590500f, 0.704100f, -0.394500f, 0.906250f, 0.750000f, 
-		-0.500000f, 0.707107f, -0.500000f, -0.502100f, 0.704100f, -0.502100f, 0.875000f, 0.750000f, 
-		-0.461939f, -0.831470f, -0.308658f, -0.465400f, -0.828600f, -0.311000f, 0.906250f, 0.187500f, 
-		-0.587938f, -0.707107f, -0.392847f, -0.590500f, -0.704100f, -0.394500f, 0.906250f, 0.250000f, 
-		-0.500000f, -0.707107f, -0.500000f, -0.502100f, -0.704100f, -0.502100f, 0.875000f, 0.250000f, 
-		-0.691341f, 0.555570f, -0.461940f, -0.692900f, 0.552800f, -0.463000f, 0.906250f, 0.687500f, 
-		-0.587937f, 0.555570f, -0.587938f, -0.589300f, 0.552800f, -0.589300f, 0.875000f, 0.687500f, 
-		-0.653281f, 0.382683f, -0.653281f, -0.653900f, 0.380500f, -0.653900f, 0.875000f, 0.625000f, 
-		-0.461939f, -0.831470f, -0.308658f, -0.465400f, -0.828600f, -0.311000f, 0.906250f, 0.187500f, 
-		-0.392847f, -0.831470f, -0.392847f, -0.395800f, -0.828600f, -0.395800f, 0.875000f, 0.187500f, 
-		-0.270598f, -0.923880f, -0.270598f, -0.274300f, -0.921700f, -0.274300f, 0.875000f, 0.125000f, 
-		-0.815493f, 0.195090f, -0.544895f, -0.815700f, 0.193900f, -0.545000f, 0.906250f, 0.562500f, 
-		-0.768177f, 0.382683f, -0.513280f, -0.768900f, 0.380500f, -0.513800f, 0.906250f, 0.625000f, 
-		-0.653281f, 0.382683f, -0.653281f, -0.653900f, 0.380500f, -0.653900f, 0.875000f, 0.625000f, 
-		-0.318189f, -0.923880f, -0.212607f, -0.322500f, -0.921700f, -0.215500f, 0.906250f, 0.125000f, 
-		-0.270598f, -0.923880f, -0.270598f, -0.274300f, -0.921700f, -0.274300f, 0.875000f, 0.125000f, 
-		-0.137950f, -0.980785f, -0.137950f, -0.142100f, -0.979600f, -0.142100f, 0.875000f, 0.062500f, 
-		-0.831468f, 0.000000f, -0.555570f, -0.831500f, -0.000000f, -0.555600f, 0.906250f, 0.500000f, 
-		-0.815493f, 0.195090f, -0.544895f, -0.815700f, 0.193900f, -0.545000f, 0.906250f, 0.562500f, 
-		-0.693519f, 0.195090f, -0.693520f, -0.693700f, 0.193900f, -0.693700f, 0.875000f, 0.562500f, 
-		-0.392847f, -0.831470f, -0.392847f, -0.395800f, -0.828600f, -0.395800f, 0.875000f, 0.187500f, 
-		-0.500000f, -0.707107f, -0.500000f, -0.502100f, -0.704100f, -0.502100f, 0.875000f, 0.250000f, 
-		-0.392847f, -0.707107f, -0.587938f, -0.394500f, -0.704100f, -0.590500f, 0.843750f, 0.250000f, 
-		-0.587937f, 0.555570f, -0.587938f, -0.589300f, 0.552800f, -0.589300f, 0.875000f, 0.687500f, 
-		-0.461939f, 0.555570f, -0.691341f, -0.463000f, 0.552800f, -0.692900f, 0.843750f, 0.687500f, 
-		-0.513280f, 0.382683f, -0.768177f, -0.513800f, 0.380500f, -0.768900f, 0.843750f, 0.625000f, 
-		-0.392847f, -0.831470f, -0.392847f, -0.395800f, -0.828600f, -0.395800f, 0.875000f, 0.187500f, 
-		-0.308658f, -0.831470f, -0.461939f, -0.311000f, -0.828600f, -0.465400f, 0.843750f, 0.187500f, 
-		-0.212607f, -0.923880f, -0.318190f, -0.215500f, -0.921700f, -0.322500f, 0.843750f, 0.125000f, 
-		-0.693519f, 0.195090f, -0.693520f, -0.693700f, 0.193900f, -0.693700f, 0.875000f, 0.562500f, 
-		-0.653281f, 0.382683f, -0.653281f, -0.653900f, 0.380500f, -0.653900f, 0.875000f, 0.625000f, 
-		-0.513280f, 0.382683f, -0.768177f, -0.513800f, 0.380500f, -0.768900f, 0.843750f, 0.625000f, 
-		-0.270598f, -0.923880f, -0.270598f, -0.274300f, -0.921700f, -0.274300f, 0.875000f, 0.125000f, 
-		-0.212607f, -0.923880f, -0.318190f, -0.215500f, -0.921700f, -0.322500f, 0.843750f, 0.125000f, 
-		-0.108386f, -0.980785f, -0.162212f, -0.111700f, -0.979600f, -0.167100f, 0.843750f, 0.062500f, 
-		-0.707106f, 0.000000f, -0.707106f, -0.707100f, -0.000000f, -0.707100f, 0.875000f, 0.500000f, 
-		-0.693519f, 0.195090f, -0.693520f, -0.693700f, 0.193900f, -0.693700f, 0.875000f, 0.562500f, 
-		-0.544895f, 0.195090f, -0.815493f, -0.545000f, 0.193900f, -0.815700f, 0.843750f, 0.562500f, 
-		-0.707106f, 0.000000f, -0.707106f, -0.707100f, -0.000000f, -0.707100f, 0.875000f, 0.500000f, 
-		-0.555569f, 0.000000f, -0.831469f, -0.555600f, -0.000000f, -0.831500f, 0.843750f, 0.500000f, 
-		-0.544895f, -0.195090f, -0.815493f, -0.545000f, -0.193900f, -0.815700f, 0.843750f, 0.437500f, 
-		-0.137950f, 0.980785f, -0.137950f, -0.142100f, 0.979600f, -0.142100f, 0.875000f, 0.937500f, 
-		-0.108386f, 0.980785f, -0.162212f, -0.111700f, 0.979600f, -0.167100f, 0.843750f, 0.937500f, 
-		-0.212607f, 0.923880f, -0.318190f, -0.215500f, 0.921700f, -0.322500f, 0.843750f, 0.875000f, 
-		-0.693519f, -0.195090f, -0.693520f, -0.693700f, -0.193900f, -0.693700f, 0.875000f, 0.437500f, 
-		-0.544895f, -0.195090f, -0.815493f, -0.545000f, -0.193900f, -0.815700f, 0.843750f, 0.437500f, 
-		-0.513280f, -0.382683f, -0.768177f, -0.513800f, -0.380500f, -0.768900f, 0.843750f, 0.375000f, 
-		-0.392847f, 0.831470f, -0.392847f, -0.395800f, 0.828600f, -0.395800f, 0.875000f, 0.812500f, 
-		-0.270598f, 0.923880f, -0.270598f, -0.274300f, 0.921700f, -0.274300f, 0.875000f, 0.875000f, 
-		-0.212607f, 0.923880f, -0.318190f, -0.215500f, 0.921700f, -0.322500f, 0.843750f, 0.875000f, 
-		-0.587937f, -0.555570f, -0.587938f, -0.589300f, -0.552800f, -0.589300f, 0.875000f, 0.312500f, 
-		-0.653281f, -0.382683f, -0.653281f, -0.653900f, -0.380500f, -0.653900f, 0.875000f, 0.375000f, 
-		-0.513280f, -0.382683f, -0.768177f, -0.513800f, -0.380500f, -0.768900f, 0.843750f, 0.375000f, 
-		-0.392847f, 0.831470f, -0.392847f, -0.395800f, 0.828600f, -0.395800f, 0.875000f, 0.812500f, 
-		-0.308658f, 0.831470f, -0.461939f, -0.311000f, 0.828600f, -0.465400f, 0.843750f, 0.812500f, 
-		-0.392847f, 0.707107f, -0.587938f, -0.394500f, 0.704100f, -0.590500f, 0.843750f, 0.750000f, 
-		-0.587937f, -0.555570f, -0.587938f, -0.589300f, -0.552800f, -0.589300f, 0.875000f, 0.312500f, 
-		-0.461939f, -0.555570f, -0.691341f, -0.463000f, -0.552800f, -0.692900f, 0.843750f, 0.312500f, 
-		-0.392847f, -0.707107f, -0.587938f, -0.394500f, -0.704100f, -0.590500f, 0.843750f, 0.250000f, 
-		-0.587937f, 0.555570f, -0.587938f, -0.589300f, 0.552800f, -0.589300f, 0.875000f, 0.687500f, 
-		-0.500000f, 0.707107f, -0.500000f, -0.502100f, 0.704100f, -0.502100f, 0.875000f, 0.750000f, 
-		-0.392847f, 0.707107f, -0.587938f, -0.394500f, 0.704100f, -0.590500f, 0.843750f, 0.750000f, 
-		-0.544895f, -0.195090f, -0.815493f, -0.545000f, -0.193900f, -0.815700f, 0.843750f, 0.437500f, 
-		-0.375330f, -0.195090f, -0.906127f, -0.375400f, -0.193900f, -0.906300f, 0.812500f, 0.437500f, 
-		-0.353553f, -0.382683f, -0.853553f, -0.353900f, -0.380500f, -0.854400f, 0.812500f, 0.375000f, 
-		-0.212607f, 0.923880f, -0.318190f, -0.215500f, 0.921700f, -0.322500f, 0.843750f, 0.875000f, 
-		-0.146446f, 0.923880f, -0.353553f, -0.148400f, 0.921700f, -0.358400f, 0.812500f, 0.875000f, 
-		-0.212607f, 0.831470f, -0.513279f, -0.214200f, 0.828600f, -0.517200f, 0.812500f, 0.812500f, 
-		-0.461939f, -0.555570f, -0.691341f, -0.463000f, -0.552800f, -0.692900f, 0.843750f, 0.312500f, 
-		-0.513280f, -0.382683f, -0.768177f, -0.513800f, -0.380500f, -0.768900f, 0.843750f, 0.375000f, 
-		-0.353553f, -0.382683f, -0.853553f, -0.353900f, -0.380500f, -0.854400f, 0.812500f, 0.375000f, 
-		-0.308658f, 0.831470f, -0.461939f, -0.311000f, 0.828600f, -0.465400f, 0.843750f, 0.812500f, 
-		-0.212607f, 0.831470f, -0.513279f, -0.214200f, 0.828600f, -0.517200f, 0.812500f, 0.812500f, 
-		-0.270598f, 0.707107f, -0.653281f, -0.271800f, 0.704100f, -0.656100f, 0.812500f, 0.750000f, 
-		-0.461939f, -0.555570f, -0.691341f, -0.463000f, -0.552800f, -0.692900f, 0.843750f, 0.312500f, 
-		-0.318189f, -0.555570f, -0.768177f, -0.318900f, -0.552800f, -0.769900f, 0.812500f, 0.312500f, 
-		-0.270598f, -0.707107f, -0.653281f, -0.271800f, -0.704100f, -0.656100f, 0.812500f, 0.250000f, 
-		-0.461939f, 0.555570f, -0.691341f, -0.463000f, 0.552800f, -0.692900f, 0.843750f, 0.687500f, 
-		-0.392847f, 0.707107f, -0.587938f, -0.394500f, 0.704100f, -0.590500f, 0.843750f, 0.750000f, 
-		-0.270598f, 0.707107f, -0.653281f, -0.271800f, 0.704100f, -0.656100f, 0.812500f, 0.750000f, 
-		-0.308658f, -0.831470f, -0.461939f, -0.311000f, -0.828600f, -0.465400f, 0.843750f, 0.187500f, 
-		-0.392847f, -0.707107f, -0.587938f, -0.394500f, -0.704100f, -0.590500f, 0.843750f, 0.250000f, 
-		-0.270598f, -0.707107f, -0.653281f, -0.271800f, -0.704100f, -0.656100f, 0.812500f, 0.250000f, 
-		-0.461939f, 0.555570f, -0.691341f, -0.463000f, 0.552800f, -0.692900f, 0.843750f, 0.687500f, 
-		-0.318189f, 0.555570f, -0.768177f, -0.318900f, 0.552800f, -0.769900f, 0.812500f, 0.687500f, 
-		-0.353553f, 0.382683f, -0.853553f, -0.353900f, 0.380500f, -0.854400f, 0.812500f, 0.625000f, 
-		-0.308658f, -0.831470f, -0.461939f, -0.311000f, -0.828600f, -0.465400f, 0.843750f, 0.187500f, 
-		-0.212607f, -0.831470f, -0.513279f, -0.214200f, -0.828600f, -0.517200f, 0.812500f, 0.187500f, 
-		-0.146446f, -0.923880f, -0.353553f, -0.148400f, -0.921700f, -0.358400f, 0.812500f, 0.125000f, 
-		-0.544895f, 0.195090f, -0.815493f, -0.545000f, 0.193900f, -0.815700f, 0.843750f, 0.562500f, 
-		-0.513280f, 0.382683f, -0.768177f, -0.513800f, 0.380500f, -0.768900f, 0.843750f, 0.625000f, 
-		-0.353553f, 0.382683f, -0.853553f, -0.353900f, 0.380500f, -0.854400f, 0.812500f, 0.625000f, 
-		-0.212607f, -0.923880f, -0.318190f, -0.215500f, -0.921700f, -0.322500f, 0.843750f, 0.125000f, 
-		-0.146446f, -0.923880f, -0.353553f, -0.148400f, -0.921700f, -0.358400f, 0.812500f, 0.125000f, 
-		-0.074658f, -0.980785f, -0.180240f, -0.076900f, -0.979600f, -0.185700f, 0.812500f, 0.062500f, 
-		-0.555569f, 0.000000f, -0.831469f, -0.555600f, -0.000000f, -0.831500f, 0.843750f, 0.500000f, 
-		-0.544895f, 0.195090f, -0.815493f, -0.545000f, 0.193900f, -0.815700f, 0.843750f, 0.562500f, 
-		-0.375330f, 0.195090f, -0.906127f, -0.375400f, 0.193900f, -0.906300f, 0.812500f, 0.562500f, 
-		-0.555569f, 0.000000f, -0.831469f, -0.555600f, -0.000000f, -0.831500f, 0.843750f, 0.500000f, 
-		-0.382683f, 0.000000f, -0.923879f, -0.382700f, -0.000000f, -0.923900f, 0.812500f, 0.500000f, 
-		-0.375330f, -0.195090f, -0.906127f, -0.375400f, -0.193900f, -0.906300f, 0.812500f, 0.437500f, 
-		-0.212607f, 0.923880f, -0.318190f, -0.215500f, 0.921700f, -0.322500f, 0.843750f, 0.875000f, 
-		-0.108386f, 0.980785f, -0.162212f, -0.111700f, 0.979600f, -0.167100f, 0.843750f, 0.937500f, 
-		-0.074658f, 0.980785f, -0.180240f, -0.076900f, 0.979600f, -0.185700f, 0.812500f, 0.937500f, 
-		-0.212607f, -0.831470f, -0.513279f, -0.214200f, -0.828600f, -0.517200f, 0.812500f, 0.187500f, 
-		-0.108386f, -0.831470f, -0.544895f, -0.109200f, -0.828600f, -0.549000f, 0.781250f, 0.187500f, 
-		-0.074658f, -0.923880f, -0.375330f, -0.075700f, -0.921700f, -0.380400f, 0.781250f, 0.125000f, 
-		-0.375330f, 0.195090f, -0.906127f, -0.375400f, 0.193900f, -0.906300f, 0.812500f, 0.562500f, 
-		-0.353553f, 0.382683f, -0.853553f, -0.353900f, 0.380500f, -0.854400f, 0.812500f, 0.625000f, 
-		-0.180240f, 0.382683f, -0.906127f, -0.180400f, 0.380500f, -0.907000f, 0.781250f, 0.625000f, 
-		-0.074658f, -0.980785f, -0.180240f, -0.076900f, -0.979600f, -0.185700f, 0.812500f, 0.062500f, 
-		-0.146446f, -0.923880f, -0.353553f, -0.148400f, -0.921700f, -0.358400f, 0.812500f, 0.125000f, 
-		-0.074658f, -0.923880f, -0.375330f, -0.075700f, -0.921700f, -0.380400f, 0.781250f, 0.125000f, 
-		-0.382683f, 0.000000f, -0.923879f, -0.382700f, -0.000000f, -0.923900f, 0.812500f, 0.500000f, 
-		-0.375330f, 0.195090f, -0.906127f, -0.375400f, 0.193900f, -0.906300f, 0.812500f, 0.562500f, 
-		-0.191341f, 0.195090f, -0.961939f, -0.191400f, 0.193900f, -0.962200f, 0.781250f, 0.562500f, 
-		-0.382683f, 0.000000f, -0.923879f, -0.382700f, -0.000000f, -0.923900f, 0.812500f, 0.500000f, 
-		-0.195090f, 0.000000f, -0.980784f, -0.195100f, -0.000000f, -0.980800f, 0.781250f, 0.500000f, 
-		-0.191341f, -0.195090f, -0.961939f, -0.191400f, -0.193900f, -0.962200f, 0.781250f, 0.437500f, 
-		-0.074658f, 0.980785f, -0.180240f, -0.076900f, 0.979600f, -0.185700f, 0.812500f, 0.937500f, 
-		-0.038060f, 0.980785f, -0.191342f, -0.039200f, 0.979600f, -0.197100f, 0.781250f, 0.937500f, 
-		-0.074658f, 0.923880f, -0.375330f, -0.075700f, 0.921700f, -0.380400f, 0.781250f, 0.875000f, 
-		-0.375330f, -0.195090f, -0.906127f, -0.375400f, -0.193900f, -0.906300f, 0.812500f, 0.437500f, 
-		-0.191341f, -0.195090f, -0.961939f, -0.191400f, -0.193900f, -0.962200f, 0.781250f, 0.437500f, 
-		-0.180240f, -0.382683f, -0.906127f, -0.180400f, -0.380500f, -0.907000f, 0.781250f, 0.375000f, 
-		-0.212607f, 0.831470f, -0.513279f, -0.214200f, 0.828600f, -0.517200f, 0.812500f, 0.812500f, 
-		-0.146446f, 0.923880f, -0.353553f, -0.148400f, 0.921700f, -0.358400f, 0.812500f, 0.875000f, 
-		-0.074658f, 0.923880f, -0.375330f, -0.075700f, 0.921700f, -0.380400f, 0.781250f, 0.875000f, 
-		-0.318189f, -0.555570f, -0.768177f, -0.318900f, -0.552800f, -0.769900f, 0.812500f, 0.312500f, 
-		-0.353553f, -0.382683f, -0.853553f, -0.353900f, -0.380500f, -0.854400f, 0.812500f, 0.375000f, 
-		-0.180240f, -0.382683f, -0.906127f, -0.180400f, -0.380500f, -0.907000f, 0.781250f, 0.375000f, 
-		-0.212607f, 0.831470f, -0.513279f, -0.214200f, 0.828600f, -0.517200f, 0.812500f, 0.812500f, 
-		-0.108386f, 0.831470f, -0.544895f, -0.109200f, 0.828600f, -0.549000f, 0.781250f, 0.812500f, 
-		-0.137950f, 0.707107f, -0.693520f, -0.138500f, 0.704100f, -0.696500f, 0.781250f, 0.750000f, 
-		-0.318189f, -0.555570f, -0.768177f, -0.318900f, -0.552800f, -0.769900f, 0.812500f, 0.312500f, 
-		-0.162211f, -0.555570f, -0.815493f, -0.162600f, -0.552800f, -0.817300f, 0.781250f, 0.312500f, 
-		-0.137950f, -0.707107f, -0.693520f, -0.138500f, -0.704100f, -0.696500f, 0.781250f, 0.250000f, 
-		-0.318189f, 0.555570f, -0.768177f, -0.318900f, 0.552800f, -0.769900f, 0.812500f, 0.687500f, 
-		-0.270598f, 0.707107f, -0.653281f, -0.271800f, 0.704100f, -0.656100f, 0.812500f, 0.750000f, 
-		-0.137950f, 0.707107f, -0.693520f, -0.138500f, 0.704100f, -0.696500f, 0.781250f, 0.750000f, 
-		-0.212607f, -0.831470f, -0.513279f, -0.214200f, -0.828600f, -0.517200f, 0.812500f, 0.187500f, 
-		-0.270598f, -0.707107f, -0.653281f, -0.271800f, -0.704100f, -0.656100f, 0.812500f, 0.250000f, 
-		-0.137950f, -0.707107f, -0.693520f, -0.138500f, -0.704100f, -0.696500f, 0.781250f, 0.250000f, 
-		-0.318189f, 0.555570f, -0.768177f, -0.318900f, 0.552800f, -0.769900f, 0.812500f, 0.687500f, 
-		-0.162211f, 0.555570f, -0.815493f, -0.162600f, 0.552800f, -0.817300f, 0.781250f, 0.687500f, 
-		-0.180240f, 0.382683f, -0.906127f, -0.180400f, 0.380500f, -0.907000f, 0.781250f, 0.625000f, 
-		-0.108386f, 0.831470f, -0.544895f, -0.109200f, 0.828600f, -0.549000f, 0.781250f, 0.812500f, 
-		-0.074658f, 0.923880f, -0.375330f, -0.075700f, 0.921700f, -0.380400f, 0.781250f, 0.875000f, 
-		0.000000f, 0.923880f, -0.382683f, -0.000000f, 0.921700f, -0.387900f, 0.750000f, 0.875000f, 
-		-0.180240f, -0.382683f, -0.906127f, -0.180400f, -0.380500f, -0.907000f, 0.781250f, 0.375000f, 
-		0.000000f, -0.382683f, -0.923879f, -0.000000f, -0.380500f, -0.924800f, 0.750000f, 0.375000f, 
-		0.000000f, -0.555570f, -0.831470f, -0.000000f, -0.552800f, -0.833300f, 0.750000f, 0.312500f, 
-		-0.137950f, 0.707107f, -0.693520f, -0.138500f, 0.704100f, -0.696500f, 0.781250f, 0.750000f, 
-		-0.108386f, 0.831470f, -0.544895f, -0.109200f, 0.828600f, -0.549000f, 0.781250f, 0.812500f, 
-		0.000000f, 0.831470f, -0.555570f, -0.000000f, 0.828600f, -0.559800f, 0.750000f, 0.812500f, 
-		-0.162211f, -0.555570f, -0.815493f, -0.162600f, -0.552800f, -0.817300f, 0.781250f, 0.312500f, 
-		0.000000f, -0.555570f, -0.831470f, -0.000000f, -0.552800f, -0.833300f, 0.750000f, 0.312500f, 
-		0.000000f, -0.707107f, -0.707107f, -0.000000f, -0.704100f, -0.710100f, 0.750000f, 0.250000f, 
-		-0.162211f, 0.555570f, -0.815493f, -0.162600f, 0.552800f, -0.817300f, 0.781250f, 0.687500f, 
-		-0.137950f, 0.707107f, -0.693520f, -0.138500f, 0.704100f, -0.696500f, 0.781250f, 0.750000f, 
-		0.000000f, 0.707107f, -0.707107f, -0.000000f, 0.704100f, -0.710100f, 0.750000f, 0.750000f, 
-		-0.108386f, -0.831470f, -0.544895f, -0.109200f, -0.828600f, -0.549000f, 0.781250f, 0.187500f, 
-		-0.137950f, -0.707107f, -0.693520f, -0.138500f, -0.704100f, -0.696500f, 0.781250f, 0.250000f, 
-		0.000000f, -0.707107f, -0.707107f, -0.000000f, -0.704100f, -0.710100f, 0.750000f, 0.250000f, 
-		-0.180240f, 0.382683f, -0.906127f, -0.180400f, 0.380500f, -0.907000f, 0.781250f, 0.625000f, 
-		-0.162211f, 0.555570f, -0.815493f, -0.162600f, 0.552800f, -0.817300f, 0.781250f, 0.687500f, 
-		0.000000f, 0.555570f, -0.831470f, -0.000000f, 0.552800f, -0.833300f, 0.750000f, 0.687500f, 
-		-0.108386f, -0.831470f, -0.544895f, -0.109200f, -0.828600f, -0.549000f, 0.781250f, 0.187500f, 
-		0.000000f, -0.831470f, -0.555570f, -0.000000f, -0.828600f, -0.559800f, 0.750000f, 0.187500f, 
-		0.000000f, -0.923880f, -0.382683f, -0.000000f, -0.921700f, -0.387900f, 0.750000f, 0.125000f, 
-		-0.191341f, 0.195090f, -0.961939f, -0.191400f, 0.193900f, -0.962200f, 0.781250f, 0.562500f, 
-		-0.180240f, 0.382683f, -0.906127f, -0.180400f, 0.380500f, -0.907000f, 0.781250f, 0.625000f, 
-		0.000000f, 0.382683f, -0.923879f, -0.000000f, 0.380500f, -0.924800f, 0.750000f, 0.625000f, 
-		-0.074658f, -0.923880f, -0.375330f, -0.075700f, -0.921700f, -0.380400f, 0.781250f, 0.125000f, 
-		0.000000f, -0.923880f, -0.382683f, -0.000000f, -0.921700f, -0.387900f, 0.750000f, 0.125000f, 
-		0.000000f, -0.980785f, -0.195090f, -0.000000f, -0.979600f, -0.201000f, 0.750000f, 0.062500f, 
-		-0.195090f, 0.000000f, -0.980784f, -0.195100f, -0.000000f, -0.980800f, 0.781250f, 0.500000f, 
-		-0.191341f, 0.195090f, -0.961939f, -0.191400f, 0.193900f, -0.962200f, 0.781250f, 0.562500f, 
-		0.000000f, 0.195090f, -0.980785f, -0.000000f, 0.193900f, -0.981000f, 0.750000f, 0.562500f, 
-		-0.195090f, 0.000000f, -0.980784f, -0.195100f, -0.000000f, -0.980800f, 0.781250f, 0.500000f, 
-		0.000000f, 0.000000f, -1.000000f, -0.000000f, -0.000000f, -1.000000f, 0.750000f, 0.500000f, 
-		0.000000f, -0.195090f, -0.980785f, -0.000000f, -0.193900f, -0.981000f, 0.750000f, 0.437500f, 
-		-0.074658f, 0.923880f, -0.375330f, -0.075700f, 0.921700f, -0.380400f, 0.781250f, 0.875000f, 
-		-0.038060f, 0.980785f, -0.191342f, -0.039200f, 0.979600f, -0.197100f, 0.781250f, 0.937500f, 
-		0.000000f, 0.980785f, -0.195090f, -0.000000f, 0.979600f, -0.201000f, 0.750000f, 0.937500f, 
-		-0.191341f, -0.195090f, -0.961939f, -0.191400f, -0.193900f, -0.962200f, 0.781250f, 0.437500f, 
-		0.000000f, -0.195090f, -0.980785f, -0.000000f, -0.193900f, -0.981000f, 0.750000f, 0.437500f, 
-		0.000000f, -0.382683f, -0.923879f, -0.000000f, -0.380500f, -0.924800f, 0.750000f, 0.375000f
-	};
-
-	int m_verticesSize = 92160;
-
-	int m_vertexCount = 2880;
-}; 
-
-#endif // COMPONENT_MESH_SPHERE_H
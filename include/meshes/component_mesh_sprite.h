@@ -10,20 +10,28 @@
 #define COMPONENT_MESH_SPRITE_H
 
 struct MeshSpriteComponent { 
-    float m_vertices[30] = { 
+    float m_vertices[20] = { 
         // position (x y z)  // texture (u v)
         -1.0f,  1.0f,   0.0f,   0.0f,   0.0f,
         -1.0f,  -1.0f,  0.0f,   0.0f,   1.0f,
         1.0f,   -1.0f,  0.0f,   1.0f,   1.0f,
-
-        -1.0f,  1.0f,   0.0f,   0.0f,   0.0f,
-        1.0f,   -1.0f,  0.0f,   1.0f,   1.0f,
         1.0f,   1.0f,   0.0f,   1.0f,   0.0f
     };
 
-    int m_verticesSize = 120;
+    unsigned int m_indices[6] = { 
+        0, 1, 2,
+        0, 2, 3
+    };
+
+    int m_verticesSize = 80;
+
+    int m_indicesSize = 24;
+
+    int m_vertexCount = 4;
+
+    int m_indexCount = 6;
 
-    int m_vertexCount = 6;
+    int m_vertexFormat = 0;
 
 };
 
@@ -14,5 +14,7 @@
 #include "system_player_movement.h"
 #include "system_render.h"
 #include "system_select_mode.h"
+#include "system_snapshot.h"
+#include "system_transform.h"
 
 #endif // SYSTEM_ALL_H
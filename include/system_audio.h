@@ -12,6 +12,7 @@
 #include "component_body_transform.h"
 #include "component_audio_data.h"
 #include "component_render_data.h"
+#include "component_transform.h"
 
 #include "AL/al.h"
 #include "box2d/box2d.h"
@@ -41,6 +42,15 @@ public:
      *          playing sounds. 
      */
     void setRegistry(entt::registry*);
+    /**
+     * \brief   The function update. 
+     * \details This function moves every entity's sound source to the 
+     *          position and velocity of its body, so playing sounds follow
+     *          their entity. Reads the TransformComponent filled by the 
+     *          TransformSystem.
+     * \return  void, none.
+     */
+    void update();
 
     /**
      * \brief   Plays select-mode toggle sound effect via OpenAL.
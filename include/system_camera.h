@@ -11,6 +11,7 @@
 #include "component_camera.h"
 #include "component_player.h"
 #include "component_body_transform.h"
+#include "component_transform.h"
 
 #include "glm/glm.hpp"
 #include "glm/gtc/type_ptr.hpp"
@@ -8,6 +8,15 @@
 #ifndef SYSTEM_RENDER_H
 #define SYSTEM_RENDER_H
 
+#include "core_frame_snapshot.h"
+#include "core_frustum_culler.h"
+#include "core_gpu_profile_manager.h"
+#include "core_mesh_registry.h"
+#include "core_profile_macros.h"
+#include "core_render_queue.h"
+#include "core_shadow_atlas.h"
+#include "core_spatial_grid.h"
+#include "core_shader_uniforms.h"
 #include "component_body_transform.h"
 #include "component_camera.h"
 #include "component_light.h"
@@ -29,7 +38,13 @@
 #include "glm/gtc/type_ptr.hpp"
 #include "entt/entt.hpp"
 
+#include <map>
 #include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+class AssetManager;
 
 /** 
  * \brief   The RenderSystem class.
@@ -48,24 +63,90 @@ public:
 
     /**
      * \brief   The function update. 
-     * \details This function renders selected entities to the game's glfw 
-     *          window. Uses Box2D bodies for position and angle of rendered
-     *          output, and OpenGL IDs for textures, shaders, and vertex 
-     *          buffers/arrays.
-     * \param   timeStep    The amount of time to simulate (representing seconds).
-     * \param   registry    The game's EnTT registry for accessing renderable entities.
-     * \param   camera      A pointer to the game's camera inside the registry.
+     * \details This function renders a frame snapshot to the game's glfw 
+     *          window. Uses the captured body transforms for position and angle
+     *          of rendered output, and OpenGL IDs for textures, shaders, and 
+     *          vertex buffers/arrays. Never touches the registry, so it may run
+     *          while the simulation thread steps the world.
+     * \param   renderFactor    Fraction of a time step elapsed since the snapshot.
+     * \param   snapshot        Render state captured by the SnapshotSystem.
      * \return  void, none.
      */
-    void update(const float, entt::registry&);
+    void update(const float, const FrameSnapshot&);
     /**
      * \brief   The function deleteBuffers. 
      * \details This function deletes the OpenGL VBO and VAO buffers from memory for
-     *          selected entities (those with a RenderBuffersComponent).
+     *          selected entities (those with a RenderBuffersComponent) not 
+     *          sharing a mesh, every mesh of the MeshRegistry, and the uniform
+     *          buffers.
      * \param   registry    The game's EnTT registry for accessing renderable entities.
      * \return  void, none.
      */
     void deleteBuffers(entt::registry&);
+    /**
+     * \brief   The function createMeshBuffers. 
+     * \details This function points an object at a static mesh, creating the
+     *          mesh's VAO, VBO and EBO on its first use only. Later objects 
+     *          naming the same mesh and layout share them. Vertex data has 
+     *          consecutive float attributes at locations 0, 1, 2... Floats of
+     *          a vertex past the last attribute are skipped. Locations from 
+     *          INSTANCE_LOCATION on hold the per-instance attributes of 
+     *          instanced draws, so a mesh has at most 3 attributes. Meshes
+     *          in graphics' vertexFormatPacked describe the float layout they
+     *          encode (stride 8, attributes 3, 3, 2), and bind the packed 
+     *          attributes for as many attributes as given.
+     * \param   graphics        RenderDataComponent receiving the mesh.
+     * \param   name            Name of the mesh, e.g. "sphere".
+     * \param   vertices        Interleaved vertex data of the mesh, in 
+     *                          graphics' vertex format.
+     * \param   verticesSize    Size of the vertex data, in bytes.
+     * \param   indices         Triangle list indexing the vertices.
+     * \param   indicesSize     Size of the index data, in bytes.
+     * \param   stride          Number of floats per vertex, unpacked.
+     * \param   attributeSizes  Number of floats of each vertex attribute.
+     * \param   lods            Levels of detail, ranges of the indices, full
+     *                          detail first. Empty for a single level 
+     *                          drawing every index.
+     * \return  void, none.
+     */
+    void createMeshBuffers(RenderDataComponent&, const std::string&, const void*, int, const unsigned int*, int, int, const std::vector<int>&, const std::vector<MeshLod>&);
+    /**
+     * \brief   The function getMeshRegistry. 
+     * \return  const MeshRegistry&, the meshes resident on the GPU.
+     */
+    const MeshRegistry& getMeshRegistry() const;
+    /**
+     * \brief   The function createUniformBuffers. 
+     * \details This function creates the uniform buffers of the Camera and 
+     *          Lights blocks, and binds them to the blocks' binding points.
+     * \return  void, none.
+     */
+    void createUniformBuffers();
+    /**
+     * \brief   The function createTextBuffers. 
+     * \details This function creates the VAO and dynamic VBO used to draw one
+     *          glyph quad at a time.
+     * \param   graphics    RenderDataComponent receiving the VAO and VBO.
+     * \return  void, none.
+     */
+    void createTextBuffers(RenderDataComponent&);
+    /**
+     * \brief   The function createShadowCubemap. 
+     * \details This function creates the framebuffer and depth cubemap of a 
+     *          point light's shadow map, at the shadow resolution.
+     * \param   shadow      ShadowFramebufferComponent receiving the IDs.
+     * \return  void, none.
+     */
+    void createShadowCubemap(ShadowFramebufferComponent&);
+    /**
+     * \brief   The function setHeadless. 
+     * \details This function sets the Render System's m_headless flag. When
+     *          headless there is no GL context, so the create functions leave
+     *          their components untouched.
+     * \param   headless    Boolean representing if there is no GL context (true).
+     * \return  void, none.
+     */
+    void setHeadless(bool);
     /**
      * \brief   The function setGammaFlag. 
      * \details This function sets the Render System's GammaFlag, which determines
@@ -77,7 +158,8 @@ public:
     /**
      * \brief   The function setShadowResolution. 
      * \details This function sets the Render System's m_shadowWidth and m_shadowHeight, 
-     *          which sets the resolution of shadow maps.
+     *          which sets the resolution of shadow cubemaps. The width also 
+     *          caps the tiles of spot lights in the shadow atlas.
      * \param   unsigned int    shadowWidth     Sets the width of shadow map resolution.
      * \param   unsigned int    shadowHeight    Sets the height of shadow map resolution.
      * \return  void, none.
@@ -91,6 +173,22 @@ public:
      * \return  void, none.
      */
     void setWindowPointer(GLFWwindow*);
+    /**
+     * \brief   The function setGpuProfileManager. 
+     * \details This function sets the GpuProfileManager timing each render 
+     *          pass. Passes are not timed on the GPU while it is null.
+     * \param   gpuProfileManager   Pointer to the game's GpuProfileManager.
+     * \return  void, none.
+     */
+    void setGpuProfileManager(GpuProfileManager*);
+    /**
+     * \brief   The function setAssetManager. 
+     * \details This function sets the AssetManager whose reflected uniforms
+     *          resolve the uniform handles of each shader program.
+     * \param   assetManager    Pointer to the game's AssetManager.
+     * \return  void, none.
+     */
+    void setAssetManager(AssetManager*);
     /**
      * \brief   The function handleFramebufferResize. 
      * \details This function processes user changing the glfw window size. Will 
@@ -103,14 +201,400 @@ public:
     void handleFramebufferResize(GLFWwindow*, int, int);
 
 private:
+    /**
+     * \brief   The QueuePass enum.
+     * \details Passes drawn from the sorted RenderQueue, in the order drawn.
+     */
+    enum QueuePass : unsigned int {
+        lightQueue = 0,
+        gameplayQueue,
+        spriteQueue,
+        stencilQueue
+    };
+
+    /**
+     * \brief   The InstanceData struct.
+     * \details Per-instance attributes of an instanced draw, read by the 
+     *          vertex shader from INSTANCE_LOCATION on: the model matrix, 
+     *          the normal matrix, the material's shininess and the cube map
+     *          faces a shadow caster is drawn to.
+     */
+    struct InstanceData {
+        glm::mat4 m_model = glm::mat4(1.0f);
+        glm::mat3 m_normal = glm::mat3(1.0f);
+        float m_shininess = 0.0f;
+        /**
+         * \brief A bit per face, in GL_TEXTURE_CUBE_MAP_POSITIVE_X order.
+         */
+        std::uint32_t m_shadowFaces = ALL_CUBE_FACES;
+    };
+    /**
+     * \brief   The InstanceBatch struct.
+     * \details Entities drawn by one glDrawElementsInstanced call: same mesh, 
+     *          and for the queued passes the same program and textures.
+     */
+    struct InstanceBatch {
+        /**
+         * \brief Render queue command of the batch's first entity.
+         */
+        std::size_t m_command = 0;
+        unsigned int m_VAO = 0;
+        /**
+         * \brief Level of detail drawn, a range of the mesh's indices.
+         */
+        unsigned int m_firstIndex = 0;
+        int m_indexCount = 0;
+        /**
+         * \brief Range of the batch's instances in m_instances.
+         */
+        std::size_t m_firstInstance = 0;
+        std::size_t m_instanceCount = 0;
+    };
+
+    /**
+     * \brief   The ProgramUniforms struct.
+     * \details Handles of every uniform the passes set, for one program.
+     *          Uniforms a program does not declare keep location -1. Camera
+     *          and light data are not among them, they live in the uniform
+     *          blocks shared by every program, nor are the transforms and 
+     *          shininess of instanced draws, which are instance attributes.
+     */
+    struct ProgramUniforms {
+        // transforms of programs drawn one entity at a time
+        Uniform<glm::mat4> m_model;
+        // surfaces
+        Uniform<glm::vec4> m_lightColor;
+        Uniform<glm::vec3> m_textColor;
+        // shadow depth
+        Uniform<glm::mat4> m_lightSpaceMatrix;
+        Uniform<glm::mat4> m_shadowMatrices[6];
+        Uniform<float> m_farPlane;
+        Uniform<glm::vec3> m_lightPos;
+    };
+
+    /**
+     * \brief   The function getProgramUniforms. 
+     * \details This function returns the uniform handles of a program, 
+     *          resolving them from the AssetManager on the program's first use.
+     * \param   program     OpenGL's ID of the shader program.
+     * \return  const ProgramUniforms&, handles of the program.
+     */
+    const ProgramUniforms& getProgramUniforms(unsigned int);
+    /**
+     * \brief   The function updateUniformBuffers. 
+     * \details This function fills the Camera and Lights blocks from the 
+     *          snapshot, and uploads each with a single buffer update. Every
+     *          program reads them through the blocks' binding points.
+     * \param   snapshot    Render state captured by the SnapshotSystem.
+     * \return  void, none.
+     */
+    void updateUniformBuffers(const FrameSnapshot&);
+    /**
+     * \brief   The function packShadowAtlas. 
+     * \details This function sizes a tile of the spot shadow atlas for each
+     *          shadowed spot light, by the pixels its range covers on screen,
+     *          packs the tiles, and grows or shrinks the atlas texture to fit.
+     * \param   snapshot    Render state captured by the SnapshotSystem.
+     * \return  void, none.
+     */
+    void packShadowAtlas(const FrameSnapshot&);
+    /**
+     * \brief   The function buildRenderQueue. 
+     * \details This function culls the light meshes, gameplay entities and 
+     *          sprites of the snapshot against the camera's frustum, pushes a
+     *          command for each one in view and each stencil outline of one,
+     *          keyed by the GL state of its draw, and sorts the queue.
+     * \param   snapshot    Render state captured by the SnapshotSystem.
+     * \return  void, none.
+     */
+    void buildRenderQueue(const FrameSnapshot&);
+    /**
+     * \brief   The function buildInstances. 
+     * \details This function gathers the instances of the gameplay, stencil
+     *          outline and shadow passes into batches sharing a mesh, then 
+     *          uploads every instance of the frame with a single buffer update.
+     *          Gameplay and stencil batches are runs of the sorted render 
+     *          queue, shadow batches are the casters in reach of each light,
+     *          found through a uniform grid of the casters, grouped by mesh.
+     * \param   snapshot    Render state captured by the SnapshotSystem.
+     * \return  void, none.
+     */
+    void buildInstances(const FrameSnapshot&);
+    /**
+     * \brief   The function drawInstances. 
+     * \details This function points the batch's VAO at its instances, and 
+     *          draws them with one instanced draw call.
+     * \param   batch   The batch to draw.
+     * \return  void, none.
+     */
+    void drawInstances(const InstanceBatch&);
+    /**
+     * \brief   Upload a mesh's vertices and indices, and record its layout in
+     *          a new VAO.
+     */
+    void createMeshArrays(Mesh&, VertexFormat, const void*, int, const unsigned int*, int, int, const std::vector<int>&);
+    /**
+     * \brief   Point the bound VAO's instance attributes at an instance of 
+     *          the buffer bound to GL_ARRAY_BUFFER.
+     */
+    void pointInstanceAttributes(std::size_t);
+    /**
+     * \brief   The function selectLod. 
+     * \details This function picks the coarsest level of detail of an 
+     *          object's mesh whose error stays within maxErrorPixels, as seen
+     *          from a view.
+     * \param   graphics        RenderDataComponent of the object.
+     * \param   unitPixels      Size of one mesh unit at the object, in pixels
+     *                          of the view.
+     * \param   maxErrorPixels  Error allowed, in pixels of the view.
+     * \return  unsigned int, the level of detail, 0 for full detail.
+     */
+    unsigned int selectLod(const RenderDataComponent&, float, float) const;
+    /**
+     * \brief   Range of an object's mesh indices drawing a level of detail.
+     */
+    MeshLod getMeshLod(const RenderDataComponent&, unsigned int) const;
+    /**
+     * \brief   The function getTextureSet. 
+     * \details This function returns the index of a set of material maps,
+     *          numbering each set on first use.
+     * \param   texture     TextureComponent holding the material maps.
+     * \return  unsigned int, index of the texture set.
+     */
+    unsigned int getTextureSet(const TextureComponent&);
+    /**
+     * \brief   The function resetBindings. 
+     * \details This function forgets the GL state bound so far, so the next
+     *          bind of each kind is issued. Called at the start of a pass, 
+     *          as other passes bind without going through the cache.
+     * \return  void, none.
+     */
+    void resetBindings();
+    /**
+     * \brief   Use a shader program, unless already in use.
+     */
+    void useProgram(unsigned int);
+    /**
+     * \brief   Bind a VAO, unless already bound.
+     */
+    void bindVertexArray(unsigned int);
+    /**
+     * \brief   Bind a texture to a texture unit, unless already bound there.
+     */
+    void bindTexture(unsigned int, GLenum, unsigned int);
+
+    /**
+     * \brief   The function renderSpotShadows. 
+     * \details This function renders the depth of every shadow caster into the
+     *          tile of each spot light in the shadow atlas, in one framebuffer.
+     * \param   snapshot    Render state captured by the SnapshotSystem.
+     * \return  void, none.
+     */
+    void renderSpotShadows(const FrameSnapshot&);
+    /**
+     * \brief   The function renderPointShadows. 
+     * \details This function renders the depth of every shadow caster into the
+     *          shadow cubemap of each point light, each caster only into the
+     *          faces its bounds reach.
+     * \param   snapshot    Render state captured by the SnapshotSystem.
+     * \return  void, none.
+     */
+    void renderPointShadows(const FrameSnapshot&);
+    /**
+     * \brief   The function renderLights. 
+     * \details This function uploads reflection data of every light to its lighting
+     *          program, and draws the point and spot light meshes.
+     * \param   snapshot    Render state captured by the SnapshotSystem.
+     * \return  void, none.
+     */
+    void renderLights(const FrameSnapshot&);
+    /**
+     * \brief   The function renderSkybox. 
+     * \details This function draws the skybox cubemap behind the scene.
+     * \param   snapshot    Render state captured by the SnapshotSystem.
+     * \return  void, none.
+     */
+    void renderSkybox(const FrameSnapshot&);
+    /**
+     * \brief   The function renderGameplay. 
+     * \details This function draws lit, textured gameplay entities with the shadow
+     *          maps of the shadow pass.
+     * \param   snapshot    Render state captured by the SnapshotSystem.
+     * \return  void, none.
+     */
+    void renderGameplay(const FrameSnapshot&);
+    /**
+     * \brief   The function renderSprites. 
+     * \details This function draws textured sprite quads.
+     * \param   snapshot    Render state captured by the SnapshotSystem.
+     * \return  void, none.
+     */
+    void renderSprites(const FrameSnapshot&);
+    /**
+     * \brief   The function renderText. 
+     * \details This function draws text entities one glyph quad at a time.
+     * \param   snapshot    Render state captured by the SnapshotSystem.
+     * \return  void, none.
+     */
+    void renderText(const FrameSnapshot&);
+    /**
+     * \brief   The function renderStencilOutlines. 
+     * \details This function draws a scaled outline around gameplay entities with
+     *          their stencil flag set.
+     * \param   snapshot    Render state captured by the SnapshotSystem.
+     * \return  void, none.
+     */
+    void renderStencilOutlines(const FrameSnapshot&);
+
     /**
      * \brief Pointer to game's GLFW generated window.
      */
     GLFWwindow* m_glfwWindow;
+    /**
+     * \brief Pointer to the game's GpuProfileManager, null when not timing.
+     */
+    GpuProfileManager* m_gpuProfileManager = nullptr;
+    /**
+     * \brief Pointer to the game's AssetManager, resolving uniform handles.
+     */
+    AssetManager* m_assetManager = nullptr;
+    /**
+     * \brief Uniform handles of each program used so far, by program ID.
+     */
+    std::unordered_map<unsigned int, ProgramUniforms> m_programUniforms;
+    /**
+     * \brief Draw commands of this frame, sorted by GL state.
+     */
+    RenderQueue m_renderQueue;
+    /**
+     * \brief Bounds of the light meshes, gameplay entities and sprites, in 
+     *        that order, tested against the camera's frustum.
+     */
+    FrustumCuller m_frustumCuller;
+    /**
+     * \brief First vertex attribute location of the per-instance attributes,
+     *        past the mesh's own attributes, and the locations they take.
+     */
+    static constexpr unsigned int INSTANCE_LOCATION = 3;
+    static constexpr unsigned int INSTANCE_ATTRIBUTES = 9;
+    /**
+     * \brief Face mask of a caster drawn to every face of a cube map.
+     */
+    static constexpr std::uint32_t ALL_CUBE_FACES = 0x3F;
+    /**
+     * \brief Low bits of a sort key's mesh field holding the level of detail,
+     *        past the VAO, so each level batches apart.
+     */
+    static constexpr unsigned int LOD_BITS = 2;
+    static_assert(MAX_MESH_LODS <= (1u << LOD_BITS), "LOD_BITS must hold every level of detail");
+    /**
+     * \brief Error of a level of detail allowed on screen, and in shadow maps,
+     *        in pixels (texels). Shadows are filtered, so they take coarser
+     *        levels.
+     */
+    static constexpr float LOD_ERROR_PIXELS = 1.0f;
+    static constexpr float SHADOW_LOD_ERROR_PIXELS = 3.0f;
+    /**
+     * \brief Smallest tile of a spot light in the shadow atlas, and largest
+     *        side of the atlas, in texels.
+     */
+    static constexpr unsigned int MIN_SHADOW_TILE = 128;
+    static constexpr unsigned int MAX_SHADOW_ATLAS = 4096;
+    /**
+     * \brief Value of m_spotShadowTiles for lights without a tile.
+     */
+    static constexpr std::uint32_t NO_SHADOW_TILE = 0xFFFFFFFF;
+    /**
+     * \brief Instances of this frame, uploaded to m_instanceBuffer.
+     */
+    std::vector<InstanceData> m_instances;
+    /**
+     * \brief Instance of each shadow caster this frame, gameplay entities
+     *        then lights, in snapshot order.
+     */
+    std::vector<InstanceData> m_casterInstances;
+    std::vector<InstanceBatch> m_gameplayBatches;
+    std::vector<InstanceBatch> m_stencilBatches;
+    std::vector<InstanceBatch> m_shadowBatches;
+    /**
+     * \brief Shadow batches of light i are [m_shadowBatchBegin[i], m_shadowBatchBegin[i + 1]).
+     */
+    std::vector<std::size_t> m_shadowBatchBegin;
+    /**
+     * \brief Casters in reach of a light, sorted to group them by mesh.
+     */
+    RenderQueue m_casterQueue;
+    /**
+     * \brief Position of each shadow caster of this frame, by its index in
+     *        m_casterInstances, and the casters found near a light.
+     */
+    SpatialGrid m_casterGrid;
+    std::vector<std::uint32_t> m_nearbyCasters;
+    /**
+     * \brief Cube map faces each caster near the current light reaches, by
+     *        its index in m_casterInstances.
+     */
+    std::vector<std::uint32_t> m_casterFaces;
+    /**
+     * \brief Tiles of this frame's shadowed spot lights, and the tile of each
+     *        light, by its index in the snapshot.
+     */
+    ShadowAtlas m_shadowAtlas;
+    std::vector<std::uint32_t> m_spotShadowTiles;
+    /**
+     * \brief Framebuffer and depth texture of the spot shadow atlas, and the
+     *        size the texture was allocated at.
+     */
+    unsigned int m_shadowAtlasFramebuffer = 0;
+    unsigned int m_shadowAtlasTexture = 0;
+    unsigned int m_shadowAtlasWidth = 0;
+    unsigned int m_shadowAtlasHeight = 0;
+    /**
+     * \brief Meshes resident on the GPU, each uploaded once.
+     */
+    MeshRegistry m_meshRegistry;
+    /**
+     * \brief Vertex buffer of the per-instance attributes, shared by every VAO.
+     */
+    unsigned int m_instanceBuffer = 0;
+    /**
+     * \brief Index of each set of material maps (diffuse, specular, normal).
+     */
+    std::map<std::tuple<unsigned int, unsigned int, unsigned int>, unsigned int> m_textureSets;
+    /**
+     * \brief Bound program, VAO, active unit and texture of each unit, as far
+     *        as the cache knows. UNBOUND forces the next bind.
+     */
+    static constexpr unsigned int UNBOUND = 0xFFFFFFFF;
+    static constexpr unsigned int TEXTURE_UNITS = 12;
+    unsigned int m_boundProgram = UNBOUND;
+    unsigned int m_boundVertexArray = UNBOUND;
+    unsigned int m_activeUnit = UNBOUND;
+    unsigned int m_boundTextures[TEXTURE_UNITS] = {};
+    /**
+     * \brief Uniform buffer of the Camera block.
+     */
+    unsigned int m_cameraBuffer = 0;
+    /**
+     * \brief Uniform buffer of the Lights block.
+     */
+    unsigned int m_lightsBuffer = 0;
+    /**
+     * \brief Contents of the Camera block, this frame.
+     */
+    CameraBlock m_cameraBlock;
+    /**
+     * \brief Contents of the Lights block, this frame.
+     */
+    LightsBlock m_lightsBlock;
     /**
      * \brief Boolean to represent whether gamma correction is enabled for rendering.
      */
     bool m_gammaFlag = true;
+    /**
+     * \brief Boolean to represent whether the game runs without a GL context.
+     */
+    bool m_headless = false;
     /**
      * \brief Integer to represent the Width of the glfw window.
      */
@@ -128,6 +612,39 @@ private:
      * \brief Integer to represent the Height of depth map (for shadow resolution).
      */
     unsigned int m_shadowHeight;
+
+    /**
+     * \brief Fraction of a time step elapsed since the snapshot, this frame.
+     */
+    float m_renderFactor = 1.0f;
+    /**
+     * \brief Width of the window's framebuffer, this frame.
+     */
+    int m_framebufferWidth = 0;
+    /**
+     * \brief Height of the window's framebuffer, this frame.
+     */
+    int m_framebufferHeight = 0;
+    /**
+     * \brief Camera zoom (field of view, in degrees), this frame.
+     */
+    float m_cameraZoom = 45.0f;
+    /**
+     * \brief Interpolated camera position, this frame.
+     */
+    glm::vec3 m_cameraPosition = glm::vec3(0.0f, 0.0f, 20.0f);
+    /**
+     * \brief Camera front direction, this frame.
+     */
+    glm::vec3 m_cameraFront = glm::vec3(0.0f, 0.0f, -1.0f);
+    /**
+     * \brief Camera up direction, this frame.
+     */
+    glm::vec3 m_cameraUp = glm::vec3(0.0f, 1.0f, 0.0f);
+    /**
+     * \brief Point light depth cubemaps written by the shadow pass, by shadow index.
+     */
+    unsigned int m_shadowCubes[MAX_POINT_LIGHTS] = {};
 };
 
 #endif // SYSTEM_RENDER_H
\ No newline at end of file
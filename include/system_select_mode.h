@@ -33,21 +33,29 @@ public:
     void setRegistry(entt::registry*);
 
     /**
-     * \brief   Apply force to player and selected objects in left direction.
+     * \brief   Queue force on player and selected objects in left direction.
      */
     void moveSelectedLeft();
     /**
-     * \brief   Apply force to player and selected objects in right direction. 
+     * \brief   Queue force on player and selected objects in right direction. 
      */
     void moveSelectedRight();
     /**
-     * \brief   Apply force to player and selected objects in up direction.
+     * \brief   Queue force on player and selected objects in up direction.
      */
     void moveSelectedUp();
     /**
-     * \brief   Apply force to player and selected objects in down direction. 
+     * \brief   Queue force on player and selected objects in down direction. 
      */
     void moveSelectedDown();
+    /**
+     * \brief   The function update. 
+     * \details This function applies the force queued by the move functions
+     *          since the last call, then clears it. Called once per fixed 
+     *          step, before the Box2D world is stepped.
+     * \return  void, none.
+     */
+    void update();
 
     /**
      * \brief   Toggle select mode: on if currently off, off if currently on. 
@@ -57,6 +65,11 @@ public:
 private:
     entt::registry* m_registry;
 
+    /**
+     * \brief Sum of forces queued by move commands, applied on update.
+     */
+    b2Vec2 m_pendingForce = b2Vec2(0.0f, 0.0f);
+
 };
 
 #endif // SYSTEM_SELECT_MODE_H
\ No newline at end of file
@@ -0,0 +1,64 @@
+// -----------------------------------------------------------------------------
+// Onset Engine
+// https://github.com/dylanafterall/OnsetEngine.git
+//
+// system_snapshot.h
+//  header: system to capture renderable registry state into a FrameSnapshot
+// -----------------------------------------------------------------------------
+#ifndef SYSTEM_SNAPSHOT_H
+#define SYSTEM_SNAPSHOT_H
+
+#include "core_frame_snapshot.h"
+#include "component_camera.h"
+#include "component_light.h"
+#include "component_material.h"
+#include "component_render_data.h"
+#include "component_shader_program.h"
+#include "component_shadow_framebuffer.h"
+#include "component_skybox.h"
+#include "component_sprite.h"
+#include "component_text.h"
+#include "component_texture.h"
+#include "component_transform.h"
+
+#include "entt/entt.hpp"
+
+/** 
+ * \brief   The SnapshotSystem class.
+ * \details Used by Game class to copy everything the RenderSystem draws out of
+ *          the registry, so rendering never reads live simulation state.
+ */
+class SnapshotSystem {
+public:
+    /**
+     * \brief   The default constructor. 
+     */
+    SnapshotSystem() = default;
+    /**
+     * \brief   The default destructor. 
+     */
+    ~SnapshotSystem() = default;
+
+    /**
+     * \brief   Set the EnTT registry to capture renderable entities from. 
+     */
+    void setRegistry(entt::registry*);
+
+    /**
+     * \brief   The function update. 
+     * \details This function overwrites the given snapshot with the current
+     *          camera, lights, gameplay entities, skyboxes, sprites and text.
+     *          Must run on the thread stepping the simulation.
+     * \param   snapshot    The snapshot to fill, stale contents are replaced.
+     * \return  void, none.
+     */
+    void update(FrameSnapshot&);
+
+private:
+    /**
+     * \brief Pointer to the game's registry, read to fill snapshots.
+     */
+    entt::registry* m_registry;
+};
+
+#endif // SYSTEM_SNAPSHOT_H
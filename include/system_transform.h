@@ -0,0 +1,71 @@
+// -----------------------------------------------------------------------------
+// Onset Engine
+// https://github.com/dylanafterall/OnsetEngine.git
+//
+// system_transform.h
+//  header: system to extract Box2D body transforms into the registry
+// -----------------------------------------------------------------------------
+#ifndef SYSTEM_TRANSFORM_H
+#define SYSTEM_TRANSFORM_H
+
+#include "core_job_manager.h"
+#include "component_body_transform.h"
+#include "component_transform.h"
+
+#include "entt/entt.hpp"
+#include "box2d/box2d.h"
+
+#include <vector>
+
+/** 
+ * \brief   The TransformSystem class.
+ * \details Used by Game class to copy position, angle and velocity of every 
+ *          Box2D body into its TransformComponent, split across job workers.
+ */
+class TransformSystem {
+public:
+    /**
+     * \brief   The default constructor. 
+     */
+    TransformSystem() = default;
+    /**
+     * \brief   The default destructor. 
+     */
+    ~TransformSystem() = default;
+
+    /**
+     * \brief   Set the EnTT registry to access body and transform data. 
+     */
+    void setRegistry(entt::registry*);
+    /**
+     * \brief   Set the JobManager used to split extraction across workers. 
+     */
+    void setJobManager(JobManager*);
+
+    /**
+     * \brief   The function update. 
+     * \details This function reads every body with a TransformComponent, and
+     *          stores its current transform, keeping the last one as the 
+     *          previous transform. Must run once after every world step, and
+     *          never concurrently with it.
+     * \return  void, none.
+     */
+    void update();
+
+private:
+    /**
+     * \brief Pointer to the game's registry, holding the transforms to fill.
+     */
+    entt::registry* m_registry;
+    /**
+     * \brief Pointer to the game's JobManager, for parallel extraction.
+     */
+    JobManager* m_jobManager;
+
+    /**
+     * \brief Entities gathered each update, reused to avoid reallocating.
+     */
+    std::vector<entt::entity> m_entities;
+};
+
+#endif // SYSTEM_TRANSFORM_H
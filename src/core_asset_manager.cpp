@@ -11,6 +11,29 @@
 #define STB_IMAGE_IMPLEMENTATION    // required before stb include - only once
 #include "stb_image.h"
 
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <filesystem>
+#include <mutex>
+#include <thread>
+
+static const char PROGRAM_CACHE_MAGIC[8] = {'O', 'N', 'S', 'E', 'T', 'P', 'R', 'G'};
+
+// program binaries are core in GL 4.1, and an extension to our 3.3 context;
+// drivers without it leave the entry points unloaded, or report no formats
+static bool isProgramBinarySupported() {
+    if (glGetProgramBinary == nullptr || glProgramBinary == nullptr || glProgramParameteri == nullptr) {
+        return false;
+    }
+    GLint formatCount = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+    return formatCount > 0;
+}
+
 // _____________________________________________________________________________
 // -----------------------------------------------------------------------------
 // 'Set' functions
@@ -19,31 +42,7 @@
 
 void AssetManager::setTexture(const std::string& assetId, const char* texturePath, bool repeat, bool gamma) {
     // generate and bind texture for OpenGL configuration
-    unsigned int texture;
-    glGenTextures(1, &texture);
-    glBindTexture(GL_TEXTURE_2D, texture);
-
-    if (repeat) {
-        // set the texture WRAPPING parameters - (s,t,r is equivalent of x,y,z)
-        glTexParameteri(        // acts on currently active/bound texture
-        GL_TEXTURE_2D,          // specify texture target (texture is in 2D)
-        GL_TEXTURE_WRAP_S,      // what option to set and for which texture axis 
-        GL_REPEAT               // specify wrapping parameter         
-        );
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);   
-    }
-    else {
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);  
-    }
-
-    // set texture FILTERING parameters
-    glTexParameteri(
-        GL_TEXTURE_2D,
-        GL_TEXTURE_MIN_FILTER,  // minifying or magnifying? scaling down or up?
-        GL_LINEAR_MIPMAP_LINEAR   // nearest texel center, linear interpolation, or Mipmaps
-    );
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    unsigned int texture = createTexture(false, repeat);
     
     // tell stb_image.h to flip loaded textures on the y-axis
     stbi_set_flip_vertically_on_load(true); // needed due to OpenGL coordinates 
@@ -52,40 +51,14 @@ void AssetManager::setTexture(const std::string& assetId, const char* texturePat
     int width, height, nrChannels;
     unsigned char* data = stbi_load(texturePath, &width, &height, &nrChannels, 0);
     if (data) {
-        GLenum internalFormat, format;
-        if (nrChannels == 1) {
-            internalFormat = format = GL_RED;
-        }
-        else if (nrChannels == 3) {
-            internalFormat = format = GL_RGB;
-            if (gamma) {
-                internalFormat = GL_SRGB;
-            }
-        }
-        else {
-            internalFormat = format = GL_RGBA;
-            if (gamma) {
-                internalFormat = GL_SRGB_ALPHA;
-            }
-        }
-
-        glTexImage2D(
-            GL_TEXTURE_2D,      // texture target (1D/2D/3D) 
-            0,                  // level of detail (0 to nth mipmap reduction) 
-            internalFormat,     // number of color components (RED / RGB / RGBA) 
-            width,       
-            height, 
-            0,                  // border, value must be 0 
-            format,             // format of pixel data (RED / RGB / RGBA) 
-            GL_UNSIGNED_BYTE,   // data type of pixel data 
-            data                // pointer to image data in memory
-        );
+        uploadImage(GL_TEXTURE_2D, data, width, height, nrChannels, gamma);
         glGenerateMipmap(GL_TEXTURE_2D);
         // add new texture to Asset Manager's texture map
         textures.emplace(assetId, texture);
         ONSET_INFO("New Texture added to Asset Manager with id = {}", assetId);
     }
     else {
+        glDeleteTextures(1, &texture);
         ONSET_ERROR("Failed to load texture");
     }
 
@@ -94,50 +67,239 @@ void AssetManager::setTexture(const std::string& assetId, const char* texturePat
 }
 
 void AssetManager::setCubemap(const std::string& assetId, std::vector<std::string> faces, bool gamma) {
-    unsigned int textureID;
-    glGenTextures(1, &textureID);
-    glBindTexture(GL_TEXTURE_CUBE_MAP, textureID);
+    unsigned int textureID = createTexture(true, false);
 
     stbi_set_flip_vertically_on_load(false);
     int width, height, nrComponents;
     for (unsigned int i = 0; i < faces.size(); i++) {
         unsigned char *data = stbi_load(faces[i].c_str(), &width, &height, &nrComponents, 0);
         if (data) {
-            GLenum internalFormat, format;
-            if (nrComponents == 1) {
-                internalFormat = format = GL_RED;
-            }
-            else if (nrComponents == 3) {
-                internalFormat = format = GL_RGB;
-                if (gamma) {
-                    internalFormat = GL_SRGB;
+            uploadImage(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, data, width, height, nrComponents, gamma);
+            stbi_image_free(data);
+        }
+        else {
+            ONSET_ERROR("Cubemap-texture failed to load at path: {}", faces[i]);
+            stbi_image_free(data);
+        }
+    }
+    stbi_set_flip_vertically_on_load(true);
+
+    cubemaps.emplace(assetId, textureID);
+    ONSET_INFO("New Cubemap added to Asset Manager with id = {}", assetId);
+}
+
+void AssetManager::queueTexture(const std::string& assetId, const char* texturePath, bool repeat, bool gamma) {
+    QueuedTexture queued;
+    queued.m_assetId = assetId;
+    queued.m_paths.emplace_back(texturePath);
+    queued.m_repeat = repeat;
+    queued.m_gamma = gamma;
+    queuedTextures.push_back(std::move(queued));
+}
+
+void AssetManager::queueCubemap(const std::string& assetId, std::vector<std::string> faces, bool gamma) {
+    QueuedTexture queued;
+    queued.m_assetId = assetId;
+    queued.m_paths = std::move(faces);
+    queued.m_isCubemap = true;
+    queued.m_gamma = gamma;
+    queuedTextures.push_back(std::move(queued));
+}
+
+void AssetManager::loadQueuedTextures(JobManager& jobManager) {
+    ONSET_PROFILE_SCOPE("AssetManager::loadQueuedTextures");
+    if (queuedTextures.empty()) {
+        return;
+    }
+    auto start = std::chrono::steady_clock::now();
+
+    // one image per texture, one per face of a cubemap
+    struct DecodedImage {
+        std::size_t m_texture = 0;
+        unsigned int m_face = 0;
+        unsigned char* m_data = nullptr;
+        int m_width = 0;
+        int m_height = 0;
+        int m_channels = 0;
+    };
+    std::vector<DecodedImage> images;
+    std::vector<std::size_t> remainingImages(queuedTextures.size());
+    for (std::size_t i = 0; i < queuedTextures.size(); i++) {
+        QueuedTexture& queued = queuedTextures[i];
+        queued.m_texture = createTexture(queued.m_isCubemap, queued.m_repeat);
+        remainingImages[i] = queued.m_paths.size();
+        for (unsigned int face = 0; face < queued.m_paths.size(); face++) {
+            DecodedImage image;
+            image.m_texture = i;
+            image.m_face = face;
+            images.push_back(image);
+        }
+    }
+
+    // stb_image's flip flag is shared by every thread, so the workers decode
+    // unflipped and flip 2D textures themselves (as OpenGL coordinates need)
+    stbi_set_flip_vertically_on_load(false);
+
+    // workers hand decoded images to this thread through the ready queue
+    std::mutex readyMutex;
+    std::condition_variable readyCondition;
+    std::deque<std::size_t> readyImages;
+    bool decoderDone = false;
+
+    // decode from a separate thread, as running jobs blocks the caller
+    auto decodeImages = [&]() {
+        jobManager.parallelFor(images.size(), 1, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++) {
+                ONSET_PROFILE_SCOPE("AssetManager::decodeImage");
+                DecodedImage& image = images[i];
+                const QueuedTexture& queued = queuedTextures[image.m_texture];
+                image.m_data = stbi_load(
+                    queued.m_paths[image.m_face].c_str(), 
+                    &image.m_width, 
+                    &image.m_height, 
+                    &image.m_channels, 
+                    0
+                );
+                if (image.m_data && !queued.m_isCubemap) {
+                    flipVertically(image.m_data, image.m_width, image.m_height, image.m_channels);
                 }
+
+                {
+                    std::lock_guard<std::mutex> lock(readyMutex);
+                    readyImages.push_back(i);
+                }
+                readyCondition.notify_one();
+            }
+        });
+    };
+    // an exception escaping the thread would end the program, and leave this
+    // one waiting: the decoder reports it and always signals it is done
+    std::thread decoder([&]() {
+        ONSET_PROFILE_THREAD("asset decoder");
+        try {
+            decodeImages();
+        }
+        catch (const std::exception& e) {
+            ONSET_ERROR("Asset Manager stopped decoding images: {}", e.what());
+        }
+        catch (...) {
+            ONSET_ERROR("Asset Manager stopped decoding images");
+        }
+        {
+            std::lock_guard<std::mutex> lock(readyMutex);
+            decoderDone = true;
+        }
+        readyCondition.notify_one();
+    });
+
+    // upload each image as soon as it has been decoded
+    for (std::size_t uploaded = 0; uploaded < images.size(); uploaded++) {
+        std::size_t index;
+        {
+            std::unique_lock<std::mutex> lock(readyMutex);
+            readyCondition.wait(lock, [&]() { return !readyImages.empty() || decoderDone; });
+            if (readyImages.empty()) {
+                break;
+            }
+            index = readyImages.front();
+            readyImages.pop_front();
+        }
+        ONSET_PROFILE_SCOPE("AssetManager::uploadImage");
+
+        // a cubemap missing a face is deleted like a failed 2D texture, and
+        // the rest of its faces skipped
+        DecodedImage& image = images[index];
+        QueuedTexture& queued = queuedTextures[image.m_texture];
+        if (!image.m_data) {
+            if (queued.m_isCubemap) {
+                ONSET_ERROR("Cubemap-texture failed to load at path: {}", queued.m_paths[image.m_face]);
             }
             else {
-                internalFormat = format = GL_RGBA;
-                if (gamma) {
-                    internalFormat = GL_SRGB_ALPHA;
-                }
+                ONSET_ERROR("Failed to load texture at path: {}", queued.m_paths[image.m_face]);
             }
+            glDeleteTextures(1, &queued.m_texture);
+            queued.m_texture = 0;
+        }
+        else if (queued.m_texture != 0 && queued.m_isCubemap) {
+            glBindTexture(GL_TEXTURE_CUBE_MAP, queued.m_texture);
+            uploadImage(
+                GL_TEXTURE_CUBE_MAP_POSITIVE_X + image.m_face, 
+                image.m_data, 
+                image.m_width, 
+                image.m_height, 
+                image.m_channels, 
+                queued.m_gamma
+            );
+        }
+        else if (queued.m_texture != 0) {
+            glBindTexture(GL_TEXTURE_2D, queued.m_texture);
+            uploadImage(GL_TEXTURE_2D, image.m_data, image.m_width, image.m_height, image.m_channels, queued.m_gamma);
+            glGenerateMipmap(GL_TEXTURE_2D);
+        }
+        stbi_image_free(image.m_data);
+        image.m_data = nullptr;
 
-            glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, internalFormat, width, height, 0, format, GL_UNSIGNED_BYTE, data);
-            stbi_image_free(data);
+        // add the texture to its map once all of its images are uploaded
+        if (--remainingImages[image.m_texture] > 0 || queued.m_texture == 0) {
+            continue;
+        }
+        if (queued.m_isCubemap) {
+            cubemaps.emplace(queued.m_assetId, queued.m_texture);
+            ONSET_INFO("New Cubemap added to Asset Manager with id = {}", queued.m_assetId);
         }
         else {
-            ONSET_ERROR("Cubemap-texture failed to load at path: {}", faces[i]);
-            stbi_image_free(data);
+            textures.emplace(queued.m_assetId, queued.m_texture);
+            ONSET_INFO("New Texture added to Asset Manager with id = {}", queued.m_assetId);
+        }
+    }
+    decoder.join();
+
+    // a stopped decoder leaves images never uploaded, and their textures
+    // incomplete
+    for (DecodedImage& image : images) {
+        stbi_image_free(image.m_data);
+        image.m_data = nullptr;
+    }
+    for (std::size_t i = 0; i < queuedTextures.size(); i++) {
+        if (remainingImages[i] > 0 && queuedTextures[i].m_texture != 0) {
+            ONSET_ERROR("Asset Manager dropped texture {}, not every image was decoded", queuedTextures[i].m_assetId);
+            glDeleteTextures(1, &queuedTextures[i].m_texture);
+            queuedTextures[i].m_texture = 0;
         }
     }
     stbi_set_flip_vertically_on_load(true);
 
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    ONSET_INFO(
+        "Asset Manager loaded {} images on {} workers in {:.2f} ms", 
+        images.size(), 
+        jobManager.getWorkerCount(), 
+        elapsed.count()
+    );
+    queuedTextures.clear();
+}
 
-    cubemaps.emplace(assetId, textureID);
-    ONSET_INFO("New Cubemap added to Asset Manager with id = {}", assetId);
+void AssetManager::streamQueuedTextures() {
+    // mid grey, neutral under lighting until the real image arrives
+    const unsigned char placeholder[4] = {128, 128, 128, 255};
+
+    std::vector<QueuedTexture> cubemapQueue;
+    for (QueuedTexture& queued : queuedTextures) {
+        if (queued.m_isCubemap) {
+            cubemapQueue.push_back(std::move(queued));
+            continue;
+        }
+        unsigned int texture = createTexture(false, queued.m_repeat);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, placeholder);
+        textures.emplace(queued.m_assetId, texture);
+        textureStreamer.request(texture, queued.m_paths[0], queued.m_gamma);
+        ONSET_INFO("New Texture added to Asset Manager with id = {}, streaming", queued.m_assetId);
+    }
+    queuedTextures = std::move(cubemapQueue);
+}
+
+void AssetManager::updateStreaming() {
+    textureStreamer.update();
 }
 
 void AssetManager::setVShader(const std::string& assetId, const char* vertexPath) {
@@ -162,19 +324,8 @@ void AssetManager::setVShader(const std::string& assetId, const char* vertexPath
         ONSET_ERROR("VShader file not successfully read: {}", e.what());
     }
 
-    const char* vShaderCode = vertexCode.c_str();
-
-    // compile vertex shader 
-    unsigned int vertex = glCreateShader(GL_VERTEX_SHADER);
-    // attach shader source code to shader object
-    glShaderSource(
-        vertex,         // shader object to compile
-        1,              // how many strings to pass as source code 
-        &vShaderCode,   // actual source code of vertex shader 
-        NULL            // an array of string lengths
-    );
-    glCompileShader(vertex);
-    checkShaderErrors(vertex, "VERTEX");
+    // create vertex shader, compiled when first linked
+    unsigned int vertex = createShader(GL_VERTEX_SHADER, vertexCode, "VERTEX");
 
     // add vshader to asset manager's map
     vshaders.emplace(assetId, vertex);
@@ -203,13 +354,8 @@ void AssetManager::setFShader(const std::string& assetId, const char* fragmentPa
         ONSET_ERROR("FShader file not successfully read: {}", e.what());
     }
 
-    const char* fShaderCode = fragmentCode.c_str();
-
-    // compile fragment shader 
-    unsigned int fragment = glCreateShader(GL_FRAGMENT_SHADER);
-    glShaderSource(fragment, 1, &fShaderCode, NULL);
-    glCompileShader(fragment);
-    checkShaderErrors(fragment, "FRAGMENT");
+    // create fragment shader, compiled when first linked
+    unsigned int fragment = createShader(GL_FRAGMENT_SHADER, fragmentCode, "FRAGMENT");
 
     // add fshader to asset manager's map
     fshaders.emplace(assetId, fragment);
@@ -238,13 +384,8 @@ void AssetManager::setGShader(const std::string& assetId, const char* geometryPa
         ONSET_ERROR("GShader file not successfully read: {}", e.what());
     }
 
-    const char* gShaderCode = geometryCode.c_str();
-
-    // compile geometry shader 
-    unsigned int geometry = glCreateShader(GL_GEOMETRY_SHADER);
-    glShaderSource(geometry, 1, &gShaderCode, NULL);
-    glCompileShader(geometry);
-    checkShaderErrors(geometry, "GEOMETRY");
+    // create geometry shader, compiled when first linked
+    unsigned int geometry = createShader(GL_GEOMETRY_SHADER, geometryCode, "GEOMETRY");
 
     // add fshader to asset manager's map
     gshaders.emplace(assetId, geometry);
@@ -252,32 +393,15 @@ void AssetManager::setGShader(const std::string& assetId, const char* geometryPa
 }
 
 void AssetManager::setShaderProgram(const std::string& assetId, unsigned int vertexShader, unsigned int fragmentShader) {
-    unsigned int shaderProgram = glCreateProgram();
-    glAttachShader(shaderProgram, vertexShader);
-    glAttachShader(shaderProgram, fragmentShader);
-    glLinkProgram(shaderProgram);
-
-    // check shader linking for errors 
-    checkShaderProgramErrors(shaderProgram);
-
-    // add shaderProgram to asset manager's map 
-    shaderPrograms.emplace(assetId, shaderProgram);
-    ONSET_INFO("New ShaderProgram added to Asset Manager with id = {}", assetId);
+    linkShaderProgram(assetId, {vertexShader, fragmentShader});
 }
 
 void AssetManager::setShaderProgram(const std::string& assetId, unsigned int vertexShader, unsigned int geometryShader, unsigned int fragmentShader) {
-    unsigned int shaderProgram = glCreateProgram();
-    glAttachShader(shaderProgram, vertexShader);
-    glAttachShader(shaderProgram, geometryShader);
-    glAttachShader(shaderProgram, fragmentShader);
-    glLinkProgram(shaderProgram);
-
-    // check shader linking for errors 
-    checkShaderProgramErrors(shaderProgram);
+    linkShaderProgram(assetId, {vertexShader, geometryShader, fragmentShader});
+}
 
-    // add shaderProgram to asset manager's map 
-    shaderPrograms.emplace(assetId, shaderProgram);
-    ONSET_INFO("New ShaderProgram added to Asset Manager with id = {}", assetId);
+void AssetManager::setProgramCacheDirectory(const std::string& directory) {
+    programCacheDirectory = directory;
 }
 
 // _____________________________________________________________________________
@@ -316,7 +440,324 @@ unsigned int AssetManager::getShaderProgram(const std::string& assetId) {
 // _____________________________________________________________________________
 // -----------------------------------------------------------------------------
 
+unsigned int AssetManager::createShader(GLenum type, const std::string& code, const std::string& typeName) {
+    unsigned int shader = glCreateShader(type);
+    const char* shaderCode = code.c_str();
+    // attach shader source code to shader object
+    glShaderSource(
+        shader,         // shader object to compile
+        1,              // how many strings to pass as source code 
+        &shaderCode,    // actual source code of shader 
+        NULL            // an array of string lengths
+    );
+
+    PendingShader pending;
+    pending.m_code = code;
+    pending.m_type = typeName;
+    shaderSources[shader] = std::move(pending);
+    return shader;
+}
+
+void AssetManager::linkShaderProgram(const std::string& assetId, const std::vector<unsigned int>& shaders) {
+    ONSET_PROFILE_SCOPE("AssetManager::linkShaderProgram");
+    unsigned int shaderProgram = glCreateProgram();
+    std::uint64_t programKey = getProgramKey(shaders);
+
+    if (loadProgramBinary(shaderProgram, assetId, programKey)) {
+        reflectUniforms(shaderProgram);
+        bindUniformBlocks(shaderProgram);
+        shaderPrograms.emplace(assetId, shaderProgram);
+        ONSET_INFO("New ShaderProgram added to Asset Manager with id = {}, from cache", assetId);
+        return;
+    }
+
+    // cache miss: compile whichever shaders have not been compiled yet
+    for (unsigned int shader : shaders) {
+        PendingShader& pending = shaderSources[shader];
+        if (!pending.m_isCompiled) {
+            glCompileShader(shader);
+            checkShaderErrors(shader, pending.m_type);
+            pending.m_isCompiled = true;
+        }
+        glAttachShader(shaderProgram, shader);
+    }
+    if (!programCacheDirectory.empty() && isProgramBinarySupported()) {
+        glProgramParameteri(shaderProgram, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
+    glLinkProgram(shaderProgram);
+
+    // check shader linking for errors 
+    checkShaderProgramErrors(shaderProgram);
+    saveProgramBinary(shaderProgram, assetId, programKey);
+    reflectUniforms(shaderProgram);
+    bindUniformBlocks(shaderProgram);
+
+    // add shaderProgram to asset manager's map 
+    shaderPrograms.emplace(assetId, shaderProgram);
+    ONSET_INFO("New ShaderProgram added to Asset Manager with id = {}", assetId);
+}
+
+void AssetManager::reflectUniforms(unsigned int program) {
+    std::map<std::string, ShaderUniform>& uniforms = programUniforms[program];
+    uniforms.clear();
+
+    int uniformCount = 0;
+    int maxNameLength = 0;
+    glGetProgramiv(program, GL_ACTIVE_UNIFORMS, &uniformCount);
+    glGetProgramiv(program, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxNameLength);
+    std::vector<char> nameBuffer(static_cast<std::size_t>(std::max(maxNameLength, 1)));
+
+    for (int i = 0; i < uniformCount; i++) {
+        GLsizei nameLength = 0;
+        GLint size = 0;
+        GLenum type = 0;
+        glGetActiveUniform(program, i, maxNameLength, &nameLength, &size, &type, nameBuffer.data());
+        std::string name(nameBuffer.data(), static_cast<std::size_t>(nameLength));
+
+        // arrays are reported once, as "name[0]" - record every element, 
+        // and the bare name for element 0
+        std::string baseName = name;
+        if (baseName.size() > 3 && baseName.compare(baseName.size() - 3, 3, "[0]") == 0) {
+            baseName.erase(baseName.size() - 3);
+        }
+        for (int element = 0; element < size; element++) {
+            std::string elementName = (size > 1 || baseName != name)
+                ? baseName + "[" + std::to_string(element) + "]"
+                : name;
+            ShaderUniform uniform;
+            uniform.m_location = glGetUniformLocation(program, elementName.c_str());
+            uniform.m_type = type;
+            // members of uniform blocks have no location
+            if (uniform.m_location != -1) {
+                uniforms[elementName] = uniform;
+            }
+        }
+        if (baseName != name && uniforms.count(name) > 0) {
+            uniforms[baseName] = uniforms[name];
+        }
+    }
+}
+
+void AssetManager::bindUniformBlocks(unsigned int program) {
+    struct BlockBinding {
+        const char* m_name;
+        GLuint m_binding;
+        GLint m_size;
+    };
+    const BlockBinding blocks[] = {
+        {"Camera", CAMERA_BLOCK_BINDING, static_cast<GLint>(sizeof(CameraBlock))},
+        {"Lights", LIGHTS_BLOCK_BINDING, static_cast<GLint>(sizeof(LightsBlock))}
+    };
+    for (const BlockBinding& block : blocks) {
+        GLuint index = glGetUniformBlockIndex(program, block.m_name);
+        if (index == GL_INVALID_INDEX) {
+            continue;
+        }
+        // a block larger than its struct means the GLSL and C++ layouts disagree
+        GLint size = 0;
+        glGetActiveUniformBlockiv(program, index, GL_UNIFORM_BLOCK_DATA_SIZE, &size);
+        if (size > block.m_size) {
+            ONSET_ERROR("Uniform block {} of ShaderProgram {} is {} bytes, expected {}", block.m_name, program, size, block.m_size);
+        }
+        glUniformBlockBinding(program, index, block.m_binding);
+    }
+}
+
+GLint AssetManager::findUniform(unsigned int program, const std::string& name, bool (*matches)(GLenum)) const {
+    auto uniforms = programUniforms.find(program);
+    if (uniforms == programUniforms.end()) {
+        return -1;
+    }
+    auto uniform = uniforms->second.find(name);
+    if (uniform == uniforms->second.end()) {
+        // inactive uniforms are optimized out by the compiler, not an error
+        return -1;
+    }
+    if (!matches(uniform->second.m_type)) {
+        ONSET_ERROR("Uniform {} of ShaderProgram {} set with the wrong type", name, program);
+        return -1;
+    }
+    return uniform->second.m_location;
+}
+
+std::uint64_t AssetManager::getProgramKey(const std::vector<unsigned int>& shaders) {
+    // FNV-1a over the driver's identity and every stage's source, so a
+    // driver update or any edited shader misses the cache
+    std::uint64_t hash = 14695981039346656037ull;
+    auto addBytes = [&hash](const char* bytes, std::size_t size) {
+        for (std::size_t i = 0; i < size; i++) {
+            hash ^= static_cast<unsigned char>(bytes[i]);
+            hash *= 1099511628211ull;
+        }
+        // separator, so moving text between fields changes the hash
+        hash ^= 0xFF;
+        hash *= 1099511628211ull;
+    };
+    for (GLenum name : {GL_VENDOR, GL_RENDERER, GL_VERSION}) {
+        const char* driver = reinterpret_cast<const char*>(glGetString(name));
+        if (driver != nullptr) {
+            addBytes(driver, std::strlen(driver));
+        }
+    }
+    for (unsigned int shader : shaders) {
+        const PendingShader& pending = shaderSources[shader];
+        addBytes(pending.m_type.data(), pending.m_type.size());
+        addBytes(pending.m_code.data(), pending.m_code.size());
+    }
+    return hash;
+}
+
+bool AssetManager::loadProgramBinary(unsigned int program, const std::string& assetId, std::uint64_t programKey) {
+    if (programCacheDirectory.empty() || !isProgramBinarySupported()) {
+        return false;
+    }
+    std::ifstream file(programCacheDirectory + "/" + assetId + ".bin", std::ios::binary);
+    if (!file) {
+        return false;
+    }
+
+    char magic[8];
+    std::uint64_t fileKey = 0;
+    std::uint32_t format = 0;
+    std::uint32_t length = 0;
+    file.read(magic, sizeof(magic));
+    file.read(reinterpret_cast<char*>(&fileKey), sizeof(fileKey));
+    file.read(reinterpret_cast<char*>(&format), sizeof(format));
+    file.read(reinterpret_cast<char*>(&length), sizeof(length));
+    if (!file || std::memcmp(magic, PROGRAM_CACHE_MAGIC, sizeof(magic)) != 0 || fileKey != programKey) {
+        return false;
+    }
+    std::vector<char> binary(length);
+    if (!file.read(binary.data(), length)) {
+        return false;
+    }
+
+    // the driver may still reject a binary, e.g. after an update keeping
+    // its version string, so fall back to compiling when it does not link
+    glProgramBinary(program, format, binary.data(), static_cast<GLsizei>(length));
+    int success;
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+    if (!success) {
+        ONSET_WARN("Cached binary of ShaderProgram {} rejected, compiling", assetId);
+        return false;
+    }
+    return true;
+}
+
+void AssetManager::saveProgramBinary(unsigned int program, const std::string& assetId, std::uint64_t programKey) {
+    if (programCacheDirectory.empty() || !isProgramBinarySupported()) {
+        return;
+    }
+    int success;
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+    int length = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (!success || length <= 0) {
+        return;
+    }
+    std::vector<char> binary(static_cast<std::size_t>(length));
+    GLenum format = 0;
+    glGetProgramBinary(program, length, nullptr, &format, binary.data());
+
+    std::error_code error;
+    std::filesystem::create_directories(programCacheDirectory, error);
+    std::ofstream file(programCacheDirectory + "/" + assetId + ".bin", std::ios::binary | std::ios::trunc);
+    if (!file) {
+        ONSET_WARN("Could not write binary of ShaderProgram {} to {}", assetId, programCacheDirectory);
+        return;
+    }
+    std::uint32_t fileFormat = format;
+    std::uint32_t fileLength = static_cast<std::uint32_t>(length);
+    file.write(PROGRAM_CACHE_MAGIC, sizeof(PROGRAM_CACHE_MAGIC));
+    file.write(reinterpret_cast<const char*>(&programKey), sizeof(programKey));
+    file.write(reinterpret_cast<const char*>(&fileFormat), sizeof(fileFormat));
+    file.write(reinterpret_cast<const char*>(&fileLength), sizeof(fileLength));
+    file.write(binary.data(), length);
+}
+
+unsigned int AssetManager::createTexture(bool isCubemap, bool repeat) {
+    unsigned int texture;
+    glGenTextures(1, &texture);
+
+    if (isCubemap) {
+        glBindTexture(GL_TEXTURE_CUBE_MAP, texture);
+        glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+        return texture;
+    }
+
+    glBindTexture(GL_TEXTURE_2D, texture);
+    if (repeat) {
+        // set the texture WRAPPING parameters - (s,t,r is equivalent of x,y,z)
+        glTexParameteri(        // acts on currently active/bound texture
+        GL_TEXTURE_2D,          // specify texture target (texture is in 2D)
+        GL_TEXTURE_WRAP_S,      // what option to set and for which texture axis 
+        GL_REPEAT               // specify wrapping parameter         
+        );
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);   
+    }
+    else {
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);  
+    }
+
+    // set texture FILTERING parameters
+    glTexParameteri(
+        GL_TEXTURE_2D,
+        GL_TEXTURE_MIN_FILTER,  // minifying or magnifying? scaling down or up?
+        GL_LINEAR_MIPMAP_LINEAR   // nearest texel center, linear interpolation, or Mipmaps
+    );
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    return texture;
+}
+
+void AssetManager::uploadImage(GLenum target, const unsigned char* data, int width, int height, int nrChannels, bool gamma) {
+    GLenum internalFormat, format;
+    if (nrChannels == 1) {
+        internalFormat = format = GL_RED;
+    }
+    else if (nrChannels == 3) {
+        internalFormat = format = GL_RGB;
+        if (gamma) {
+            internalFormat = GL_SRGB;
+        }
+    }
+    else {
+        internalFormat = format = GL_RGBA;
+        if (gamma) {
+            internalFormat = GL_SRGB_ALPHA;
+        }
+    }
+
+    glTexImage2D(
+        target,             // texture target (2D, or face of a cubemap) 
+        0,                  // level of detail (0 to nth mipmap reduction) 
+        internalFormat,     // number of color components (RED / RGB / RGBA) 
+        width,       
+        height, 
+        0,                  // border, value must be 0 
+        format,             // format of pixel data (RED / RGB / RGBA) 
+        GL_UNSIGNED_BYTE,   // data type of pixel data 
+        data                // pointer to image data in memory
+    );
+}
+
+void AssetManager::flipVertically(unsigned char* data, int width, int height, int nrChannels) {
+    std::size_t rowSize = static_cast<std::size_t>(width) * nrChannels;
+    unsigned char* top = data;
+    unsigned char* bottom = data + (height - 1) * rowSize;
+    for (; top < bottom; top += rowSize, bottom -= rowSize) {
+        std::swap_ranges(top, top + rowSize, bottom);
+    }
+}
+
 void AssetManager::deleteAssets() {
+    // stop streaming before deleting the textures it uploads to
+    textureStreamer.destroy();
+
     for (auto texture : textures) {
         glDeleteTextures(1, &texture.second);
     }
@@ -346,6 +787,8 @@ void AssetManager::deleteAssets() {
         glDeleteProgram(program.second);
     }
     shaderPrograms.clear();
+    programUniforms.clear();
+    shaderSources.clear();
 }
 
 void AssetManager::checkShaderErrors(unsigned int shader, std::string type) {
@@ -0,0 +1,32 @@
+// -----------------------------------------------------------------------------
+// Onset Engine
+// https://github.com/dylanafterall/OnsetEngine.git
+//
+// core_frame_snapshot.cpp
+//  implementation: triple buffer of render state snapshots
+// -----------------------------------------------------------------------------
+
+#include "core_frame_snapshot.h"
+
+FrameSnapshot& FrameSnapshotBuffer::getWriteSnapshot() {
+    return m_snapshots[m_writeIndex];
+}
+
+void FrameSnapshotBuffer::publish() {
+    // release: the reader must see the snapshot's contents after swapping
+    unsigned int previous = m_middleIndex.exchange(m_writeIndex | FRESH_BIT, std::memory_order_acq_rel);
+    m_writeIndex = previous & INDEX_MASK;
+}
+
+const FrameSnapshot& FrameSnapshotBuffer::acquire() {
+    if (m_middleIndex.load(std::memory_order_relaxed) & FRESH_BIT) {
+        unsigned int previous = m_middleIndex.exchange(m_readIndex, std::memory_order_acq_rel);
+        m_readIndex = previous & INDEX_MASK;
+    }
+
+    return m_snapshots[m_readIndex];
+}
+
+const FrameSnapshot& FrameSnapshotBuffer::getReadSnapshot() const {
+    return m_snapshots[m_readIndex];
+}
@@ -0,0 +1,116 @@
+// -----------------------------------------------------------------------------
+// Onset Engine
+// https://github.com/dylanafterall/OnsetEngine.git
+//
+// core_frustum_culler.cpp
+//  implementation of FrustumCuller class
+// -----------------------------------------------------------------------------
+
+#include "core_frustum_culler.h"
+#include "core_profile_macros.h"
+
+#include <limits>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define ONSET_FRUSTUM_SSE
+#endif
+
+// spheres tested together
+static const std::size_t CULL_WIDTH = 4;
+
+void FrustumCuller::setFrustum(const glm::mat4& viewProjection) {
+    // glm is column major, row i of the matrix is m[0][i] ... m[3][i]
+    glm::vec4 rows[4];
+    for (int i = 0; i < 4; i++) {
+        rows[i] = glm::vec4(viewProjection[0][i], viewProjection[1][i], viewProjection[2][i], viewProjection[3][i]);
+    }
+    m_planes[0] = rows[3] + rows[0];
+    m_planes[1] = rows[3] - rows[0];
+    m_planes[2] = rows[3] + rows[1];
+    m_planes[3] = rows[3] - rows[1];
+    m_planes[4] = rows[3] + rows[2];
+    m_planes[5] = rows[3] - rows[2];
+    for (glm::vec4& plane : m_planes) {
+        float length = glm::length(glm::vec3(plane));
+        if (length > 0.0f) {
+            plane /= length;
+        }
+    }
+}
+
+void FrustumCuller::clear() {
+    m_centerX.clear();
+    m_centerY.clear();
+    m_centerZ.clear();
+    m_radius.clear();
+    m_count = 0;
+    m_visible.clear();
+}
+
+std::uint32_t FrustumCuller::addSphere(const glm::vec3& center, float radius) {
+    m_centerX.push_back(center.x);
+    m_centerY.push_back(center.y);
+    m_centerZ.push_back(center.z);
+    m_radius.push_back(radius);
+    return static_cast<std::uint32_t>(m_count++);
+}
+
+void FrustumCuller::cull() {
+    ONSET_PROFILE_SCOPE("FrustumCuller::cull");
+    m_visible.clear();
+
+    // pad to whole groups with spheres of radius -infinity, inside no plane
+    std::size_t padded = (m_count + CULL_WIDTH - 1) / CULL_WIDTH * CULL_WIDTH;
+    m_centerX.resize(padded, 0.0f);
+    m_centerY.resize(padded, 0.0f);
+    m_centerZ.resize(padded, 0.0f);
+    m_radius.resize(padded, -std::numeric_limits<float>::infinity());
+
+    // a sphere is out if it lies entirely behind any plane: distance < -radius
+    for (std::size_t i = 0; i < padded; i += CULL_WIDTH) {
+#if defined(ONSET_FRUSTUM_SSE)
+        __m128 x = _mm_loadu_ps(&m_centerX[i]);
+        __m128 y = _mm_loadu_ps(&m_centerY[i]);
+        __m128 z = _mm_loadu_ps(&m_centerZ[i]);
+        __m128 negativeRadius = _mm_sub_ps(_mm_setzero_ps(), _mm_loadu_ps(&m_radius[i]));
+        __m128 inside = _mm_cmpeq_ps(_mm_setzero_ps(), _mm_setzero_ps());
+        for (const glm::vec4& plane : m_planes) {
+            __m128 distance = _mm_add_ps(
+                _mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(plane.x)), _mm_mul_ps(y, _mm_set1_ps(plane.y))),
+                _mm_add_ps(_mm_mul_ps(z, _mm_set1_ps(plane.z)), _mm_set1_ps(plane.w))
+            );
+            inside = _mm_and_ps(inside, _mm_cmpge_ps(distance, negativeRadius));
+        }
+        int mask = _mm_movemask_ps(inside);
+#else
+        int mask = 0;
+        for (std::size_t j = 0; j < CULL_WIDTH; j++) {
+            bool inside = true;
+            for (const glm::vec4& plane : m_planes) {
+                float distance = plane.x * m_centerX[i + j] + plane.y * m_centerY[i + j] + plane.z * m_centerZ[i + j] + plane.w;
+                inside = inside && distance >= -m_radius[i + j];
+            }
+            mask |= inside ? (1 << j) : 0;
+        }
+#endif
+        for (std::size_t j = 0; mask != 0; j++, mask >>= 1) {
+            if (mask & 1) {
+                m_visible.push_back(static_cast<std::uint32_t>(i + j));
+            }
+        }
+    }
+
+    m_centerX.resize(m_count);
+    m_centerY.resize(m_count);
+    m_centerZ.resize(m_count);
+    m_radius.resize(m_count);
+}
+
+const std::vector<std::uint32_t>& FrustumCuller::getVisible() const {
+    return m_visible;
+}
+
+std::size_t FrustumCuller::getCount() const {
+    return m_count;
+}
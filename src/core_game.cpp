@@ -27,18 +27,27 @@ void Game::initialize() {
     ONSET_INFO("CONFIGURATION: RELEASE");
 #endif
 
-    m_windowManager = std::make_unique<WindowManager>();
-    m_windowManager->initialize(m_screenWidth, m_screenHeight);
-
-    // event handling
-    // -------------------------------------------------------------------------
-    m_inputInvoker = std::make_unique<InputInvoker>();
-    m_inputInvoker->initialize(
-        m_windowManager->m_glfwWindow, 
-        &m_dispatcher,
-        m_screenWidth, 
-        m_screenHeight
-    );
+    // before the job manager, so worker threads get named in the trace
+    m_profileManager.initialize();
+    ONSET_PROFILE_THREAD("main");
+    m_jobManager.initialize();
+
+    // headless runs have no window, GL context or user input
+    if (m_runMode != headless) {
+        m_windowManager = std::make_unique<WindowManager>();
+        m_windowManager->initialize(m_screenWidth, m_screenHeight);
+
+        // event handling
+        // ---------------------------------------------------------------------
+        m_inputInvoker = std::make_unique<InputInvoker>();
+        m_inputInvoker->initialize(
+            m_windowManager->m_glfwWindow, 
+            &m_dispatcher,
+            m_screenWidth, 
+            m_screenHeight
+        );
+        m_inputInvoker->setDispatcherMutex(&m_dispatcherMutex);
+    }
 
     // system handling
     // -------------------------------------------------------------------------
@@ -48,30 +57,45 @@ void Game::initialize() {
     m_collisionSystem.setRegistry(&m_registry);
     m_collisionSystem.setDispatcher(&m_dispatcher);
     m_playerMovementSystem.setRegistry(&m_registry);
-    m_renderSystem.setWindowPointer(m_windowManager->m_glfwWindow);
+    if (m_runMode != headless) {
+        m_renderSystem.setWindowPointer(m_windowManager->m_glfwWindow);
+        m_gpuProfileManager.initialize();
+        m_renderSystem.setGpuProfileManager(&m_gpuProfileManager);
+        m_renderSystem.setAssetManager(&m_assetManager);
+        m_renderSystem.createUniformBuffers();
+    }
+    m_renderSystem.setHeadless(m_runMode == headless);
     m_renderSystem.setGammaFlag(true);
     m_renderSystem.setShadowResolution(m_shadowWidth, m_shadowHeight);
     m_selectModeSystem.setRegistry(&m_registry);
+    m_transformSystem.setRegistry(&m_registry);
+    m_transformSystem.setJobManager(&m_jobManager);
+    m_snapshotSystem.setRegistry(&m_registry);
+
+    // level loading
+    // -------------------------------------------------------------------------
+    m_sceneManager.initialize(
+        &m_registry,
+        m_world.get(),
+        &m_renderSystem,
+        &m_assetManager,
+        &m_audioManager,
+        &m_textManager
+    );
 }
 
 void Game::setup() {
+    setup([this]() {
+        m_sceneManager.loadScene(m_scenePath);
+    });
+}
+
+void Game::setup(const std::function<void()>& createLevel) {
     // _________________________________________________________________________
     // -------------------------------------------------------------------------
     // Assets
     // _________________________________________________________________________
     // -------------------------------------------------------------------------
-    // meshes
-    // .........................................................................
-    MeshCubeComponent cubeMesh;
-    MeshSphereComponent sphereMesh;
-    MeshGroundComponent groundMesh;
-    MeshSpriteComponent spriteMesh;
-    MeshSkyboxComponent skyboxMesh;
-
-    // fonts 
-    // .........................................................................
-    m_textManager.initialize("../assets/fonts/Meslo/MesloLG_M_Regular_Nerd_Font_Complete_Mono.ttf");
-
     // audio
     // .........................................................................
     m_audioManager.setSoundEffect("button1", "../assets/audio/StumpyStrust/button1.ogg");
@@ -80,6 +104,83 @@ void Game::setup() {
     m_audioManager.setSoundEffect("off", "../assets/audio/StumpyStrust/off.ogg");
     m_audioManager.setSoundEffect("on", "../assets/audio/StumpyStrust/on.ogg");
 
+    // shaders, textures and fonts
+    // .........................................................................
+    // no GL context to upload to when headless, components keep ID 0
+    if (m_runMode != headless) {
+        loadGraphicsAssets();
+    }
+
+    // _________________________________________________________________________
+    // -------------------------------------------------------------------------
+    // EnTT
+    // _________________________________________________________________________
+    // -------------------------------------------------------------------------
+    // event dispatcher setup
+    // .........................................................................
+    m_dispatcher.sink<LeftCommand>().connect<&PlayerMovementSystem::movePlayerLeft>(m_playerMovementSystem);
+    m_dispatcher.sink<RightCommand>().connect<&PlayerMovementSystem::movePlayerRight>(m_playerMovementSystem);
+    m_dispatcher.sink<UpCommand>().connect<&PlayerMovementSystem::movePlayerUp>(m_playerMovementSystem);
+    m_dispatcher.sink<DownCommand>().connect<&PlayerMovementSystem::movePlayerDown>(m_playerMovementSystem);
+
+    m_dispatcher.sink<CameraLeftCommand>().connect<&CameraSystem::translateCameraLeft>(m_cameraSystem);
+    m_dispatcher.sink<CameraRightCommand>().connect<&CameraSystem::translateCameraRight>(m_cameraSystem);
+    m_dispatcher.sink<CameraUpCommand>().connect<&CameraSystem::translateCameraUp>(m_cameraSystem);
+    m_dispatcher.sink<CameraDownCommand>().connect<&CameraSystem::translateCameraDown>(m_cameraSystem);
+    m_dispatcher.sink<CameraForwardCommand>().connect<&CameraSystem::translateCameraForward>(m_cameraSystem);
+    m_dispatcher.sink<CameraBackwardCommand>().connect<&CameraSystem::translateCameraBackward>(m_cameraSystem);
+    m_dispatcher.sink<CameraZoomInCommand>().connect<&CameraSystem::zoomCameraIn>(m_cameraSystem);
+    m_dispatcher.sink<CameraZoomOutCommand>().connect<&CameraSystem::zoomCameraOut>(m_cameraSystem);
+    m_dispatcher.sink<CameraPitchUpCommand>().connect<&CameraSystem::pitchCameraUp>(m_cameraSystem);
+    m_dispatcher.sink<CameraPitchDownCommand>().connect<&CameraSystem::pitchCameraDown>(m_cameraSystem);
+    m_dispatcher.sink<CameraYawLeftCommand>().connect<&CameraSystem::yawCameraLeft>(m_cameraSystem);
+    m_dispatcher.sink<CameraYawRightCommand>().connect<&CameraSystem::yawCameraRight>(m_cameraSystem);
+
+    m_dispatcher.sink<SelectedLeftCommand>().connect<&SelectModeSystem::moveSelectedLeft>(m_selectModeSystem);
+    m_dispatcher.sink<SelectedRightCommand>().connect<&SelectModeSystem::moveSelectedRight>(m_selectModeSystem);
+    m_dispatcher.sink<SelectedUpCommand>().connect<&SelectModeSystem::moveSelectedUp>(m_selectModeSystem);
+    m_dispatcher.sink<SelectedDownCommand>().connect<&SelectModeSystem::moveSelectedDown>(m_selectModeSystem);
+    m_dispatcher.sink<ToggleSelectModeCommand>().connect<&SelectModeSystem::toggleSelectMode>(m_selectModeSystem);
+
+    m_dispatcher.sink<DumpProfileCommand>().connect<&ProfileManager::handleDumpCommand>(m_profileManager);
+
+    m_dispatcher.sink<ToggleSelectModeAudioEvent>().connect<&AudioSystem::playSelectModeToggleSound>(m_audioSystem);
+
+    // input record and replay, after the sinks above so a replay dispatches
+    // commands in the recorded order
+    // .........................................................................
+    m_inputRecorder.connect(m_dispatcher);
+    m_inputRecorder.setInputInvoker(m_inputInvoker.get());
+    if (!m_inputRecordPath.empty()) {
+        m_inputRecorder.startRecording(m_inputRecordPath);
+    }
+    if (!m_inputReplayPath.empty()) {
+        m_inputRecorder.startReplay(m_inputReplayPath);
+    }
+
+    // level entities
+    // .........................................................................
+    createLevel();
+
+    // jobs of every fixed step
+    // .........................................................................
+    buildUpdateGraph();
+
+    // fill transforms and a snapshot before the first frame is drawn. update
+    // twice, so the previous transforms also hold the spawn position rather
+    // than interpolating the first frame from the origin
+    m_transformSystem.update();
+    m_transformSystem.update();
+    if (m_runMode != headless) {
+        publishSnapshot(glfwGetTime());
+    }
+}
+
+void Game::loadGraphicsAssets() {
+    // fonts 
+    // .........................................................................
+    m_textManager.initialize("../assets/fonts/Meslo/MesloLG_M_Regular_Nerd_Font_Complete_Mono.ttf");
+
     // shaders
     // .........................................................................
     m_assetManager.setVShader("solid_color_vert", "../assets/shaders/solid_color.vert");
@@ -142,12 +243,10 @@ void Game::setup() {
     glUniform1i(glGetUniformLocation(m_assetManager.getShaderProgram("basic_lighting"), "material.diffuse"), 0); 
     glUniform1i(glGetUniformLocation(m_assetManager.getShaderProgram("basic_lighting"), "material.specular"), 1);
     glUniform1i(glGetUniformLocation(m_assetManager.getShaderProgram("basic_lighting"), "material.normal"), 2);
-    glUniform1i(glGetUniformLocation(m_assetManager.getShaderProgram("basic_lighting"), "spotLights[0].depthTex"), 3);
-    glUniform1i(glGetUniformLocation(m_assetManager.getShaderProgram("basic_lighting"), "spotLights[1].depthTex"), 4);
-    glUniform1i(glGetUniformLocation(m_assetManager.getShaderProgram("basic_lighting"), "spotLights[2].depthTex"), 5);
-    glUniform1i(glGetUniformLocation(m_assetManager.getShaderProgram("basic_lighting"), "pointLights[0].depthCube"), 6);
-    glUniform1i(glGetUniformLocation(m_assetManager.getShaderProgram("basic_lighting"), "pointLights[1].depthCube"), 7);
-    glUniform1i(glGetUniformLocation(m_assetManager.getShaderProgram("basic_lighting"), "pointLights[2].depthCube"), 8);
+    glUniform1i(glGetUniformLocation(m_assetManager.getShaderProgram("basic_lighting"), "spotShadowAtlas"), 3);
+    glUniform1i(glGetUniformLocation(m_assetManager.getShaderProgram("basic_lighting"), "pointShadowMaps[0]"), 6);
+    glUniform1i(glGetUniformLocation(m_assetManager.getShaderProgram("basic_lighting"), "pointShadowMaps[1]"), 7);
+    glUniform1i(glGetUniformLocation(m_assetManager.getShaderProgram("basic_lighting"), "pointShadowMaps[2]"), 8);
     glUseProgram(m_assetManager.getShaderProgram("text"));
     glm::mat4 textProjection = glm::ortho(0.0f, static_cast<float>(m_screenWidth), 0.0f, static_cast<float>(m_screenHeight));
     glUniformMatrix4fv(glGetUniformLocation(m_assetManager.getShaderProgram("text"), "projection"), 1, GL_FALSE, glm::value_ptr(textProjection));
@@ -155,26 +254,28 @@ void Game::setup() {
     glUniform1i(glGetUniformLocation(m_assetManager.getShaderProgram("shadow_framebuffer"), "depthMap"), 0); 
     glUniform1f(glGetUniformLocation(m_assetManager.getShaderProgram("shadow_framebuffer"), "near_plane"), 1.0f);
     glUniform1f(glGetUniformLocation(m_assetManager.getShaderProgram("shadow_framebuffer"), "far_plane"), 15.0f);
+    glUseProgram(m_assetManager.getShaderProgram("skybox"));
+    glUniform1i(glGetUniformLocation(m_assetManager.getShaderProgram("skybox"), "skybox"), 11);
 
-    // texture maps
+    // texture maps, queued to load as one batch with the skybox
     // .........................................................................
-    m_assetManager.setTexture("tiles_diff", "../assets/textures/black-white-tile_albedo.png", true, true);
-    m_assetManager.setTexture("tiles_spec", "../assets/textures/black-white-tile_metallic.png", true, false);
-    m_assetManager.setTexture("tiles_norm", "../assets/textures/black-white-tile_normal-ogl.png", true, false);
-    m_assetManager.setTexture("rusted_diff", "../assets/textures/rusted-steel_albedo.png", true, true);
-    m_assetManager.setTexture("rusted_spec", "../assets/textures/rusted-steel_metallic.png", true, false);
-    m_assetManager.setTexture("rusted_norm", "../assets/textures/rusted-steel_normal-ogl.png", true, false);
-    m_assetManager.setTexture("blocks_diff", "../assets/textures/angled-blocks-vegetation_albedo.png", true, true);
-    m_assetManager.setTexture("blocks_spec", "../assets/textures/angled-blocks-vegetation_metallic.png", true, false);
-    m_assetManager.setTexture("blocks_norm", "../assets/textures/angled-blocks-vegetation_normal-ogl.png", true, false);
-    m_assetManager.setTexture("metal_diff", "../assets/textures/dull_metal_albedo.png", true, true);
-    m_assetManager.setTexture("metal_spec", "../assets/textures/dull_metal_metallic.png", true, false);
-    m_assetManager.setTexture("metal_norm", "../assets/textures/dull_metal_normal-ogl.png", true, false);
-    m_assetManager.setTexture("gold_diff", "../assets/textures/lightgold_albedo.png", true, true);
-    m_assetManager.setTexture("gold_spec", "../assets/textures/lightgold_metallic.png", true, false);
-    m_assetManager.setTexture("gold_norm", "../assets/textures/lightgold_normal-ogl.png", true, false);
-    m_assetManager.setTexture("blending", "../assets/textures/blending_transparent_window.png", false, true);
-    m_assetManager.setTexture("white", "../assets/textures/white.jpg", true, true);
+    m_assetManager.queueTexture("tiles_diff", "../assets/textures/black-white-tile_albedo.png", true, true);
+    m_assetManager.queueTexture("tiles_spec", "../assets/textures/black-white-tile_metallic.png", true, false);
+    m_assetManager.queueTexture("tiles_norm", "../assets/textures/black-white-tile_normal-ogl.png", true, false);
+    m_assetManager.queueTexture("rusted_diff", "../assets/textures/rusted-steel_albedo.png", true, true);
+    m_assetManager.queueTexture("rusted_spec", "../assets/textures/rusted-steel_metallic.png", true, false);
+    m_assetManager.queueTexture("rusted_norm", "../assets/textures/rusted-steel_normal-ogl.png", true, false);
+    m_assetManager.queueTexture("blocks_diff", "../assets/textures/angled-blocks-vegetation_albedo.png", true, true);
+    m_assetManager.queueTexture("blocks_spec", "../assets/textures/angled-blocks-vegetation_metallic.png", true, false);
+    m_assetManager.queueTexture("blocks_norm", "../assets/textures/angled-blocks-vegetation_normal-ogl.png", true, false);
+    m_assetManager.queueTexture("metal_diff", "../assets/textures/dull_metal_albedo.png", true, true);
+    m_assetManager.queueTexture("metal_spec", "../assets/textures/dull_metal_metallic.png", true, false);
+    m_assetManager.queueTexture("metal_norm", "../assets/textures/dull_metal_normal-ogl.png", true, false);
+    m_assetManager.queueTexture("gold_diff", "../assets/textures/lightgold_albedo.png", true, true);
+    m_assetManager.queueTexture("gold_spec", "../assets/textures/lightgold_metallic.png", true, false);
+    m_assetManager.queueTexture("gold_norm", "../assets/textures/lightgold_normal-ogl.png", true, false);
+    m_assetManager.queueTexture("blending", "../assets/textures/blending_transparent_window.png", false, true);
+    m_assetManager.queueTexture("white", "../assets/textures/white.jpg", true, true);
 
     // skybox maps
     // .........................................................................
@@ -186,984 +287,38 @@ void Game::setup() {
         "../assets/textures/skybox/front.jpg",
         "../assets/textures/skybox/back.jpg",
     };
-    m_assetManager.setCubemap("learnopengl_skybox", learnopenglFaces, true);
-
-    // _________________________________________________________________________
-    // -------------------------------------------------------------------------
-    // EnTT
-    // _________________________________________________________________________
-    // -------------------------------------------------------------------------
-    // event dispatcher setup
-    // .........................................................................
-    m_dispatcher.sink<LeftCommand>().connect<&PlayerMovementSystem::movePlayerLeft>(m_playerMovementSystem);
-    m_dispatcher.sink<RightCommand>().connect<&PlayerMovementSystem::movePlayerRight>(m_playerMovementSystem);
-    m_dispatcher.sink<UpCommand>().connect<&PlayerMovementSystem::movePlayerUp>(m_playerMovementSystem);
-    m_dispatcher.sink<DownCommand>().connect<&PlayerMovementSystem::movePlayerDown>(m_playerMovementSystem);
+    m_assetManager.queueCubemap("learnopengl_skybox", learnopenglFaces, true);
 
-    m_dispatcher.sink<CameraLeftCommand>().connect<&CameraSystem::translateCameraLeft>(m_cameraSystem);
-    m_dispatcher.sink<CameraRightCommand>().connect<&CameraSystem::translateCameraRight>(m_cameraSystem);
-    m_dispatcher.sink<CameraUpCommand>().connect<&CameraSystem::translateCameraUp>(m_cameraSystem);
-    m_dispatcher.sink<CameraDownCommand>().connect<&CameraSystem::translateCameraDown>(m_cameraSystem);
-    m_dispatcher.sink<CameraForwardCommand>().connect<&CameraSystem::translateCameraForward>(m_cameraSystem);
-    m_dispatcher.sink<CameraBackwardCommand>().connect<&CameraSystem::translateCameraBackward>(m_cameraSystem);
-    m_dispatcher.sink<CameraZoomInCommand>().connect<&CameraSystem::zoomCameraIn>(m_cameraSystem);
-    m_dispatcher.sink<CameraZoomOutCommand>().connect<&CameraSystem::zoomCameraOut>(m_cameraSystem);
-    m_dispatcher.sink<CameraPitchUpCommand>().connect<&CameraSystem::pitchCameraUp>(m_cameraSystem);
-    m_dispatcher.sink<CameraPitchDownCommand>().connect<&CameraSystem::pitchCameraDown>(m_cameraSystem);
-    m_dispatcher.sink<CameraYawLeftCommand>().connect<&CameraSystem::yawCameraLeft>(m_cameraSystem);
-    m_dispatcher.sink<CameraYawRightCommand>().connect<&CameraSystem::yawCameraRight>(m_cameraSystem);
+    // hand textures to the streamer if streaming, then decode every image
+    // left in the queue across the workers, uploading as they finish
+    if (m_streamTextures) {
+        m_assetManager.streamQueuedTextures();
+    }
+    m_assetManager.loadQueuedTextures(m_jobManager);
+}
 
-    m_dispatcher.sink<SelectedLeftCommand>().connect<&SelectModeSystem::moveSelectedLeft>(m_selectModeSystem);
-    m_dispatcher.sink<SelectedRightCommand>().connect<&SelectModeSystem::moveSelectedRight>(m_selectModeSystem);
-    m_dispatcher.sink<SelectedUpCommand>().connect<&SelectModeSystem::moveSelectedUp>(m_selectModeSystem);
-    m_dispatcher.sink<SelectedDownCommand>().connect<&SelectModeSystem::moveSelectedDown>(m_selectModeSystem);
-    m_dispatcher.sink<ToggleSelectModeCommand>().connect<&SelectModeSystem::toggleSelectMode>(m_selectModeSystem);
+void Game::setRunMode(RunMode runMode) {
+    m_runMode = runMode;
+}
 
-    m_dispatcher.sink<ToggleSelectModeAudioEvent>().connect<&AudioSystem::playSelectModeToggleSound>(m_audioSystem);
+void Game::setHeadlessSteps(unsigned int headlessSteps) {
+    m_headlessSteps = headlessSteps;
+}
 
-    // camera entity
-    // .........................................................................
-    // setup components
-    CameraComponent camera(glm::vec3(0.0f, 0.0f, 20.0f));
-    camera.m_type = first;
+void Game::setInputRecordPath(const std::string& path) {
+    m_inputRecordPath = path;
+}
 
-    // skybox entity
-    // .........................................................................
-    SkyboxComponent skyboxSkybox;
-    TextureComponent skyboxTexture;
-    ShaderProgramComponent skyboxShaderProgram;
-    RenderDataComponent skyboxGraphics;
-    skyboxTexture.m_cubemap = m_assetManager.getCubemap("learnopengl_skybox");
-    skyboxShaderProgram.m_outputProgram = m_assetManager.getShaderProgram("skybox");
-    skyboxGraphics.m_vertexCount = cubeMesh.m_vertexCount;
-    // setup OpenGL data
-    glGenVertexArrays(1, &skyboxGraphics.m_VAO);
-    glGenBuffers(1, &skyboxGraphics.m_VBO);
-    glBindVertexArray(skyboxGraphics.m_VAO);
-    glBindBuffer(GL_ARRAY_BUFFER, skyboxGraphics.m_VBO);
-    glBufferData(GL_ARRAY_BUFFER, skyboxMesh.m_verticesSize, skyboxMesh.m_vertices, GL_STATIC_DRAW);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-    glUseProgram(skyboxShaderProgram.m_outputProgram);
-    glUniform1i(glGetUniformLocation(skyboxShaderProgram.m_outputProgram, "skybox"), 11);
-
-    // sun entity (pointed down, white light)
-    // .........................................................................
-    // setup components
-    LightComponent sunLight;
-    BodyTransformComponent sunTransform;
-    ShaderProgramComponent sunShaderProgram;
-    RenderDataComponent sunGraphics;
-    ShadowFramebufferComponent sunShadow;
-    sunLight.m_type = 0;                                   // directional type
-    sunLight.m_direction = glm::vec3(0.0f, -1.0f, 0.0f);   // pointed down
-    sunLight.m_ambient = glm::vec3(0.15f, 0.15f, 0.15f);      // white ambient
-    sunLight.m_diffuse = glm::vec3(0.15f, 0.15f, 0.15f);      // white diffuse
-    sunLight.m_specular = glm::vec3(0.15f, 0.15f, 0.15f);     // white specular
-    sunShaderProgram.m_lightProgram = m_assetManager.getShaderProgram("basic_lighting");
-    // setup shadow mapping
-    sunShadow.m_type = 0; // no shadow casting
-
-    // redOrb entity (dynamic point source, red light)
-    // .........................................................................
-    // setup components
-    LightComponent redOrbLight;
-    BodyTransformComponent redOrbTransform;
-    BodyCircleComponent redOrbCircle;
-    AudioDataComponent redOrbAudio;
-    ShaderProgramComponent redOrbShaderProgram;
-    RenderDataComponent redOrbGraphics;
-    FixtureUserDataComponent redOrbUserData;
-    ShadowFramebufferComponent redOrbShadow;
-    redOrbLight.m_type = 1;                                  // point type 
-    redOrbLight.m_scale = glm::vec3(1.0f, 1.0f, 1.0f);       // check Box2D size
-    redOrbLight.m_constant = 1.0f;
-    redOrbLight.m_linear = 0.14f;
-    redOrbLight.m_quadratic = 0.07f;
-    redOrbLight.m_ambient = glm::vec3(0.0f, 0.0f, 0.0f);     // red ambient
-    redOrbLight.m_diffuse = glm::vec3(1.0f, 0.0f, 0.0f);     // red diffuse
-    redOrbLight.m_specular = glm::vec3(1.0f, 0.0f, 0.0f);    // red specular
-    alGenSources(1, &redOrbAudio.m_soundSource);
-    redOrbAudio.m_collisionSound.m_soundBuffer = m_audioManager.getSoundEffect("button2");
-    redOrbAudio.m_collisionSound.m_pitch = 1.0f;
-    redOrbAudio.m_collisionSound.m_gain = 1.0f;
-    redOrbAudio.m_collisionSound.m_loop = false;
-    redOrbShaderProgram.m_outputProgram = m_assetManager.getShaderProgram("solid_color");
-    redOrbShaderProgram.m_lightProgram = m_assetManager.getShaderProgram("basic_lighting");
-    redOrbShaderProgram.m_shadowProgram = m_assetManager.getShaderProgram("shadow_depth_cube");
-    redOrbGraphics.m_vertexCount = sphereMesh.m_vertexCount;
-    // setup Box2D data
-    redOrbUserData.m_fixtureType = 1;
-    redOrbCircle.m_bodyDef.type = b2_dynamicBody;
-    redOrbCircle.m_bodyDef.position.Set(10.0f, 5.0f);
-    redOrbTransform.m_body = m_world->CreateBody(&redOrbCircle.m_bodyDef);
-    redOrbCircle.m_circleShape.m_p.Set(0.0f, 0.0f);
-    redOrbCircle.m_circleShape.m_radius = 1.0f;
-    redOrbCircle.m_fixtureDef.shape = &redOrbCircle.m_circleShape;
-    redOrbCircle.m_fixtureDef.density = 1.0f;
-    redOrbCircle.m_fixtureDef.friction = 0.3f;
-    redOrbCircle.m_fixtureDef.userData.pointer = reinterpret_cast<uintptr_t>(&redOrbUserData);
-    redOrbTransform.m_body->CreateFixture(&redOrbCircle.m_fixtureDef);
-    // setup OpenGL data
-    glGenVertexArrays(1, &redOrbGraphics.m_VAO);
-    glGenBuffers(1, &redOrbGraphics.m_VBO);
-    glBindVertexArray(redOrbGraphics.m_VAO);
-    glBindBuffer(GL_ARRAY_BUFFER, redOrbGraphics.m_VBO);
-    glBufferData(GL_ARRAY_BUFFER, sphereMesh.m_verticesSize, sphereMesh.m_vertices, GL_STATIC_DRAW);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-    // setup shadow mapping
-    redOrbShadow.m_type = 2; // omnidirectional shadow casting
-    redOrbShadow.m_index = 0;
-    redOrbShadow.m_nearPlane = 1.0f;
-    redOrbShadow.m_farPlane = 32.0f;
-    glGenFramebuffers(1, &redOrbShadow.m_shadowFramebuffer);
-    glGenTextures(1, &redOrbShadow.m_depthCubemap);
-    glBindTexture(GL_TEXTURE_CUBE_MAP, redOrbShadow.m_depthCubemap);
-    for (unsigned int i = 0; i < 6; ++i) {
-        glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, GL_DEPTH_COMPONENT, m_shadowWidth, m_shadowHeight, 0, GL_DEPTH_COMPONENT, GL_FLOAT, NULL);
-    }
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
-    // attach depth texture as FBO's depth buffer
-    glBindFramebuffer(GL_FRAMEBUFFER, redOrbShadow.m_shadowFramebuffer);
-    glFramebufferTexture(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, redOrbShadow.m_depthCubemap, 0);
-    glDrawBuffer(GL_NONE);
-    glReadBuffer(GL_NONE);
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
-
-    // greenOrb entity (dynamic point source, green light)
-    // .........................................................................
-    // setup components
-    LightComponent greenOrbLight;
-    BodyTransformComponent greenOrbTransform;
-    BodyCircleComponent greenOrbCircle;
-    AudioDataComponent greenOrbAudio;
-    ShaderProgramComponent greenOrbShaderProgram;
-    RenderDataComponent greenOrbGraphics;
-    FixtureUserDataComponent greenOrbUserData;
-    ShadowFramebufferComponent greenOrbShadow;
-    greenOrbLight.m_type = 1;                                 // point type
-    greenOrbLight.m_scale = glm::vec3(1.0f, 1.0f, 1.0f);      // check Box2D
-    greenOrbLight.m_constant = 1.0f;
-    greenOrbLight.m_linear = 0.14f;
-    greenOrbLight.m_quadratic = 0.07f;
-    greenOrbLight.m_ambient = glm::vec3(0.0f, 0.0f, 0.0f);    // green ambient
-    greenOrbLight.m_diffuse = glm::vec3(0.0f, 1.0f, 0.0f);    // green diffuse
-    greenOrbLight.m_specular = glm::vec3(0.0f, 1.0f, 0.0f);   // green specular
-    alGenSources(1, &greenOrbAudio.m_soundSource);
-    greenOrbAudio.m_collisionSound.m_soundBuffer = m_audioManager.getSoundEffect("button2");
-    greenOrbAudio.m_collisionSound.m_pitch = 1.0f;
-    greenOrbAudio.m_collisionSound.m_gain = 1.0f;
-    greenOrbAudio.m_collisionSound.m_loop = false;
-    greenOrbShaderProgram.m_outputProgram = m_assetManager.getShaderProgram("solid_color");
-    greenOrbShaderProgram.m_lightProgram = m_assetManager.getShaderProgram("basic_lighting");
-    greenOrbShaderProgram.m_shadowProgram = m_assetManager.getShaderProgram("shadow_depth_cube");
-    greenOrbGraphics.m_vertexCount = sphereMesh.m_vertexCount;
-    // setup Box2D data
-    greenOrbUserData.m_fixtureType = 1;
-    greenOrbCircle.m_bodyDef.type = b2_dynamicBody;
-    greenOrbCircle.m_bodyDef.position.Set(25.0f, 5.0f);
-    greenOrbTransform.m_body = m_world->CreateBody(&greenOrbCircle.m_bodyDef);
-    greenOrbCircle.m_circleShape.m_p.Set(0.0f, 0.0f);
-    greenOrbCircle.m_circleShape.m_radius = 1.0f;
-    greenOrbCircle.m_fixtureDef.shape = &greenOrbCircle.m_circleShape;
-    greenOrbCircle.m_fixtureDef.density = 1.0f;
-    greenOrbCircle.m_fixtureDef.friction = 0.3f;
-    greenOrbCircle.m_fixtureDef.userData.pointer = reinterpret_cast<uintptr_t>(&greenOrbUserData);
-    greenOrbTransform.m_body->CreateFixture(&greenOrbCircle.m_fixtureDef);
-    // setup OpenGL data
-    glGenVertexArrays(1, &greenOrbGraphics.m_VAO);
-    glGenBuffers(1, &greenOrbGraphics.m_VBO);
-    glBindVertexArray(greenOrbGraphics.m_VAO);
-    glBindBuffer(GL_ARRAY_BUFFER, greenOrbGraphics.m_VBO);
-    glBufferData(GL_ARRAY_BUFFER, sphereMesh.m_verticesSize, sphereMesh.m_vertices, GL_STATIC_DRAW);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-    // setup shadow mapping
-    greenOrbShadow.m_type = 2; // omnidirectional shadow casting
-    greenOrbShadow.m_index = 1;
-    greenOrbShadow.m_nearPlane = 1.0f;
-    greenOrbShadow.m_farPlane = 32.0f;
-    glGenFramebuffers(1, &greenOrbShadow.m_shadowFramebuffer);
-    glGenTextures(1, &greenOrbShadow.m_depthCubemap);
-    glBindTexture(GL_TEXTURE_CUBE_MAP, greenOrbShadow.m_depthCubemap);
-    for (unsigned int i = 0; i < 6; ++i) {
-        glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, GL_DEPTH_COMPONENT, m_shadowWidth, m_shadowHeight, 0, GL_DEPTH_COMPONENT, GL_FLOAT, NULL);
-    }
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
-    // attach depth texture as FBO's depth buffer
-    glBindFramebuffer(GL_FRAMEBUFFER, greenOrbShadow.m_shadowFramebuffer);
-    glFramebufferTexture(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, greenOrbShadow.m_depthCubemap, 0);
-    glDrawBuffer(GL_NONE);
-    glReadBuffer(GL_NONE);
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
-
-    // blueOrb entity (dynamic point source, blue light)
-    // .........................................................................
-    // setup components
-    LightComponent blueOrbLight;
-    BodyTransformComponent blueOrbTransform;
-    BodyCircleComponent blueOrbCircle;
-    AudioDataComponent blueOrbAudio;
-    ShaderProgramComponent blueOrbShaderProgram;
-    RenderDataComponent blueOrbGraphics;
-    FixtureUserDataComponent blueOrbUserData;
-    ShadowFramebufferComponent blueOrbShadow;
-    blueOrbLight.m_type = 1;                                  // point type 
-    blueOrbLight.m_scale = glm::vec3(1.0f, 1.0f, 1.0f);       // check Box2D size
-    blueOrbLight.m_constant = 1.0f;
-    blueOrbLight.m_linear = 0.14f;
-    blueOrbLight.m_quadratic = 0.07f;
-    blueOrbLight.m_ambient = glm::vec3(0.0f, 0.0f, 0.0f);     // blue ambient
-    blueOrbLight.m_diffuse = glm::vec3(0.0f, 0.0f, 1.0f);     // blue diffuse
-    blueOrbLight.m_specular = glm::vec3(0.0f, 0.0f, 1.0f);    // blue specular
-    alGenSources(1, &blueOrbAudio.m_soundSource);
-    blueOrbAudio.m_collisionSound.m_soundBuffer = m_audioManager.getSoundEffect("button2");
-    blueOrbAudio.m_collisionSound.m_pitch = 1.0f;
-    blueOrbAudio.m_collisionSound.m_gain = 1.0f;
-    blueOrbAudio.m_collisionSound.m_loop = false;
-    blueOrbShaderProgram.m_outputProgram = m_assetManager.getShaderProgram("solid_color");
-    blueOrbShaderProgram.m_lightProgram = m_assetManager.getShaderProgram("basic_lighting");
-    blueOrbShaderProgram.m_shadowProgram = m_assetManager.getShaderProgram("shadow_depth_cube");
-    blueOrbGraphics.m_vertexCount = sphereMesh.m_vertexCount;
-    // setup Box2D data
-    blueOrbUserData.m_fixtureType = 1;
-    blueOrbCircle.m_bodyDef.type = b2_dynamicBody;
-    blueOrbCircle.m_bodyDef.position.Set(-15.0f, 5.0f);
-    blueOrbTransform.m_body = m_world->CreateBody(&blueOrbCircle.m_bodyDef);
-    blueOrbCircle.m_circleShape.m_p.Set(0.0f, 0.0f);
-    blueOrbCircle.m_circleShape.m_radius = 1.0f;
-    blueOrbCircle.m_fixtureDef.shape = &blueOrbCircle.m_circleShape;
-    blueOrbCircle.m_fixtureDef.density = 1.0f;
-    blueOrbCircle.m_fixtureDef.friction = 0.3f;
-    blueOrbCircle.m_fixtureDef.userData.pointer = reinterpret_cast<uintptr_t>(&blueOrbUserData);
-    blueOrbTransform.m_body->CreateFixture(&blueOrbCircle.m_fixtureDef);
-    // setup OpenGL data
-    glGenVertexArrays(1, &blueOrbGraphics.m_VAO);
-    glGenBuffers(1, &blueOrbGraphics.m_VBO);
-    glBindVertexArray(blueOrbGraphics.m_VAO);
-    glBindBuffer(GL_ARRAY_BUFFER, blueOrbGraphics.m_VBO);
-    glBufferData(GL_ARRAY_BUFFER, sphereMesh.m_verticesSize, sphereMesh.m_vertices, GL_STATIC_DRAW);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-    // setup shadow mapping
-    blueOrbShadow.m_type = 2; // omnidirectional shadow casting
-    blueOrbShadow.m_index = 2;
-    blueOrbShadow.m_nearPlane = 1.0f;
-    blueOrbShadow.m_farPlane = 32.0f;
-    glGenFramebuffers(1, &blueOrbShadow.m_shadowFramebuffer);
-    glGenTextures(1, &blueOrbShadow.m_depthCubemap);
-    glBindTexture(GL_TEXTURE_CUBE_MAP, blueOrbShadow.m_depthCubemap);
-    for (unsigned int i = 0; i < 6; ++i) {
-        glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, GL_DEPTH_COMPONENT, m_shadowWidth, m_shadowHeight, 0, GL_DEPTH_COMPONENT, GL_FLOAT, NULL);
-    }
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
-    // attach depth texture as FBO's depth buffer
-    glBindFramebuffer(GL_FRAMEBUFFER, blueOrbShadow.m_shadowFramebuffer);
-    glFramebufferTexture(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, blueOrbShadow.m_depthCubemap, 0);
-    glDrawBuffer(GL_NONE);
-    glReadBuffer(GL_NONE);
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
-
-    // yellowLamp entity (fixed position, pointed down, yellow light)
-    // .........................................................................
-    // setup components
-    LightComponent yellowLampLight;
-    BodyTransformComponent yellowLampTransform;
-    BodyCircleComponent yellowLampCircle;
-    AudioDataComponent yellowLampAudio;
-    ShaderProgramComponent yellowLampShaderProgram;
-    RenderDataComponent yellowLampGraphics;
-    FixtureUserDataComponent yellowLampUserData;
-    ShadowFramebufferComponent yellowLampShadow;
-    yellowLampLight.m_type = 2;                                    // spot type
-    yellowLampLight.m_scale = glm::vec3(1.0f, 1.0f, 1.0f);         // check Box2D size
-    yellowLampLight.m_direction = glm::vec3(0.0f, -1.0f, 0.0f);    // pointed down
-    yellowLampLight.m_cutOff = glm::cos(glm::radians(15.0f));
-    yellowLampLight.m_outerCutOff = glm::cos(glm::radians(17.5f));
-    yellowLampLight.m_constant = 1.0f;
-    yellowLampLight.m_linear = 0.09f;
-    yellowLampLight.m_quadratic = 0.032f;
-    yellowLampLight.m_ambient = glm::vec3(0.0f, 0.0f, 0.0f);    // no ambient
-    yellowLampLight.m_diffuse = glm::vec3(1.0f, 1.0f, 0.0f);    // yellow diffuse
-    yellowLampLight.m_specular = glm::vec3(1.0f, 1.0f, 0.0f);   // yellow specular
-    alGenSources(1, &yellowLampAudio.m_soundSource);
-    yellowLampAudio.m_collisionSound.m_soundBuffer = m_audioManager.getSoundEffect("button2");
-    yellowLampAudio.m_collisionSound.m_pitch = 1.0f;
-    yellowLampAudio.m_collisionSound.m_gain = 1.0f;
-    yellowLampAudio.m_collisionSound.m_loop = false;
-    yellowLampShaderProgram.m_outputProgram = m_assetManager.getShaderProgram("solid_color");
-    yellowLampShaderProgram.m_lightProgram = m_assetManager.getShaderProgram("basic_lighting");
-    yellowLampShaderProgram.m_shadowProgram = m_assetManager.getShaderProgram("shadow_depth");
-    yellowLampGraphics.m_vertexCount = sphereMesh.m_vertexCount;
-    // setup Box2D data
-    yellowLampUserData.m_fixtureType = 1;
-    yellowLampCircle.m_bodyDef.position.Set(-10.0f, 10.0f);
-    yellowLampTransform.m_body = m_world->CreateBody(&yellowLampCircle.m_bodyDef);
-    yellowLampCircle.m_circleShape.m_p.Set(0.0f, 0.0f);
-    yellowLampCircle.m_circleShape.m_radius = 1.0f;
-    yellowLampCircle.m_fixtureDef.shape = &yellowLampCircle.m_circleShape;
-    yellowLampCircle.m_fixtureDef.density = 1.0f;
-    yellowLampCircle.m_fixtureDef.friction = 0.3f;
-    yellowLampCircle.m_fixtureDef.userData.pointer = reinterpret_cast<uintptr_t>(&yellowLampUserData);
-    yellowLampTransform.m_body->CreateFixture(&yellowLampCircle.m_fixtureDef);
-    // setup OpenGL data
-    glGenVertexArrays(1, &yellowLampGraphics.m_VAO);
-    glGenBuffers(1, &yellowLampGraphics.m_VBO);
-    glBindVertexArray(yellowLampGraphics.m_VAO);
-    glBindBuffer(GL_ARRAY_BUFFER, yellowLampGraphics.m_VBO);
-    glBufferData(GL_ARRAY_BUFFER, sphereMesh.m_verticesSize, sphereMesh.m_vertices, GL_STATIC_DRAW);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-    // setup shadow mapping
-    yellowLampShadow.m_type = 1; // mono-directional shadow casting
-    yellowLampShadow.m_index = 0;
-    yellowLampShadow.m_nearPlane = 1.0f;
-    yellowLampShadow.m_farPlane = 15.0f;
-    glGenFramebuffers(1, &yellowLampShadow.m_shadowFramebuffer);
-    glGenTextures(1, &yellowLampShadow.m_depthMap);
-    glBindTexture(GL_TEXTURE_2D, yellowLampShadow.m_depthMap);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT, m_shadowWidth, m_shadowHeight, 0, GL_DEPTH_COMPONENT, GL_FLOAT, NULL);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_BORDER);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_BORDER);
-    float yellowLampBorderColor[] = {1.0, 1.0, 1.0, 1.0};
-    glTexParameterfv(GL_TEXTURE_2D, GL_TEXTURE_BORDER_COLOR, yellowLampBorderColor);
-    // attach depth texture as FBO's depth buffer
-    glBindFramebuffer(GL_FRAMEBUFFER, yellowLampShadow.m_shadowFramebuffer);
-    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, yellowLampShadow.m_depthMap, 0);
-    glDrawBuffer(GL_NONE);
-    glReadBuffer(GL_NONE);
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
-
-    // magentaLamp entity (fixed position, pointed down, magenta light)
-    // .........................................................................
-    // setup components
-    LightComponent magentaLampLight;
-    BodyTransformComponent magentaLampTransform;
-    BodyCircleComponent magentaLampCircle;
-    AudioDataComponent magentaLampAudio;
-    ShaderProgramComponent magentaLampShaderProgram;
-    RenderDataComponent magentaLampGraphics;
-    FixtureUserDataComponent magentaLampUserData;
-    ShadowFramebufferComponent magentaLampShadow;
-    magentaLampLight.m_type = 2;                                    // spot type
-    magentaLampLight.m_scale = glm::vec3(1.25f, 1.25f, 1.25f);      // check Box2D size
-    magentaLampLight.m_direction = glm::vec3(0.0f, -1.0f, 0.0f);    // pointed down
-    magentaLampLight.m_cutOff = glm::cos(glm::radians(15.0f));
-    magentaLampLight.m_outerCutOff = glm::cos(glm::radians(17.5f));
-    magentaLampLight.m_constant = 1.0f;
-    magentaLampLight.m_linear = 0.09f;
-    magentaLampLight.m_quadratic = 0.032f;
-    magentaLampLight.m_ambient = glm::vec3(0.0f, 0.0f, 0.0f);    // no ambient
-    magentaLampLight.m_diffuse = glm::vec3(1.0f, 0.0f, 1.0f);    // magenta diffuse
-    magentaLampLight.m_specular = glm::vec3(1.0f, 0.0f, 1.0f);   // magenta specular
-    alGenSources(1, &magentaLampAudio.m_soundSource);
-    magentaLampAudio.m_collisionSound.m_soundBuffer = m_audioManager.getSoundEffect("button2");
-    magentaLampAudio.m_collisionSound.m_pitch = 1.0f;
-    magentaLampAudio.m_collisionSound.m_gain = 1.0f;
-    magentaLampAudio.m_collisionSound.m_loop = false;
-    magentaLampShaderProgram.m_outputProgram = m_assetManager.getShaderProgram("solid_color");
-    magentaLampShaderProgram.m_lightProgram = m_assetManager.getShaderProgram("basic_lighting");
-    magentaLampShaderProgram.m_shadowProgram = m_assetManager.getShaderProgram("shadow_depth");
-    magentaLampGraphics.m_vertexCount = sphereMesh.m_vertexCount;
-    // setup Box2D data
-    magentaLampUserData.m_fixtureType = 1;
-    magentaLampCircle.m_bodyDef.position.Set(-25.0f, 10.0f);
-    magentaLampTransform.m_body = m_world->CreateBody(&magentaLampCircle.m_bodyDef);
-    magentaLampCircle.m_circleShape.m_p.Set(0.0f, 0.0f);
-    magentaLampCircle.m_circleShape.m_radius = 1.25f;
-    magentaLampCircle.m_fixtureDef.shape = &magentaLampCircle.m_circleShape;
-    magentaLampCircle.m_fixtureDef.density = 1.0f;
-    magentaLampCircle.m_fixtureDef.friction = 0.3f;
-    magentaLampCircle.m_fixtureDef.userData.pointer = reinterpret_cast<uintptr_t>(&magentaLampUserData);
-    magentaLampTransform.m_body->CreateFixture(&magentaLampCircle.m_fixtureDef);
-    // setup OpenGL data
-    glGenVertexArrays(1, &magentaLampGraphics.m_VAO);
-    glGenBuffers(1, &magentaLampGraphics.m_VBO);
-    glBindVertexArray(magentaLampGraphics.m_VAO);
-    glBindBuffer(GL_ARRAY_BUFFER, magentaLampGraphics.m_VBO);
-    glBufferData(GL_ARRAY_BUFFER, sphereMesh.m_verticesSize, sphereMesh.m_vertices, GL_STATIC_DRAW);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-    // setup shadow mapping
-    magentaLampShadow.m_type = 1; // monodirectional shadow casting
-    magentaLampShadow.m_index = 1;
-    magentaLampShadow.m_nearPlane = 1.0f;
-    magentaLampShadow.m_farPlane = 15.0f;
-    glGenFramebuffers(1, &magentaLampShadow.m_shadowFramebuffer);
-    glGenTextures(1, &magentaLampShadow.m_depthMap);
-    glBindTexture(GL_TEXTURE_2D, magentaLampShadow.m_depthMap);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT, m_shadowWidth, m_shadowHeight, 0, GL_DEPTH_COMPONENT, GL_FLOAT, NULL);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_BORDER);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_BORDER);
-    float magentaLampBorderColor[] = {1.0, 1.0, 1.0, 1.0};
-    glTexParameterfv(GL_TEXTURE_2D, GL_TEXTURE_BORDER_COLOR, magentaLampBorderColor);
-    // attach depth texture as FBO's depth buffer
-    glBindFramebuffer(GL_FRAMEBUFFER, magentaLampShadow.m_shadowFramebuffer);
-    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, magentaLampShadow.m_depthMap, 0);
-    glDrawBuffer(GL_NONE);
-    glReadBuffer(GL_NONE);
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
-
-    // cyanLamp entity (fixed position, pointed down, cyan light)
-    // .........................................................................
-    // setup components
-    LightComponent cyanLampLight;
-    BodyTransformComponent cyanLampTransform;
-    BodyCircleComponent cyanLampCircle;
-    AudioDataComponent cyanLampAudio;
-    ShaderProgramComponent cyanLampShaderProgram;
-    RenderDataComponent cyanLampGraphics;
-    FixtureUserDataComponent cyanLampUserData;
-    ShadowFramebufferComponent cyanLampShadow;
-    cyanLampLight.m_type = 2;                                    // spot type
-    cyanLampLight.m_scale = glm::vec3(0.75f, 0.75f, 0.75f);      // check Box2D size
-    cyanLampLight.m_direction = glm::vec3(0.0f, -1.0f, 0.0f);    // pointed down
-    cyanLampLight.m_cutOff = glm::cos(glm::radians(15.0f));
-    cyanLampLight.m_outerCutOff = glm::cos(glm::radians(17.5f));
-    cyanLampLight.m_constant = 1.0f;
-    cyanLampLight.m_linear = 0.09f;
-    cyanLampLight.m_quadratic = 0.032f;
-    cyanLampLight.m_ambient = glm::vec3(0.0f, 0.0f, 0.0f);    // no ambient
-    cyanLampLight.m_diffuse = glm::vec3(0.0f, 1.0f, 1.0f);    // cyan diffuse
-    cyanLampLight.m_specular = glm::vec3(0.0f, 1.0f, 1.0f);   // cyan specular
-    alGenSources(1, &cyanLampAudio.m_soundSource);
-    cyanLampAudio.m_collisionSound.m_soundBuffer = m_audioManager.getSoundEffect("button2");
-    cyanLampAudio.m_collisionSound.m_pitch = 1.0f;
-    cyanLampAudio.m_collisionSound.m_gain = 1.0f;
-    cyanLampAudio.m_collisionSound.m_loop = false;
-    cyanLampShaderProgram.m_outputProgram = m_assetManager.getShaderProgram("solid_color");
-    cyanLampShaderProgram.m_lightProgram = m_assetManager.getShaderProgram("basic_lighting");
-    cyanLampShaderProgram.m_shadowProgram = m_assetManager.getShaderProgram("shadow_depth");
-    cyanLampGraphics.m_vertexCount = sphereMesh.m_vertexCount;
-    // setup Box2D data
-    cyanLampUserData.m_fixtureType = 1;
-    cyanLampCircle.m_bodyDef.position.Set(20.0f, 10.0f);
-    cyanLampTransform.m_body = m_world->CreateBody(&cyanLampCircle.m_bodyDef);
-    cyanLampCircle.m_circleShape.m_p.Set(0.0f, 0.0f);
-    cyanLampCircle.m_circleShape.m_radius = 0.75f;
-    cyanLampCircle.m_fixtureDef.shape = &cyanLampCircle.m_circleShape;
-    cyanLampCircle.m_fixtureDef.density = 1.0f;
-    cyanLampCircle.m_fixtureDef.friction = 0.3f;
-    cyanLampCircle.m_fixtureDef.userData.pointer = reinterpret_cast<uintptr_t>(&cyanLampUserData);
-    cyanLampTransform.m_body->CreateFixture(&cyanLampCircle.m_fixtureDef);
-    // setup OpenGL data
-    glGenVertexArrays(1, &cyanLampGraphics.m_VAO);
-    glGenBuffers(1, &cyanLampGraphics.m_VBO);
-    glBindVertexArray(cyanLampGraphics.m_VAO);
-    glBindBuffer(GL_ARRAY_BUFFER, cyanLampGraphics.m_VBO);
-    glBufferData(GL_ARRAY_BUFFER, sphereMesh.m_verticesSize, sphereMesh.m_vertices, GL_STATIC_DRAW);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-    // setup shadow mapping
-    cyanLampShadow.m_type = 1; // monodirectional shadow casting
-    cyanLampShadow.m_index = 2;
-    cyanLampShadow.m_nearPlane = 1.0f;
-    cyanLampShadow.m_farPlane = 15.0f;
-    glGenFramebuffers(1, &cyanLampShadow.m_shadowFramebuffer);
-    glGenTextures(1, &cyanLampShadow.m_depthMap);
-    glBindTexture(GL_TEXTURE_2D, cyanLampShadow.m_depthMap);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT, m_shadowWidth, m_shadowHeight, 0, GL_DEPTH_COMPONENT, GL_FLOAT, NULL);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_BORDER);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_BORDER);
-    float cyanLampBorderColor[] = {1.0, 1.0, 1.0, 1.0};
-    glTexParameterfv(GL_TEXTURE_2D, GL_TEXTURE_BORDER_COLOR, cyanLampBorderColor);
-    // attach depth texture as FBO's depth buffer
-    glBindFramebuffer(GL_FRAMEBUFFER, cyanLampShadow.m_shadowFramebuffer);
-    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, cyanLampShadow.m_depthMap, 0);
-    glDrawBuffer(GL_NONE);
-    glReadBuffer(GL_NONE);
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
-
-    // player entity (dynamic, marble-textured sphere)
-    // .........................................................................
-    // setup components
-    PlayerComponent playerPlayer;
-    MaterialComponent playerMaterial;
-    BodyTransformComponent playerTransform;
-    BodyCircleComponent playerCircle;
-    TextureComponent playerTexture;
-    AudioDataComponent playerAudio;
-    ShaderProgramComponent playerShaderProgram;
-    RenderDataComponent playerGraphics;
-    FixtureUserDataComponent playerUserData;
-    playerMaterial.m_shininess = 128.0f;
-    playerTexture.m_diffuse = m_assetManager.getTexture("tiles_diff");
-    playerTexture.m_specular = m_assetManager.getTexture("tiles_spec");
-    playerTexture.m_normal = m_assetManager.getTexture("tiles_norm");
-    alGenSources(1, &playerAudio.m_soundSource);
-    playerAudio.m_selectModeOnSound.m_soundBuffer = m_audioManager.getSoundEffect("on");
-    playerAudio.m_selectModeOnSound.m_pitch = 1.0f;
-    playerAudio.m_selectModeOnSound.m_gain = 1.0f;
-    playerAudio.m_selectModeOnSound.m_loop = false;
-    playerAudio.m_selectModeOffSound.m_soundBuffer = m_audioManager.getSoundEffect("off");
-    playerAudio.m_selectModeOffSound.m_pitch = 1.0f;
-    playerAudio.m_selectModeOffSound.m_gain = 1.0f;
-    playerAudio.m_selectModeOffSound.m_loop = false;
-    playerShaderProgram.m_outputProgram = m_assetManager.getShaderProgram("basic_lighting");
-    playerShaderProgram.m_stencilProgram = m_assetManager.getShaderProgram("stencil");
-    playerGraphics.m_vertexCount = sphereMesh.m_vertexCount;
-    // setup Box2D data
-    playerUserData.m_fixtureType = 2;
-    playerCircle.m_bodyDef.type = b2_dynamicBody;
-    playerCircle.m_bodyDef.position.Set(0.0f, 5.0f);
-    playerTransform.m_body = m_world->CreateBody(&playerCircle.m_bodyDef);
-    playerCircle.m_circleShape.m_p.Set(0.0f, 0.0f);
-    playerCircle.m_circleShape.m_radius = 1.0f;
-    playerCircle.m_fixtureDef.shape = &playerCircle.m_circleShape;
-    playerCircle.m_fixtureDef.density = 1.0f;
-    playerCircle.m_fixtureDef.friction = 0.3f;
-    playerCircle.m_fixtureDef.userData.pointer = reinterpret_cast<uintptr_t>(&playerUserData);
-    playerTransform.m_body->CreateFixture(&playerCircle.m_fixtureDef);
-    // setup OpenGL data
-    glGenVertexArrays(1, &playerGraphics.m_VAO);
-    glGenBuffers(1, &playerGraphics.m_VBO);
-    glBindVertexArray(playerGraphics.m_VAO);
-    glBindBuffer(GL_ARRAY_BUFFER, playerGraphics.m_VBO);
-    glBufferData(GL_ARRAY_BUFFER, sphereMesh.m_verticesSize, sphereMesh.m_vertices, GL_STATIC_DRAW);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(3 * sizeof(float)));
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(6 * sizeof(float)));
-    glEnableVertexAttribArray(2);
-
-    // floor entity (static, tile-textured box)
-    // .........................................................................
-    // setup components
-    MaterialComponent floorMaterial;
-    BodyTransformComponent floorTransform;
-    BodyPolygonComponent floorPolygon;
-    TextureComponent floorTexture;
-    AudioDataComponent floorAudio;
-    ShaderProgramComponent floorShaderProgram;
-    RenderDataComponent floorGraphics;
-    FixtureUserDataComponent floorUserData;
-    floorMaterial.m_shininess = 32.0f;
-    floorTexture.m_diffuse = m_assetManager.getTexture("metal_diff");
-    floorTexture.m_specular = m_assetManager.getTexture("metal_spec");
-    floorTexture.m_normal = m_assetManager.getTexture("metal_norm");
-    alGenSources(1, &floorAudio.m_soundSource);
-    floorAudio.m_collisionSound.m_soundBuffer = m_audioManager.getSoundEffect("button2");
-    floorAudio.m_collisionSound.m_pitch = 1.0f;
-    floorAudio.m_collisionSound.m_gain = 1.0f;
-    floorAudio.m_collisionSound.m_loop = false;
-    floorShaderProgram.m_outputProgram = m_assetManager.getShaderProgram("basic_lighting");
-    floorShaderProgram.m_stencilProgram = m_assetManager.getShaderProgram("stencil");
-    floorGraphics.m_vertexCount = groundMesh.m_vertexCount;
-    // setup Box2D data
-    floorUserData.m_fixtureType = 4;
-    floorPolygon.m_bodyDef.position.Set(0.0f, -1.0f);
-    floorTransform.m_body = m_world->CreateBody(&floorPolygon.m_bodyDef);
-    floorPolygon.m_polygonShape.SetAsBox(50.0f, 1.0f); // (SetAsBox(half-width, half-height))
-    floorTransform.m_body->CreateFixture(&floorPolygon.m_polygonShape, 0.0f);
-    // setup OpenGL data
-    glGenVertexArrays(1, &floorGraphics.m_VAO);
-    glGenBuffers(1, &floorGraphics.m_VBO);
-    glBindVertexArray(floorGraphics.m_VAO);
-    glBindBuffer(GL_ARRAY_BUFFER, floorGraphics.m_VBO);
-    glBufferData(GL_ARRAY_BUFFER, groundMesh.m_verticesSize, groundMesh.m_vertices, GL_STATIC_DRAW);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(3 * sizeof(float)));
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(6 * sizeof(float)));
-    glEnableVertexAttribArray(2);
-
-    // sphere entity (dynamic, rust-textured sphere)
-    // .........................................................................
-    // setup components
-    MaterialComponent sphereMaterial;
-    BodyTransformComponent sphereTransform;
-    BodyCircleComponent sphereCircle;
-    TextureComponent sphereTexture;
-    AudioDataComponent sphereAudio;
-    ShaderProgramComponent sphereShaderProgram;
-    RenderDataComponent sphereGraphics;
-    FixtureUserDataComponent sphereUserData;
-    sphereMaterial.m_shininess = 32.0f;
-    sphereTexture.m_diffuse = m_assetManager.getTexture("rusted_diff");
-    sphereTexture.m_specular = m_assetManager.getTexture("rusted_spec");
-    sphereTexture.m_normal = m_assetManager.getTexture("rusted_norm");
-    alGenSources(1, &sphereAudio.m_soundSource);
-    sphereAudio.m_collisionSound.m_soundBuffer = m_audioManager.getSoundEffect("button1");
-    sphereAudio.m_collisionSound.m_pitch = 1.0f;
-    sphereAudio.m_collisionSound.m_gain = 1.0f;
-    sphereAudio.m_collisionSound.m_loop = false;
-    sphereShaderProgram.m_outputProgram = m_assetManager.getShaderProgram("basic_lighting");
-    sphereShaderProgram.m_stencilProgram = m_assetManager.getShaderProgram("stencil");
-    sphereGraphics.m_vertexCount = sphereMesh.m_vertexCount;
-    // setup Box2D data
-    sphereUserData.m_fixtureType = 3;
-    sphereCircle.m_bodyDef.type = b2_dynamicBody;
-    sphereCircle.m_bodyDef.position.Set(-5.0f, 5.0f);
-    sphereTransform.m_body = m_world->CreateBody(&sphereCircle.m_bodyDef);
-    sphereCircle.m_circleShape.m_p.Set(0.0f, 0.0f);
-    sphereCircle.m_circleShape.m_radius = 1.0f;
-    sphereCircle.m_fixtureDef.shape = &sphereCircle.m_circleShape;
-    sphereCircle.m_fixtureDef.density = 1.0f;
-    sphereCircle.m_fixtureDef.friction = 0.3f;
-    sphereCircle.m_fixtureDef.userData.pointer = reinterpret_cast<uintptr_t>(&sphereUserData);
-    sphereTransform.m_body->CreateFixture(&sphereCircle.m_fixtureDef);
-    // setup OpenGL data
-    glGenVertexArrays(1, &sphereGraphics.m_VAO);
-    glGenBuffers(1, &sphereGraphics.m_VBO);
-    glBindVertexArray(sphereGraphics.m_VAO);
-    glBindBuffer(GL_ARRAY_BUFFER, sphereGraphics.m_VBO);
-    glBufferData(GL_ARRAY_BUFFER, sphereMesh.m_verticesSize, sphereMesh.m_vertices, GL_STATIC_DRAW);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(3 * sizeof(float)));
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(6 * sizeof(float)));
-    glEnableVertexAttribArray(2);
-
-    // gold sphere entity (dynamic, reflecting surface)
-    // .........................................................................
-    // setup components
-    MaterialComponent goldMaterial;
-    BodyTransformComponent goldTransform;
-    BodyCircleComponent goldCircle;
-    TextureComponent goldTexture;
-    AudioDataComponent goldAudio;
-    ShaderProgramComponent goldShaderProgram;
-    RenderDataComponent goldGraphics;
-    FixtureUserDataComponent goldUserData;
-    goldMaterial.m_shininess = 256.0f;
-    goldTexture.m_diffuse = m_assetManager.getTexture("gold_diff");
-    goldTexture.m_specular = m_assetManager.getTexture("gold_spec");
-    goldTexture.m_normal = m_assetManager.getTexture("gold_norm");
-    alGenSources(1, &goldAudio.m_soundSource);
-    goldAudio.m_collisionSound.m_soundBuffer = m_audioManager.getSoundEffect("button1");
-    goldAudio.m_collisionSound.m_pitch = 1.0f;
-    goldAudio.m_collisionSound.m_gain = 1.0f;
-    goldAudio.m_collisionSound.m_loop = false;
-    goldShaderProgram.m_outputProgram = m_assetManager.getShaderProgram("basic_lighting");
-    goldShaderProgram.m_stencilProgram = m_assetManager.getShaderProgram("stencil");
-    goldGraphics.m_vertexCount = sphereMesh.m_vertexCount;
-    // setup Box2D data
-    goldUserData.m_fixtureType = 3;
-    goldCircle.m_bodyDef.type = b2_dynamicBody;
-    goldCircle.m_bodyDef.position.Set(-20.0f, 5.0f);
-    goldTransform.m_body = m_world->CreateBody(&goldCircle.m_bodyDef);
-    goldCircle.m_circleShape.m_p.Set(0.0f, 0.0f);
-    goldCircle.m_circleShape.m_radius = 1.0f;
-    goldCircle.m_fixtureDef.shape = &goldCircle.m_circleShape;
-    goldCircle.m_fixtureDef.density = 1.0f;
-    goldCircle.m_fixtureDef.friction = 0.3f;
-    goldCircle.m_fixtureDef.userData.pointer = reinterpret_cast<uintptr_t>(&goldUserData);
-    goldTransform.m_body->CreateFixture(&goldCircle.m_fixtureDef);
-    // setup OpenGL data
-    glGenVertexArrays(1, &goldGraphics.m_VAO);
-    glGenBuffers(1, &goldGraphics.m_VBO);
-    glBindVertexArray(goldGraphics.m_VAO);
-    glBindBuffer(GL_ARRAY_BUFFER, goldGraphics.m_VBO);
-    glBufferData(GL_ARRAY_BUFFER, sphereMesh.m_verticesSize, sphereMesh.m_vertices, GL_STATIC_DRAW);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(3 * sizeof(float)));
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(6 * sizeof(float)));
-    glEnableVertexAttribArray(2);
-
-    // cube entity (dynamic, block-textured cube)
-    // .........................................................................
-    // setup components
-    MaterialComponent cubeMaterial;
-    BodyTransformComponent cubeTransform;
-    BodyPolygonComponent cubePolygon;
-    ShapeSquareComponent cubeShape;
-    TextureComponent cubeTexture;
-    AudioDataComponent cubeAudio;
-    ShaderProgramComponent cubeShaderProgram;
-    RenderDataComponent cubeGraphics;
-    FixtureUserDataComponent cubeUserData;
-    cubeMaterial.m_shininess = 32.0f;
-    cubeTexture.m_diffuse = m_assetManager.getTexture("blocks_diff");
-    cubeTexture.m_specular = m_assetManager.getTexture("blocks_spec");
-    cubeTexture.m_normal = m_assetManager.getTexture("blocks_norm");
-    alGenSources(1, &cubeAudio.m_soundSource);
-    cubeAudio.m_collisionSound.m_soundBuffer = m_audioManager.getSoundEffect("button2");
-    cubeAudio.m_collisionSound.m_pitch = 1.0f;
-    cubeAudio.m_collisionSound.m_gain = 1.0f;
-    cubeAudio.m_collisionSound.m_loop = false;
-    cubeShaderProgram.m_outputProgram = m_assetManager.getShaderProgram("basic_lighting");
-    cubeShaderProgram.m_stencilProgram = m_assetManager.getShaderProgram("stencil");
-    cubeGraphics.m_vertexCount = cubeMesh.m_vertexCount;
-    // setup Box2D data
-    cubeUserData.m_fixtureType = 4;
-    cubePolygon.m_bodyDef.type = b2_dynamicBody;
-    cubePolygon.m_bodyDef.position.Set(5.0f, 5.0f);
-    cubeTransform.m_body = m_world->CreateBody(&cubePolygon.m_bodyDef);
-    cubePolygon.m_polygonShape.Set(cubeShape.m_vertices, cubeShape.m_vertexCount);
-    cubePolygon.m_fixtureDef.shape = &cubePolygon.m_polygonShape;
-    cubePolygon.m_fixtureDef.density = 1.0f;
-    cubePolygon.m_fixtureDef.friction = 0.3f;
-    cubePolygon.m_fixtureDef.userData.pointer = reinterpret_cast<uintptr_t>(&cubeUserData);
-    cubeTransform.m_body->CreateFixture(&cubePolygon.m_fixtureDef);
-    // setup OpenGL data
-    glGenVertexArrays(1, &cubeGraphics.m_VAO);
-    glGenBuffers(1, &cubeGraphics.m_VBO);
-    glBindVertexArray(cubeGraphics.m_VAO);
-    glBindBuffer(GL_ARRAY_BUFFER, cubeGraphics.m_VBO);
-    glBufferData(GL_ARRAY_BUFFER, cubeMesh.m_verticesSize, cubeMesh.m_vertices, GL_STATIC_DRAW);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(3 * sizeof(float)));
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(6 * sizeof(float)));
-    glEnableVertexAttribArray(2);
-
-    // window entity (flat, blended sprite)
-    // .........................................................................
-    // setup components
-    SpriteComponent windowSprite;
-    TextureComponent windowTexture;
-    ShaderProgramComponent windowShaderProgram;
-    RenderDataComponent windowGraphics;
-    windowSprite.m_shininess = 32.0f;
-    windowSprite.m_position = glm::vec3(15.0f, 1.0f, 5.0f);
-    windowSprite.m_rotation = 0.0f;
-    windowSprite.m_scale = glm::vec3(1.0f, 1.0f, 1.0f);
-    windowTexture.m_diffuse = m_assetManager.getTexture("blending");
-    windowTexture.m_specular = m_assetManager.getTexture("gold_spec");
-    windowShaderProgram.m_outputProgram = m_assetManager.getShaderProgram("sprite");
-    windowShaderProgram.m_stencilProgram = m_assetManager.getShaderProgram("stencil");
-    windowGraphics.m_vertexCount = spriteMesh.m_vertexCount;
-    // setup OpenGL data
-    glGenVertexArrays(1, &windowGraphics.m_VAO);
-    glGenBuffers(1, &windowGraphics.m_VBO);
-    glBindVertexArray(windowGraphics.m_VAO);
-    glBindBuffer(GL_ARRAY_BUFFER, windowGraphics.m_VBO);
-    glBufferData(GL_ARRAY_BUFFER, spriteMesh.m_verticesSize, spriteMesh.m_vertices, GL_STATIC_DRAW);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)(3 * sizeof(float)));
-    glEnableVertexAttribArray(1);
-
-    // identification text entity (onset engine id text)
-    // .........................................................................
-    // setup components
-    TextComponent idtextText;
-    ShaderProgramComponent idtextShaderProgram;
-    RenderDataComponent idtextGraphics;
-    idtextShaderProgram.m_outputProgram = m_assetManager.getShaderProgram("text");
-    // setup text to render
-    idtextText.m_xCoord = 25.0f;
-    idtextText.m_yCoord = 40.0f;
-    idtextText.m_scale = 0.3f;
-    idtextText.m_color = glm::vec3(1.0f, 1.0f, 1.0f);
-    std::string idtextMessage = "Onset Engine v0.1.0";
-    for (std::string::const_iterator c = idtextMessage.begin(); c != idtextMessage.end(); c++) {
-        idtextText.m_characters.insert(idtextText.m_characters.end(), m_textManager.getCharacter(*c));
-    }
-    // setup OpenGL data
-    glGenVertexArrays(1, &idtextGraphics.m_VAO);
-    glGenBuffers(1, &idtextGraphics.m_VBO);
-    glBindVertexArray(idtextGraphics.m_VAO);
-    glBindBuffer(GL_ARRAY_BUFFER, idtextGraphics.m_VBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(float) * 6 * 4, NULL, GL_DYNAMIC_DRAW);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, 4 * sizeof(float), 0);
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindVertexArray(0);
-
-    // link text entity (github link text)
-    // .........................................................................
-    // setup components
-    TextComponent linkText;
-    ShaderProgramComponent linkShaderProgram;
-    RenderDataComponent linkGraphics;
-    linkShaderProgram.m_outputProgram = m_assetManager.getShaderProgram("text");
-    // setup text to render
-    linkText.m_xCoord = 25.0f;
-    linkText.m_yCoord = 25.0f;
-    linkText.m_scale = 0.2f;
-    linkText.m_color = glm::vec3(1.0f, 1.0f, 1.0f);
-    std::string linkMessage = "github.com/dylanafterall/OnsetEngine.git";
-    for (std::string::const_iterator c = linkMessage.begin(); c != linkMessage.end(); c++) {
-        linkText.m_characters.insert(linkText.m_characters.end(), m_textManager.getCharacter(*c));
-    }
-    // setup OpenGL data
-    glGenVertexArrays(1, &linkGraphics.m_VAO);
-    glGenBuffers(1, &linkGraphics.m_VBO);
-    glBindVertexArray(linkGraphics.m_VAO);
-    glBindBuffer(GL_ARRAY_BUFFER, linkGraphics.m_VBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(float) * 6 * 4, NULL, GL_DYNAMIC_DRAW);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, 4 * sizeof(float), 0);
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindVertexArray(0);
+void Game::setInputReplayPath(const std::string& path) {
+    m_inputReplayPath = path;
+}
 
+void Game::setScenePath(const std::string& path) {
+    m_scenePath = path;
+}
 
-    // _________________________________________________________________________
-    // -------------------------------------------------------------------------
-    // Registry
-    // _________________________________________________________________________
-    // -------------------------------------------------------------------------
-    auto cameraEntity = m_registry.create();
-    m_registry.emplace<CameraComponent>(cameraEntity, camera);
-
-    auto skyboxEntity = m_registry.create();
-    m_registry.emplace<SkyboxComponent>(skyboxEntity, skyboxSkybox);
-    m_registry.emplace<TextureComponent>(skyboxEntity, skyboxTexture);
-    m_registry.emplace<ShaderProgramComponent>(skyboxEntity, skyboxShaderProgram);
-    m_registry.emplace<RenderDataComponent>(skyboxEntity, skyboxGraphics);
-
-    auto sunEntity = m_registry.create();
-    m_registry.emplace<LightComponent>(sunEntity, sunLight);
-    m_registry.emplace<BodyTransformComponent>(sunEntity, sunTransform);
-    m_registry.emplace<ShaderProgramComponent>(sunEntity, sunShaderProgram);
-    m_registry.emplace<RenderDataComponent>(sunEntity, sunGraphics);
-    m_registry.emplace<ShadowFramebufferComponent>(sunEntity, sunShadow);
-
-    auto redOrbEntity = m_registry.create();
-    m_registry.emplace<LightComponent>(redOrbEntity, redOrbLight);
-    m_registry.emplace<BodyTransformComponent>(redOrbEntity, redOrbTransform);
-    m_registry.emplace<AudioDataComponent>(redOrbEntity, redOrbAudio);
-    m_registry.emplace<ShaderProgramComponent>(redOrbEntity, redOrbShaderProgram);
-    m_registry.emplace<RenderDataComponent>(redOrbEntity, redOrbGraphics);
-    m_registry.emplace<FixtureUserDataComponent>(redOrbEntity, redOrbUserData);
-    m_registry.emplace<ShadowFramebufferComponent>(redOrbEntity, redOrbShadow);
-    redOrbUserData.m_enttEntity = &redOrbEntity;
-
-    auto greenOrbEntity = m_registry.create();
-    m_registry.emplace<LightComponent>(greenOrbEntity, greenOrbLight);
-    m_registry.emplace<BodyTransformComponent>(greenOrbEntity, greenOrbTransform);
-    m_registry.emplace<AudioDataComponent>(greenOrbEntity, greenOrbAudio);
-    m_registry.emplace<ShaderProgramComponent>(greenOrbEntity, greenOrbShaderProgram);
-    m_registry.emplace<RenderDataComponent>(greenOrbEntity, greenOrbGraphics);
-    m_registry.emplace<FixtureUserDataComponent>(greenOrbEntity, greenOrbUserData);
-    m_registry.emplace<ShadowFramebufferComponent>(greenOrbEntity, greenOrbShadow);
-    greenOrbUserData.m_enttEntity = &greenOrbEntity;
-
-    auto blueOrbEntity = m_registry.create();
-    m_registry.emplace<LightComponent>(blueOrbEntity, blueOrbLight);
-    m_registry.emplace<BodyTransformComponent>(blueOrbEntity, blueOrbTransform);
-    m_registry.emplace<AudioDataComponent>(blueOrbEntity, blueOrbAudio);
-    m_registry.emplace<ShaderProgramComponent>(blueOrbEntity, blueOrbShaderProgram);
-    m_registry.emplace<RenderDataComponent>(blueOrbEntity, blueOrbGraphics);
-    m_registry.emplace<FixtureUserDataComponent>(blueOrbEntity, blueOrbUserData);
-    m_registry.emplace<ShadowFramebufferComponent>(blueOrbEntity, blueOrbShadow);
-    blueOrbUserData.m_enttEntity = &blueOrbEntity;
-
-    auto yellowLampEntity = m_registry.create();
-    m_registry.emplace<LightComponent>(yellowLampEntity, yellowLampLight);
-    m_registry.emplace<BodyTransformComponent>(yellowLampEntity, yellowLampTransform);
-    m_registry.emplace<BodyCircleComponent>(yellowLampEntity, yellowLampCircle);
-    m_registry.emplace<AudioDataComponent>(yellowLampEntity, yellowLampAudio);
-    m_registry.emplace<ShaderProgramComponent>(yellowLampEntity, yellowLampShaderProgram);
-    m_registry.emplace<RenderDataComponent>(yellowLampEntity, yellowLampGraphics);
-    m_registry.emplace<FixtureUserDataComponent>(yellowLampEntity, yellowLampUserData);
-    m_registry.emplace<ShadowFramebufferComponent>(yellowLampEntity, yellowLampShadow);
-    yellowLampUserData.m_enttEntity = &yellowLampEntity;
-
-    auto magentaLampEntity = m_registry.create();
-    m_registry.emplace<LightComponent>(magentaLampEntity, magentaLampLight);
-    m_registry.emplace<BodyTransformComponent>(magentaLampEntity, magentaLampTransform);
-    m_registry.emplace<BodyCircleComponent>(magentaLampEntity, magentaLampCircle);
-    m_registry.emplace<AudioDataComponent>(magentaLampEntity, magentaLampAudio);
-    m_registry.emplace<ShaderProgramComponent>(magentaLampEntity, magentaLampShaderProgram);
-    m_registry.emplace<RenderDataComponent>(magentaLampEntity, magentaLampGraphics);
-    m_registry.emplace<FixtureUserDataComponent>(magentaLampEntity, magentaLampUserData);
-    m_registry.emplace<ShadowFramebufferComponent>(magentaLampEntity, magentaLampShadow);
-    magentaLampUserData.m_enttEntity = &magentaLampEntity;
-
-    auto cyanLampEntity = m_registry.create();
-    m_registry.emplace<LightComponent>(cyanLampEntity, cyanLampLight);
-    m_registry.emplace<BodyTransformComponent>(cyanLampEntity, cyanLampTransform);
-    m_registry.emplace<BodyCircleComponent>(cyanLampEntity, cyanLampCircle);
-    m_registry.emplace<AudioDataComponent>(cyanLampEntity, cyanLampAudio);
-    m_registry.emplace<ShaderProgramComponent>(cyanLampEntity, cyanLampShaderProgram);
-    m_registry.emplace<RenderDataComponent>(cyanLampEntity, cyanLampGraphics);
-    m_registry.emplace<FixtureUserDataComponent>(cyanLampEntity, cyanLampUserData);
-    m_registry.emplace<ShadowFramebufferComponent>(cyanLampEntity, cyanLampShadow);
-    cyanLampUserData.m_enttEntity = &cyanLampEntity;
-
-    auto playerEntity = m_registry.create();
-    m_registry.emplace<PlayerComponent>(playerEntity, playerPlayer);
-    m_registry.emplace<MaterialComponent>(playerEntity, playerMaterial);
-    m_registry.emplace<BodyTransformComponent>(playerEntity, playerTransform);
-    m_registry.emplace<TextureComponent>(playerEntity, playerTexture);
-    m_registry.emplace<AudioDataComponent>(playerEntity, playerAudio);
-    m_registry.emplace<ShaderProgramComponent>(playerEntity, playerShaderProgram);
-    m_registry.emplace<RenderDataComponent>(playerEntity, playerGraphics);
-    m_registry.emplace<FixtureUserDataComponent>(playerEntity, playerUserData);
-    playerUserData.m_enttEntity = &playerEntity;
-
-    auto floorEntity = m_registry.create();
-    m_registry.emplace<MaterialComponent>(floorEntity, floorMaterial);
-    m_registry.emplace<BodyTransformComponent>(floorEntity, floorTransform);
-    m_registry.emplace<TextureComponent>(floorEntity, floorTexture);
-    m_registry.emplace<AudioDataComponent>(floorEntity, floorAudio);
-    m_registry.emplace<ShaderProgramComponent>(floorEntity, floorShaderProgram);
-    m_registry.emplace<RenderDataComponent>(floorEntity, floorGraphics);
-    m_registry.emplace<FixtureUserDataComponent>(floorEntity, floorUserData);
-    floorUserData.m_enttEntity = &floorEntity;
-
-    auto sphereEntity = m_registry.create();
-    m_registry.emplace<MaterialComponent>(sphereEntity, sphereMaterial);
-    m_registry.emplace<BodyTransformComponent>(sphereEntity, sphereTransform);
-    m_registry.emplace<TextureComponent>(sphereEntity, sphereTexture);
-    m_registry.emplace<AudioDataComponent>(sphereEntity, sphereAudio);
-    m_registry.emplace<ShaderProgramComponent>(sphereEntity, sphereShaderProgram);
-    m_registry.emplace<RenderDataComponent>(sphereEntity, sphereGraphics);
-    m_registry.emplace<FixtureUserDataComponent>(sphereEntity, sphereUserData);
-    sphereUserData.m_enttEntity = &sphereEntity;
-
-    auto goldEntity = m_registry.create();
-    m_registry.emplace<MaterialComponent>(goldEntity, goldMaterial);
-    m_registry.emplace<BodyTransformComponent>(goldEntity, goldTransform);
-    m_registry.emplace<TextureComponent>(goldEntity, goldTexture);
-    m_registry.emplace<AudioDataComponent>(goldEntity, goldAudio);
-    m_registry.emplace<ShaderProgramComponent>(goldEntity, goldShaderProgram);
-    m_registry.emplace<RenderDataComponent>(goldEntity, goldGraphics);
-    m_registry.emplace<FixtureUserDataComponent>(goldEntity, goldUserData);
-    goldUserData.m_enttEntity = &goldEntity;
-
-    auto cubeEntity = m_registry.create();
-    m_registry.emplace<MaterialComponent>(cubeEntity, cubeMaterial);
-    m_registry.emplace<BodyTransformComponent>(cubeEntity, cubeTransform);
-    m_registry.emplace<TextureComponent>(cubeEntity, cubeTexture);
-    m_registry.emplace<AudioDataComponent>(cubeEntity, cubeAudio);
-    m_registry.emplace<ShaderProgramComponent>(cubeEntity, cubeShaderProgram);
-    m_registry.emplace<RenderDataComponent>(cubeEntity, cubeGraphics);
-    m_registry.emplace<FixtureUserDataComponent>(cubeEntity, cubeUserData);
-    cubeUserData.m_enttEntity = &cubeEntity;
-
-    auto windowEntity = m_registry.create();
-    m_registry.emplace<SpriteComponent>(windowEntity, windowSprite);
-    m_registry.emplace<TextureComponent>(windowEntity, windowTexture);
-    m_registry.emplace<ShaderProgramComponent>(windowEntity, windowShaderProgram);
-    m_registry.emplace<RenderDataComponent>(windowEntity, windowGraphics);
-
-    auto idtextEntity = m_registry.create();
-    m_registry.emplace<TextComponent>(idtextEntity, idtextText);
-    m_registry.emplace<ShaderProgramComponent>(idtextEntity, idtextShaderProgram);
-    m_registry.emplace<RenderDataComponent>(idtextEntity, idtextGraphics);
-
-    auto linkEntity = m_registry.create();
-    m_registry.emplace<TextComponent>(linkEntity, linkText);
-    m_registry.emplace<ShaderProgramComponent>(linkEntity, linkShaderProgram);
-    m_registry.emplace<RenderDataComponent>(linkEntity, linkGraphics);
+void Game::setStreamTextures(bool streamTextures) {
+    m_streamTextures = streamTextures;
 }
 
 // _____________________________________________________________________________
@@ -1173,8 +328,31 @@ void Game::setup() {
 // -----------------------------------------------------------------------------
 
 void Game::run() {
+    if (m_runMode == headless) {
+        runHeadless();
+        return;
+    }
+    if (m_runMode == multiThreaded) {
+        ONSET_INFO("Running simulation on its own thread");
+        m_simulationThread = std::thread(&Game::simulate, this);
+
+        // the main thread owns the window and GL context, so it only renders
+        while (!glfwWindowShouldClose(m_windowManager->m_glfwWindow) && m_isRunning) {
+            ONSET_PROFILE_SCOPE("frame");
+            const FrameSnapshot& snapshot = m_snapshots.acquire();
+            // time elapsed since the snapshot's state, as a fraction of a step
+            double renderFactor = (glfwGetTime() - snapshot.m_time) / TIME_STEP;
+            render(static_cast<float>(std::min(std::max(renderFactor, 0.0), 1.0)));
+        }
+
+        m_isRunning = false;
+        m_simulationThread.join();
+        return;
+    }
+
     // glfwWindowShouldClose() returns GL_FALSE until window instructed to close
     while (!glfwWindowShouldClose(m_windowManager->m_glfwWindow) && m_isRunning) {
+        ONSET_PROFILE_SCOPE("frame");
         // find time-step 
         double currentTime = glfwGetTime();    // returns time in secs
         double deltaTime = currentTime - previousTime;
@@ -1189,42 +367,172 @@ void Game::run() {
         // game loop
         processInput();
         // use a fixed-step for Update(), for physics and AI
+        bool stepped = false;
         while (lag >= TIME_STEP) {
             update(TIME_STEP, VELOCITY_ITERATIONS, POSITION_ITERATIONS);
             lag -= TIME_STEP;
+            stepped = true;
+        }
+        if (stepped) {
+            publishSnapshot(currentTime - lag);
         }
+        m_snapshots.acquire();
         // normalize renderFactor [0, 1.0], used  to interpolate rendering
         render(lag / TIME_STEP);
     }
 }
 
+void Game::simulate() {
+    ONSET_PROFILE_THREAD("simulation");
+    while (m_isRunning) {
+        double currentTime = glfwGetTime();
+        double deltaTime = currentTime - previousTime;
+        if (deltaTime > 0.25) {
+            deltaTime = 0.25;
+            ONSET_WARN("The calculated deltaTime exceeded 0.25 seconds");
+        }
+        previousTime = currentTime;
+        lag += deltaTime;
+
+        processInput();
+        bool stepped = false;
+        while (lag >= TIME_STEP) {
+            update(TIME_STEP, VELOCITY_ITERATIONS, POSITION_ITERATIONS);
+            lag -= TIME_STEP;
+            stepped = true;
+        }
+        if (stepped) {
+            publishSnapshot(currentTime - lag);
+        }
+
+        // nothing to simulate until the next step is due
+        std::this_thread::sleep_for(std::chrono::duration<double>(TIME_STEP - lag));
+    }
+}
+
+void Game::runHeadless() {
+    ONSET_INFO("Running {} headless steps", m_headlessSteps);
+    auto startTime = std::chrono::steady_clock::now();
+
+    // no wall clock to keep up with, step as fast as possible
+    for (unsigned int step = 0; step < m_headlessSteps && m_isRunning; step++) {
+        ONSET_PROFILE_SCOPE("headless step");
+        processInput();
+        update(TIME_STEP, VELOCITY_ITERATIONS, POSITION_ITERATIONS);
+    }
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - startTime;
+    ONSET_INFO(
+        "Simulated {:.2f} seconds in {:.3f} seconds ({:.0f} steps per second)", 
+        m_headlessSteps * TIME_STEP, 
+        elapsed.count(), 
+        elapsed.count() > 0.0 ? m_headlessSteps / elapsed.count() : 0.0
+    );
+    // no window to press the dump key in, so always keep the trace
+    m_profileManager.handleDumpCommand();
+}
+
 void Game::processInput() {
+    ONSET_PROFILE_SCOPE("Game::processInput");
     // emits all the events of the given type at once
     // m_dispatcher.update<an_event>();
 
-    // emits all the events queued so far at once
+    // emits all the events queued so far at once, input callbacks may be 
+    // enqueueing from the main thread
+    std::lock_guard<std::mutex> lock(m_dispatcherMutex);
     m_dispatcher.update();
 }
 
 void Game::update(const float timeStep, const int32 velocityIterations, const int32 positionIterations) {
-    // box2D update
-    m_world->Step(timeStep, velocityIterations, positionIterations);
-    m_cameraSystem.update(timeStep);
+    // queued forces are applied before the world steps, transforms are 
+    // extracted after it, then the systems reading transforms run in parallel.
+    // all component pools exist after setup(), so views taken inside jobs 
+    // only read the registry's pool map
+    ONSET_PROFILE_SCOPE("Game::update");
+    // recorded commands are dispatched right before the step they preceded
+    if (m_inputRecorder.isReplaying()) {
+        std::lock_guard<std::mutex> lock(m_dispatcherMutex);
+        m_inputRecorder.replayStep(m_dispatcher);
+        m_dispatcher.update();
+    }
+
+    m_stepTime = timeStep;
+    m_velocityIterations = velocityIterations;
+    m_positionIterations = positionIterations;
+    m_jobManager.run(m_updateGraph);
+    m_inputRecorder.endStep();
+}
+
+void Game::buildUpdateGraph() {
+    // the graph is the same every step, its jobs read the step's arguments
+    m_updateGraph.clear();
+    unsigned int forces = m_updateGraph.addJob("select mode forces", [this]() {
+        ONSET_PROFILE_SCOPE("select mode forces");
+        m_selectModeSystem.update();
+    });
+    unsigned int physics = m_updateGraph.addJob("physics step", [this]() {
+        ONSET_PROFILE_SCOPE("physics step");
+        // box2D update
+        m_world->Step(m_stepTime, m_velocityIterations, m_positionIterations);
+    });
+    unsigned int transforms = m_updateGraph.addJob("transform extraction", [this]() {
+        ONSET_PROFILE_SCOPE("transform extraction");
+        m_transformSystem.update();
+    });
+    unsigned int camera = m_updateGraph.addJob("camera follow", [this]() {
+        ONSET_PROFILE_SCOPE("camera follow");
+        m_cameraSystem.update(m_stepTime);
+    });
+    unsigned int audio = m_updateGraph.addJob("audio sync", [this]() {
+        ONSET_PROFILE_SCOPE("audio sync");
+        m_audioSystem.update();
+    });
+
+    m_updateGraph.addDependency(forces, physics);
+    m_updateGraph.addDependency(physics, transforms);
+    m_updateGraph.addDependency(transforms, camera);
+    m_updateGraph.addDependency(transforms, audio);
 }
 
 void Game::render(const float renderFactor) {
+    ONSET_PROFILE_SCOPE("Game::render");
     // specify color values to then use in filling color buffer
     glClearColor(0.1f, 0.1f, 0.1f, 1.0f);   // R, G, B, Alpha
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
 
-    m_renderSystem.update(renderFactor, m_registry);
+    m_assetManager.updateStreaming();
+    m_renderSystem.update(renderFactor, m_snapshots.getReadSnapshot());
 
     // swap front and back buffers (drawing to back buffer, displaying front)
-    glfwSwapBuffers(m_windowManager->m_glfwWindow);
+    {
+        ONSET_PROFILE_SCOPE("glfwSwapBuffers");
+        glfwSwapBuffers(m_windowManager->m_glfwWindow);
+    }
     // call window and input callbacks associated with these events
     glfwPollEvents();
 }
 
+void Game::runFrame() {
+    ONSET_PROFILE_SCOPE("frame");
+    processInput();
+    update(TIME_STEP, VELOCITY_ITERATIONS, POSITION_ITERATIONS);
+    if (m_runMode == headless) {
+        return;
+    }
+
+    publishSnapshot(glfwGetTime());
+    m_snapshots.acquire();
+    render(1.0f);
+}
+
+void Game::publishSnapshot(double time) {
+    ONSET_PROFILE_SCOPE("Game::publishSnapshot");
+    FrameSnapshot& snapshot = m_snapshots.getWriteSnapshot();
+    m_snapshotSystem.update(snapshot);
+    snapshot.m_time = time;
+    m_snapshots.publish();
+}
+
 // _____________________________________________________________________________
 // -----------------------------------------------------------------------------
 // Post - Game Loop
@@ -1234,14 +542,56 @@ void Game::render(const float renderFactor) {
 void Game::destroy() {
     // temporarily deleting buffers, assets, entities here for now
     // TODO: will need to use these methods between game levels
-    m_renderSystem.deleteBuffers(m_registry);
+    if (m_runMode != headless) {
+        m_renderSystem.deleteBuffers(m_registry);
+        m_assetManager.deleteAssets();
+    }
+    m_inputRecorder.stopRecording();
     m_audioManager.deleteBuffers();
     m_audioSystem.deleteSources();
-    m_assetManager.deleteAssets();
     m_registry.clear();
     
-    m_textManager.destroy();
-    m_inputInvoker->destroy();
-    m_windowManager->destroy();
+    if (m_runMode != headless) {
+        m_textManager.destroy();
+        m_gpuProfileManager.destroy();
+        m_inputInvoker->destroy();
+        m_windowManager->destroy();
+    }
+    m_jobManager.destroy();
+    m_profileManager.destroy();
     m_logManager.destroy();
-}
\ No newline at end of file
+}
+
+// _____________________________________________________________________________
+// -----------------------------------------------------------------------------
+// Accessors
+// _____________________________________________________________________________
+// -----------------------------------------------------------------------------
+
+entt::registry& Game::getRegistry() {
+    return m_registry;
+}
+
+b2World& Game::getWorld() {
+    return *m_world;
+}
+
+RenderSystem& Game::getRenderSystem() {
+    return m_renderSystem;
+}
+
+AssetManager& Game::getAssetManager() {
+    return m_assetManager;
+}
+
+TextManager& Game::getTextManager() {
+    return m_textManager;
+}
+
+ProfileManager& Game::getProfileManager() {
+    return m_profileManager;
+}
+
+GpuProfileManager& Game::getGpuProfileManager() {
+    return m_gpuProfileManager;
+}
@@ -0,0 +1,134 @@
+// -----------------------------------------------------------------------------
+// Onset Engine
+// https://github.com/dylanafterall/OnsetEngine.git
+//
+// core_gpu_profile_manager.cpp
+//  implementation of GpuProfileManager class, GPU time of each render pass
+// -----------------------------------------------------------------------------
+
+#include "core_gpu_profile_manager.h"
+
+#include <iomanip>
+#include <sstream>
+
+void GpuProfileManager::initialize() {
+    glGenQueries(2 * gpuPassCount, &m_queries[0][0]);
+    m_isInitialized = true;
+}
+
+void GpuProfileManager::destroy() {
+    if (!m_isInitialized) {
+        return;
+    }
+    glDeleteQueries(2 * gpuPassCount, &m_queries[0][0]);
+    m_isInitialized = false;
+}
+
+void GpuProfileManager::beginFrame() {
+    if (!m_isInitialized) {
+        return;
+    }
+
+    // the set about to be reused is two frames old, then collect last frame's.
+    // results the GPU hasn't made available are left for the next frame, or
+    // dropped once their query is reused
+    unsigned int sets[2] = {m_frameIndex, m_frameIndex ^ 1};
+    for (unsigned int set : sets) {
+        for (int pass = 0; pass < gpuPassCount; pass++) {
+            if (!m_pending[set][pass]) {
+                continue;
+            }
+            GLint available = 0;
+            glGetQueryObjectiv(m_queries[set][pass], GL_QUERY_RESULT_AVAILABLE, &available);
+            if (!available) {
+                continue;
+            }
+            GLuint64 nanoseconds = 0;
+            glGetQueryObjectui64v(m_queries[set][pass], GL_QUERY_RESULT, &nanoseconds);
+            m_pending[set][pass] = false;
+
+            m_lastMilliseconds[pass] = nanoseconds / 1000000.0;
+            m_totalMilliseconds[pass] += m_lastMilliseconds[pass];
+            m_sampleCount[pass]++;
+        }
+    }
+    for (int pass = 0; pass < gpuPassCount; pass++) {
+        m_pending[m_frameIndex][pass] = false;
+    }
+}
+
+void GpuProfileManager::endFrame() {
+    if (!m_isInitialized) {
+        return;
+    }
+    m_frameIndex ^= 1;
+
+    m_framesSinceSummary++;
+    if (m_summaryInterval == 0 || m_framesSinceSummary < m_summaryInterval) {
+        return;
+    }
+
+    std::ostringstream summary;
+    summary << std::fixed << std::setprecision(3);
+    double frameTotal = 0.0;
+    for (int pass = 0; pass < gpuPassCount; pass++) {
+        double average = getAverageMilliseconds(static_cast<GpuPass>(pass));
+        frameTotal += average;
+        summary << (pass == 0 ? "" : ", ") << getPassName(static_cast<GpuPass>(pass)) << " " << average;
+    }
+    ONSET_INFO("GPU ms per frame over {} frames: {} (total {:.3f})", m_framesSinceSummary, summary.str(), frameTotal);
+
+    resetAverages();
+}
+
+void GpuProfileManager::beginPass(GpuPass pass) {
+    if (!m_isInitialized) {
+        return;
+    }
+    glBeginQuery(GL_TIME_ELAPSED, m_queries[m_frameIndex][pass]);
+}
+
+void GpuProfileManager::endPass(GpuPass pass) {
+    if (!m_isInitialized) {
+        return;
+    }
+    glEndQuery(GL_TIME_ELAPSED);
+    m_pending[m_frameIndex][pass] = true;
+}
+
+double GpuProfileManager::getPassMilliseconds(GpuPass pass) const {
+    return m_lastMilliseconds[pass];
+}
+
+double GpuProfileManager::getAverageMilliseconds(GpuPass pass) const {
+    if (m_sampleCount[pass] == 0) {
+        return 0.0;
+    }
+    return m_totalMilliseconds[pass] / m_sampleCount[pass];
+}
+
+const char* GpuProfileManager::getPassName(GpuPass pass) {
+    switch (pass) {
+        case spotShadowPass:    return "spot shadows";
+        case pointShadowPass:   return "point shadows";
+        case lightPass:         return "lights";
+        case skyboxPass:        return "skybox";
+        case gameplayPass:      return "gameplay";
+        case spritePass:        return "sprites";
+        case textPass:          return "text";
+        case stencilPass:       return "stencil outlines";
+        default:                return "unknown";
+    }
+}
+
+void GpuProfileManager::setSummaryInterval(unsigned int frames) {
+    m_summaryInterval = frames;
+}
+
+void GpuProfileManager::resetAverages() {
+    for (int pass = 0; pass < gpuPassCount; pass++) {
+        m_totalMilliseconds[pass] = 0.0;
+        m_sampleCount[pass] = 0;
+    }
+    m_framesSinceSummary = 0;
+}
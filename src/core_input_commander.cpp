@@ -120,4 +120,9 @@ void CameraYawLeftCommand::execute(entt::dispatcher& dispatcher) const {
 
 void CameraYawRightCommand::execute(entt::dispatcher& dispatcher) const {
     dispatcher.enqueue<CameraYawRightCommand>();
+}
+
+// -----------------------------------------------------------------------------
+void DumpProfileCommand::execute(entt::dispatcher& dispatcher) const {
+    dispatcher.enqueue<DumpProfileCommand>();
 }
\ No newline at end of file
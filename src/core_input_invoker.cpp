@@ -80,6 +80,7 @@ void InputInvoker::initialize(
     set8KeyCommand(new CameraPitchDownCommand());
     set9KeyCommand(new CameraYawLeftCommand());
     set0KeyCommand(new CameraYawRightCommand());
+    setPKeyCommand(new DumpProfileCommand());
     setShiftAKeyCommand(new SelectedLeftCommand);
     setShiftSKeyCommand(new SelectedDownCommand);
     setShiftDKeyCommand(new SelectedRightCommand);
@@ -112,12 +113,25 @@ void InputInvoker::destroy() {
     delete m_key8;
     delete m_key9;
     delete m_key0;
+    delete m_keyP;
     delete m_keyShiftA;
     delete m_keyShiftS;
     delete m_keyShiftD;
     delete m_keyShiftW;
 }
 
+void InputInvoker::setDispatcherMutex(std::mutex* dispatcherMutex) {
+    m_dispatcherMutex = dispatcherMutex;
+}
+
+void InputInvoker::setCommandsEnabled(bool enabled) {
+    m_commandsEnabled = enabled;
+}
+
+bool InputInvoker::getCommandsEnabled() const {
+    return m_commandsEnabled;
+}
+
 // _____________________________________________________________________________
 // -----------------------------------------------------------------------------
 // handling inputs
@@ -125,6 +139,16 @@ void InputInvoker::destroy() {
 // -----------------------------------------------------------------------------
 
 void InputInvoker::handleKeyInput(GLFWwindow* window, int key, int scancode, int action, int mods) {
+    // the simulation thread may be updating the dispatcher
+    std::unique_lock<std::mutex> lock;
+    if (m_dispatcherMutex) {
+        lock = std::unique_lock<std::mutex>(*m_dispatcherMutex);
+    }
+
+    if (!m_commandsEnabled && key != GLFW_KEY_ESCAPE) {
+        return;
+    }
+
     if (action == GLFW_PRESS) {
         switch (key) {
             case GLFW_KEY_ESCAPE:
@@ -191,6 +215,9 @@ void InputInvoker::handleKeyInput(GLFWwindow* window, int key, int scancode, int
             case GLFW_KEY_0:
                 m_key0->execute(*m_dispatcherPtr);
                 break;
+            case GLFW_KEY_P:
+                m_keyP->execute(*m_dispatcherPtr);
+                break;
         }
     }
 }
@@ -211,6 +238,15 @@ void InputInvoker::handleMouseInput(double xposIn, double yposIn) {
 
     m_lastX = xpos;
     m_lastY = ypos;
+    if (!m_commandsEnabled) {
+        return;
+    }
+
+    // the simulation thread may be updating the dispatcher
+    std::unique_lock<std::mutex> lock;
+    if (m_dispatcherMutex) {
+        lock = std::unique_lock<std::mutex>(*m_dispatcherMutex);
+    }
 
     // call InputCommander
     // if cursor is moving to the right
@@ -233,6 +269,16 @@ void InputInvoker::handleMouseInput(double xposIn, double yposIn) {
 }
 
 void InputInvoker::handleScrollInput(float yoffset) {
+    if (!m_commandsEnabled) {
+        return;
+    }
+
+    // the simulation thread may be updating the dispatcher
+    std::unique_lock<std::mutex> lock;
+    if (m_dispatcherMutex) {
+        lock = std::unique_lock<std::mutex>(*m_dispatcherMutex);
+    }
+
     // positive yoffset means scroll down
     if (yoffset > 0) {m_scrollDownMove->execute(*m_dispatcherPtr);}
     // negative yoffset is scroll up
@@ -357,6 +403,10 @@ void InputInvoker::set0KeyCommand(IInputCommand* command) {
     m_key0 = command;
 }
 
+void InputInvoker::setPKeyCommand(IInputCommand* command) {
+    m_keyP = command;
+}
+
 void InputInvoker::setShiftAKeyCommand(IInputCommand* command) {
     m_keyShiftA = command;
 }
@@ -0,0 +1,215 @@
+// -----------------------------------------------------------------------------
+// Onset Engine
+// https://github.com/dylanafterall/OnsetEngine.git
+//
+// core_input_recorder.cpp
+//  implementation of InputRecorder class, records and replays input commands
+// -----------------------------------------------------------------------------
+
+#include "core_input_recorder.h"
+
+#include <algorithm>
+#include <iterator>
+
+static const char RECORDING_MAGIC[8] = {'O', 'N', 'S', 'E', 'T', 'I', 'N', 'P'};
+static const std::uint32_t RECORDING_VERSION = 1;
+
+template<typename Command, InputCommandId Id>
+void InputRecorder::connectCommand(entt::dispatcher& dispatcher) {
+    dispatcher.sink<Command>().template connect<&InputRecorder::recordCommand<Id>>(*this);
+    m_commands[Id] = std::make_unique<Command>();
+}
+
+template<InputCommandId Id>
+void InputRecorder::recordCommand() {
+    record(Id);
+}
+
+void InputRecorder::connect(entt::dispatcher& dispatcher) {
+    connectCommand<LeftCommand, leftCommandId>(dispatcher);
+    connectCommand<DownCommand, downCommandId>(dispatcher);
+    connectCommand<RightCommand, rightCommandId>(dispatcher);
+    connectCommand<UpCommand, upCommandId>(dispatcher);
+    connectCommand<SelectedLeftCommand, selectedLeftCommandId>(dispatcher);
+    connectCommand<SelectedDownCommand, selectedDownCommandId>(dispatcher);
+    connectCommand<SelectedRightCommand, selectedRightCommandId>(dispatcher);
+    connectCommand<SelectedUpCommand, selectedUpCommandId>(dispatcher);
+    connectCommand<ToggleSelectModeCommand, toggleSelectModeCommandId>(dispatcher);
+    connectCommand<CameraUpCommand, cameraUpCommandId>(dispatcher);
+    connectCommand<CameraDownCommand, cameraDownCommandId>(dispatcher);
+    connectCommand<CameraLeftCommand, cameraLeftCommandId>(dispatcher);
+    connectCommand<CameraRightCommand, cameraRightCommandId>(dispatcher);
+    connectCommand<CameraForwardCommand, cameraForwardCommandId>(dispatcher);
+    connectCommand<CameraBackwardCommand, cameraBackwardCommandId>(dispatcher);
+    connectCommand<CameraZoomInCommand, cameraZoomInCommandId>(dispatcher);
+    connectCommand<CameraZoomOutCommand, cameraZoomOutCommandId>(dispatcher);
+    connectCommand<CameraPitchUpCommand, cameraPitchUpCommandId>(dispatcher);
+    connectCommand<CameraPitchDownCommand, cameraPitchDownCommandId>(dispatcher);
+    connectCommand<CameraYawLeftCommand, cameraYawLeftCommandId>(dispatcher);
+    connectCommand<CameraYawRightCommand, cameraYawRightCommandId>(dispatcher);
+    connectCommand<DumpProfileCommand, dumpProfileCommandId>(dispatcher);
+}
+
+void InputRecorder::setInputInvoker(InputInvoker* inputInvoker) {
+    m_inputInvoker = inputInvoker;
+}
+
+// _____________________________________________________________________________
+// -----------------------------------------------------------------------------
+// recording
+// _____________________________________________________________________________
+// -----------------------------------------------------------------------------
+
+bool InputRecorder::startRecording(const std::string& path) {
+    stopRecording();
+    m_recordFile.open(path, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!m_recordFile.is_open()) {
+        ONSET_ERROR("Input Recorder failed to open recording file {}", path);
+        return false;
+    }
+
+    m_recordFile.write(RECORDING_MAGIC, sizeof(RECORDING_MAGIC));
+    for (int shift = 0; shift < 32; shift += 8) {
+        m_recordFile.put(static_cast<char>((RECORDING_VERSION >> shift) & 0xFF));
+    }
+    // deltas are taken from the step recording started at
+    m_lastRecordedStep = m_step;
+    m_recordCount = 0;
+    ONSET_INFO("Input Recorder recording to {}", path);
+    return true;
+}
+
+void InputRecorder::stopRecording() {
+    if (!m_recordFile.is_open()) {
+        return;
+    }
+    m_recordFile.close();
+    ONSET_INFO("Input Recorder recorded {} commands", m_recordCount);
+}
+
+void InputRecorder::record(InputCommandId command) {
+    if (!m_recordFile.is_open()) {
+        return;
+    }
+
+    // step delta as a LEB128 varint: 7 bits per byte, high bit set if more
+    std::uint64_t delta = m_step - m_lastRecordedStep;
+    do {
+        std::uint8_t byte = delta & 0x7F;
+        delta >>= 7;
+        m_recordFile.put(static_cast<char>(delta ? byte | 0x80 : byte));
+    } while (delta);
+    m_recordFile.put(static_cast<char>(command));
+
+    m_lastRecordedStep = m_step;
+    m_recordCount++;
+}
+
+// _____________________________________________________________________________
+// -----------------------------------------------------------------------------
+// replaying
+// _____________________________________________________________________________
+// -----------------------------------------------------------------------------
+
+bool InputRecorder::startReplay(const std::string& path) {
+    std::ifstream file(path, std::ios::in | std::ios::binary);
+    if (!file.is_open()) {
+        ONSET_ERROR("Input Recorder failed to open recording file {}", path);
+        return false;
+    }
+    std::vector<std::uint8_t> bytes(
+        (std::istreambuf_iterator<char>(file)),
+        std::istreambuf_iterator<char>()
+    );
+
+    // header
+    // .........................................................................
+    std::size_t headerSize = sizeof(RECORDING_MAGIC) + 4;
+    if (bytes.size() < headerSize || !std::equal(RECORDING_MAGIC, RECORDING_MAGIC + sizeof(RECORDING_MAGIC), bytes.begin())) {
+        ONSET_ERROR("Input Recorder found no recording header in {}", path);
+        return false;
+    }
+    std::uint32_t version = 0;
+    for (int i = 0; i < 4; i++) {
+        version |= static_cast<std::uint32_t>(bytes[sizeof(RECORDING_MAGIC) + i]) << (8 * i);
+    }
+    if (version != RECORDING_VERSION) {
+        ONSET_ERROR("Input Recorder cannot read version {} recording {}", version, path);
+        return false;
+    }
+
+    // commands, steps relative to the step the replay starts at
+    // .........................................................................
+    std::vector<InputRecord> records;
+    std::uint64_t step = m_step;
+    std::size_t i = headerSize;
+    while (i < bytes.size()) {
+        std::uint64_t delta = 0;
+        int shift = 0;
+        while (i < bytes.size() && (bytes[i] & 0x80) && shift < 63) {
+            delta |= static_cast<std::uint64_t>(bytes[i++] & 0x7F) << shift;
+            shift += 7;
+        }
+        if (i + 1 >= bytes.size() || bytes[i] & 0x80) {
+            ONSET_ERROR("Input Recorder found a truncated command in {}", path);
+            return false;
+        }
+        delta |= static_cast<std::uint64_t>(bytes[i++]) << shift;
+        if (bytes[i] >= inputCommandCount) {
+            ONSET_ERROR("Input Recorder found unknown command {} in {}", static_cast<unsigned int>(bytes[i]), path);
+            return false;
+        }
+
+        step += delta;
+        InputRecord record;
+        record.m_step = step;
+        record.m_command = static_cast<InputCommandId>(bytes[i++]);
+        records.push_back(record);
+    }
+
+    m_replay.swap(records);
+    m_replayIndex = 0;
+    // user input would diverge from the recorded session
+    if (m_inputInvoker) {
+        m_inputInvoker->setCommandsEnabled(!isReplaying());
+    }
+    ONSET_INFO(
+        "Input Recorder replaying {} commands over {} steps from {}",
+        m_replay.size(),
+        m_replay.empty() ? 0 : m_replay.back().m_step - m_step + 1,
+        path
+    );
+    return true;
+}
+
+void InputRecorder::replayStep(entt::dispatcher& dispatcher) {
+    while (m_replayIndex < m_replay.size() && m_replay[m_replayIndex].m_step <= m_step) {
+        const IInputCommand* command = m_commands[m_replay[m_replayIndex].m_command].get();
+        if (command) {
+            command->execute(dispatcher);
+        }
+        m_replayIndex++;
+    }
+    if (m_replayIndex == m_replay.size() && !m_replay.empty()) {
+        ONSET_INFO("Input Recorder finished replay at step {}", m_step);
+        m_replay.clear();
+        m_replayIndex = 0;
+        if (m_inputInvoker) {
+            m_inputInvoker->setCommandsEnabled(true);
+        }
+    }
+}
+
+void InputRecorder::endStep() {
+    m_step++;
+}
+
+// .............................................................................
+
+bool InputRecorder::isRecording() const {
+    return m_recordFile.is_open();
+}
+
+bool InputRecorder::isReplaying() const {
+    return m_replayIndex < m_replay.size();
+}
@@ -0,0 +1,258 @@
+// -----------------------------------------------------------------------------
+// Onset Engine
+// https://github.com/dylanafterall/OnsetEngine.git
+//
+// core_job_manager.cpp
+//  implementation of JobManager class, work-stealing scheduler for dependent jobs
+// -----------------------------------------------------------------------------
+
+#include "core_job_manager.h"
+
+// index of the queue owned by the current thread, workers overwrite this when
+// they start. all other threads share the final queue of the manager
+static thread_local int t_queueIndex = -1;
+
+// _____________________________________________________________________________
+// -----------------------------------------------------------------------------
+// JobGraph
+// _____________________________________________________________________________
+// -----------------------------------------------------------------------------
+
+unsigned int JobGraph::addJob(const std::string& name, std::function<void()> function) {
+    m_jobs.emplace_back();
+    Job& job = m_jobs.back();
+    job.m_name = name;
+    job.m_function = std::move(function);
+    job.m_graph = this;
+
+    return static_cast<unsigned int>(m_jobs.size() - 1);
+}
+
+void JobGraph::addDependency(unsigned int before, unsigned int after) {
+    if (before >= m_jobs.size() || after >= m_jobs.size() || before == after) {
+        ONSET_ERROR("JobGraph: invalid dependency {} -> {}", before, after);
+        return;
+    }
+
+    m_jobs[before].m_successors.push_back(after);
+    m_jobs[after].m_dependencyCount++;
+}
+
+void JobGraph::clear() {
+    m_jobs.clear();
+}
+
+std::size_t JobGraph::size() const {
+    return m_jobs.size();
+}
+
+// _____________________________________________________________________________
+// -----------------------------------------------------------------------------
+// JobManager
+// _____________________________________________________________________________
+// -----------------------------------------------------------------------------
+
+void JobManager::initialize() {
+    // leave one hardware thread for the caller, which helps run every graph
+    unsigned int hardwareThreads = std::thread::hardware_concurrency();
+    initialize(hardwareThreads > 1 ? hardwareThreads - 1 : 0);
+}
+
+void JobManager::initialize(unsigned int workerCount) {
+    m_isRunning = true;
+
+    // one queue per worker, plus the queue shared by non-worker threads
+    for (unsigned int i = 0; i <= workerCount; i++) {
+        m_queues.push_back(std::make_unique<WorkQueue>());
+    }
+    for (unsigned int i = 0; i < workerCount; i++) {
+        m_workers.emplace_back(&JobManager::workerLoop, this, i);
+    }
+
+    ONSET_INFO("Job Manager started {} worker threads", workerCount);
+}
+
+void JobManager::destroy() {
+    {
+        std::lock_guard<std::mutex> lock(m_wakeMutex);
+        m_isRunning = false;
+    }
+    m_wakeCondition.notify_all();
+
+    for (auto& worker : m_workers) {
+        worker.join();
+    }
+    m_workers.clear();
+    m_queues.clear();
+}
+
+void JobManager::run(JobGraph& graph) {
+    if (graph.m_jobs.empty()) {
+        return;
+    }
+
+    // reset dependency counters, so a graph can be run again every frame
+    graph.m_pending = static_cast<unsigned int>(graph.m_jobs.size());
+    graph.m_failed = false;
+    graph.m_exception = nullptr;
+    for (auto& job : graph.m_jobs) {
+        job.m_remaining = job.m_dependencyCount;
+    }
+
+    bool hasRoot = false;
+    for (auto& job : graph.m_jobs) {
+        if (job.m_dependencyCount == 0) {
+            push(&job);
+            hasRoot = true;
+        }
+    }
+    if (!hasRoot) {
+        ONSET_ERROR("JobGraph has no job without dependencies, skipping run");
+        return;
+    }
+
+    // help out until every job of this graph is done
+    while (graph.m_pending.load(std::memory_order_acquire) > 0) {
+        Job* job = acquire();
+        if (job) {
+            execute(job);
+        }
+        else {
+            std::this_thread::yield();
+        }
+    }
+
+    // every job is done, so no worker touches the exception any more
+    if (graph.m_exception) {
+        std::exception_ptr exception = nullptr;
+        std::swap(exception, graph.m_exception);
+        std::rethrow_exception(exception);
+    }
+}
+
+void JobManager::parallelFor(
+    std::size_t count,
+    std::size_t grainSize,
+    const std::function<void(std::size_t, std::size_t)>& function
+) {
+    if (count == 0) {
+        return;
+    }
+    if (grainSize == 0) {
+        grainSize = 1;
+    }
+
+    // a single chunk gains nothing from scheduling
+    if (count <= grainSize || m_workers.empty()) {
+        function(0, count);
+        return;
+    }
+
+    JobGraph graph;
+    for (std::size_t begin = 0; begin < count; begin += grainSize) {
+        std::size_t end = std::min(begin + grainSize, count);
+        graph.addJob("parallelFor", [&function, begin, end]() {
+            function(begin, end);
+        });
+    }
+    run(graph);
+}
+
+unsigned int JobManager::getWorkerCount() const {
+    return static_cast<unsigned int>(m_workers.size());
+}
+
+// .............................................................................
+
+void JobManager::workerLoop(unsigned int index) {
+    t_queueIndex = static_cast<int>(index);
+    ONSET_PROFILE_THREAD("job worker");
+
+    while (m_isRunning) {
+        Job* job = acquire();
+        if (job) {
+            execute(job);
+            continue;
+        }
+
+        // nothing to do, sleep until a job is pushed or the pool shuts down
+        std::unique_lock<std::mutex> lock(m_wakeMutex);
+        m_wakeCondition.wait(lock, [&]() {
+            return m_queuedJobs.load() > 0 || !m_isRunning;
+        });
+    }
+}
+
+void JobManager::push(Job* job) {
+    std::size_t index = t_queueIndex < 0 ? m_queues.size() - 1 : t_queueIndex;
+    {
+        std::lock_guard<std::mutex> lock(m_queues[index]->m_mutex);
+        m_queues[index]->m_jobs.push_back(job);
+    }
+    m_queuedJobs++;
+
+    // take the wake mutex so a worker can't miss the notify between checking
+    // its predicate and going to sleep
+    { std::lock_guard<std::mutex> lock(m_wakeMutex); }
+    m_wakeCondition.notify_one();
+}
+
+Job* JobManager::acquire() {
+    std::size_t queueCount = m_queues.size();
+    std::size_t index = t_queueIndex < 0 ? queueCount - 1 : t_queueIndex;
+
+    // newest job from our own queue first, it is most likely to be cache-hot
+    {
+        WorkQueue& own = *m_queues[index];
+        std::lock_guard<std::mutex> lock(own.m_mutex);
+        if (!own.m_jobs.empty()) {
+            Job* job = own.m_jobs.back();
+            own.m_jobs.pop_back();
+            m_queuedJobs--;
+            return job;
+        }
+    }
+
+    // otherwise steal the oldest job of another queue
+    for (std::size_t i = 1; i < queueCount; i++) {
+        WorkQueue& victim = *m_queues[(index + i) % queueCount];
+        std::lock_guard<std::mutex> lock(victim.m_mutex);
+        if (!victim.m_jobs.empty()) {
+            Job* job = victim.m_jobs.front();
+            victim.m_jobs.pop_front();
+            m_queuedJobs--;
+            return job;
+        }
+    }
+
+    return nullptr;
+}
+
+void JobManager::execute(Job* job) {
+    // a throwing job still counts as done, or run would wait on it forever.
+    // jobs after it are skipped, as they may depend on its work
+    JobGraph* graph = job->m_graph;
+    if (!graph->m_failed.load(std::memory_order_acquire)) {
+        try {
+            job->m_function();
+        }
+        catch (...) {
+            std::lock_guard<std::mutex> lock(graph->m_exceptionMutex);
+            if (!graph->m_exception) {
+                graph->m_exception = std::current_exception();
+            }
+            graph->m_failed.store(true, std::memory_order_release);
+        }
+    }
+
+    // release successors before marking this job done, so the graph can't
+    // be seen as finished while work is still being pushed
+    for (unsigned int successor : job->m_successors) {
+        Job& next = graph->m_jobs[successor];
+        if (next.m_remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            push(&next);
+        }
+    }
+
+    graph->m_pending.fetch_sub(1, std::memory_order_release);
+}
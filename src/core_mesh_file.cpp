@@ -0,0 +1,243 @@
+// -----------------------------------------------------------------------------
+// Onset Engine
+// https://github.com/dylanafterall/OnsetEngine.git
+//
+// core_mesh_file.cpp
+//  implementation of MeshFile class
+// -----------------------------------------------------------------------------
+
+#include "core_mesh_file.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// a half float, as tools/formatter writes positions of packed vertices
+static float halfToFloat(std::uint16_t half) {
+    int exponent = (half >> 10) & 0x1F;
+    float mantissa = static_cast<float>(half & 0x3FF);
+    // subnormal: no implicit leading 1
+    float value = exponent == 0
+        ? std::ldexp(mantissa, -24)
+        : std::ldexp(mantissa + 1024.0f, exponent - 25);
+    return (half & 0x8000) ? -value : value;
+}
+
+MeshFile::~MeshFile() {
+    close();
+}
+
+std::string MeshFile::getPath(const std::string& name) {
+    return std::string(MESH_DIRECTORY) + name + MESH_EXTENSION;
+}
+
+bool MeshFile::open(const std::string& path) {
+    close();
+
+#if !defined(_WIN32)
+    int descriptor = ::open(path.c_str(), O_RDONLY);
+    if (descriptor < 0) {
+        ONSET_ERROR("Mesh File failed to open {}", path);
+        return false;
+    }
+    struct stat status;
+    if (fstat(descriptor, &status) != 0 || status.st_size <= 0) {
+        ONSET_ERROR("Mesh File found no mesh in {}", path);
+        ::close(descriptor);
+        return false;
+    }
+    m_size = static_cast<std::size_t>(status.st_size);
+    void* mapping = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    // the mapping holds its own reference to the file
+    ::close(descriptor);
+    if (mapping == MAP_FAILED) {
+        ONSET_ERROR("Mesh File failed to map {}", path);
+        m_size = 0;
+        return false;
+    }
+    m_data = static_cast<const unsigned char*>(mapping);
+#else
+    std::ifstream file(path, std::ios::in | std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        ONSET_ERROR("Mesh File failed to open {}", path);
+        return false;
+    }
+    m_buffer.resize(static_cast<std::size_t>(file.tellg()));
+    file.seekg(0);
+    file.read(reinterpret_cast<char*>(m_buffer.data()), static_cast<std::streamsize>(m_buffer.size()));
+    if (!file || m_buffer.empty()) {
+        ONSET_ERROR("Mesh File failed to read {}", path);
+        m_buffer.clear();
+        return false;
+    }
+    m_data = m_buffer.data();
+    m_size = m_buffer.size();
+#endif
+
+    if (!validate(path)) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+void MeshFile::close() {
+#if !defined(_WIN32)
+    if (m_data) {
+        munmap(const_cast<unsigned char*>(m_data), m_size);
+    }
+#endif
+    m_buffer.clear();
+    m_buffer.shrink_to_fit();
+    m_data = nullptr;
+    m_size = 0;
+    m_header = {};
+    m_lods.clear();
+    m_boundingRadius = 0.0f;
+}
+
+int MeshFile::getVertexFormat() const {
+    return static_cast<int>(m_header.m_vertexFormat);
+}
+
+int MeshFile::getStride() const {
+    int stride = 0;
+    for (std::uint32_t i = 0; i < m_header.m_attributeCount; i++) {
+        stride += static_cast<int>(m_header.m_attributes[i]);
+    }
+    return stride;
+}
+
+int MeshFile::getVertexCount() const {
+    return static_cast<int>(m_header.m_vertexCount);
+}
+
+int MeshFile::getIndexCount() const {
+    return m_lods.empty() ? 0 : static_cast<int>(m_lods[0].m_indexCount);
+}
+
+float MeshFile::getBoundingRadius() const {
+    return m_boundingRadius;
+}
+
+const std::vector<MeshLod>& MeshFile::getLods() const {
+    return m_lods;
+}
+
+const void* MeshFile::getVertices() const {
+    return m_data ? m_data + getVerticesOffset() : nullptr;
+}
+
+int MeshFile::getVerticesSize() const {
+    return static_cast<int>(m_header.m_vertexCount * m_header.m_vertexSize);
+}
+
+const unsigned int* MeshFile::getIndices() const {
+    if (!m_data) {
+        return nullptr;
+    }
+    // 4 byte aligned, as the header, the level table and every vertex are
+    return reinterpret_cast<const unsigned int*>(m_data + getVerticesOffset() + getVerticesSize());
+}
+
+int MeshFile::getIndicesSize() const {
+    return static_cast<int>(m_header.m_indexCount * sizeof(std::uint32_t));
+}
+
+std::size_t MeshFile::getVerticesOffset() const {
+    return sizeof(MeshFileHeader) + m_header.m_lodCount * sizeof(MeshLod);
+}
+
+bool MeshFile::validate(const std::string& path) {
+    if (m_size < sizeof(MeshFileHeader)) {
+        ONSET_ERROR("Mesh File found no mesh header in {}", path);
+        return false;
+    }
+    std::memcpy(&m_header, m_data, sizeof(MeshFileHeader));
+    if (!std::equal(MESH_MAGIC, MESH_MAGIC + sizeof(MESH_MAGIC), m_header.m_magic)) {
+        ONSET_ERROR("Mesh File found no mesh header in {}", path);
+        return false;
+    }
+    if (m_header.m_version != MESH_VERSION) {
+        ONSET_ERROR("Mesh File cannot read version {} mesh {}", m_header.m_version, path);
+        return false;
+    }
+
+    // the layout: float vertices hold every attribute's floats, packed ones
+    // the 16 byte encoding of position, normal and tex coords
+    bool validLayout = m_header.m_attributeCount > 0 && m_header.m_attributeCount <= 4 && m_header.m_vertexFormat <= 1;
+    if (validLayout) {
+        int stride = getStride();
+        validLayout = m_header.m_vertexFormat == 0
+            ? m_header.m_vertexSize == stride * sizeof(float)
+            : m_header.m_vertexSize == 16 && stride == 8;
+    }
+    if (!validLayout) {
+        ONSET_ERROR("Mesh File found an unknown vertex layout in {}", path);
+        return false;
+    }
+
+    if (m_header.m_lodCount == 0 || m_header.m_lodCount > MAX_MESH_LODS) {
+        ONSET_ERROR("Mesh File found {} levels of detail in {}", m_header.m_lodCount, path);
+        return false;
+    }
+
+    std::uint64_t expectedSize = getVerticesOffset()
+        + static_cast<std::uint64_t>(m_header.m_vertexCount) * m_header.m_vertexSize
+        + static_cast<std::uint64_t>(m_header.m_indexCount) * sizeof(std::uint32_t);
+    if (expectedSize != m_size || expectedSize > 0x7FFFFFFF || m_header.m_indexCount % 3 != 0) {
+        ONSET_ERROR("Mesh File found a truncated or malformed mesh {}", path);
+        return false;
+    }
+    // every level a range of whole triangles, the first one at full detail
+    m_lods.resize(m_header.m_lodCount);
+    std::memcpy(m_lods.data(), m_data + sizeof(MeshFileHeader), m_lods.size() * sizeof(MeshLod));
+    for (std::size_t i = 0; i < m_lods.size(); i++) {
+        const MeshLod& lod = m_lods[i];
+        bool validLod = lod.m_indexCount > 0 && lod.m_indexCount % 3 == 0
+            && static_cast<std::uint64_t>(lod.m_indexOffset) + lod.m_indexCount <= m_header.m_indexCount
+            && (i == 0 ? lod.m_error == 0.0f : lod.m_error >= m_lods[i - 1].m_error);
+        if (!validLod) {
+            ONSET_ERROR("Mesh File found a malformed level of detail {} in {}", i, path);
+            return false;
+        }
+    }
+
+    const unsigned int* indices = getIndices();
+    for (std::uint32_t i = 0; i < m_header.m_indexCount; i++) {
+        if (indices[i] >= m_header.m_vertexCount) {
+            ONSET_ERROR("Mesh File found index {} past the vertices of {}", indices[i], path);
+            return false;
+        }
+    }
+
+    // bounds, from the position attribute of every vertex
+    const unsigned char* vertex = static_cast<const unsigned char*>(getVertices());
+    int positionFloats = std::min<int>(m_header.m_attributes[0], 3);
+    float lengthSquared = 0.0f;
+    for (std::uint32_t i = 0; i < m_header.m_vertexCount; i++, vertex += m_header.m_vertexSize) {
+        float position[3] = {0.0f, 0.0f, 0.0f};
+        if (m_header.m_vertexFormat == 0) {
+            std::memcpy(position, vertex, positionFloats * sizeof(float));
+        }
+        else {
+            std::uint16_t halves[3];
+            std::memcpy(halves, vertex, sizeof(halves));
+            for (int axis = 0; axis < 3; axis++) {
+                position[axis] = halfToFloat(halves[axis]);
+            }
+        }
+        lengthSquared = std::max(lengthSquared, position[0] * position[0] + position[1] * position[1] + position[2] * position[2]);
+    }
+    m_boundingRadius = std::sqrt(lengthSquared);
+    return true;
+}
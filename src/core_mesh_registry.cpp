@@ -0,0 +1,43 @@
+// -----------------------------------------------------------------------------
+// Onset Engine
+// https://github.com/dylanafterall/OnsetEngine.git
+//
+// core_mesh_registry.cpp
+//  implementation of MeshRegistry class
+// -----------------------------------------------------------------------------
+
+#include "core_mesh_registry.h"
+
+unsigned int MeshRegistry::find(const std::string& key) const {
+    auto handle = m_handles.find(key);
+    if (handle == m_handles.end()) {
+        return 0;
+    }
+    return handle->second;
+}
+
+unsigned int MeshRegistry::add(const std::string& key, const Mesh& mesh) {
+    m_meshes.push_back(mesh);
+    unsigned int handle = static_cast<unsigned int>(m_meshes.size());
+    m_handles[key] = handle;
+    ONSET_INFO("New Mesh added to Mesh Registry with key = {}, {} vertices, {} indices, {} levels of detail", key, mesh.m_vertexCount, mesh.m_indexCount, mesh.m_lods.size());
+    return handle;
+}
+
+const Mesh& MeshRegistry::get(unsigned int handle) const {
+    return m_meshes[handle - 1];
+}
+
+std::size_t MeshRegistry::getCount() const {
+    return m_meshes.size();
+}
+
+void MeshRegistry::destroy() {
+    for (Mesh& mesh : m_meshes) {
+        glDeleteVertexArrays(1, &mesh.m_VAO);
+        glDeleteBuffers(1, &mesh.m_VBO);
+        glDeleteBuffers(1, &mesh.m_EBO);
+    }
+    m_meshes.clear();
+    m_handles.clear();
+}
@@ -0,0 +1,168 @@
+// -----------------------------------------------------------------------------
+// Onset Engine
+// https://github.com/dylanafterall/OnsetEngine.git
+//
+// core_profile_manager.cpp
+//  implementation of ProfileManager class, scoped CPU timers and Chrome trace export
+// -----------------------------------------------------------------------------
+
+#include "core_profile_manager.h"
+#include "core_log_macros.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+
+std::atomic<ProfileManager*> ProfileManager::s_instance{nullptr};
+std::atomic<unsigned int> ProfileManager::s_generation{0};
+
+// buffer of the current thread, valid while t_generation matches the manager's
+static thread_local ProfileThreadBuffer* t_buffer = nullptr;
+static thread_local unsigned int t_generation = 0;
+
+// scope and thread names are literals, but keep the JSON valid regardless
+static void writeEscaped(std::ofstream& file, const char* text) {
+    for (const char* c = text; *c != '\0'; c++) {
+        if (*c == '"' || *c == '\\') {
+            file << '\\';
+        }
+        file << *c;
+    }
+}
+
+void ProfileManager::initialize() {
+    m_startTime = now();
+    s_generation.fetch_add(1, std::memory_order_relaxed);
+    s_instance.store(this, std::memory_order_release);
+}
+
+void ProfileManager::destroy() {
+    s_instance.store(nullptr, std::memory_order_release);
+
+    std::lock_guard<std::mutex> lock(m_buffersMutex);
+    m_buffers.clear();
+}
+
+bool ProfileManager::writeTrace(const std::string& path) {
+    std::ofstream file(path, std::ios::out | std::ios::trunc);
+    if (!file.is_open()) {
+        ONSET_ERROR("Profile Manager failed to open trace file {}", path);
+        return false;
+    }
+    file << std::fixed << std::setprecision(3);
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+    std::lock_guard<std::mutex> lock(m_buffersMutex);
+    std::vector<ProfileEvent> events;
+    bool first = true;
+    std::size_t eventCount = 0;
+    for (const auto& buffer : m_buffers) {
+        const char* threadName = buffer->m_threadName.load(std::memory_order_relaxed);
+        if (threadName != nullptr) {
+            file << (first ? "" : ",") << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":"
+                 << buffer->m_threadId << ",\"args\":{\"name\":\"";
+            writeEscaped(file, threadName);
+            file << "\"}}";
+            first = false;
+        }
+
+        events.clear();
+        copyEvents(*buffer, events);
+        for (std::size_t i = 0; i < events.size(); i++) {
+            const ProfileEvent& event = events[i];
+            file << (first ? "" : ",") << "\n{\"name\":\"";
+            writeEscaped(file, event.m_name);
+            file << "\",\"cat\":\"cpu\",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->m_threadId
+                 << ",\"ts\":" << (event.m_start - m_startTime) / 1000.0
+                 << ",\"dur\":" << (event.m_end - event.m_start) / 1000.0 << "}";
+            first = false;
+            eventCount++;
+        }
+    }
+
+    file << "\n]}\n";
+    ONSET_INFO("Profile Manager wrote {} events to {}", eventCount, path);
+    return true;
+}
+
+void ProfileManager::getEvents(std::vector<ProfileEvent>& events) {
+    std::lock_guard<std::mutex> lock(m_buffersMutex);
+    for (const auto& buffer : m_buffers) {
+        copyEvents(*buffer, events);
+    }
+}
+
+void ProfileManager::setTracePath(const std::string& path) {
+    m_tracePath = path;
+}
+
+void ProfileManager::handleDumpCommand() {
+    writeTrace(m_tracePath);
+}
+
+// .............................................................................
+
+std::int64_t ProfileManager::now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()
+    ).count();
+}
+
+void ProfileManager::record(const char* name, std::int64_t start, std::int64_t end) {
+    ProfileManager* manager = s_instance.load(std::memory_order_acquire);
+    if (manager == nullptr) {
+        return;
+    }
+
+    // single writer per buffer: fill the slot, then publish it with the head
+    ProfileThreadBuffer* buffer = manager->getThreadBuffer();
+    std::uint64_t head = buffer->m_head.load(std::memory_order_relaxed);
+    ProfileEvent& event = buffer->m_events[head & (ProfileThreadBuffer::CAPACITY - 1)];
+    event.m_name = name;
+    event.m_start = start;
+    event.m_end = end;
+    buffer->m_head.store(head + 1, std::memory_order_release);
+}
+
+void ProfileManager::setThreadName(const char* name) {
+    ProfileManager* manager = s_instance.load(std::memory_order_acquire);
+    if (manager == nullptr) {
+        return;
+    }
+
+    manager->getThreadBuffer()->m_threadName.store(name, std::memory_order_relaxed);
+}
+
+void ProfileManager::copyEvents(const ProfileThreadBuffer& buffer, std::vector<ProfileEvent>& events) {
+    // copy the buffer while its thread keeps recording, then drop whatever
+    // the thread may have overwritten during the copy
+    std::size_t first = events.size();
+    std::uint64_t head = buffer.m_head.load(std::memory_order_acquire);
+    std::uint64_t begin = head > ProfileThreadBuffer::CAPACITY ? head - ProfileThreadBuffer::CAPACITY : 0;
+    for (std::uint64_t i = begin; i < head; i++) {
+        events.push_back(buffer.m_events[i & (ProfileThreadBuffer::CAPACITY - 1)]);
+    }
+
+    std::uint64_t newHead = buffer.m_head.load(std::memory_order_acquire);
+    std::uint64_t overwritten = newHead > ProfileThreadBuffer::CAPACITY ? newHead - ProfileThreadBuffer::CAPACITY : 0;
+    if (overwritten > begin) {
+        std::size_t skip = static_cast<std::size_t>(std::min(overwritten - begin, head - begin));
+        events.erase(events.begin() + first, events.begin() + first + skip);
+    }
+}
+
+ProfileThreadBuffer* ProfileManager::getThreadBuffer() {
+    unsigned int generation = s_generation.load(std::memory_order_relaxed);
+    if (t_buffer != nullptr && t_generation == generation) {
+        return t_buffer;
+    }
+
+    // first event of this thread since initialize, the only locked path
+    std::lock_guard<std::mutex> lock(m_buffersMutex);
+    m_buffers.push_back(std::make_unique<ProfileThreadBuffer>());
+    m_buffers.back()->m_threadId = static_cast<unsigned int>(m_buffers.size());
+    t_buffer = m_buffers.back().get();
+    t_generation = generation;
+
+    return t_buffer;
+}
@@ -0,0 +1,90 @@
+// -----------------------------------------------------------------------------
+// Onset Engine
+// https://github.com/dylanafterall/OnsetEngine.git
+//
+// core_render_queue.cpp
+//  implementation of RenderQueue class, radix sorts draw commands
+// -----------------------------------------------------------------------------
+
+#include "core_render_queue.h"
+
+#include <algorithm>
+
+static_assert(
+    RenderQueue::PASS_BITS + RenderQueue::PROGRAM_BITS + RenderQueue::MATERIAL_BITS + RenderQueue::MESH_BITS == 64,
+    "RenderQueue key fields must fill 64 bits"
+);
+
+static std::uint64_t maskField(unsigned int value, unsigned int bits) {
+    return static_cast<std::uint64_t>(value) & ((std::uint64_t(1) << bits) - 1);
+}
+
+std::uint64_t RenderQueue::makeKey(unsigned int pass, unsigned int program, unsigned int material, unsigned int mesh) {
+    std::uint64_t key = maskField(pass, PASS_BITS);
+    key = (key << PROGRAM_BITS) | maskField(program, PROGRAM_BITS);
+    key = (key << MATERIAL_BITS) | maskField(material, MATERIAL_BITS);
+    key = (key << MESH_BITS) | maskField(mesh, MESH_BITS);
+    return key;
+}
+
+unsigned int RenderQueue::getPass(std::uint64_t key) {
+    return static_cast<unsigned int>(key >> (64 - PASS_BITS));
+}
+
+void RenderQueue::clear() {
+    m_commands.clear();
+}
+
+void RenderQueue::push(std::uint64_t key, std::uint32_t index) {
+    RenderCommand command;
+    command.m_key = key;
+    command.m_index = index;
+    m_commands.push_back(command);
+}
+
+void RenderQueue::sort() {
+    std::size_t count = m_commands.size();
+    if (count < 2) {
+        return;
+    }
+    m_scratch.resize(count);
+
+    for (unsigned int shift = 0; shift < 64; shift += 8) {
+        std::size_t offsets[256] = {};
+        for (const RenderCommand& command : m_commands) {
+            offsets[(command.m_key >> shift) & 0xFF]++;
+        }
+        // every key shares this byte, the pass would not move anything
+        if (offsets[(m_commands[0].m_key >> shift) & 0xFF] == count) {
+            continue;
+        }
+
+        // bucket counts to starting offsets
+        std::size_t total = 0;
+        for (std::size_t& offset : offsets) {
+            std::size_t bucket = offset;
+            offset = total;
+            total += bucket;
+        }
+        for (const RenderCommand& command : m_commands) {
+            m_scratch[offsets[(command.m_key >> shift) & 0xFF]++] = command;
+        }
+        m_commands.swap(m_scratch);
+    }
+}
+
+void RenderQueue::getPassRange(unsigned int pass, std::size_t& begin, std::size_t& end) const {
+    // the pass is the key's top field, so sorted passes are contiguous
+    auto first = std::partition_point(m_commands.begin(), m_commands.end(), [pass](const RenderCommand& command) {
+        return getPass(command.m_key) < pass;
+    });
+    auto last = std::partition_point(first, m_commands.end(), [pass](const RenderCommand& command) {
+        return getPass(command.m_key) == pass;
+    });
+    begin = static_cast<std::size_t>(first - m_commands.begin());
+    end = static_cast<std::size_t>(last - m_commands.begin());
+}
+
+const std::vector<RenderCommand>& RenderQueue::getCommands() const {
+    return m_commands;
+}
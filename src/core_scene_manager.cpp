@@ -0,0 +1,508 @@
+// -----------------------------------------------------------------------------
+// Onset Engine
+// https://github.com/dylanafterall/OnsetEngine.git
+//
+// core_scene_manager.cpp
+//  implementation of SceneManager class, creates entities from compiled scenes
+// -----------------------------------------------------------------------------
+
+#include "core_scene_manager.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <memory>
+
+// size of each SceneComponentType's blob, indexed by type
+static const std::uint16_t BLOB_SIZES[sceneComponentCount] = {
+    sizeof(SceneCameraBlob),
+    sizeof(SceneSkyboxBlob),
+    sizeof(SceneLightBlob),
+    sizeof(SceneMaterialBlob),
+    sizeof(SceneTextureBlob),
+    sizeof(SceneShaderBlob),
+    sizeof(SceneMeshBlob),
+    sizeof(SceneTextBlob),
+    sizeof(SceneSpriteBlob),
+    sizeof(ScenePlayerBlob),
+    sizeof(SceneBodyBlob),
+    sizeof(SceneCircleBlob),
+    sizeof(SceneBoxBlob),
+    sizeof(SceneFixtureBlob),
+    sizeof(SceneAudioBlob),
+    sizeof(SceneShadowBlob),
+};
+
+static_assert(SCENE_SPOT_SHADOWS == MAX_SPOT_LIGHTS, "scenes must index the Lights block's spot lights");
+static_assert(SCENE_POINT_SHADOWS == MAX_POINT_LIGHTS, "scenes must index the Lights block's point lights");
+
+/**
+ * \brief The meshes of a load: the few compiled into the engine, and the mesh
+ *        files named so far, by name. A file that failed to open is kept as
+ *        nullptr, so it is reported once.
+ */
+struct SceneManager::MeshTable {
+    MeshSpriteComponent m_sprite;
+    MeshSkyboxComponent m_skybox;
+    std::map<std::string, std::unique_ptr<MeshFile>> m_files;
+
+    // map a mesh file on its first use by the load
+    const MeshFile* findFile(const std::string& name) {
+        auto found = m_files.find(name);
+        if (found == m_files.end()) {
+            std::unique_ptr<MeshFile> file = std::make_unique<MeshFile>();
+            if (!file->open(MeshFile::getPath(name))) {
+                file.reset();
+            }
+            found = m_files.emplace(name, std::move(file)).first;
+        }
+        return found->second.get();
+    }
+};
+
+// read a blob in place, the file buffer guarantees no alignment
+template<typename Blob>
+static Blob readBlob(const unsigned char* blob) {
+    Blob value;
+    std::memcpy(&value, blob, sizeof(Blob));
+    return value;
+}
+
+void SceneManager::initialize(
+    entt::registry* registry,
+    b2World* world,
+    RenderSystem* renderSystem,
+    AssetManager* assetManager,
+    AudioManager* audioManager,
+    TextManager* textManager
+) {
+    m_registry = registry;
+    m_world = world;
+    m_renderSystem = renderSystem;
+    m_assetManager = assetManager;
+    m_audioManager = audioManager;
+    m_textManager = textManager;
+}
+
+// _____________________________________________________________________________
+// -----------------------------------------------------------------------------
+// loading
+// _____________________________________________________________________________
+// -----------------------------------------------------------------------------
+
+bool SceneManager::loadScene(const std::string& path) {
+    ONSET_PROFILE_SCOPE("SceneManager::loadScene");
+    auto start = std::chrono::steady_clock::now();
+
+    // whole file in a single read
+    // .........................................................................
+    std::ifstream file(path, std::ios::in | std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        ONSET_ERROR("Scene Manager failed to open scene file {}", path);
+        return false;
+    }
+    std::vector<unsigned char> bytes(static_cast<std::size_t>(file.tellg()));
+    file.seekg(0);
+    file.read(reinterpret_cast<char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    if (!file) {
+        ONSET_ERROR("Scene Manager failed to read scene file {}", path);
+        return false;
+    }
+
+    // header and section bounds
+    // .........................................................................
+    SceneHeader header;
+    if (bytes.size() < sizeof(header)) {
+        ONSET_ERROR("Scene Manager found no scene header in {}", path);
+        return false;
+    }
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    if (!std::equal(SCENE_MAGIC, SCENE_MAGIC + sizeof(SCENE_MAGIC), header.m_magic)) {
+        ONSET_ERROR("Scene Manager found no scene header in {}", path);
+        return false;
+    }
+    if (header.m_version != SCENE_VERSION) {
+        ONSET_ERROR("Scene Manager cannot read version {} scene {}", header.m_version, path);
+        return false;
+    }
+    std::uint64_t recordCount = static_cast<std::uint64_t>(header.m_templateCount) + header.m_entityCount;
+    std::uint64_t expectedSize = sizeof(header) + static_cast<std::uint64_t>(header.m_stringTableSize)
+        + recordCount * sizeof(SceneRecord) + header.m_componentDataSize;
+    if (expectedSize != bytes.size() || (header.m_stringTableSize && bytes[sizeof(header) + header.m_stringTableSize - 1] != '\0')) {
+        ONSET_ERROR("Scene Manager found a truncated or malformed scene {}", path);
+        return false;
+    }
+    m_strings = reinterpret_cast<const char*>(bytes.data() + sizeof(header));
+    m_stringsSize = header.m_stringTableSize;
+    const unsigned char* recordData = bytes.data() + sizeof(header) + header.m_stringTableSize;
+    const unsigned char* componentData = recordData + recordCount * sizeof(SceneRecord);
+
+    std::vector<SceneRecord> records(recordCount);
+    if (recordCount > 0) {
+        std::memcpy(records.data(), recordData, recordCount * sizeof(SceneRecord));
+    }
+    for (std::size_t i = 0; i < records.size(); i++) {
+        bool isEntity = i >= header.m_templateCount;
+        bool validTemplate = records[i].m_template == SCENE_NO_TEMPLATE || (isEntity && records[i].m_template < header.m_templateCount);
+        if (!validTemplate || !validateRecord(records[i], componentData, header.m_componentDataSize)) {
+            ONSET_ERROR("Scene Manager found a malformed record {} in {}", getString(records[i].m_name), path);
+            return false;
+        }
+    }
+
+    // entities, created in bulk
+    // .........................................................................
+    std::vector<entt::entity> entities(header.m_entityCount);
+    m_registry->create(entities.begin(), entities.end());
+
+    std::unique_ptr<MeshTable> meshes = std::make_unique<MeshTable>();
+    m_meshes = meshes.get();
+    std::uint32_t skipped = 0;
+    for (std::uint32_t i = 0; i < header.m_entityCount; i++) {
+        const SceneRecord& record = records[header.m_templateCount + i];
+        const unsigned char* blobs[sceneComponentCount] = {};
+        if (record.m_template != SCENE_NO_TEMPLATE) {
+            collectBlobs(records[record.m_template], componentData, blobs);
+        }
+        collectBlobs(record, componentData, blobs);
+        // the RenderSystem indexes its shadow maps by the shadow's index
+        if (blobs[sceneShadow] && !isValidShadow(readBlob<SceneShadowBlob>(blobs[sceneShadow]))) {
+            SceneShadowBlob shadow = readBlob<SceneShadowBlob>(blobs[sceneShadow]);
+            ONSET_ERROR("Scene Manager skipped entity {} of {}, no shadow map of type {} has index {}", getString(record.m_name), path, shadow.m_type, shadow.m_index);
+            m_registry->destroy(entities[i]);
+            skipped++;
+            continue;
+        }
+        createEntity(entities[i], blobs);
+    }
+    m_meshes = nullptr;
+    m_strings = nullptr;
+    m_stringsSize = 0;
+
+    double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    ONSET_INFO("Scene Manager loaded {} entities from {} in {:.2f} ms", header.m_entityCount - skipped, path, milliseconds);
+    return true;
+}
+
+bool SceneManager::validateRecord(const SceneRecord& record, const unsigned char* componentData, std::uint32_t componentDataSize) {
+    std::uint64_t offset = record.m_componentOffset;
+    for (std::uint32_t i = 0; i < record.m_componentCount; i++) {
+        if (offset + sizeof(SceneComponentHeader) > componentDataSize) {
+            return false;
+        }
+        SceneComponentHeader component = readBlob<SceneComponentHeader>(componentData + offset);
+        if (component.m_type >= sceneComponentCount || component.m_size != BLOB_SIZES[component.m_type]) {
+            return false;
+        }
+        offset += sizeof(SceneComponentHeader) + component.m_size;
+        if (offset > componentDataSize) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void SceneManager::collectBlobs(const SceneRecord& record, const unsigned char* componentData, const unsigned char** blobs) {
+    const unsigned char* component = componentData + record.m_componentOffset;
+    for (std::uint32_t i = 0; i < record.m_componentCount; i++) {
+        SceneComponentHeader header = readBlob<SceneComponentHeader>(component);
+        blobs[header.m_type] = component + sizeof(SceneComponentHeader);
+        component += sizeof(SceneComponentHeader) + header.m_size;
+    }
+}
+
+std::string SceneManager::getString(std::uint32_t offset) const {
+    if (offset == SCENE_NO_STRING || offset >= m_stringsSize) {
+        return std::string();
+    }
+    return std::string(m_strings + offset);
+}
+
+// _____________________________________________________________________________
+// -----------------------------------------------------------------------------
+// entity creation
+// _____________________________________________________________________________
+// -----------------------------------------------------------------------------
+
+void SceneManager::createEntity(entt::entity entity, const unsigned char* const* blobs) {
+    // camera, skybox, light, material
+    // .........................................................................
+    if (blobs[sceneCamera]) {
+        SceneCameraBlob blob = readBlob<SceneCameraBlob>(blobs[sceneCamera]);
+        CameraComponent camera(glm::vec3(blob.m_position[0], blob.m_position[1], blob.m_position[2]));
+        camera.m_type = static_cast<CameraType>(blob.m_type);
+        m_registry->emplace<CameraComponent>(entity, camera);
+    }
+    if (blobs[sceneSkybox]) {
+        SceneSkyboxBlob blob = readBlob<SceneSkyboxBlob>(blobs[sceneSkybox]);
+        SkyboxComponent skybox;
+        skybox.m_id = static_cast<int>(blob.m_id);
+        m_registry->emplace<SkyboxComponent>(entity, skybox);
+    }
+    if (blobs[sceneLight]) {
+        SceneLightBlob blob = readBlob<SceneLightBlob>(blobs[sceneLight]);
+        LightComponent light;
+        light.m_type = blob.m_type;
+        light.m_scale = glm::vec3(blob.m_scale[0], blob.m_scale[1], blob.m_scale[2]);
+        light.m_direction = glm::vec3(blob.m_direction[0], blob.m_direction[1], blob.m_direction[2]);
+        light.m_cutOff = blob.m_cutOff;
+        light.m_outerCutOff = blob.m_outerCutOff;
+        light.m_constant = blob.m_constant;
+        light.m_linear = blob.m_linear;
+        light.m_quadratic = blob.m_quadratic;
+        light.m_ambient = glm::vec3(blob.m_ambient[0], blob.m_ambient[1], blob.m_ambient[2]);
+        light.m_diffuse = glm::vec3(blob.m_diffuse[0], blob.m_diffuse[1], blob.m_diffuse[2]);
+        light.m_specular = glm::vec3(blob.m_specular[0], blob.m_specular[1], blob.m_specular[2]);
+        m_registry->emplace<LightComponent>(entity, light);
+    }
+    if (blobs[sceneMaterial]) {
+        SceneMaterialBlob blob = readBlob<SceneMaterialBlob>(blobs[sceneMaterial]);
+        MaterialComponent material;
+        material.m_shininess = blob.m_shininess;
+        m_registry->emplace<MaterialComponent>(entity, material);
+    }
+
+    // textures and shaders, resolved by name
+    // .........................................................................
+    if (blobs[sceneTexture]) {
+        SceneTextureBlob blob = readBlob<SceneTextureBlob>(blobs[sceneTexture]);
+        TextureComponent texture = {};
+        if (blob.m_diffuse != SCENE_NO_STRING) {
+            texture.m_diffuse = m_assetManager->getTexture(getString(blob.m_diffuse));
+        }
+        if (blob.m_specular != SCENE_NO_STRING) {
+            texture.m_specular = m_assetManager->getTexture(getString(blob.m_specular));
+        }
+        if (blob.m_normal != SCENE_NO_STRING) {
+            texture.m_normal = m_assetManager->getTexture(getString(blob.m_normal));
+        }
+        if (blob.m_cubemap != SCENE_NO_STRING) {
+            texture.m_cubemap = m_assetManager->getCubemap(getString(blob.m_cubemap));
+        }
+        m_registry->emplace<TextureComponent>(entity, texture);
+    }
+    if (blobs[sceneShader]) {
+        SceneShaderBlob blob = readBlob<SceneShaderBlob>(blobs[sceneShader]);
+        ShaderProgramComponent shaderProgram = {};
+        if (blob.m_output != SCENE_NO_STRING) {
+            shaderProgram.m_outputProgram = m_assetManager->getShaderProgram(getString(blob.m_output));
+        }
+        if (blob.m_light != SCENE_NO_STRING) {
+            shaderProgram.m_lightProgram = m_assetManager->getShaderProgram(getString(blob.m_light));
+        }
+        if (blob.m_shadow != SCENE_NO_STRING) {
+            shaderProgram.m_shadowProgram = m_assetManager->getShaderProgram(getString(blob.m_shadow));
+        }
+        if (blob.m_stencil != SCENE_NO_STRING) {
+            shaderProgram.m_stencilProgram = m_assetManager->getShaderProgram(getString(blob.m_stencil));
+        }
+        m_registry->emplace<ShaderProgramComponent>(entity, shaderProgram);
+    }
+
+    // GL buffers, for anything drawn or lighting the scene
+    // .........................................................................
+    // radius of the mesh about its origin, 0 for the built in meshes
+    float meshRadius = 0.0f;
+    if (blobs[sceneMesh] || blobs[sceneText] || blobs[sceneShader] || blobs[sceneLight]) {
+        RenderDataComponent graphics = {};
+        if (blobs[sceneMesh]) {
+            SceneMeshBlob blob = readBlob<SceneMeshBlob>(blobs[sceneMesh]);
+            std::string name = getString(blob.m_mesh);
+            const void* vertices = nullptr;
+            int verticesSize = 0;
+            const unsigned int* indices = nullptr;
+            int indicesSize = 0;
+            int vertexCount = 0;
+            int indexCount = 0;
+            int vertexFormat = vertexFormatFloat;
+            int stride = 0;
+            std::vector<MeshLod> lods;
+            if (name == "sprite") {
+                vertices = m_meshes->m_sprite.m_vertices;
+                verticesSize = m_meshes->m_sprite.m_verticesSize;
+                indices = m_meshes->m_sprite.m_indices;
+                indicesSize = m_meshes->m_sprite.m_indicesSize;
+                vertexCount = m_meshes->m_sprite.m_vertexCount;
+                indexCount = m_meshes->m_sprite.m_indexCount;
+                vertexFormat = m_meshes->m_sprite.m_vertexFormat;
+                stride = 5;
+            }
+            else if (name == "skybox") {
+                vertices = m_meshes->m_skybox.m_vertices;
+                verticesSize = m_meshes->m_skybox.m_verticesSize;
+                indices = m_meshes->m_skybox.m_indices;
+                indicesSize = m_meshes->m_skybox.m_indicesSize;
+                vertexCount = m_meshes->m_skybox.m_vertexCount;
+                indexCount = m_meshes->m_skybox.m_indexCount;
+                vertexFormat = m_meshes->m_skybox.m_vertexFormat;
+                stride = 3;
+            }
+            // any other mesh is a file, mapped once per load
+            else if (const MeshFile* file = m_meshes->findFile(name)) {
+                vertices = file->getVertices();
+                verticesSize = file->getVerticesSize();
+                indices = file->getIndices();
+                indicesSize = file->getIndicesSize();
+                vertexCount = file->getVertexCount();
+                indexCount = file->getIndexCount();
+                vertexFormat = file->getVertexFormat();
+                stride = file->getStride();
+                lods = file->getLods();
+                meshRadius = file->getBoundingRadius();
+            }
+
+            std::vector<int> attributeSizes;
+            int attributeFloats = 0;
+            for (std::uint32_t i = 0; i < blob.m_attributeCount && i < 4; i++) {
+                attributeSizes.push_back(static_cast<int>(blob.m_attributes[i]));
+                attributeFloats += static_cast<int>(blob.m_attributes[i]);
+            }
+            if (!vertices) {
+                ONSET_WARN("Scene Manager found unknown mesh {}", name);
+            }
+            else if (attributeFloats > stride) {
+                ONSET_WARN("Scene Manager found a layout wider than mesh {}", name);
+            }
+            else {
+                graphics.m_vertexCount = vertexCount;
+                graphics.m_indexCount = indexCount;
+                graphics.m_vertexFormat = static_cast<VertexFormat>(vertexFormat);
+                m_renderSystem->createMeshBuffers(graphics, name, vertices, verticesSize, indices, indicesSize, stride, attributeSizes, lods);
+            }
+        }
+        if (blobs[sceneText]) {
+            m_renderSystem->createTextBuffers(graphics);
+        }
+        m_registry->emplace<RenderDataComponent>(entity, graphics);
+    }
+
+    // text and sprite
+    // .........................................................................
+    if (blobs[sceneText]) {
+        SceneTextBlob blob = readBlob<SceneTextBlob>(blobs[sceneText]);
+        TextComponent text;
+        text.m_xCoord = blob.m_x;
+        text.m_yCoord = blob.m_y;
+        text.m_scale = blob.m_scale;
+        text.m_color = glm::vec3(blob.m_color[0], blob.m_color[1], blob.m_color[2]);
+        std::string message = getString(blob.m_message);
+        text.m_characters.reserve(message.size());
+        for (std::string::const_iterator c = message.begin(); c != message.end(); c++) {
+            text.m_characters.push_back(m_textManager->getCharacter(*c));
+        }
+        m_registry->emplace<TextComponent>(entity, std::move(text));
+    }
+    if (blobs[sceneSprite]) {
+        SceneSpriteBlob blob = readBlob<SceneSpriteBlob>(blobs[sceneSprite]);
+        SpriteComponent sprite;
+        sprite.m_shininess = blob.m_shininess;
+        sprite.m_position = glm::vec3(blob.m_position[0], blob.m_position[1], blob.m_position[2]);
+        sprite.m_rotation = blob.m_rotation;
+        sprite.m_scale = glm::vec3(blob.m_scale[0], blob.m_scale[1], blob.m_scale[2]);
+        m_registry->emplace<SpriteComponent>(entity, sprite);
+    }
+    if (blobs[scenePlayer]) {
+        ScenePlayerBlob blob = readBlob<ScenePlayerBlob>(blobs[scenePlayer]);
+        PlayerComponent player;
+        player.m_id = static_cast<int>(blob.m_id);
+        m_registry->emplace<PlayerComponent>(entity, player);
+    }
+
+    // Box2D body, then its fixtures
+    // .........................................................................
+    if (blobs[sceneBody]) {
+        SceneBodyBlob blob = readBlob<SceneBodyBlob>(blobs[sceneBody]);
+        b2BodyDef bodyDef;
+        bodyDef.type = static_cast<b2BodyType>(std::min<std::uint32_t>(blob.m_type, b2_dynamicBody));
+        bodyDef.position.Set(blob.m_position[0], blob.m_position[1]);
+        bodyDef.angle = blob.m_angle;
+        BodyTransformComponent transform;
+        transform.m_body = m_world->CreateBody(&bodyDef);
+
+        // fixtures of entities with fixture user data point back at them
+        b2FixtureDef fixtureDef;
+        if (blobs[sceneFixture]) {
+            fixtureDef.userData.pointer = static_cast<uintptr_t>(entt::to_integral(entity)) + 1;
+        }
+        if (blobs[sceneCircle]) {
+            SceneCircleBlob circle = readBlob<SceneCircleBlob>(blobs[sceneCircle]);
+            b2CircleShape circleShape;
+            circleShape.m_p.Set(circle.m_center[0], circle.m_center[1]);
+            circleShape.m_radius = circle.m_radius;
+            fixtureDef.shape = &circleShape;
+            fixtureDef.density = circle.m_density;
+            fixtureDef.friction = circle.m_friction;
+            fixtureDef.restitution = circle.m_restitution;
+            transform.m_body->CreateFixture(&fixtureDef);
+        }
+        if (blobs[sceneBox]) {
+            SceneBoxBlob box = readBlob<SceneBoxBlob>(blobs[sceneBox]);
+            b2PolygonShape polygonShape;
+            polygonShape.SetAsBox(box.m_halfSize[0], box.m_halfSize[1], b2Vec2(box.m_center[0], box.m_center[1]), box.m_angle);
+            fixtureDef.shape = &polygonShape;
+            fixtureDef.density = box.m_density;
+            fixtureDef.friction = box.m_friction;
+            fixtureDef.restitution = box.m_restitution;
+            transform.m_body->CreateFixture(&fixtureDef);
+        }
+        m_registry->emplace<BodyTransformComponent>(entity, transform);
+
+        // bounds of what is drawn at the body, lights drawn scaled
+        TransformComponent bodyTransform;
+        bodyTransform.m_boundingRadius = meshRadius;
+        if (blobs[sceneLight]) {
+            SceneLightBlob light = readBlob<SceneLightBlob>(blobs[sceneLight]);
+            bodyTransform.m_boundingRadius *= std::max(std::abs(light.m_scale[0]), std::max(std::abs(light.m_scale[1]), std::abs(light.m_scale[2])));
+        }
+        m_registry->emplace<TransformComponent>(entity, bodyTransform);
+    }
+    else if (blobs[sceneCircle] || blobs[sceneBox]) {
+        ONSET_WARN("Scene Manager found a shape without a body, skipped");
+    }
+    if (blobs[sceneFixture]) {
+        SceneFixtureBlob blob = readBlob<SceneFixtureBlob>(blobs[sceneFixture]);
+        FixtureUserDataComponent userData;
+        userData.m_fixtureType = static_cast<int>(blob.m_fixtureType);
+        m_registry->emplace<FixtureUserDataComponent>(entity, userData);
+    }
+
+    // audio source
+    // .........................................................................
+    if (blobs[sceneAudio]) {
+        SceneAudioBlob blob = readBlob<SceneAudioBlob>(blobs[sceneAudio]);
+        AudioDataComponent audio = {};
+        alGenSources(1, &audio.m_soundSource);
+        BufferData* sounds[3] = {&audio.m_collisionSound, &audio.m_selectModeOnSound, &audio.m_selectModeOffSound};
+        std::uint32_t names[3] = {blob.m_collision, blob.m_selectOn, blob.m_selectOff};
+        for (int i = 0; i < 3; i++) {
+            if (names[i] != SCENE_NO_STRING) {
+                sounds[i]->m_soundBuffer = m_audioManager->getSoundEffect(getString(names[i]));
+            }
+            sounds[i]->m_pitch = blob.m_pitch;
+            sounds[i]->m_gain = blob.m_gain;
+            sounds[i]->m_loop = blob.m_loop != 0;
+        }
+        m_registry->emplace<AudioDataComponent>(entity, audio);
+    }
+
+    // shadow mapping, every light has one (type 0 casts no shadow)
+    // .........................................................................
+    if (blobs[sceneShadow] || blobs[sceneLight]) {
+        ShadowFramebufferComponent shadow = {};
+        if (blobs[sceneShadow]) {
+            SceneShadowBlob blob = readBlob<SceneShadowBlob>(blobs[sceneShadow]);
+            shadow.m_type = static_cast<int>(blob.m_type);
+            shadow.m_index = blob.m_index;
+            shadow.m_nearPlane = blob.m_nearPlane;
+            shadow.m_farPlane = blob.m_farPlane;
+        }
+        // spot light shadows (type 1) are tiles of the RenderSystem's atlas
+        if (shadow.m_type == 2) {
+            m_renderSystem->createShadowCubemap(shadow);
+        }
+        m_registry->emplace<ShadowFramebufferComponent>(entity, shadow);
+    }
+}
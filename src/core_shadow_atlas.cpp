@@ -0,0 +1,116 @@
+// -----------------------------------------------------------------------------
+// Onset Engine
+// https://github.com/dylanafterall/OnsetEngine.git
+//
+// core_shadow_atlas.cpp
+//  implementation of ShadowAtlas class
+// -----------------------------------------------------------------------------
+
+#include "core_shadow_atlas.h"
+
+#include <algorithm>
+
+// largest power of two not above value, 1 for 0
+static std::uint32_t floorPowerOfTwo(std::uint32_t value) {
+    std::uint32_t power = 1;
+    while (power <= value / 2) {
+        power *= 2;
+    }
+    return power;
+}
+
+// every other bit of a Morton code, starting with bit 0
+static std::uint32_t compactBits(std::uint64_t code) {
+    std::uint32_t value = 0;
+    for (unsigned int bit = 0; bit < 32; bit++) {
+        value |= static_cast<std::uint32_t>((code >> (2 * bit)) & 1) << bit;
+    }
+    return value;
+}
+
+void ShadowAtlas::clear() {
+    m_tiles.clear();
+    m_order.clear();
+    m_width = 0;
+    m_height = 0;
+}
+
+std::uint32_t ShadowAtlas::addTile(std::uint32_t size) {
+    ShadowTile tile;
+    tile.m_size = floorPowerOfTwo(size);
+    m_tiles.push_back(tile);
+    return static_cast<std::uint32_t>(m_tiles.size() - 1);
+}
+
+void ShadowAtlas::pack(std::uint32_t maxSize) {
+    m_width = 0;
+    m_height = 0;
+    if (m_tiles.empty()) {
+        return;
+    }
+
+    m_order.resize(m_tiles.size());
+    for (std::size_t i = 0; i < m_order.size(); i++) {
+        m_order[i] = static_cast<std::uint32_t>(i);
+    }
+    std::stable_sort(m_order.begin(), m_order.end(), [&](std::uint32_t a, std::uint32_t b) {
+        return m_tiles[a].m_size > m_tiles[b].m_size;
+    });
+
+    // smallest square holding the tiles' area, halving them until it fits
+    std::uint64_t side = 0;
+    std::uint64_t area = 0;
+    for (;;) {
+        area = 0;
+        for (const ShadowTile& tile : m_tiles) {
+            area += static_cast<std::uint64_t>(tile.m_size) * tile.m_size;
+        }
+        side = m_tiles[m_order[0]].m_size;
+        while (side * side < area) {
+            side *= 2;
+        }
+        if (side <= maxSize || m_tiles[m_order[0]].m_size == 1) {
+            break;
+        }
+        for (ShadowTile& tile : m_tiles) {
+            tile.m_size = std::max<std::uint32_t>(tile.m_size / 2, 1);
+        }
+    }
+    m_width = static_cast<std::uint32_t>(side);
+    // the first half of a Morton curve is the lower half of its square
+    m_height = area * 2 <= side * side ? m_width / 2 : m_width;
+
+    // a tile's offset along the curve is a multiple of its area, as every
+    // tile before it is at least as large, so it covers a whole square cell
+    std::uint64_t offset = 0;
+    for (std::uint32_t index : m_order) {
+        ShadowTile& tile = m_tiles[index];
+        std::uint64_t tileArea = static_cast<std::uint64_t>(tile.m_size) * tile.m_size;
+        std::uint64_t cell = offset / tileArea;
+        tile.m_x = compactBits(cell) * tile.m_size;
+        tile.m_y = compactBits(cell >> 1) * tile.m_size;
+        offset += tileArea;
+    }
+}
+
+const ShadowTile& ShadowAtlas::getTile(std::uint32_t tile) const {
+    return m_tiles[tile];
+}
+
+glm::vec4 ShadowAtlas::getRect(std::uint32_t tile, std::uint32_t textureWidth, std::uint32_t textureHeight) const {
+    const ShadowTile& rect = m_tiles[tile];
+    return glm::vec4(
+        static_cast<float>(rect.m_x) / textureWidth,
+        static_cast<float>(rect.m_y) / textureHeight,
+        static_cast<float>(rect.m_size) / textureWidth,
+        static_cast<float>(rect.m_size) / textureHeight
+    );
+}
+
+std::uint32_t ShadowAtlas::getWidth() const {
+    return m_width;
+}
+
+std::uint32_t ShadowAtlas::getHeight() const {
+    return m_height;
+}
@@ -0,0 +1,105 @@
+// -----------------------------------------------------------------------------
+// Onset Engine
+// https://github.com/dylanafterall/OnsetEngine.git
+//
+// core_spatial_grid.cpp
+//  implementation of SpatialGrid class
+// -----------------------------------------------------------------------------
+
+#include "core_spatial_grid.h"
+
+#include <algorithm>
+#include <cmath>
+
+// cell of a coordinate along an axis of count cells, clamped into the grid
+static int getCell(float coordinate, float origin, float cellSize, int count) {
+    float cell = std::floor((coordinate - origin) / cellSize);
+    return static_cast<int>(std::min(std::max(cell, 0.0f), static_cast<float>(count - 1)));
+}
+
+void SpatialGrid::clear() {
+    m_items.clear();
+    m_positions.clear();
+    m_cellItems.clear();
+    m_cellStarts.clear();
+    m_columns = 0;
+    m_rows = 0;
+}
+
+void SpatialGrid::insert(std::uint32_t item, const glm::vec2& position) {
+    m_items.push_back(item);
+    m_positions.push_back(position);
+}
+
+void SpatialGrid::build(float cellSize) {
+    m_cellItems.clear();
+    m_cellStarts.clear();
+    m_columns = 0;
+    m_rows = 0;
+    if (m_positions.empty()) {
+        return;
+    }
+
+    glm::vec2 lower = m_positions[0];
+    glm::vec2 upper = m_positions[0];
+    for (const glm::vec2& position : m_positions) {
+        lower = glm::vec2(std::min(lower.x, position.x), std::min(lower.y, position.y));
+        upper = glm::vec2(std::max(upper.x, position.x), std::max(upper.y, position.y));
+    }
+    // far flung points would make a mostly empty grid, coarsen it instead
+    std::size_t maxCells = std::max<std::size_t>(m_positions.size() * MAX_CELLS_PER_POINT, 1);
+    m_cellSize = std::max(cellSize, 0.001f);
+    for (;;) {
+        double columns = std::floor((upper.x - lower.x) / m_cellSize) + 1.0;
+        double rows = std::floor((upper.y - lower.y) / m_cellSize) + 1.0;
+        if (columns * rows <= static_cast<double>(maxCells)) {
+            m_columns = static_cast<int>(columns);
+            m_rows = static_cast<int>(rows);
+            break;
+        }
+        m_cellSize *= 2.0f;
+    }
+    m_origin = lower;
+
+    // counting sort of the items by cell
+    std::vector<std::uint32_t> cells(m_positions.size());
+    m_cellStarts.assign(static_cast<std::size_t>(m_columns) * m_rows + 1, 0);
+    for (std::size_t i = 0; i < m_positions.size(); i++) {
+        int column = getCell(m_positions[i].x, m_origin.x, m_cellSize, m_columns);
+        int row = getCell(m_positions[i].y, m_origin.y, m_cellSize, m_rows);
+        cells[i] = static_cast<std::uint32_t>(row * m_columns + column);
+        m_cellStarts[cells[i] + 1]++;
+    }
+    for (std::size_t cell = 1; cell < m_cellStarts.size(); cell++) {
+        m_cellStarts[cell] += m_cellStarts[cell - 1];
+    }
+    m_cellItems.resize(m_positions.size());
+    std::vector<std::uint32_t> cursors(m_cellStarts.begin(), m_cellStarts.end() - 1);
+    for (std::size_t i = 0; i < m_positions.size(); i++) {
+        m_cellItems[cursors[cells[i]]++] = m_items[i];
+    }
+}
+
+void SpatialGrid::query(const glm::vec2& center, float radius, std::vector<std::uint32_t>& items) const {
+    items.clear();
+    if (m_columns == 0) {
+        return;
+    }
+    // ranges missing the grid overlap no cell, rather than its edge cells
+    glm::vec2 upper = m_origin + glm::vec2(m_columns * m_cellSize, m_rows * m_cellSize);
+    if (center.x + radius < m_origin.x || center.y + radius < m_origin.y
+        || center.x - radius >= upper.x || center.y - radius >= upper.y) {
+        return;
+    }
+
+    int firstColumn = getCell(center.x - radius, m_origin.x, m_cellSize, m_columns);
+    int lastColumn = getCell(center.x + radius, m_origin.x, m_cellSize, m_columns);
+    int firstRow = getCell(center.y - radius, m_origin.y, m_cellSize, m_rows);
+    int lastRow = getCell(center.y + radius, m_origin.y, m_cellSize, m_rows);
+    for (int row = firstRow; row <= lastRow; row++) {
+        // a row's cells are adjacent, so are their items
+        std::size_t begin = m_cellStarts[row * m_columns + firstColumn];
+        std::size_t end = m_cellStarts[row * m_columns + lastColumn + 1];
+        items.insert(items.end(), m_cellItems.begin() + begin, m_cellItems.begin() + end);
+    }
+}
@@ -0,0 +1,179 @@
+// -----------------------------------------------------------------------------
+// Onset Engine
+// https://github.com/dylanafterall/OnsetEngine.git
+//
+// core_texture_streamer.cpp
+//  implementation of TextureStreamer class, uploads textures via PBOs
+// -----------------------------------------------------------------------------
+
+#include "core_texture_streamer.h"
+#include "core_asset_manager.h"
+
+#include "stb_image.h"
+
+#include <cstring>
+
+void TextureStreamer::request(unsigned int texture, const std::string& path, bool gamma) {
+    // the ring is created here, as the PBOs need the GL thread
+    if (m_pixelBuffers.empty()) {
+        m_pixelBuffers.resize(PIXEL_BUFFER_COUNT);
+        for (PixelBuffer& pixelBuffer : m_pixelBuffers) {
+            glGenBuffers(1, &pixelBuffer.m_buffer);
+        }
+    }
+
+    StreamImage image;
+    image.m_texture = texture;
+    image.m_path = path;
+    image.m_gamma = gamma;
+    m_pendingCount++;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_requested.push_back(std::move(image));
+        if (!m_isRunning) {
+            m_isRunning = true;
+            m_decodeThread = std::thread(&TextureStreamer::decodeLoop, this);
+        }
+    }
+    m_condition.notify_one();
+}
+
+void TextureStreamer::update() {
+    ONSET_PROFILE_SCOPE("TextureStreamer::update");
+    if (m_pixelBuffers.empty()) {
+        return;
+    }
+
+    // retire uploads the driver has finished copying out of their PBO
+    for (PixelBuffer& pixelBuffer : m_pixelBuffers) {
+        if (pixelBuffer.m_fence == nullptr) {
+            continue;
+        }
+        GLenum status = glClientWaitSync(pixelBuffer.m_fence, 0, 0);
+        if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED) {
+            continue;
+        }
+        glDeleteSync(pixelBuffer.m_fence);
+        pixelBuffer.m_fence = nullptr;
+        m_pendingCount--;
+        ONSET_INFO("Texture streamed in from {}", pixelBuffer.m_path);
+    }
+
+    // one upload per frame bounds the copy cost of each frame
+    PixelBuffer& pixelBuffer = m_pixelBuffers[m_nextBuffer];
+    if (pixelBuffer.m_fence != nullptr) {
+        return;
+    }
+    StreamImage image;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_decoded.empty()) {
+            return;
+        }
+        image = std::move(m_decoded.front());
+        m_decoded.pop_front();
+    }
+    if (image.m_data == nullptr) {
+        // the texture keeps its placeholder
+        ONSET_ERROR("Failed to stream texture at path: {}", image.m_path);
+        m_pendingCount--;
+        return;
+    }
+
+    ONSET_PROFILE_SCOPE("TextureStreamer::upload");
+    GLsizeiptr size = static_cast<GLsizeiptr>(image.m_width) * image.m_height * image.m_channels;
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pixelBuffer.m_buffer);
+    // orphan the PBO's previous storage, so mapping it never waits on the GPU
+    glBufferData(GL_PIXEL_UNPACK_BUFFER, size, nullptr, GL_STREAM_DRAW);
+    void* pixels = glMapBufferRange(
+        GL_PIXEL_UNPACK_BUFFER,
+        0,
+        size,
+        GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT
+    );
+    if (pixels != nullptr) {
+        std::memcpy(pixels, image.m_data, static_cast<std::size_t>(size));
+        glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+
+        // with a PBO bound, the data pointer is an offset into the PBO
+        glBindTexture(GL_TEXTURE_2D, image.m_texture);
+        AssetManager::uploadImage(
+            GL_TEXTURE_2D,
+            nullptr,
+            image.m_width,
+            image.m_height,
+            image.m_channels,
+            image.m_gamma
+        );
+        glGenerateMipmap(GL_TEXTURE_2D);
+
+        pixelBuffer.m_fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        pixelBuffer.m_path = image.m_path;
+        m_nextBuffer = (m_nextBuffer + 1) % m_pixelBuffers.size();
+    }
+    else {
+        ONSET_ERROR("Failed to map pixel buffer for texture at path: {}", image.m_path);
+        m_pendingCount--;
+    }
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    stbi_image_free(image.m_data);
+}
+
+void TextureStreamer::destroy() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_isRunning = false;
+    }
+    m_condition.notify_one();
+    if (m_decodeThread.joinable()) {
+        m_decodeThread.join();
+    }
+
+    for (StreamImage& image : m_decoded) {
+        stbi_image_free(image.m_data);
+    }
+    m_decoded.clear();
+    m_requested.clear();
+
+    for (PixelBuffer& pixelBuffer : m_pixelBuffers) {
+        if (pixelBuffer.m_fence != nullptr) {
+            glDeleteSync(pixelBuffer.m_fence);
+        }
+        glDeleteBuffers(1, &pixelBuffer.m_buffer);
+    }
+    m_pixelBuffers.clear();
+    m_nextBuffer = 0;
+    m_pendingCount = 0;
+}
+
+std::size_t TextureStreamer::getPendingCount() const {
+    return m_pendingCount.load();
+}
+
+void TextureStreamer::decodeLoop() {
+    ONSET_PROFILE_THREAD("texture streamer");
+    while (true) {
+        StreamImage image;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_condition.wait(lock, [this]() { return !m_isRunning || !m_requested.empty(); });
+            if (!m_isRunning) {
+                return;
+            }
+            image = std::move(m_requested.front());
+            m_requested.pop_front();
+        }
+
+        {
+            ONSET_PROFILE_SCOPE("TextureStreamer::decode");
+            // decoded unflipped, as stb_image's flip flag is shared by threads
+            image.m_data = stbi_load(image.m_path.c_str(), &image.m_width, &image.m_height, &image.m_channels, 0);
+            if (image.m_data != nullptr) {
+                AssetManager::flipVertically(image.m_data, image.m_width, image.m_height, image.m_channels);
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_decoded.push_back(std::move(image));
+    }
+}
@@ -8,9 +8,42 @@
 
 #include "core_game.h"
 
+#include <cstdlib>
+#include <cstring>
+
 int main(int argc, char* argv[]) {
     Game game;
 
+    // --threaded: step the simulation on its own thread
+    // --headless [steps]: simulate without a window, as fast as possible
+    // --record <file>: record input commands for a later replay
+    // --replay <file>: replay recorded input commands instead of user input
+    // --scene <file>: load a compiled scene instead of the demo level
+    // --stream-textures: stream textures in across frames after startup
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--threaded") == 0) {
+            game.setRunMode(multiThreaded);
+        }
+        else if (std::strcmp(argv[i], "--headless") == 0) {
+            game.setRunMode(headless);
+            if (i + 1 < argc && std::atoi(argv[i + 1]) > 0) {
+                game.setHeadlessSteps(static_cast<unsigned int>(std::atoi(argv[++i])));
+            }
+        }
+        else if (std::strcmp(argv[i], "--record") == 0 && i + 1 < argc) {
+            game.setInputRecordPath(argv[++i]);
+        }
+        else if (std::strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+            game.setInputReplayPath(argv[++i]);
+        }
+        else if (std::strcmp(argv[i], "--scene") == 0 && i + 1 < argc) {
+            game.setScenePath(argv[++i]);
+        }
+        else if (std::strcmp(argv[i], "--stream-textures") == 0) {
+            game.setStreamTextures(true);
+        }
+    }
+
     // pre loop
     game.initialize();
     game.setup();
@@ -24,6 +24,20 @@ void AudioSystem::deleteSources() {
     });
 }
 
+void AudioSystem::update() {
+    auto soundSource = (*m_registry).view<
+        TransformComponent,
+        AudioDataComponent
+    >();
+    soundSource.each([&](
+        const auto& transform,
+        const auto& audio
+    ) {
+        alSource3f(audio.m_soundSource, AL_POSITION, transform.m_position.x, transform.m_position.y, 0.0f);
+        alSource3f(audio.m_soundSource, AL_VELOCITY, transform.m_velocity.x, transform.m_velocity.y, 0.0f);
+    });
+}
+
 void AudioSystem::playSelectModeToggleSound() {
     auto player = (*m_registry).view<
         PlayerComponent,
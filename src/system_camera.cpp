@@ -17,19 +17,19 @@ void CameraSystem::update(const float timeStep) {
     glm::vec3 translate = glm::vec3(0.0f, 0.0f, 0.0f);
     auto player = (*m_registry).view<
         PlayerComponent,
-        BodyTransformComponent
+        TransformComponent
     >();
     player.each([&](
-        auto& player,
-        auto& body
+        const auto& player,
+        const auto& transform
     ) {
-        b2Vec2 position = body.m_body->GetPosition();
-        translate[0] = position.x;
-        translate[1] = position.y;
+        translate[0] = transform.m_position.x;
+        translate[1] = transform.m_position.y;
     });
 
     auto cameras = (*m_registry).view<CameraComponent>();
     cameras.each([&](auto& camera) {
+        camera.m_previousPosition = camera.m_position;
         camera.m_position[0] = translate[0];
         camera.m_position[1] = translate[1];
     });
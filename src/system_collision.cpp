@@ -17,14 +17,21 @@ void CollisionSystem::setDispatcher(entt::dispatcher* dispatcher) {
 }
 
 void CollisionSystem::BeginContact(b2Contact* contact) {
-    auto a = contact->GetFixtureA()->GetUserData();
-    auto b = contact->GetFixtureB()->GetUserData();
-    FixtureUserDataComponent* aUserData = (FixtureUserDataComponent*)a.pointer;
-    FixtureUserDataComponent* bUserData = (FixtureUserDataComponent*)b.pointer;
+    // fixture user data holds the owning entity plus one, 0 if none
+    uintptr_t a = contact->GetFixtureA()->GetUserData().pointer;
+    uintptr_t b = contact->GetFixtureB()->GetUserData().pointer;
+    if (!a || !b) {
+        return;
+    }
+    auto aEntity = static_cast<entt::entity>(a - 1);
+    auto bEntity = static_cast<entt::entity>(b - 1);
+    FixtureUserDataComponent* aUserData = (*m_registry).try_get<FixtureUserDataComponent>(aEntity);
+    FixtureUserDataComponent* bUserData = (*m_registry).try_get<FixtureUserDataComponent>(bEntity);
 
-    if (aUserData && bUserData) {
-        auto aEntity = *(*aUserData).m_enttEntity;
-        auto bEntity = *(*bUserData).m_enttEntity;
+    if (aUserData && bUserData
+        && (*m_registry).all_of<RenderDataComponent, AudioDataComponent>(aEntity)
+        && (*m_registry).all_of<RenderDataComponent, AudioDataComponent>(bEntity)
+    ) {
         auto &aRenderable = (*m_registry).get<RenderDataComponent>(aEntity);
         auto &bRenderable = (*m_registry).get<RenderDataComponent>(bEntity);
 
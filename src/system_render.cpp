@@ -7,33 +7,123 @@
 // -----------------------------------------------------------------------------
 
 #include "system_render.h"
+#include "core_asset_manager.h"
 
-//      1) store camera data
-//      2) store shadow map data for point/spot lights
-//      3) store reflection data for directional/point/spot, render point/spot
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+// draws the FrameSnapshot captured by the SnapshotSystem, never the registry,
+// so it can run on a different thread than the simulation
+//      1) store camera and light data in the uniform blocks, cull against the
+//         camera's frustum, and build the sorted render queue of what is in 
+//         view
+//      2) store shadow map data for spot lights, in tiles of one atlas, then
+//         point lights
+//      3) render point/spot lights
 //      4) render skybox
 //      5) render gameplay entities
 //      6) render sprites
 //      7) render text
 //      8) render stencil outlines
+// steps 2) to 8) are separate functions, so each is timed by the profiler.
+// Light meshes, gameplay entities, sprites and stencil outlines are drawn in
+// the order of the render queue, sorted by program, textures, then mesh, and
+// binds are skipped while the state they set is still bound. Meshes draw the
+// coarsest level of detail whose error stays under a pixel from the camera,
+// and under a few texels from a shadowing light
+
+// blend the transforms of the last two steps, renderFactor of 0 draws the
+// previous step and 1 draws the latest
+static glm::vec3 interpolatePosition(const glm::vec2& previous, const glm::vec2& current, float factor) {
+    glm::vec2 position = glm::mix(previous, current, factor);
+    return glm::vec3(position.x, position.y, 0.0f);
+}
+
+static float interpolateAngle(float previous, float current, float factor) {
+    // box2D angles are continuous (never wrapped to [-pi, pi]), so a plain
+    // lerp between consecutive steps is correct
+    return previous + (current - previous) * factor;
+}
+
+// attributes of a vertexFormatPacked vertex, in the order of the float layout
+// they encode: position, normal, tex coords
+struct PackedAttribute {
+    GLint m_size;
+    GLenum m_type;
+    GLboolean m_normalized;
+    std::size_t m_offset;
+};
+static const PackedAttribute packedAttributes[] = {
+    {3, GL_HALF_FLOAT, GL_FALSE, 0},
+    {4, GL_INT_2_10_10_10_REV, GL_TRUE, 8},
+    {2, GL_UNSIGNED_SHORT, GL_TRUE, 12}
+};
+static const int packedStride = 16;
+static const int packedFloatStride = 8;
+
+// vertical field of view of a spot light's shadow map, in degrees
+static const float spotShadowFieldOfView = 35.0f;
+
+// pixels a mesh unit spans at distance 1 in front of a perspective view, of
+// the given field of view (degrees) and height (pixels)
+static float getPixelsPerUnit(float fieldOfView, float height) {
+    return height / (2.0f * tanf(glm::radians(fieldOfView) * 0.5f));
+}
+
+// size of a mesh unit on a view at some distance, for level of detail 
+// selection. Objects closer than the near plane count as at the near plane
+static float getUnitPixels(float pixelsPerUnit, float scale, float distance) {
+    return pixelsPerUnit * scale / std::max(distance, 0.1f);
+}
+
+// mesh field of a sort key: the VAO, then the level of detail drawn
+static unsigned int getMeshKey(unsigned int VAO, unsigned int lod, unsigned int lodBits) {
+    return (VAO << lodBits) | lod;
+}
+static unsigned int getKeyLod(std::uint64_t key, unsigned int lodBits) {
+    return static_cast<unsigned int>(key & ((1u << lodBits) - 1));
+}
+
+// faces of a point light's shadow cubemap a sphere reaches, a bit per face in
+// GL_TEXTURE_CUBE_MAP_POSITIVE_X order (+x, -x, +y, -y, +z, -z). A face sees
+// the pyramid where its axis is the largest coordinate, and the sphere is out
+// of it when wholly behind one of the pyramid's four side planes
+static std::uint32_t getCubeFaces(const glm::vec3& offset, float radius) {
+    // side planes like x = |y| are at 45 degrees, 1/sqrt(2) normalizes them
+    const float planeScale = 0.70710678f;
+    std::uint32_t faces = 0;
+    for (int axis = 0; axis < 3; axis++) {
+        float side = std::max(std::fabs(offset[(axis + 1) % 3]), std::fabs(offset[(axis + 2) % 3]));
+        if ((offset[axis] - side) * planeScale >= -radius) {
+            faces |= 1u << (2 * axis);
+        }
+        if ((-offset[axis] - side) * planeScale >= -radius) {
+            faces |= 1u << (2 * axis + 1);
+        }
+    }
+    return faces;
+}
+
+// view-projection of a spot light's shadow map, read by the shadow pass and 
+// the Lights block
+static glm::mat4 getSpotLightSpaceMatrix(const glm::vec3& position, const glm::vec3& direction, float aspect, float nearPlane, float farPlane) {
+    glm::vec3 offsetPosition = position + glm::vec3(0.0f, 0.0f, 0.1f);
+    glm::mat4 projection = glm::perspective(glm::radians(spotShadowFieldOfView), aspect, nearPlane, farPlane);
+    glm::mat4 view = glm::lookAt(offsetPosition, position + direction, glm::vec3(0.0f, 1.0f, 0.0f));
+    return projection * view;
+}
 
 void RenderSystem::update(
-    const float timeStep, 
-    entt::registry& registry
+    const float renderFactor, 
+    const FrameSnapshot& snapshot
 ) {
-    unsigned int shadowTextures[3];
-    unsigned int shadowCubes[3];
-    int framebufferWidth;
-    int framebufferHeight;
-    glfwGetFramebufferSize(m_glfwWindow, &framebufferWidth, &framebufferHeight);
-
-    auto gameplayEntities = registry.view<
-        MaterialComponent,
-        BodyTransformComponent,
-        TextureComponent, 
-        ShaderProgramComponent,
-        RenderDataComponent
-    >();
+    ONSET_PROFILE_SCOPE("RenderSystem::update");
+    m_renderFactor = renderFactor;
+    glfwGetFramebufferSize(m_glfwWindow, &m_framebufferWidth, &m_framebufferHeight);
+    if (m_gpuProfileManager) {
+        m_gpuProfileManager->beginFrame();
+    }
 
     // _________________________________________________________________________
     // -------------------------------------------------------------------------
@@ -41,484 +131,751 @@ void RenderSystem::update(
     // _________________________________________________________________________
     // -------------------------------------------------------------------------
     // camera data
-    float cameraZoom;
-    glm::vec3 cameraPosition;
-    glm::vec3 cameraFront;
-    glm::vec3 cameraUp;
-
-    auto cameraEntities = registry.view<CameraComponent>();
-    cameraEntities.each([&](const auto& camera) {
-        // if 'first' camera (designates main camera)
-        if (camera.m_type == 1) {
-            cameraZoom = camera.m_zoom;
-            cameraPosition = camera.m_position;
-            cameraFront = camera.m_front;
-            cameraUp = camera.m_up;
-        }
-    });
+    m_cameraZoom = snapshot.m_camera.m_zoom;
+    m_cameraPosition = glm::mix(snapshot.m_camera.m_previousPosition, snapshot.m_camera.m_position, m_renderFactor);
+    m_cameraFront = snapshot.m_camera.m_front;
+    m_cameraUp = snapshot.m_camera.m_up;
+    packShadowAtlas(snapshot);
+    updateUniformBuffers(snapshot);
+    buildRenderQueue(snapshot);
+    buildInstances(snapshot);
 
-    // _________________________________________________________________________
-    // -------------------------------------------------------------------------
-    // 2) shadow mapping
-    // _________________________________________________________________________
-    // -------------------------------------------------------------------------
-    auto lightEntities = registry.view<
-        LightComponent,
-        BodyTransformComponent,
-        ShaderProgramComponent,
-        RenderDataComponent,
-        ShadowFramebufferComponent
-    >();
-    lightEntities.each([&](
-        const auto& rootLight,
-        const auto& rootBody,
-        const auto& rootShader,
-        const auto& rootGraphics,
-        const auto& rootShadow
-    ) {
-        // .................................................................
-        // spotlight: monodirectional shadow mapping
-        // .................................................................
-        if (rootShadow.m_type == 1) {
-            shadowTextures[rootShadow.m_index] = rootShadow.m_depthMap;
-            b2Vec2 rootBodyPos = rootBody.m_body->GetPosition();
-            glm::vec3 rootPos = glm::vec3(rootBodyPos.x, rootBodyPos.y, 0.0f);
-            glm::vec3 offsetRootPos = glm::vec3(rootBodyPos.x, rootBodyPos.y, 0.1f);
-
-            glm::mat4 rootProjection = glm::perspective(glm::radians(35.0f), (GLfloat)m_shadowWidth / (GLfloat)m_shadowHeight, rootShadow.m_nearPlane, rootShadow.m_farPlane);
-            glm::mat4 rootView = glm::lookAt(offsetRootPos, rootPos + rootLight.m_direction, glm::vec3(0.0f, 1.0f, 0.0f));
-            glm::mat4 rootSpaceMatrix = rootProjection * rootView;
-
-            glUseProgram(rootShader.m_lightProgram);
-            std::string lightSpaceMatrixAddress = "spotLights[" + std::to_string(rootShadow.m_index) + "].lightSpaceMatrix";
-            glUniformMatrix4fv(glGetUniformLocation(rootShader.m_lightProgram, lightSpaceMatrixAddress.c_str()), 1, GL_FALSE, &rootSpaceMatrix[0][0]);
-            glUseProgram(rootShader.m_shadowProgram);
-            glUniformMatrix4fv(glGetUniformLocation(rootShader.m_shadowProgram, "lightSpaceMatrix"), 1, GL_FALSE, &rootSpaceMatrix[0][0]);
-
-            glViewport(0, 0, m_shadowWidth, m_shadowHeight);
-            glBindFramebuffer(GL_FRAMEBUFFER, rootShadow.m_shadowFramebuffer);
-            glClear(GL_DEPTH_BUFFER_BIT);
-            // render objects that cast a shadow to the 2D shadow map texture
-            gameplayEntities.each([&](
-                const auto& gameMaterial,
-                const auto& gameBody,
-                const auto& gameTexture,
-                const auto& gameShader,
-                const auto& gameGraphics
-            ) {
-                b2Vec2 gameBodyPos = gameBody.m_body->GetPosition();
-                glm::vec3 gamePos = glm::vec3(gameBodyPos.x, gameBodyPos.y, 0.0f);
-                if (glm::distance(rootPos, gamePos) <= rootShadow.m_farPlane) {
-                    float gameAngle = gameBody.m_body->GetAngle();
-                    glm::mat4 gameModel = glm::mat4(1.0f);
-                    gameModel = glm::translate(gameModel, gamePos);
-                    gameModel = glm::rotate(gameModel, gameAngle, glm::vec3(0.0f, 0.0f, 1.0f));
-                    glUniformMatrix4fv(glGetUniformLocation(rootShader.m_shadowProgram, "model"), 1, GL_FALSE, &gameModel[0][0]);
-                    glBindVertexArray(gameGraphics.m_VAO);
-                    glDrawArrays(GL_TRIANGLES, 0, gameGraphics.m_vertexCount);
-                    glBindVertexArray(0);
-                }
-            });
-            lightEntities.each([&](
-                const auto& interiorLight,
-                const auto& interiorBody,
-                const auto& interiorShader,
-                const auto& interiorGraphics,
-                const auto& interiorShadow
-            ) {
-                // if point or spot light, it will cast a shadow
-                if (interiorLight.m_type != 0) {
-                    b2Vec2 interiorBodyPos = interiorBody.m_body->GetPosition();
-                    glm::vec3 interiorPos = glm::vec3(interiorBodyPos.x, interiorBodyPos.y, 0.0f);
-                    if (glm::distance(rootPos, interiorPos) <= rootShadow.m_farPlane) {
-                        float interiorAngle = interiorBody.m_body->GetAngle();
-                        glm::mat4 interiorModel = glm::mat4(1.0f);
-                        interiorModel = glm::translate(interiorModel, interiorPos);
-                        interiorModel = glm::rotate(interiorModel, interiorAngle, glm::vec3(0.0f, 0.0f, 1.0f));
-                        interiorModel = glm::scale(interiorModel, interiorLight.m_scale);
-                        glUniformMatrix4fv(glGetUniformLocation(rootShader.m_shadowProgram, "model"), 1, GL_FALSE, &interiorModel[0][0]);
-                        glBindVertexArray(interiorGraphics.m_VAO);
-                        glDrawArrays(GL_TRIANGLES, 0, interiorGraphics.m_vertexCount);
-                        glBindVertexArray(0);
-                    }
-                }
-            });
-            glBindFramebuffer(GL_FRAMEBUFFER, 0);
-            glViewport(0, 0, framebufferWidth, framebufferHeight);
-            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    renderSpotShadows(snapshot);
+    renderPointShadows(snapshot);
+    renderLights(snapshot);
+    renderSkybox(snapshot);
+    renderGameplay(snapshot);
+    renderSprites(snapshot);
+    renderText(snapshot);
+    renderStencilOutlines(snapshot);
+
+    if (m_gpuProfileManager) {
+        m_gpuProfileManager->endFrame();
+    }
+}
+
+void RenderSystem::updateUniformBuffers(const FrameSnapshot& snapshot) {
+    ONSET_PROFILE_SCOPE("RenderSystem::updateUniformBuffers");
+    // .........................................................................
+    // camera
+    // .........................................................................
+    m_cameraBlock.m_projection = glm::perspective(glm::radians(m_cameraZoom), (float)m_screenWidth / (float)m_screenHeight, 0.1f, 100.0f);
+    m_cameraBlock.m_view = glm::lookAt(m_cameraPosition, m_cameraPosition + m_cameraFront, m_cameraUp);
+    m_cameraBlock.m_viewPos = m_cameraPosition;
+
+    // .........................................................................
+    // lights, by shadow index
+    // .........................................................................
+    m_lightsBlock = LightsBlock();
+    for (std::size_t i = 0; i < snapshot.m_lights.size(); i++) {
+        const auto& entity = snapshot.m_lights[i];
+        const auto& light = entity.m_light;
+        const auto& shadow = entity.m_shadow;
+        glm::vec3 position = interpolatePosition(entity.m_previousPosition, entity.m_position, m_renderFactor);
+        if (light.m_type == 0) {
+            DirLightBlock& dirLight = m_lightsBlock.m_dirLight;
+            dirLight.m_direction = light.m_direction;
+            dirLight.m_ambient = light.m_ambient;
+            dirLight.m_diffuse = light.m_diffuse;
+            dirLight.m_specular = light.m_specular;
         }
-        // .................................................................
-        // pointlight: omnidirectional shadow mapping
-        // .................................................................
-        else if (rootShadow.m_type == 2) {
-            shadowCubes[rootShadow.m_index] = rootShadow.m_depthCubemap;
-            b2Vec2 rootBodyPos = rootBody.m_body->GetPosition();
-            glm::vec3 rootPos = glm::vec3(rootBodyPos.x, rootBodyPos.y, 0.0f);
-            glm::vec3 offsetRootPos = glm::vec3(rootBodyPos.x, rootBodyPos.y, 0.1f);
-
-            glUseProgram(rootShader.m_lightProgram);
-            std::string farPlaneAddress = "pointLights[" + std::to_string(rootShadow.m_index) + "].farPlane";
-            glUniform1f(glGetUniformLocation(rootShader.m_lightProgram, farPlaneAddress.c_str()), rootShadow.m_farPlane);
-
-            glm::mat4 rootProjection = glm::perspective(glm::radians(90.0f), (GLfloat)m_shadowWidth / (GLfloat)m_shadowHeight, rootShadow.m_nearPlane, rootShadow.m_farPlane);
-            std::vector<glm::mat4> rootTransforms;
-            rootTransforms.push_back(rootProjection * glm::lookAt(offsetRootPos, rootPos + glm::vec3(1.0f, 0.0f, 0.0f), glm::vec3(0.0f, -1.0f, 0.0f)));
-            rootTransforms.push_back(rootProjection * glm::lookAt(offsetRootPos, rootPos + glm::vec3(-1.0f, 0.0f, 0.0f), glm::vec3(0.0f, -1.0f, 0.0f)));
-            rootTransforms.push_back(rootProjection * glm::lookAt(offsetRootPos, rootPos + glm::vec3(0.0f, 1.0f, 0.0f), glm::vec3(0.0f, 0.0f, 1.0f)));
-            rootTransforms.push_back(rootProjection * glm::lookAt(offsetRootPos, rootPos + glm::vec3(0.0f, -1.0f, 0.0f), glm::vec3(0.0f, 0.0f, -1.0f)));
-            rootTransforms.push_back(rootProjection * glm::lookAt(offsetRootPos, rootPos + glm::vec3(0.0f, 0.0f, 1.0f), glm::vec3(0.0f, -1.0f, 0.0f)));
-            rootTransforms.push_back(rootProjection * glm::lookAt(offsetRootPos, rootPos + glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, -1.0f, 0.0f)));
-
-            glUseProgram(rootShader.m_shadowProgram);
-            std::string uniformName;
-            for (unsigned int i = 0; i < 6; ++i) {
-                uniformName = "shadowMatrices[" + std::to_string(i) + "]";
-                glUniformMatrix4fv(glGetUniformLocation(rootShader.m_shadowProgram, uniformName.c_str()), 1, GL_FALSE, &(rootTransforms[i])[0][0]);
+        else if (light.m_type == 1 && shadow.m_index < MAX_POINT_LIGHTS) {
+            PointLightBlock& pointLight = m_lightsBlock.m_pointLights[shadow.m_index];
+            pointLight.m_position = position;
+            pointLight.m_ambient = light.m_ambient;
+            pointLight.m_diffuse = light.m_diffuse;
+            pointLight.m_specular = light.m_specular;
+            pointLight.m_constant = light.m_constant;
+            pointLight.m_linear = light.m_linear;
+            pointLight.m_quadratic = light.m_quadratic;
+            pointLight.m_farPlane = shadow.m_farPlane;
+        }
+        else if (light.m_type == 2 && shadow.m_index < MAX_SPOT_LIGHTS) {
+            SpotLightBlock& spotLight = m_lightsBlock.m_spotLights[shadow.m_index];
+            // atlas tiles are square
+            spotLight.m_lightSpaceMatrix = getSpotLightSpaceMatrix(
+                position, 
+                light.m_direction, 
+                1.0f, 
+                shadow.m_nearPlane, 
+                shadow.m_farPlane
+            );
+            if (m_spotShadowTiles[i] != NO_SHADOW_TILE) {
+                spotLight.m_atlasRect = m_shadowAtlas.getRect(m_spotShadowTiles[i], m_shadowAtlasWidth, m_shadowAtlasHeight);
             }
-            glUniform1f(glGetUniformLocation(rootShader.m_shadowProgram, "far_plane"), rootShadow.m_farPlane);
-            glUniform3fv(glGetUniformLocation(rootShader.m_shadowProgram, "lightPos"), 1, &offsetRootPos[0]); 
-
-            glViewport(0, 0, m_shadowWidth, m_shadowHeight);
-            glBindFramebuffer(GL_FRAMEBUFFER, rootShadow.m_shadowFramebuffer);
-            glClear(GL_DEPTH_BUFFER_BIT);
-            // render objects that cast a shadow to the 3D shadow map cubemap
-            gameplayEntities.each([&](
-                const auto& gameMaterial,
-                const auto& gameBody,
-                const auto& gameTexture,
-                const auto& gameShader,
-                const auto& gameGraphics
-            ) {
-                b2Vec2 gameBodyPos = gameBody.m_body->GetPosition();
-                glm::vec3 gamePos = glm::vec3(gameBodyPos.x, gameBodyPos.y, 0.0f);
-                if (glm::distance(rootPos, gamePos) <= rootShadow.m_farPlane) {
-                    float gameAngle = gameBody.m_body->GetAngle();
-                    glm::mat4 gameModel = glm::mat4(1.0f);
-                    gameModel = glm::translate(gameModel, gamePos);
-                    gameModel = glm::rotate(gameModel, gameAngle, glm::vec3(0.0f, 0.0f, 1.0f));
-                    glUniformMatrix4fv(glGetUniformLocation(rootShader.m_shadowProgram, "model"), 1, GL_FALSE, &gameModel[0][0]);
-                    glBindVertexArray(gameGraphics.m_VAO);
-                    glDrawArrays(GL_TRIANGLES, 0, gameGraphics.m_vertexCount);
-                    glBindVertexArray(0);
-                }
-            });
-            lightEntities.each([&](
-                const auto& interiorLight,
-                const auto& interiorBody,
-                const auto& interiorShader,
-                const auto& interiorGraphics,
-                const auto& interiorShadow
-            ) {
-                // if point or spot light, it will cast a shadow
-                if (interiorLight.m_type != 0) {
-                    b2Vec2 interiorBodyPos = interiorBody.m_body->GetPosition();
-                    glm::vec3 interiorPos = glm::vec3(interiorBodyPos.x, interiorBodyPos.y, 0.0f);
-                    if (glm::distance(rootPos, interiorPos) <= rootShadow.m_farPlane) {
-                        float interiorAngle = interiorBody.m_body->GetAngle();
-                        glm::mat4 interiorModel = glm::mat4(1.0f);
-                        interiorModel = glm::translate(interiorModel, interiorPos);
-                        interiorModel = glm::rotate(interiorModel, interiorAngle, glm::vec3(0.0f, 0.0f, 1.0f));
-                        interiorModel = glm::scale(interiorModel, interiorLight.m_scale);
-                        glUniformMatrix4fv(glGetUniformLocation(rootShader.m_shadowProgram, "model"), 1, GL_FALSE, &interiorModel[0][0]);
-                        glBindVertexArray(interiorGraphics.m_VAO);
-                        glDrawArrays(GL_TRIANGLES, 0, interiorGraphics.m_vertexCount);
-                        glBindVertexArray(0);
-                    }
-                }
-            });
-            glBindFramebuffer(GL_FRAMEBUFFER, 0);
-            glViewport(0, 0, framebufferWidth, framebufferHeight);
-            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+            spotLight.m_position = position;
+            spotLight.m_direction = light.m_direction;
+            spotLight.m_ambient = light.m_ambient;
+            spotLight.m_diffuse = light.m_diffuse;
+            spotLight.m_specular = light.m_specular;
+            spotLight.m_constant = light.m_constant;
+            spotLight.m_linear = light.m_linear;
+            spotLight.m_quadratic = light.m_quadratic;
+            spotLight.m_cutOff = light.m_cutOff;
+            spotLight.m_outerCutOff = light.m_outerCutOff;
         }
-    });
+    }
 
-    // _________________________________________________________________________
-    // -------------------------------------------------------------------------
-    // 3) store reflection data and render lights
-    // _________________________________________________________________________
-    // -------------------------------------------------------------------------
-    lightEntities.each([&](
-        const auto& rootLight,
-        const auto& rootBody,
-        const auto& rootShader,
-        const auto& rootGraphics,
-        const auto& rootShadow
-    ) {
-        // .....................................................................
-        // directional lights
-        // .....................................................................
-        if (rootLight.m_type == 0) {
-            glUseProgram(rootShader.m_lightProgram);
-            glUniform3f(glGetUniformLocation(rootShader.m_lightProgram, "dirLight.direction"), rootLight.m_direction[0], rootLight.m_direction[1], rootLight.m_direction[2]);
-            glUniform3f(glGetUniformLocation(rootShader.m_lightProgram, "dirLight.ambient"), rootLight.m_ambient[0], rootLight.m_ambient[1], rootLight.m_ambient[2]);
-            glUniform3f(glGetUniformLocation(rootShader.m_lightProgram, "dirLight.diffuse"), rootLight.m_diffuse[0], rootLight.m_diffuse[1], rootLight.m_diffuse[2]);
-            glUniform3f(glGetUniformLocation(rootShader.m_lightProgram, "dirLight.specular"), rootLight.m_specular[0], rootLight.m_specular[1], rootLight.m_specular[2]);
+    // glBufferData with the data orphans last frame's storage, so the upload
+    // never waits on draws still reading it
+    glBindBuffer(GL_UNIFORM_BUFFER, m_cameraBuffer);
+    glBufferData(GL_UNIFORM_BUFFER, sizeof(CameraBlock), &m_cameraBlock, GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_UNIFORM_BUFFER, m_lightsBuffer);
+    glBufferData(GL_UNIFORM_BUFFER, sizeof(LightsBlock), &m_lightsBlock, GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+}
+
+void RenderSystem::buildRenderQueue(const FrameSnapshot& snapshot) {
+    ONSET_PROFILE_SCOPE("RenderSystem::buildRenderQueue");
+    m_renderQueue.clear();
+
+    // bounds of everything the queued passes draw, numbered lights first,
+    // then gameplay entities, then sprites. Objects of unknown bounds, e.g.
+    // lights without a body, are never culled
+    const float unbounded = std::numeric_limits<float>::infinity();
+    std::size_t lightCount = snapshot.m_lights.size();
+    std::size_t gameplayCount = snapshot.m_gameplay.size();
+    m_frustumCuller.clear();
+    m_frustumCuller.setFrustum(m_cameraBlock.m_projection * m_cameraBlock.m_view);
+    for (const auto& light : snapshot.m_lights) {
+        glm::vec3 position = interpolatePosition(light.m_previousPosition, light.m_position, m_renderFactor);
+        m_frustumCuller.addSphere(position, light.m_boundingRadius > 0.0f ? light.m_boundingRadius : unbounded);
+    }
+    for (const auto& game : snapshot.m_gameplay) {
+        glm::vec3 position = interpolatePosition(game.m_previousPosition, game.m_position, m_renderFactor);
+        // stencil outlines are drawn scaled up by 1.1
+        float radius = game.m_boundingRadius * (game.m_graphics.m_stencilFlag ? 1.1f : 1.0f);
+        m_frustumCuller.addSphere(position, radius > 0.0f ? radius : unbounded);
+    }
+    for (const auto& entity : snapshot.m_sprites) {
+        // the sprite quad spans -1 to 1, scaled
+        const auto& sprite = entity.m_sprite;
+        m_frustumCuller.addSphere(sprite.m_position, glm::length(sprite.m_scale));
+    }
+    m_frustumCuller.cull();
+
+    float pixelsPerUnit = getPixelsPerUnit(m_cameraZoom, static_cast<float>(m_framebufferHeight));
+    for (std::uint32_t visible : m_frustumCuller.getVisible()) {
+        if (visible < lightCount) {
+            std::uint32_t i = visible;
+            const LightSnapshot& light = snapshot.m_lights[i];
+            // directional lights have no mesh
+            if (light.m_light.m_type != 0) {
+                glm::vec3 position = interpolatePosition(light.m_previousPosition, light.m_position, m_renderFactor);
+                const glm::vec3& scale = light.m_light.m_scale;
+                float unitPixels = getUnitPixels(pixelsPerUnit, std::max(scale.x, std::max(scale.y, scale.z)), glm::distance(m_cameraPosition, position));
+                unsigned int lod = selectLod(light.m_graphics, unitPixels, LOD_ERROR_PIXELS);
+                m_renderQueue.push(RenderQueue::makeKey(lightQueue, light.m_shader.m_outputProgram, 0, getMeshKey(light.m_graphics.m_VAO, lod, LOD_BITS)), i);
+            }
         }
-        // .....................................................................
-        // point lights
-        // .....................................................................
-        else if (rootLight.m_type == 1) {
-            b2Vec2 rootBodyPos = rootBody.m_body->GetPosition();
-            glm::vec3 rootPos = glm::vec3(rootBodyPos.x, rootBodyPos.y, 0.0f);
-            glm::vec3 offsetRootPos = glm::vec3(rootBodyPos.x, rootBodyPos.y, 0.1f);
-            float rootAngle = rootBody.m_body->GetAngle();
-
-            // .................................................................
-            // pointlight: store reflection data
-            std::string positionAddress = "pointLights[" + std::to_string(rootShadow.m_index) + "].position";
-            std::string ambientAddress = "pointLights[" + std::to_string(rootShadow.m_index) + "].ambient";
-            std::string diffuseAddress = "pointLights[" + std::to_string(rootShadow.m_index) + "].diffuse";
-            std::string specularAddress = "pointLights[" + std::to_string(rootShadow.m_index) + "].specular";
-            std::string constantAddress = "pointLights[" + std::to_string(rootShadow.m_index) + "].constant";
-            std::string linearAddress = "pointLights[" + std::to_string(rootShadow.m_index) + "].linear";
-            std::string quadraticAddress = "pointLights[" + std::to_string(rootShadow.m_index) + "].quadratic";
-            glUseProgram(rootShader.m_lightProgram);
-            glUniform3f(glGetUniformLocation(rootShader.m_lightProgram, positionAddress.c_str()), rootPos[0], rootPos[1], rootPos[2]);
-            glUniform3f(glGetUniformLocation(rootShader.m_lightProgram, ambientAddress.c_str()), rootLight.m_ambient[0], rootLight.m_ambient[1], rootLight.m_ambient[2]);
-            glUniform3f(glGetUniformLocation(rootShader.m_lightProgram, diffuseAddress.c_str()), rootLight.m_diffuse[0], rootLight.m_diffuse[1], rootLight.m_diffuse[2]);
-            glUniform3f(glGetUniformLocation(rootShader.m_lightProgram, specularAddress.c_str()), rootLight.m_specular[0], rootLight.m_specular[1], rootLight.m_specular[2]);
-            glUniform1f(glGetUniformLocation(rootShader.m_lightProgram, constantAddress.c_str()), rootLight.m_constant);
-            glUniform1f(glGetUniformLocation(rootShader.m_lightProgram, linearAddress.c_str()), rootLight.m_linear);
-            glUniform1f(glGetUniformLocation(rootShader.m_lightProgram, quadraticAddress.c_str()), rootLight.m_quadratic);
-
-            // .................................................................
-            // pointlight: render
-            glm::mat4 pointProjection = glm::perspective(glm::radians(cameraZoom), (float)m_screenWidth / (float)m_screenHeight, 0.1f, 100.0f);
-            glm::mat4 pointView = glm::lookAt(cameraPosition, cameraPosition + cameraFront, cameraUp);
-            glm::mat4 pointModel = glm::mat4(1.0f);
-            glUseProgram(rootShader.m_outputProgram);
-            glStencilMask(0x00);
-            glUniform4f(glGetUniformLocation(rootShader.m_outputProgram, "LightColor"), rootLight.m_diffuse[0], rootLight.m_diffuse[1], rootLight.m_diffuse[2], 1.0f);
-            glUniformMatrix4fv(glGetUniformLocation(rootShader.m_outputProgram, "projection"), 1, GL_FALSE, &pointProjection[0][0]);
-            glUniformMatrix4fv(glGetUniformLocation(rootShader.m_outputProgram, "view"), 1, GL_FALSE, &pointView[0][0]);
-            pointModel = glm::translate(pointModel, rootPos);
-            pointModel = glm::rotate(pointModel, rootAngle, glm::vec3(0.0f, 0.0f, 1.0f));
-            pointModel = glm::scale(pointModel, rootLight.m_scale);
-            glUniformMatrix4fv(glGetUniformLocation(rootShader.m_outputProgram, "model"), 1, GL_FALSE, &pointModel[0][0]);
-            glBindVertexArray(rootGraphics.m_VAO);
-            glEnable(GL_FRAMEBUFFER_SRGB);
-            glDrawArrays(GL_TRIANGLES, 0, rootGraphics.m_vertexCount);
-            glDisable(GL_FRAMEBUFFER_SRGB);
-            glBindVertexArray(0);
+        else if (visible < lightCount + gameplayCount) {
+            std::uint32_t i = static_cast<std::uint32_t>(visible - lightCount);
+            const GameplaySnapshot& game = snapshot.m_gameplay[i];
+            unsigned int textureSet = getTextureSet(game.m_texture);
+            glm::vec3 position = interpolatePosition(game.m_previousPosition, game.m_position, m_renderFactor);
+            float unitPixels = getUnitPixels(pixelsPerUnit, 1.0f, glm::distance(m_cameraPosition, position));
+            unsigned int mesh = getMeshKey(game.m_graphics.m_VAO, selectLod(game.m_graphics, unitPixels, LOD_ERROR_PIXELS), LOD_BITS);
+            m_renderQueue.push(RenderQueue::makeKey(gameplayQueue, game.m_shader.m_outputProgram, textureSet, mesh), i);
+            if (game.m_graphics.m_stencilFlag) {
+                m_renderQueue.push(RenderQueue::makeKey(stencilQueue, game.m_shader.m_stencilProgram, textureSet, mesh), i);
+            }
         }
-        // .....................................................................
-        // spot lights
-        // .....................................................................
         else {
-            b2Vec2 rootBodyPos = rootBody.m_body->GetPosition();
-            glm::vec3 rootPos = glm::vec3(rootBodyPos.x, rootBodyPos.y, 0.0f);
-            glm::vec3 offsetRootPos = glm::vec3(rootBodyPos.x, rootBodyPos.y, 0.1f);
-            float rootAngle = rootBody.m_body->GetAngle();
-
-            // .................................................................
-            // spotlight: store reflection data
-            std::string positionAddress = "spotLights[" + std::to_string(rootShadow.m_index) + "].position";
-            std::string directionAddress = "spotLights[" + std::to_string(rootShadow.m_index) + "].direction";
-            std::string ambientAddress = "spotLights[" + std::to_string(rootShadow.m_index) + "].ambient";
-            std::string diffuseAddress = "spotLights[" + std::to_string(rootShadow.m_index) + "].diffuse";
-            std::string specularAddress = "spotLights[" + std::to_string(rootShadow.m_index) + "].specular";
-            std::string constantAddress = "spotLights[" + std::to_string(rootShadow.m_index) + "].constant";
-            std::string linearAddress = "spotLights[" + std::to_string(rootShadow.m_index) + "].linear";
-            std::string quadraticAddress = "spotLights[" + std::to_string(rootShadow.m_index) + "].quadratic";
-            std::string cutOffAddress = "spotLights[" + std::to_string(rootShadow.m_index) + "].cutOff";
-            std::string outerCutOffAddress = "spotLights[" + std::to_string(rootShadow.m_index) + "].outerCutOff";
-            glUseProgram(rootShader.m_lightProgram);
-            glUniform3f(glGetUniformLocation(rootShader.m_lightProgram, positionAddress.c_str()), rootPos[0], rootPos[1], rootPos[2]);
-            glUniform3f(glGetUniformLocation(rootShader.m_lightProgram, directionAddress.c_str()), rootLight.m_direction[0], rootLight.m_direction[1], rootLight.m_direction[2]);
-            glUniform3f(glGetUniformLocation(rootShader.m_lightProgram, ambientAddress.c_str()), rootLight.m_ambient[0], rootLight.m_ambient[1], rootLight.m_ambient[2]);
-            glUniform3f(glGetUniformLocation(rootShader.m_lightProgram, diffuseAddress.c_str()), rootLight.m_diffuse[0], rootLight.m_diffuse[1], rootLight.m_diffuse[2]);
-            glUniform3f(glGetUniformLocation(rootShader.m_lightProgram, specularAddress.c_str()), rootLight.m_specular[0], rootLight.m_specular[1], rootLight.m_specular[2]);
-            glUniform1f(glGetUniformLocation(rootShader.m_lightProgram, constantAddress.c_str()), rootLight.m_constant);
-            glUniform1f(glGetUniformLocation(rootShader.m_lightProgram, linearAddress.c_str()), rootLight.m_linear);
-            glUniform1f(glGetUniformLocation(rootShader.m_lightProgram, quadraticAddress.c_str()), rootLight.m_quadratic);
-            glUniform1f(glGetUniformLocation(rootShader.m_lightProgram, cutOffAddress.c_str()), rootLight.m_cutOff);
-            glUniform1f(glGetUniformLocation(rootShader.m_lightProgram, outerCutOffAddress.c_str()), rootLight.m_outerCutOff);
-
-            // .................................................................
-            // spotlight: render
-            glm::mat4 spotProjection = glm::perspective(glm::radians(cameraZoom), (float)m_screenWidth / (float)m_screenHeight, 0.1f, 100.0f);
-            glm::mat4 spotView = glm::lookAt(cameraPosition, cameraPosition + cameraFront, cameraUp);
-            glm::mat4 spotModel = glm::mat4(1.0f);
-            glUseProgram(rootShader.m_outputProgram);
-            glStencilMask(0x00);
-            glUniform4f(glGetUniformLocation(rootShader.m_outputProgram, "LightColor"), rootLight.m_diffuse[0], rootLight.m_diffuse[1], rootLight.m_diffuse[2], 1.0f);
-            glUniformMatrix4fv(glGetUniformLocation(rootShader.m_outputProgram, "projection"), 1, GL_FALSE, &spotProjection[0][0]);
-            glUniformMatrix4fv(glGetUniformLocation(rootShader.m_outputProgram, "view"), 1, GL_FALSE, &spotView[0][0]);
-            spotModel = glm::translate(spotModel, rootPos);
-            spotModel = glm::rotate(spotModel, rootAngle, glm::vec3(0.0f, 0.0f, 1.0f));
-            spotModel = glm::scale(spotModel, rootLight.m_scale);
-            glUniformMatrix4fv(glGetUniformLocation(rootShader.m_outputProgram, "model"), 1, GL_FALSE, &spotModel[0][0]);
-            glBindVertexArray(rootGraphics.m_VAO);
-            glEnable(GL_FRAMEBUFFER_SRGB);
-            glDrawArrays(GL_TRIANGLES, 0, rootGraphics.m_vertexCount);
-            glDisable(GL_FRAMEBUFFER_SRGB);
-            glBindVertexArray(0);
+            std::uint32_t i = static_cast<std::uint32_t>(visible - lightCount - gameplayCount);
+            const SpriteSnapshot& sprite = snapshot.m_sprites[i];
+            m_renderQueue.push(RenderQueue::makeKey(spriteQueue, sprite.m_shader.m_outputProgram, getTextureSet(sprite.m_texture), sprite.m_graphics.m_VAO), i);
         }
-    });
+    }
+    m_renderQueue.sort();
+}
 
-    // _________________________________________________________________________
-    // -------------------------------------------------------------------------
-    // 4) render skybox
-    // _________________________________________________________________________
-    // -------------------------------------------------------------------------
-    auto skyboxEntities = registry.view<
-        SkyboxComponent,
-        TextureComponent, 
-        ShaderProgramComponent,
-        RenderDataComponent
-    >();
-    skyboxEntities.each([&](
-        const auto& skybox,
-        const auto& texture,
-        const auto& shader,
-        const auto& graphics
-    ) {
+void RenderSystem::buildInstances(const FrameSnapshot& snapshot) {
+    ONSET_PROFILE_SCOPE("RenderSystem::buildInstances");
+    m_instances.clear();
+    m_gameplayBatches.clear();
+    m_stencilBatches.clear();
+    m_shadowBatches.clear();
+
+    // .........................................................................
+    // shadow casters: every gameplay entity, then every light (lights past
+    // the gameplay entities, in m_casterInstances and the caster queue)
+    // .........................................................................
+    std::size_t gameplayCount = snapshot.m_gameplay.size();
+    m_casterInstances.resize(gameplayCount + snapshot.m_lights.size());
+    for (std::size_t i = 0; i < gameplayCount; i++) {
+        const auto& game = snapshot.m_gameplay[i];
+        InstanceData& instance = m_casterInstances[i];
+        instance.m_model = glm::translate(glm::mat4(1.0f), interpolatePosition(game.m_previousPosition, game.m_position, m_renderFactor));
+        instance.m_model = glm::rotate(instance.m_model, interpolateAngle(game.m_previousAngle, game.m_angle, m_renderFactor), glm::vec3(0.0f, 0.0f, 1.0f));
+        instance.m_normal = glm::mat3(transpose(inverse(instance.m_model)));
+        instance.m_shininess = game.m_material.m_shininess;
+    }
+    for (std::size_t i = 0; i < snapshot.m_lights.size(); i++) {
+        const auto& light = snapshot.m_lights[i];
+        InstanceData& instance = m_casterInstances[gameplayCount + i];
+        instance.m_model = glm::translate(glm::mat4(1.0f), interpolatePosition(light.m_previousPosition, light.m_position, m_renderFactor));
+        instance.m_model = glm::rotate(instance.m_model, interpolateAngle(light.m_previousAngle, light.m_angle, m_renderFactor), glm::vec3(0.0f, 0.0f, 1.0f));
+        instance.m_model = glm::scale(instance.m_model, light.m_light.m_scale);
+    }
+
+    // .........................................................................
+    // gameplay and stencil outlines: runs of equal keys in the render queue
+    // .........................................................................
+    const std::vector<RenderCommand>& commands = m_renderQueue.getCommands();
+    std::size_t begin, end;
+    m_renderQueue.getPassRange(gameplayQueue, begin, end);
+    for (std::size_t i = begin; i < end; i++) {
+        const auto& graphics = snapshot.m_gameplay[commands[i].m_index].m_graphics;
+        MeshLod lod = getMeshLod(graphics, getKeyLod(commands[i].m_key, LOD_BITS));
+        // entities writing the stencil buffer are batched apart
+        bool isRun = !m_gameplayBatches.empty() 
+            && commands[i].m_key == commands[i - 1].m_key
+            && graphics.m_stencilFlag == snapshot.m_gameplay[commands[i - 1].m_index].m_graphics.m_stencilFlag
+            && lod.m_indexOffset == m_gameplayBatches.back().m_firstIndex
+            && static_cast<int>(lod.m_indexCount) == m_gameplayBatches.back().m_indexCount;
+        if (!isRun) {
+            InstanceBatch batch;
+            batch.m_command = i;
+            batch.m_VAO = graphics.m_VAO;
+            batch.m_firstIndex = lod.m_indexOffset;
+            batch.m_indexCount = static_cast<int>(lod.m_indexCount);
+            batch.m_firstInstance = m_instances.size();
+            m_gameplayBatches.push_back(batch);
+        }
+        m_instances.push_back(m_casterInstances[commands[i].m_index]);
+        m_gameplayBatches.back().m_instanceCount++;
+    }
+    m_renderQueue.getPassRange(stencilQueue, begin, end);
+    for (std::size_t i = begin; i < end; i++) {
+        const auto& graphics = snapshot.m_gameplay[commands[i].m_index].m_graphics;
+        MeshLod lod = getMeshLod(graphics, getKeyLod(commands[i].m_key, LOD_BITS));
+        bool isRun = !m_stencilBatches.empty() 
+            && commands[i].m_key == commands[i - 1].m_key
+            && lod.m_indexOffset == m_stencilBatches.back().m_firstIndex
+            && static_cast<int>(lod.m_indexCount) == m_stencilBatches.back().m_indexCount;
+        if (!isRun) {
+            InstanceBatch batch;
+            batch.m_command = i;
+            batch.m_VAO = graphics.m_VAO;
+            batch.m_firstIndex = lod.m_indexOffset;
+            batch.m_indexCount = static_cast<int>(lod.m_indexCount);
+            batch.m_firstInstance = m_instances.size();
+            m_stencilBatches.push_back(batch);
+        }
+        // outlines are the entity, scaled up
+        InstanceData instance = m_casterInstances[commands[i].m_index];
+        instance.m_model = glm::scale(instance.m_model, glm::vec3(1.1f, 1.1f, 1.1f));
+        instance.m_normal = glm::mat3(transpose(inverse(instance.m_model)));
+        m_instances.push_back(instance);
+        m_stencilBatches.back().m_instanceCount++;
+    }
+
+    // .........................................................................
+    // shadows: the casters in reach of each shadowed light, grouped by mesh
+    // and level of detail, as seen from the light. Casters are binned in a 
+    // grid of cells about the shortest shadow range, so each light only 
+    // tests the casters of the cells its range overlaps. Casters of point 
+    // lights carry the cubemap faces their bounds reach, the only faces the
+    // geometry shader draws them to
+    // .........................................................................
+    float shortestRange = std::numeric_limits<float>::infinity();
+    for (const auto& light : snapshot.m_lights) {
+        if (light.m_shadow.m_type == 1 || light.m_shadow.m_type == 2) {
+            shortestRange = std::min(shortestRange, light.m_shadow.m_farPlane);
+        }
+    }
+    m_casterGrid.clear();
+    if (shortestRange != std::numeric_limits<float>::infinity()) {
+        // point and spot lights cast shadows too, directional ones have no mesh
+        for (std::size_t i = 0; i < m_casterInstances.size(); i++) {
+            if (i < gameplayCount || snapshot.m_lights[i - gameplayCount].m_light.m_type != 0) {
+                m_casterGrid.insert(static_cast<std::uint32_t>(i), glm::vec2(m_casterInstances[i].m_model[3]));
+            }
+        }
+        m_casterGrid.build(shortestRange);
+    }
+
+    m_shadowBatchBegin.assign(snapshot.m_lights.size() + 1, 0);
+    for (std::size_t light = 0; light < snapshot.m_lights.size(); light++) {
+        m_shadowBatchBegin[light] = m_shadowBatches.size();
+        const auto& root = snapshot.m_lights[light];
+        bool isSpot = root.m_shadow.m_type == 1 && m_spotShadowTiles[light] != NO_SHADOW_TILE;
+        if (!isSpot && root.m_shadow.m_type != 2) {
+            continue;
+        }
+        glm::vec3 rootPos = interpolatePosition(root.m_previousPosition, root.m_position, m_renderFactor);
+        // a cube map face spans 90 degrees, a spot light's tile its own size
+        float pixelsPerUnit = isSpot
+            ? getPixelsPerUnit(spotShadowFieldOfView, static_cast<float>(m_shadowAtlas.getTile(m_spotShadowTiles[light]).m_size))
+            : getPixelsPerUnit(90.0f, static_cast<float>(m_shadowHeight));
+
+        // the cubemap is centered as in renderPointShadows
+        glm::vec3 cubeCenter = rootPos + glm::vec3(0.0f, 0.0f, 0.1f);
+
+        m_casterQueue.clear();
+        m_casterFaces.resize(m_casterInstances.size());
+        m_casterGrid.query(glm::vec2(rootPos), root.m_shadow.m_farPlane, m_nearbyCasters);
+        for (std::uint32_t i : m_nearbyCasters) {
+            glm::vec3 casterPos = glm::vec3(m_casterInstances[i].m_model[3]);
+            float distance = glm::distance(rootPos, casterPos);
+            if (distance > root.m_shadow.m_farPlane) {
+                continue;
+            }
+            const RenderDataComponent* graphics = nullptr;
+            float scale = 1.0f;
+            float radius = 0.0f;
+            if (i < gameplayCount) {
+                graphics = &snapshot.m_gameplay[i].m_graphics;
+                radius = snapshot.m_gameplay[i].m_boundingRadius;
+            }
+            else {
+                const auto& interior = snapshot.m_lights[i - gameplayCount];
+                graphics = &interior.m_graphics;
+                scale = std::max(interior.m_light.m_scale.x, std::max(interior.m_light.m_scale.y, interior.m_light.m_scale.z));
+                radius = interior.m_boundingRadius;
+            }
+            // casters of unknown bounds (radius 0) reach every face
+            m_casterFaces[i] = !isSpot && radius > 0.0f ? getCubeFaces(casterPos - cubeCenter, radius) : ALL_CUBE_FACES;
+            unsigned int lod = selectLod(*graphics, getUnitPixels(pixelsPerUnit, scale, distance), SHADOW_LOD_ERROR_PIXELS);
+            m_casterQueue.push(RenderQueue::makeKey(0, 0, 0, getMeshKey(graphics->m_VAO, lod, LOD_BITS)), i);
+        }
+        m_casterQueue.sort();
+
+        std::size_t lightBegin = m_shadowBatches.size();
+        for (const RenderCommand& caster : m_casterQueue.getCommands()) {
+            const RenderDataComponent& graphics = caster.m_index < gameplayCount
+                ? snapshot.m_gameplay[caster.m_index].m_graphics
+                : snapshot.m_lights[caster.m_index - gameplayCount].m_graphics;
+            MeshLod lod = getMeshLod(graphics, getKeyLod(caster.m_key, LOD_BITS));
+            bool isRun = m_shadowBatches.size() > lightBegin
+                && graphics.m_VAO == m_shadowBatches.back().m_VAO
+                && lod.m_indexOffset == m_shadowBatches.back().m_firstIndex
+                && static_cast<int>(lod.m_indexCount) == m_shadowBatches.back().m_indexCount;
+            if (!isRun) {
+                InstanceBatch batch;
+                batch.m_VAO = graphics.m_VAO;
+                batch.m_firstIndex = lod.m_indexOffset;
+                batch.m_indexCount = static_cast<int>(lod.m_indexCount);
+                batch.m_firstInstance = m_instances.size();
+                m_shadowBatches.push_back(batch);
+            }
+            m_instances.push_back(m_casterInstances[caster.m_index]);
+            m_instances.back().m_shadowFaces = m_casterFaces[caster.m_index];
+            m_shadowBatches.back().m_instanceCount++;
+        }
+    }
+    m_shadowBatchBegin[snapshot.m_lights.size()] = m_shadowBatches.size();
+
+    // one upload for the frame, orphaning last frame's storage. The buffer
+    // never gets empty, as VAOs drawn without instancing still point at it
+    std::size_t instanceCount = std::max<std::size_t>(m_instances.size(), 1);
+    if (m_instances.empty()) {
+        m_instances.emplace_back();
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, m_instanceBuffer);
+    glBufferData(GL_ARRAY_BUFFER, instanceCount * sizeof(InstanceData), m_instances.data(), GL_STREAM_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void RenderSystem::pointInstanceAttributes(std::size_t firstInstance) {
+    std::size_t offset = firstInstance * sizeof(InstanceData);
+    GLsizei stride = sizeof(InstanceData);
+    for (unsigned int column = 0; column < 4; column++) {
+        glVertexAttribPointer(INSTANCE_LOCATION + column, 4, GL_FLOAT, GL_FALSE, stride, (void*)(offset + offsetof(InstanceData, m_model) + column * sizeof(glm::vec4)));
+    }
+    for (unsigned int column = 0; column < 3; column++) {
+        glVertexAttribPointer(INSTANCE_LOCATION + 4 + column, 3, GL_FLOAT, GL_FALSE, stride, (void*)(offset + offsetof(InstanceData, m_normal) + column * sizeof(glm::vec3)));
+    }
+    glVertexAttribPointer(INSTANCE_LOCATION + 7, 1, GL_FLOAT, GL_FALSE, stride, (void*)(offset + offsetof(InstanceData, m_shininess)));
+    glVertexAttribIPointer(INSTANCE_LOCATION + 8, 1, GL_UNSIGNED_INT, stride, (void*)(offset + offsetof(InstanceData, m_shadowFaces)));
+}
+
+void RenderSystem::drawInstances(const InstanceBatch& batch) {
+    bindVertexArray(batch.m_VAO);
+    // GL 3.3 has no base instance, so the VAO's instance attributes are
+    // pointed at the batch's first instance
+    glBindBuffer(GL_ARRAY_BUFFER, m_instanceBuffer);
+    pointInstanceAttributes(batch.m_firstInstance);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glDrawElementsInstanced(GL_TRIANGLES, batch.m_indexCount, GL_UNSIGNED_INT, (void*)(batch.m_firstIndex * sizeof(unsigned int)), static_cast<GLsizei>(batch.m_instanceCount));
+}
+
+unsigned int RenderSystem::selectLod(const RenderDataComponent& graphics, float unitPixels, float maxErrorPixels) const {
+    // objects with buffers of their own have a single level
+    if (graphics.m_mesh == 0) {
+        return 0;
+    }
+    // levels are ordered by error, so the first one too coarse ends the search
+    const std::vector<MeshLod>& lods = m_meshRegistry.get(graphics.m_mesh).m_lods;
+    unsigned int lod = 0;
+    for (std::size_t i = 1; i < lods.size() && lods[i].m_error * unitPixels <= maxErrorPixels; i++) {
+        lod = static_cast<unsigned int>(i);
+    }
+    return lod;
+}
+
+MeshLod RenderSystem::getMeshLod(const RenderDataComponent& graphics, unsigned int lod) const {
+    if (graphics.m_mesh != 0) {
+        const std::vector<MeshLod>& lods = m_meshRegistry.get(graphics.m_mesh).m_lods;
+        if (lod < lods.size()) {
+            return lods[lod];
+        }
+    }
+    MeshLod fullDetail = {};
+    fullDetail.m_indexCount = static_cast<std::uint32_t>(graphics.m_indexCount);
+    return fullDetail;
+}
+
+// _____________________________________________________________________________
+// -----------------------------------------------------------------------------
+// 2) shadow mapping
+// _____________________________________________________________________________
+// -----------------------------------------------------------------------------
+// .............................................................................
+// spotlight: monodirectional shadow mapping, into tiles of one atlas
+// .............................................................................
+void RenderSystem::packShadowAtlas(const FrameSnapshot& snapshot) {
+    ONSET_PROFILE_SCOPE("RenderSystem::packShadowAtlas");
+    m_shadowAtlas.clear();
+    m_spotShadowTiles.assign(snapshot.m_lights.size(), NO_SHADOW_TILE);
+
+    // a tile gets about as many texels across as the light's cone spans
+    // pixels on screen at its far plane, up to the shadow resolution
+    float pixelsPerUnit = getPixelsPerUnit(m_cameraZoom, static_cast<float>(m_framebufferHeight));
+    float coneExtent = 2.0f * tanf(glm::radians(spotShadowFieldOfView) * 0.5f);
+    unsigned int maxTile = std::max(m_shadowWidth, MIN_SHADOW_TILE);
+    for (std::size_t light = 0; light < snapshot.m_lights.size(); light++) {
+        const auto& root = snapshot.m_lights[light];
+        const auto& rootShadow = root.m_shadow;
+        if (rootShadow.m_type != 1 || rootShadow.m_index >= MAX_SPOT_LIGHTS) {
+            continue;
+        }
+        glm::vec3 rootPos = interpolatePosition(root.m_previousPosition, root.m_position, m_renderFactor);
+        float coverage = getUnitPixels(pixelsPerUnit, coneExtent * rootShadow.m_farPlane, glm::distance(rootPos, m_cameraPosition));
+        unsigned int tileSize = MIN_SHADOW_TILE;
+        while (tileSize < coverage && tileSize < maxTile) {
+            tileSize *= 2;
+        }
+        m_spotShadowTiles[light] = m_shadowAtlas.addTile(std::min(tileSize, maxTile));
+    }
+    m_shadowAtlas.pack(MAX_SHADOW_ATLAS);
+
+    // the texture grows to fit, and shrinks once a quarter of it would do, 
+    // so tiles changing size do not reallocate it every frame
+    std::uint32_t width = m_shadowAtlas.getWidth();
+    std::uint32_t height = m_shadowAtlas.getHeight();
+    bool isGrowing = width > m_shadowAtlasWidth || height > m_shadowAtlasHeight;
+    bool isShrinking = width * height * 4 <= m_shadowAtlasWidth * m_shadowAtlasHeight;
+    if (width == 0 || (!isGrowing && !isShrinking)) {
+        return;
+    }
+    if (m_shadowAtlasFramebuffer == 0) {
+        glGenFramebuffers(1, &m_shadowAtlasFramebuffer);
+        glGenTextures(1, &m_shadowAtlasTexture);
+    }
+    m_shadowAtlasWidth = width;
+    m_shadowAtlasHeight = height;
+    glBindTexture(GL_TEXTURE_2D, m_shadowAtlasTexture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT, m_shadowAtlasWidth, m_shadowAtlasHeight, 0, GL_DEPTH_COMPONENT, GL_FLOAT, NULL);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_BORDER);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_BORDER);
+    float borderColor[] = {1.0, 1.0, 1.0, 1.0};
+    glTexParameterfv(GL_TEXTURE_2D, GL_TEXTURE_BORDER_COLOR, borderColor);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    // attach depth texture as FBO's depth buffer
+    glBindFramebuffer(GL_FRAMEBUFFER, m_shadowAtlasFramebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, m_shadowAtlasTexture, 0);
+    glDrawBuffer(GL_NONE);
+    glReadBuffer(GL_NONE);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+void RenderSystem::renderSpotShadows(const FrameSnapshot& snapshot) {
+    ONSET_PROFILE_SCOPE("RenderSystem::renderSpotShadows");
+    GpuProfileScope gpuScope(m_gpuProfileManager, spotShadowPass);
+
+    if (m_shadowAtlas.getWidth() == 0) {
+        return;
+    }
+    resetBindings();
+    // every tile is drawn in the one framebuffer, cleared once
+    glBindFramebuffer(GL_FRAMEBUFFER, m_shadowAtlasFramebuffer);
+    glClear(GL_DEPTH_BUFFER_BIT);
+    for (std::size_t light = 0; light < snapshot.m_lights.size(); light++) {
+        if (m_spotShadowTiles[light] == NO_SHADOW_TILE) {
+            continue;
+        }
+        const auto& root = snapshot.m_lights[light];
+        const auto& rootLight = root.m_light;
+        const auto& rootShader = root.m_shader;
+        const auto& rootShadow = root.m_shadow;
+
+        glm::vec3 rootPos = interpolatePosition(root.m_previousPosition, root.m_position, m_renderFactor);
+        glm::mat4 rootSpaceMatrix = getSpotLightSpaceMatrix(
+            rootPos, 
+            rootLight.m_direction, 
+            1.0f, 
+            rootShadow.m_nearPlane, 
+            rootShadow.m_farPlane
+        );
+
+        const ProgramUniforms& shadowUniforms = getProgramUniforms(rootShader.m_shadowProgram);
+        useProgram(rootShader.m_shadowProgram);
+        setUniform(shadowUniforms.m_lightSpaceMatrix, rootSpaceMatrix);
+
+        const ShadowTile& tile = m_shadowAtlas.getTile(m_spotShadowTiles[light]);
+        glViewport(tile.m_x, tile.m_y, tile.m_size, tile.m_size);
+        // render objects that cast a shadow to the light's tile, one instanced draw per mesh
+        for (std::size_t i = m_shadowBatchBegin[light]; i < m_shadowBatchBegin[light + 1]; i++) {
+            drawInstances(m_shadowBatches[i]);
+        }
+    }
+    bindVertexArray(0);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glViewport(0, 0, m_framebufferWidth, m_framebufferHeight);
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+}
+
+// .............................................................................
+// pointlight: omnidirectional shadow mapping
+// .............................................................................
+void RenderSystem::renderPointShadows(const FrameSnapshot& snapshot) {
+    ONSET_PROFILE_SCOPE("RenderSystem::renderPointShadows");
+    GpuProfileScope gpuScope(m_gpuProfileManager, pointShadowPass);
+
+    resetBindings();
+    for (std::size_t light = 0; light < snapshot.m_lights.size(); light++) {
+        const auto& root = snapshot.m_lights[light];
+        const auto& rootShader = root.m_shader;
+        const auto& rootShadow = root.m_shadow;
+        // lights past the shader's cubemaps cast no shadow
+        if (rootShadow.m_type != 2 || rootShadow.m_index >= MAX_POINT_LIGHTS) {
+            continue;
+        }
+
+        m_shadowCubes[rootShadow.m_index] = rootShadow.m_depthCubemap;
+        glm::vec3 rootPos = interpolatePosition(root.m_previousPosition, root.m_position, m_renderFactor);
+        glm::vec3 offsetRootPos = rootPos + glm::vec3(0.0f, 0.0f, 0.1f);
+
+        glm::mat4 rootProjection = glm::perspective(glm::radians(90.0f), (GLfloat)m_shadowWidth / (GLfloat)m_shadowHeight, rootShadow.m_nearPlane, rootShadow.m_farPlane);
+        std::vector<glm::mat4> rootTransforms;
+        rootTransforms.push_back(rootProjection * glm::lookAt(offsetRootPos, rootPos + glm::vec3(1.0f, 0.0f, 0.0f), glm::vec3(0.0f, -1.0f, 0.0f)));
+        rootTransforms.push_back(rootProjection * glm::lookAt(offsetRootPos, rootPos + glm::vec3(-1.0f, 0.0f, 0.0f), glm::vec3(0.0f, -1.0f, 0.0f)));
+        rootTransforms.push_back(rootProjection * glm::lookAt(offsetRootPos, rootPos + glm::vec3(0.0f, 1.0f, 0.0f), glm::vec3(0.0f, 0.0f, 1.0f)));
+        rootTransforms.push_back(rootProjection * glm::lookAt(offsetRootPos, rootPos + glm::vec3(0.0f, -1.0f, 0.0f), glm::vec3(0.0f, 0.0f, -1.0f)));
+        rootTransforms.push_back(rootProjection * glm::lookAt(offsetRootPos, rootPos + glm::vec3(0.0f, 0.0f, 1.0f), glm::vec3(0.0f, -1.0f, 0.0f)));
+        rootTransforms.push_back(rootProjection * glm::lookAt(offsetRootPos, rootPos + glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, -1.0f, 0.0f)));
+
+        const ProgramUniforms& shadowUniforms = getProgramUniforms(rootShader.m_shadowProgram);
+        useProgram(rootShader.m_shadowProgram);
+        for (unsigned int i = 0; i < 6; ++i) {
+            setUniform(shadowUniforms.m_shadowMatrices[i], rootTransforms[i]);
+        }
+        setUniform(shadowUniforms.m_farPlane, rootShadow.m_farPlane);
+        setUniform(shadowUniforms.m_lightPos, offsetRootPos);
+
+        glViewport(0, 0, m_shadowWidth, m_shadowHeight);
+        glBindFramebuffer(GL_FRAMEBUFFER, rootShadow.m_shadowFramebuffer);
+        glClear(GL_DEPTH_BUFFER_BIT);
+        // render objects that cast a shadow to the 3D shadow map cubemap, one instanced draw per mesh
+        for (std::size_t i = m_shadowBatchBegin[light]; i < m_shadowBatchBegin[light + 1]; i++) {
+            drawInstances(m_shadowBatches[i]);
+        }
+        bindVertexArray(0);
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        glViewport(0, 0, m_framebufferWidth, m_framebufferHeight);
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    }
+}
+
+// _____________________________________________________________________________
+// -----------------------------------------------------------------------------
+// 3) render lights
+// _____________________________________________________________________________
+// -----------------------------------------------------------------------------
+void RenderSystem::renderLights(const FrameSnapshot& snapshot) {
+    ONSET_PROFILE_SCOPE("RenderSystem::renderLights");
+    GpuProfileScope gpuScope(m_gpuProfileManager, lightPass);
+
+    // directional lights have no mesh, and the data of every light is in the 
+    // Lights block, so only point and spot light meshes are drawn
+    std::size_t begin, end;
+    m_renderQueue.getPassRange(lightQueue, begin, end);
+    if (begin == end) {
+        return;
+    }
+    resetBindings();
+    glStencilMask(0x00);
+    glEnable(GL_FRAMEBUFFER_SRGB);
+    for (std::size_t i = begin; i < end; i++) {
+        const RenderCommand& command = m_renderQueue.getCommands()[i];
+        const auto& root = snapshot.m_lights[command.m_index];
+        const auto& rootLight = root.m_light;
+        const auto& rootShader = root.m_shader;
+        const auto& rootGraphics = root.m_graphics;
+
+        glm::vec3 rootPos = interpolatePosition(root.m_previousPosition, root.m_position, m_renderFactor);
+        float rootAngle = interpolateAngle(root.m_previousAngle, root.m_angle, m_renderFactor);
+        glm::mat4 rootModel = glm::mat4(1.0f);
+        const ProgramUniforms& outputUniforms = getProgramUniforms(rootShader.m_outputProgram);
+        useProgram(rootShader.m_outputProgram);
+        setUniform(outputUniforms.m_lightColor, glm::vec4(rootLight.m_diffuse, 1.0f));
+        rootModel = glm::translate(rootModel, rootPos);
+        rootModel = glm::rotate(rootModel, rootAngle, glm::vec3(0.0f, 0.0f, 1.0f));
+        rootModel = glm::scale(rootModel, rootLight.m_scale);
+        setUniform(outputUniforms.m_model, rootModel);
+        bindVertexArray(rootGraphics.m_VAO);
+        MeshLod lod = getMeshLod(rootGraphics, getKeyLod(command.m_key, LOD_BITS));
+        glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(lod.m_indexCount), GL_UNSIGNED_INT, (void*)(lod.m_indexOffset * sizeof(unsigned int)));
+    }
+    glDisable(GL_FRAMEBUFFER_SRGB);
+    bindVertexArray(0);
+}
+
+// _____________________________________________________________________________
+// -----------------------------------------------------------------------------
+// 4) render skybox
+// _____________________________________________________________________________
+// -----------------------------------------------------------------------------
+void RenderSystem::renderSkybox(const FrameSnapshot& snapshot) {
+    ONSET_PROFILE_SCOPE("RenderSystem::renderSkybox");
+    GpuProfileScope gpuScope(m_gpuProfileManager, skyboxPass);
+
+    for (const auto& skybox : snapshot.m_skyboxes) {
+        const auto& texture = skybox.m_texture;
+        const auto& shader = skybox.m_shader;
+        const auto& graphics = skybox.m_graphics;
         // change depth function so depth test passes when values are equal to depth buffer's content
         glDepthFunc(GL_LEQUAL);
+        // the shader removes the translation from the Camera block's view
         glUseProgram(shader.m_outputProgram);
 
-        glm::mat4 projection = glm::perspective(glm::radians(cameraZoom), (float)m_screenWidth / (float)m_screenHeight, 0.1f, 100.0f);
-        // remove translation from view matrix
-        glm::mat4 view = glm::mat4(glm::mat3(glm::lookAt(cameraPosition, cameraPosition + cameraFront, cameraUp)));
-        glUniformMatrix4fv(glGetUniformLocation(shader.m_outputProgram, "projection"), 1, GL_FALSE, &projection[0][0]);
-        glUniformMatrix4fv(glGetUniformLocation(shader.m_outputProgram, "view"), 1, GL_FALSE, &view[0][0]);
-
         glBindVertexArray(graphics.m_VAO);
         glActiveTexture(GL_TEXTURE11);
         glBindTexture(GL_TEXTURE_CUBE_MAP, texture.m_cubemap);
         glEnable(GL_FRAMEBUFFER_SRGB);
-        glDrawArrays(GL_TRIANGLES, 0, graphics.m_vertexCount);
+        glDrawElements(GL_TRIANGLES, graphics.m_indexCount, GL_UNSIGNED_INT, 0);
         glDisable(GL_FRAMEBUFFER_SRGB);
         
         glBindVertexArray(0);
         glDepthFunc(GL_LESS); // set depth function back to default
-    });
+    }
+}
 
-    // _________________________________________________________________________
-    // -------------------------------------------------------------------------
-    // 5) render game entities with material components
-    // _________________________________________________________________________
-    // -------------------------------------------------------------------------
+// _____________________________________________________________________________
+// -----------------------------------------------------------------------------
+// 5) render game entities with material components
+// _____________________________________________________________________________
+// -----------------------------------------------------------------------------
+void RenderSystem::renderGameplay(const FrameSnapshot& snapshot) {
+    ONSET_PROFILE_SCOPE("RenderSystem::renderGameplay");
+    GpuProfileScope gpuScope(m_gpuProfileManager, gameplayPass);
 
-    gameplayEntities.each([&](
-        const auto& material,
-        const auto& body,
-        const auto& texture,
-        const auto& shader,
-        const auto& graphics
-    ) {
-        b2Vec2 bodyPos = body.m_body->GetPosition();
-        float angle = body.m_body->GetAngle();
+    if (m_gameplayBatches.empty()) {
+        return;
+    }
+    resetBindings();
+    // the shadow maps are shared by every entity
+    bindTexture(3, GL_TEXTURE_2D, m_shadowAtlasTexture);
+    bindTexture(6, GL_TEXTURE_CUBE_MAP, m_shadowCubes[0]);
+    bindTexture(7, GL_TEXTURE_CUBE_MAP, m_shadowCubes[1]);
+    bindTexture(8, GL_TEXTURE_CUBE_MAP, m_shadowCubes[2]);
+    glEnable(GL_FRAMEBUFFER_SRGB);
+    // entities with their stencil flag set write the stencil buffer, read 
+    // by the stencil outline pass
+    int stencilWrite = -1;
+    for (const InstanceBatch& batch : m_gameplayBatches) {
+        const auto& game = snapshot.m_gameplay[m_renderQueue.getCommands()[batch.m_command].m_index];
+        const auto& texture = game.m_texture;
+        const auto& shader = game.m_shader;
+        const auto& graphics = game.m_graphics;
         
-        glm::mat4 projection = glm::perspective(glm::radians(cameraZoom), (float)m_screenWidth / (float)m_screenHeight, 0.1f, 100.0f);
-        glm::mat4 view = glm::lookAt(cameraPosition, cameraPosition + cameraFront, cameraUp);
-        glm::mat4 model = glm::mat4(1.0f);
-        glm::mat3 normal = glm::mat3(1.0f);
-        
-        glUseProgram(shader.m_outputProgram);
-        if (graphics.m_stencilFlag == true) {
-            glStencilFunc(GL_ALWAYS, 1, 0xFF);
-            glStencilMask(0xFF);
-        }
-        else {
-            glStencilMask(0x00);
+        useProgram(shader.m_outputProgram);
+        int batchStencilWrite = graphics.m_stencilFlag ? 1 : 0;
+        if (batchStencilWrite != stencilWrite) {
+            stencilWrite = batchStencilWrite;
+            if (graphics.m_stencilFlag == true) {
+                glStencilFunc(GL_ALWAYS, 1, 0xFF);
+                glStencilMask(0xFF);
+            }
+            else {
+                glStencilMask(0x00);
+            }
         }
-        glUniform1f(glGetUniformLocation(shader.m_outputProgram, "material.shininess"), material.m_shininess);
-        glUniform3f(glGetUniformLocation(shader.m_outputProgram, "viewPos"), cameraPosition[0], cameraPosition[1], cameraPosition[2]);
-        glUniformMatrix4fv(glGetUniformLocation(shader.m_outputProgram, "projection"), 1, GL_FALSE, &projection[0][0]);
-        glUniformMatrix4fv(glGetUniformLocation(shader.m_outputProgram, "view"), 1, GL_FALSE, &view[0][0]);
-        model = glm::translate(model, glm::vec3(bodyPos.x, bodyPos.y, 0.0f));
-        model = glm::rotate(model, angle, glm::vec3(0.0f, 0.0f, 1.0f));
-        glUniformMatrix4fv(glGetUniformLocation(shader.m_outputProgram, "model"), 1, GL_FALSE, &model[0][0]);
-        normal = glm::mat3(transpose(inverse(model)));
-        glUniformMatrix3fv(glGetUniformLocation(shader.m_outputProgram, "normal"), 1, GL_FALSE, &normal[0][0]);
-        glActiveTexture(GL_TEXTURE0);
-        glBindTexture(GL_TEXTURE_2D, texture.m_diffuse);
-        glActiveTexture(GL_TEXTURE1);
-        glBindTexture(GL_TEXTURE_2D, texture.m_specular);
-        glActiveTexture(GL_TEXTURE2);
-        glBindTexture(GL_TEXTURE_2D, texture.m_normal);
-        glActiveTexture(GL_TEXTURE3);
-        glBindTexture(GL_TEXTURE_2D, shadowTextures[0]);
-        glActiveTexture(GL_TEXTURE4);
-        glBindTexture(GL_TEXTURE_2D, shadowTextures[1]);
-        glActiveTexture(GL_TEXTURE5);
-        glBindTexture(GL_TEXTURE_2D, shadowTextures[2]);
-        glActiveTexture(GL_TEXTURE6);
-        glBindTexture(GL_TEXTURE_CUBE_MAP, shadowCubes[0]);
-        glActiveTexture(GL_TEXTURE7);
-        glBindTexture(GL_TEXTURE_CUBE_MAP, shadowCubes[1]);
-        glActiveTexture(GL_TEXTURE8);
-        glBindTexture(GL_TEXTURE_CUBE_MAP, shadowCubes[2]);
-        glBindVertexArray(graphics.m_VAO);
-        glEnable(GL_FRAMEBUFFER_SRGB);
-        glDrawArrays(GL_TRIANGLES, 0, graphics.m_vertexCount);
-        glDisable(GL_FRAMEBUFFER_SRGB);
-        glBindVertexArray(0);
-    });
+        bindTexture(0, GL_TEXTURE_2D, texture.m_diffuse);
+        bindTexture(1, GL_TEXTURE_2D, texture.m_specular);
+        bindTexture(2, GL_TEXTURE_2D, texture.m_normal);
+        drawInstances(batch);
+    }
+    glDisable(GL_FRAMEBUFFER_SRGB);
+    bindVertexArray(0);
+}
+
+// _____________________________________________________________________________
+// -----------------------------------------------------------------------------
+// 6) render sprites
+// _____________________________________________________________________________
+// -----------------------------------------------------------------------------
+void RenderSystem::renderSprites(const FrameSnapshot& snapshot) {
+    ONSET_PROFILE_SCOPE("RenderSystem::renderSprites");
+    GpuProfileScope gpuScope(m_gpuProfileManager, spritePass);
+
+    std::size_t begin, end;
+    m_renderQueue.getPassRange(spriteQueue, begin, end);
+    if (begin == end) {
+        return;
+    }
+    resetBindings();
+    glStencilMask(0x00);
+    glEnable(GL_FRAMEBUFFER_SRGB);
+    for (std::size_t i = begin; i < end; i++) { 
+        const auto& entity = snapshot.m_sprites[m_renderQueue.getCommands()[i].m_index];
+        const auto& sprite = entity.m_sprite;
+        const auto& texture = entity.m_texture;
+        const auto& shader = entity.m_shader;
+        const auto& graphics = entity.m_graphics;
 
-    // _________________________________________________________________________
-    // -------------------------------------------------------------------------
-    // 6) render sprites
-    // _________________________________________________________________________
-    // -------------------------------------------------------------------------
-    auto spriteEntities = registry.view<
-        SpriteComponent,
-        TextureComponent, 
-        ShaderProgramComponent,
-        RenderDataComponent
-    >();
-    spriteEntities.each([&](
-        const auto& sprite,
-        const auto& texture,
-        const auto& shader,
-        const auto& graphics
-    ) { 
-        glm::mat4 projection = glm::perspective(glm::radians(cameraZoom), (float)m_screenWidth / (float)m_screenHeight, 0.1f, 100.0f);
-        glm::mat4 view = glm::lookAt(cameraPosition, cameraPosition + cameraFront, cameraUp);
         glm::mat4 model = glm::mat4(1.0f);
 
-        glUseProgram(shader.m_outputProgram);
-        glStencilMask(0x00);
-        glUniformMatrix4fv(glGetUniformLocation(shader.m_outputProgram, "projection"), 1, GL_FALSE, &projection[0][0]);
-        glUniformMatrix4fv(glGetUniformLocation(shader.m_outputProgram, "view"), 1, GL_FALSE, &view[0][0]);
+        useProgram(shader.m_outputProgram);
+        const ProgramUniforms& uniforms = getProgramUniforms(shader.m_outputProgram);
         model = glm::translate(model, sprite.m_position);
         model = glm::rotate(model, sprite.m_rotation, glm::vec3(0.0f, 0.0f, 1.0f));
         model = glm::scale(model, sprite.m_scale);
-        glUniformMatrix4fv(glGetUniformLocation(shader.m_outputProgram, "model"), 1, GL_FALSE, &model[0][0]);
-        glActiveTexture(GL_TEXTURE0);
-        glBindTexture(GL_TEXTURE_2D, texture.m_diffuse);
-        glBindVertexArray(graphics.m_VAO);
-        glEnable(GL_FRAMEBUFFER_SRGB);
-        glDrawArrays(GL_TRIANGLES, 0, graphics.m_vertexCount);
-        glDisable(GL_FRAMEBUFFER_SRGB);
-        glBindVertexArray(0);
-    });
+        setUniform(uniforms.m_model, model);
+        bindTexture(0, GL_TEXTURE_2D, texture.m_diffuse);
+        bindVertexArray(graphics.m_VAO);
+        glDrawElements(GL_TRIANGLES, graphics.m_indexCount, GL_UNSIGNED_INT, 0);
+    }
+    glDisable(GL_FRAMEBUFFER_SRGB);
+    bindVertexArray(0);
+}
+
+// _____________________________________________________________________________
+// -----------------------------------------------------------------------------
+// 7) render text
+// _____________________________________________________________________________
+// -----------------------------------------------------------------------------
+void RenderSystem::renderText(const FrameSnapshot& snapshot) {
+    ONSET_PROFILE_SCOPE("RenderSystem::renderText");
+    GpuProfileScope gpuScope(m_gpuProfileManager, textPass);
+
+    for (const auto& entity : snapshot.m_texts) { 
+        const auto& text = entity.m_text;
+        const auto& shader = entity.m_shader;
+        const auto& graphics = entity.m_graphics;
 
-    // _________________________________________________________________________
-    // -------------------------------------------------------------------------
-    // 7) render text
-    // _________________________________________________________________________
-    // -------------------------------------------------------------------------
-    auto textEntities = registry.view<
-        TextComponent, 
-        ShaderProgramComponent,
-        RenderDataComponent
-    >();
-    textEntities.each([&](
-        auto& text,
-        const auto& shader,
-        const auto& graphics
-    ) { 
         glUseProgram(shader.m_outputProgram);
         glStencilMask(0x00);
-        glUniform3f(glGetUniformLocation(shader.m_outputProgram, "textColor"), text.m_color.x, text.m_color.y, text.m_color.z);
+        setUniform(getProgramUniforms(shader.m_outputProgram).m_textColor, text.m_color);
         glActiveTexture(GL_TEXTURE0);
         glBindVertexArray(graphics.m_VAO);
 
         float x = text.m_xCoord;
         // iterate through all characters
-        for (std::vector<Character>::iterator ch = text.m_characters.begin(); ch != text.m_characters.end(); ++ch) {
+        for (std::vector<Character>::const_iterator ch = text.m_characters.begin(); ch != text.m_characters.end(); ++ch) {
             float xpos = x + ch->m_bearing.x * text.m_scale;
             float ypos = text.m_yCoord - (ch->m_size.y - ch->m_bearing.y) * text.m_scale;
             float w = ch->m_size.x * text.m_scale;
@@ -550,56 +907,40 @@ void RenderSystem::update(
 
         glBindVertexArray(0);
         glBindTexture(GL_TEXTURE_2D, 0);
-    });
+    }
+}
 
-    // _________________________________________________________________________
-    // -------------------------------------------------------------------------
-    // 8) render stencil outlines
-    // _________________________________________________________________________
-    // -------------------------------------------------------------------------
-    gameplayEntities.each([&](
-        const auto& material,
-        const auto& body,
-        const auto& texture,
-        const auto& shader,
-        const auto& graphics
-    ) {
-        if (graphics.m_stencilFlag == true) {
-            b2Vec2 bodyPos = body.m_body->GetPosition();
-            float angle = body.m_body->GetAngle();
-
-            glm::mat4 projection = glm::perspective(glm::radians(cameraZoom), (float)m_screenWidth / (float)m_screenHeight, 0.1f, 100.0f);
-            glm::mat4 view = glm::lookAt(cameraPosition, cameraPosition + cameraFront, cameraUp);
-            glm::mat4 model = glm::mat4(1.0f);
-            glm::mat3 normal = glm::mat3(1.0f);
-            float scale = 1.1f;
-
-            glUseProgram(shader.m_stencilProgram);
-            glStencilFunc(GL_NOTEQUAL, 1, 0xFF);
-            glStencilMask(0x00);
-            glDisable(GL_DEPTH_TEST);
-
-            glUniformMatrix4fv(glGetUniformLocation(shader.m_stencilProgram, "projection"), 1, GL_FALSE, &projection[0][0]);
-            glUniformMatrix4fv(glGetUniformLocation(shader.m_stencilProgram, "view"), 1, GL_FALSE, &view[0][0]);
-            model = glm::translate(model, glm::vec3(bodyPos.x, bodyPos.y, 0.0f));
-            model = glm::rotate(model, angle, glm::vec3(0.0f, 0.0f, 1.0f));
-            model = glm::scale(model, glm::vec3(scale, scale, scale));
-            glUniformMatrix4fv(glGetUniformLocation(shader.m_stencilProgram, "model"), 1, GL_FALSE, &model[0][0]);
-            normal = glm::mat3(transpose(inverse(model)));
-            glUniformMatrix3fv(glGetUniformLocation(shader.m_stencilProgram, "normal"), 1, GL_FALSE, &normal[0][0]);
-            glActiveTexture(GL_TEXTURE0);
-            glBindTexture(GL_TEXTURE_2D, texture.m_diffuse);
-            glActiveTexture(GL_TEXTURE1);
-            glBindTexture(GL_TEXTURE_2D, texture.m_specular);
-            glBindVertexArray(graphics.m_VAO);
-            glDrawArrays(GL_TRIANGLES, 0, graphics.m_vertexCount);
-
-            glBindVertexArray(0);
-            glStencilMask(0xFF);
-            glStencilFunc(GL_ALWAYS, 0, 0xFF);
-            glEnable(GL_DEPTH_TEST);
-        }
-    });
+// _____________________________________________________________________________
+// -----------------------------------------------------------------------------
+// 8) render stencil outlines
+// _____________________________________________________________________________
+// -----------------------------------------------------------------------------
+void RenderSystem::renderStencilOutlines(const FrameSnapshot& snapshot) {
+    ONSET_PROFILE_SCOPE("RenderSystem::renderStencilOutlines");
+    GpuProfileScope gpuScope(m_gpuProfileManager, stencilPass);
+
+    // only gameplay entities with their stencil flag set are queued
+    if (m_stencilBatches.empty()) {
+        return;
+    }
+    resetBindings();
+    glStencilFunc(GL_NOTEQUAL, 1, 0xFF);
+    glStencilMask(0x00);
+    glDisable(GL_DEPTH_TEST);
+    for (const InstanceBatch& batch : m_stencilBatches) {
+        const auto& game = snapshot.m_gameplay[m_renderQueue.getCommands()[batch.m_command].m_index];
+        const auto& texture = game.m_texture;
+        const auto& shader = game.m_shader;
+
+        useProgram(shader.m_stencilProgram);
+        bindTexture(0, GL_TEXTURE_2D, texture.m_diffuse);
+        bindTexture(1, GL_TEXTURE_2D, texture.m_specular);
+        drawInstances(batch);
+    }
+    bindVertexArray(0);
+    glStencilMask(0xFF);
+    glStencilFunc(GL_ALWAYS, 0, 0xFF);
+    glEnable(GL_DEPTH_TEST);
 }
 
 // -----------------------------------------------------------------------------
@@ -632,6 +973,88 @@ void RenderSystem::handleFramebufferResize(GLFWwindow* window, int width, int he
     );
 }
 
+void RenderSystem::setGpuProfileManager(GpuProfileManager* gpuProfileManager) {
+    m_gpuProfileManager = gpuProfileManager;
+}
+
+void RenderSystem::setAssetManager(AssetManager* assetManager) {
+    m_assetManager = assetManager;
+    m_programUniforms.clear();
+}
+
+const RenderSystem::ProgramUniforms& RenderSystem::getProgramUniforms(unsigned int program) {
+    auto cached = m_programUniforms.find(program);
+    if (cached != m_programUniforms.end()) {
+        return cached->second;
+    }
+
+    // first use of the program: the only place names are looked up
+    ProgramUniforms& uniforms = m_programUniforms[program];
+    if (m_assetManager == nullptr) {
+        return uniforms;
+    }
+    const AssetManager& assets = *m_assetManager;
+    uniforms.m_model = assets.getUniform<glm::mat4>(program, "model");
+    uniforms.m_lightColor = assets.getUniform<glm::vec4>(program, "LightColor");
+    uniforms.m_textColor = assets.getUniform<glm::vec3>(program, "textColor");
+    uniforms.m_lightSpaceMatrix = assets.getUniform<glm::mat4>(program, "lightSpaceMatrix");
+    for (unsigned int i = 0; i < 6; i++) {
+        uniforms.m_shadowMatrices[i] = assets.getUniform<glm::mat4>(program, "shadowMatrices[" + std::to_string(i) + "]");
+    }
+    uniforms.m_farPlane = assets.getUniform<float>(program, "far_plane");
+    uniforms.m_lightPos = assets.getUniform<glm::vec3>(program, "lightPos");
+    return uniforms;
+}
+
+unsigned int RenderSystem::getTextureSet(const TextureComponent& texture) {
+    auto key = std::make_tuple(texture.m_diffuse, texture.m_specular, texture.m_normal);
+    auto textureSet = m_textureSets.find(key);
+    if (textureSet != m_textureSets.end()) {
+        return textureSet->second;
+    }
+    unsigned int index = static_cast<unsigned int>(m_textureSets.size());
+    m_textureSets.emplace(key, index);
+    return index;
+}
+
+void RenderSystem::resetBindings() {
+    m_boundProgram = UNBOUND;
+    m_boundVertexArray = UNBOUND;
+    m_activeUnit = UNBOUND;
+    for (unsigned int& texture : m_boundTextures) {
+        texture = UNBOUND;
+    }
+}
+
+void RenderSystem::useProgram(unsigned int program) {
+    if (program != m_boundProgram) {
+        glUseProgram(program);
+        m_boundProgram = program;
+    }
+}
+
+void RenderSystem::bindVertexArray(unsigned int vertexArray) {
+    if (vertexArray != m_boundVertexArray) {
+        glBindVertexArray(vertexArray);
+        m_boundVertexArray = vertexArray;
+    }
+}
+
+void RenderSystem::bindTexture(unsigned int unit, GLenum target, unsigned int texture) {
+    // each unit of the passes holds a single target, so the ID is enough
+    if (unit < TEXTURE_UNITS && texture == m_boundTextures[unit]) {
+        return;
+    }
+    if (unit != m_activeUnit) {
+        glActiveTexture(GL_TEXTURE0 + unit);
+        m_activeUnit = unit;
+    }
+    glBindTexture(target, texture);
+    if (unit < TEXTURE_UNITS) {
+        m_boundTextures[unit] = texture;
+    }
+}
+
 void RenderSystem::setGammaFlag(bool gammaFlag) {
     m_gammaFlag = gammaFlag;
 }
@@ -641,16 +1064,195 @@ void RenderSystem::setShadowResolution(unsigned int shadowWidth, unsigned int sh
     m_shadowHeight = shadowHeight;
 }
 
+void RenderSystem::setHeadless(bool headless) {
+    m_headless = headless;
+}
+
+void RenderSystem::createMeshBuffers(
+    RenderDataComponent& graphics, 
+    const std::string& name, 
+    const void* vertices, 
+    int verticesSize, 
+    const unsigned int* indices, 
+    int indicesSize, 
+    int stride, 
+    const std::vector<int>& attributeSizes,
+    const std::vector<MeshLod>& lods
+) {
+    if (m_headless) {
+        return;
+    }
+
+    bool isPacked = graphics.m_vertexFormat == vertexFormatPacked;
+    if (isPacked && (stride != packedFloatStride || attributeSizes.size() > 3)) {
+        ONSET_WARN("Render System found a layout its packed mesh {} has not", name);
+        return;
+    }
+
+    // the layout is part of the key, as it is recorded in the VAO
+    std::string key = name + (isPacked ? ":packed:" : ":") + std::to_string(stride);
+    for (int attributeSize : attributeSizes) {
+        key += "," + std::to_string(attributeSize);
+    }
+    unsigned int handle = m_meshRegistry.find(key);
+    if (handle == 0) {
+        Mesh mesh;
+        mesh.m_vertexCount = verticesSize / (isPacked ? packedStride : stride * static_cast<int>(sizeof(float)));
+        mesh.m_indexCount = indicesSize / static_cast<int>(sizeof(unsigned int));
+        mesh.m_lods = lods;
+        if (mesh.m_lods.empty()) {
+            MeshLod fullDetail = {};
+            fullDetail.m_indexCount = static_cast<std::uint32_t>(mesh.m_indexCount);
+            mesh.m_lods.push_back(fullDetail);
+        }
+        createMeshArrays(mesh, graphics.m_vertexFormat, vertices, verticesSize, indices, indicesSize, stride, attributeSizes);
+        handle = m_meshRegistry.add(key, mesh);
+    }
+    const Mesh& mesh = m_meshRegistry.get(handle);
+    graphics.m_mesh = handle;
+    graphics.m_VAO = mesh.m_VAO;
+    graphics.m_VBO = mesh.m_VBO;
+    graphics.m_EBO = mesh.m_EBO;
+}
+
+const MeshRegistry& RenderSystem::getMeshRegistry() const {
+    return m_meshRegistry;
+}
+
+void RenderSystem::createMeshArrays(
+    Mesh& mesh, 
+    VertexFormat vertexFormat, 
+    const void* vertices, 
+    int verticesSize, 
+    const unsigned int* indices, 
+    int indicesSize, 
+    int stride, 
+    const std::vector<int>& attributeSizes
+) {
+    glGenVertexArrays(1, &mesh.m_VAO);
+    glGenBuffers(1, &mesh.m_VBO);
+    glGenBuffers(1, &mesh.m_EBO);
+    glBindVertexArray(mesh.m_VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, mesh.m_VBO);
+    glBufferData(GL_ARRAY_BUFFER, verticesSize, vertices, GL_STATIC_DRAW);
+    // the element buffer binding is part of the VAO's state
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh.m_EBO);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indicesSize, indices, GL_STATIC_DRAW);
+    int offset = 0;
+    for (unsigned int i = 0; i < attributeSizes.size() && i < INSTANCE_LOCATION; i++) {
+        if (vertexFormat == vertexFormatPacked) {
+            // a 4 component normal still fills the shaders' vec3
+            const PackedAttribute& packed = packedAttributes[i];
+            glVertexAttribPointer(i, packed.m_size, packed.m_type, packed.m_normalized, packedStride, (void*)packed.m_offset);
+        }
+        else {
+            glVertexAttribPointer(i, attributeSizes[i], GL_FLOAT, GL_FALSE, stride * sizeof(float), (void*)(offset * sizeof(float)));
+        }
+        glEnableVertexAttribArray(i);
+        offset += attributeSizes[i];
+    }
+
+    // per-instance attributes: model matrix (4 columns), normal matrix (3 
+    // columns), shininess and shadow cube faces, advancing once per 
+    // instance. drawInstances points them at each batch, until then they 
+    // read a single instance
+    if (m_instanceBuffer == 0) {
+        InstanceData instance;
+        glGenBuffers(1, &m_instanceBuffer);
+        glBindBuffer(GL_ARRAY_BUFFER, m_instanceBuffer);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(InstanceData), &instance, GL_STREAM_DRAW);
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, m_instanceBuffer);
+    pointInstanceAttributes(0);
+    for (unsigned int location = INSTANCE_LOCATION; location < INSTANCE_LOCATION + INSTANCE_ATTRIBUTES; location++) {
+        glEnableVertexAttribArray(location);
+        glVertexAttribDivisor(location, 1);
+    }
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void RenderSystem::createUniformBuffers() {
+    if (m_headless) {
+        return;
+    }
+
+    glGenBuffers(1, &m_cameraBuffer);
+    glBindBuffer(GL_UNIFORM_BUFFER, m_cameraBuffer);
+    glBufferData(GL_UNIFORM_BUFFER, sizeof(CameraBlock), &m_cameraBlock, GL_DYNAMIC_DRAW);
+    glBindBufferBase(GL_UNIFORM_BUFFER, CAMERA_BLOCK_BINDING, m_cameraBuffer);
+    glGenBuffers(1, &m_lightsBuffer);
+    glBindBuffer(GL_UNIFORM_BUFFER, m_lightsBuffer);
+    glBufferData(GL_UNIFORM_BUFFER, sizeof(LightsBlock), &m_lightsBlock, GL_DYNAMIC_DRAW);
+    glBindBufferBase(GL_UNIFORM_BUFFER, LIGHTS_BLOCK_BINDING, m_lightsBuffer);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+}
+
+void RenderSystem::createTextBuffers(RenderDataComponent& graphics) {
+    if (m_headless) {
+        return;
+    }
+
+    glGenVertexArrays(1, &graphics.m_VAO);
+    glGenBuffers(1, &graphics.m_VBO);
+    glBindVertexArray(graphics.m_VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, graphics.m_VBO);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(float) * 6 * 4, NULL, GL_DYNAMIC_DRAW);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, 4 * sizeof(float), 0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindVertexArray(0);
+}
+
+void RenderSystem::createShadowCubemap(ShadowFramebufferComponent& shadow) {
+    if (m_headless) {
+        return;
+    }
+
+    glGenFramebuffers(1, &shadow.m_shadowFramebuffer);
+    glGenTextures(1, &shadow.m_depthCubemap);
+    glBindTexture(GL_TEXTURE_CUBE_MAP, shadow.m_depthCubemap);
+    for (unsigned int i = 0; i < 6; ++i) {
+        glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, GL_DEPTH_COMPONENT, m_shadowWidth, m_shadowHeight, 0, GL_DEPTH_COMPONENT, GL_FLOAT, NULL);
+    }
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+    // attach depth texture as FBO's depth buffer
+    glBindFramebuffer(GL_FRAMEBUFFER, shadow.m_shadowFramebuffer);
+    glFramebufferTexture(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, shadow.m_depthCubemap, 0);
+    glDrawBuffer(GL_NONE);
+    glReadBuffer(GL_NONE);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
 void RenderSystem::deleteBuffers(entt::registry& registry) {
+    // shared meshes are deleted once, by the mesh registry
     auto buffers = registry.view<RenderDataComponent>();
     buffers.each([&](auto& graphics) {
-        glDeleteVertexArrays(1, &graphics.m_VAO);
-        glDeleteBuffers(1, &graphics.m_VBO);
+        if (graphics.m_mesh == 0) {
+            glDeleteVertexArrays(1, &graphics.m_VAO);
+            glDeleteBuffers(1, &graphics.m_VBO);
+        }
     });
+    m_meshRegistry.destroy();
     auto framebuffers = registry.view<ShadowFramebufferComponent>();
     framebuffers.each([&](auto& shadow) {
         glDeleteFramebuffers(1, &shadow.m_shadowFramebuffer);
-        glDeleteTextures(1, &shadow.m_depthMap);
         glDeleteTextures(1, &shadow.m_depthCubemap);
     });
+    glDeleteFramebuffers(1, &m_shadowAtlasFramebuffer);
+    glDeleteTextures(1, &m_shadowAtlasTexture);
+    m_shadowAtlasFramebuffer = 0;
+    m_shadowAtlasTexture = 0;
+    m_shadowAtlasWidth = 0;
+    m_shadowAtlasHeight = 0;
+    glDeleteBuffers(1, &m_instanceBuffer);
+    m_instanceBuffer = 0;
+    glDeleteBuffers(1, &m_cameraBuffer);
+    glDeleteBuffers(1, &m_lightsBuffer);
+    m_cameraBuffer = 0;
+    m_lightsBuffer = 0;
 }
\ No newline at end of file
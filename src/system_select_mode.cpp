@@ -13,123 +13,28 @@ void SelectModeSystem::setRegistry(entt::registry* registry) {
 }
 
 void SelectModeSystem::moveSelectedLeft() {
-    // get views of player and of selected objects
-    auto player = (*m_registry).view<
-        PlayerComponent,
-        BodyTransformComponent,
-        RenderDataComponent
-    >();
-    auto selectables = (*m_registry).view<
-        BodyTransformComponent,
-        FixtureUserDataComponent,
-        RenderDataComponent
-    >();
-
-    // move the player, then selectables if select mode is on
-    bool selectModeOn;
-    player.each([&](
-        const auto& player,
-        auto& body,
-        const auto& renderData
-    ) {
-        selectModeOn = renderData.m_stencilFlag;
-        b2Vec2 force = b2Vec2(-500.0f, 0.0f);
-        body.m_body->ApplyForce(force, body.m_body->GetPosition(), true);
-    });
-
-    if (selectModeOn) {
-        selectables.each([&](
-            auto& body,
-            const auto& userData,
-            const auto& renderData
-        ) {
-            if (userData.m_fixtureType == 3 && renderData.m_stencilFlag) {
-                b2Vec2 force = b2Vec2(-500.0f, 0.0f);
-                body.m_body->ApplyForce(force, body.m_body->GetPosition(), true);
-            }
-        });
-    }
+    m_pendingForce += b2Vec2(-500.0f, 0.0f);
 }
 
 void SelectModeSystem::moveSelectedRight() {
-    // get views of player and of selected objects
-    auto player = (*m_registry).view<
-        PlayerComponent,
-        BodyTransformComponent,
-        RenderDataComponent
-    >();
-    auto selectables = (*m_registry).view<
-        BodyTransformComponent,
-        FixtureUserDataComponent,
-        RenderDataComponent
-    >();
-
-    // move the player, then selectables if select mode is on
-    bool selectModeOn;
-    player.each([&](
-        const auto& player,
-        auto& body,
-        const auto& renderData
-    ) {
-        selectModeOn = renderData.m_stencilFlag;
-        b2Vec2 force = b2Vec2(500.0f, 0.0f);
-        body.m_body->ApplyForce(force, body.m_body->GetPosition(), true);
-    });
-
-    if (selectModeOn) {
-        selectables.each([&](
-            auto& body,
-            const auto& userData,
-            const auto& renderData
-        ) {
-            if (userData.m_fixtureType == 3 && renderData.m_stencilFlag) {
-                b2Vec2 force = b2Vec2(500.0f, 0.0f);
-                body.m_body->ApplyForce(force, body.m_body->GetPosition(), true);
-            }
-        });
-    }
+    m_pendingForce += b2Vec2(500.0f, 0.0f);
 }
 
 void SelectModeSystem::moveSelectedUp() {
-    // get views of player and of selected objects
-    auto player = (*m_registry).view<
-        PlayerComponent,
-        BodyTransformComponent,
-        RenderDataComponent
-    >();
-    auto selectables = (*m_registry).view<
-        BodyTransformComponent,
-        FixtureUserDataComponent,
-        RenderDataComponent
-    >();
+    m_pendingForce += b2Vec2(0.0f, 2000.0f);
+}
 
-    // move the player, then selectables if select mode is on
-    bool selectModeOn;
-    player.each([&](
-        const auto& player,
-        auto& body,
-        const auto& renderData
-    ) {
-        selectModeOn = renderData.m_stencilFlag;
-        b2Vec2 force = b2Vec2(0.0f, 2000.0f);
-        body.m_body->ApplyForce(force, body.m_body->GetPosition(), true);
-    });
+void SelectModeSystem::moveSelectedDown() {
+    m_pendingForce += b2Vec2(0.0f, -2000.0f);
+}
 
-    if (selectModeOn) {
-        selectables.each([&](
-            auto& body,
-            const auto& userData,
-            const auto& renderData
-        ) {
-            if (userData.m_fixtureType == 3 && renderData.m_stencilFlag) {
-                b2Vec2 force = b2Vec2(0.0f, 2000.0f);
-                body.m_body->ApplyForce(force, body.m_body->GetPosition(), true);
-            }
-        });
+void SelectModeSystem::update() {
+    if (m_pendingForce.x == 0.0f && m_pendingForce.y == 0.0f) {
+        return;
     }
-}
+    b2Vec2 force = m_pendingForce;
+    m_pendingForce.SetZero();
 
-void SelectModeSystem::moveSelectedDown() {
     // get views of player and of selected objects
     auto player = (*m_registry).view<
         PlayerComponent,
@@ -143,14 +48,13 @@ void SelectModeSystem::moveSelectedDown() {
     >();
 
     // move the player, then selectables if select mode is on
-    bool selectModeOn;
+    bool selectModeOn = false;
     player.each([&](
         const auto& player,
         auto& body,
         const auto& renderData
     ) {
         selectModeOn = renderData.m_stencilFlag;
-        b2Vec2 force = b2Vec2(0.0f, -2000.0f);
         body.m_body->ApplyForce(force, body.m_body->GetPosition(), true);
     });
 
@@ -161,7 +65,6 @@ void SelectModeSystem::moveSelectedDown() {
             const auto& renderData
         ) {
             if (userData.m_fixtureType == 3 && renderData.m_stencilFlag) {
-                b2Vec2 force = b2Vec2(0.0f, -2000.0f);
                 body.m_body->ApplyForce(force, body.m_body->GetPosition(), true);
             }
         });
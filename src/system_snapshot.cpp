@@ -0,0 +1,156 @@
+// -----------------------------------------------------------------------------
+// Onset Engine
+// https://github.com/dylanafterall/OnsetEngine.git
+//
+// system_snapshot.cpp
+//  implementation: system to capture renderable registry state into a FrameSnapshot
+// -----------------------------------------------------------------------------
+
+#include "system_snapshot.h"
+
+void SnapshotSystem::setRegistry(entt::registry* registry) {
+    m_registry = registry;
+}
+
+void SnapshotSystem::update(FrameSnapshot& snapshot) {
+    // camera
+    // .........................................................................
+    auto cameraEntities = (*m_registry).view<CameraComponent>();
+    cameraEntities.each([&](const auto& camera) {
+        // if 'first' camera (designates main camera)
+        if (camera.m_type == 1) {
+            snapshot.m_camera.m_zoom = camera.m_zoom;
+            snapshot.m_camera.m_position = camera.m_position;
+            snapshot.m_camera.m_previousPosition = camera.m_previousPosition;
+            snapshot.m_camera.m_front = camera.m_front;
+            snapshot.m_camera.m_up = camera.m_up;
+        }
+    });
+
+    // lights
+    // .........................................................................
+    snapshot.m_lights.clear();
+    auto lightEntities = (*m_registry).view<
+        LightComponent,
+        ShaderProgramComponent,
+        RenderDataComponent,
+        ShadowFramebufferComponent
+    >();
+    lightEntities.each([&](
+        const auto entity,
+        const auto& light,
+        const auto& shader,
+        const auto& graphics,
+        const auto& shadow
+    ) {
+        LightSnapshot lightSnapshot;
+        lightSnapshot.m_light = light;
+        lightSnapshot.m_shader = shader;
+        lightSnapshot.m_graphics = graphics;
+        lightSnapshot.m_shadow = shadow;
+        lightSnapshot.m_position = glm::vec2(0.0f, 0.0f);
+        lightSnapshot.m_angle = 0.0f;
+        lightSnapshot.m_previousPosition = glm::vec2(0.0f, 0.0f);
+        lightSnapshot.m_previousAngle = 0.0f;
+        lightSnapshot.m_boundingRadius = 0.0f;
+        // directional lights have no body to take a transform from
+        if (const auto* transform = (*m_registry).try_get<TransformComponent>(entity)) {
+            lightSnapshot.m_position = transform->m_position;
+            lightSnapshot.m_angle = transform->m_angle;
+            lightSnapshot.m_previousPosition = transform->m_previousPosition;
+            lightSnapshot.m_previousAngle = transform->m_previousAngle;
+            lightSnapshot.m_boundingRadius = transform->m_boundingRadius;
+        }
+        snapshot.m_lights.push_back(lightSnapshot);
+    });
+
+    // gameplay entities
+    // .........................................................................
+    snapshot.m_gameplay.clear();
+    auto gameplayEntities = (*m_registry).view<
+        MaterialComponent,
+        TransformComponent,
+        TextureComponent,
+        ShaderProgramComponent,
+        RenderDataComponent
+    >();
+    gameplayEntities.each([&](
+        const auto& material,
+        const auto& transform,
+        const auto& texture,
+        const auto& shader,
+        const auto& graphics
+    ) {
+        GameplaySnapshot gameplaySnapshot;
+        gameplaySnapshot.m_material = material;
+        gameplaySnapshot.m_texture = texture;
+        gameplaySnapshot.m_shader = shader;
+        gameplaySnapshot.m_graphics = graphics;
+        gameplaySnapshot.m_position = transform.m_position;
+        gameplaySnapshot.m_angle = transform.m_angle;
+        gameplaySnapshot.m_previousPosition = transform.m_previousPosition;
+        gameplaySnapshot.m_previousAngle = transform.m_previousAngle;
+        gameplaySnapshot.m_boundingRadius = transform.m_boundingRadius;
+        snapshot.m_gameplay.push_back(gameplaySnapshot);
+    });
+
+    // skyboxes
+    // .........................................................................
+    snapshot.m_skyboxes.clear();
+    auto skyboxEntities = (*m_registry).view<
+        SkyboxComponent,
+        TextureComponent, 
+        ShaderProgramComponent,
+        RenderDataComponent
+    >();
+    skyboxEntities.each([&](
+        const auto& skybox,
+        const auto& texture,
+        const auto& shader,
+        const auto& graphics
+    ) {
+        snapshot.m_skyboxes.push_back({texture, shader, graphics});
+    });
+
+    // sprites
+    // .........................................................................
+    snapshot.m_sprites.clear();
+    auto spriteEntities = (*m_registry).view<
+        SpriteComponent,
+        TextureComponent, 
+        ShaderProgramComponent,
+        RenderDataComponent
+    >();
+    spriteEntities.each([&](
+        const auto& sprite,
+        const auto& texture,
+        const auto& shader,
+        const auto& graphics
+    ) {
+        snapshot.m_sprites.push_back({sprite, texture, shader, graphics});
+    });
+
+    // text
+    // .........................................................................
+    // assign into existing elements, so glyph vectors keep their capacity
+    std::size_t textCount = 0;
+    auto textEntities = (*m_registry).view<
+        TextComponent, 
+        ShaderProgramComponent,
+        RenderDataComponent
+    >();
+    textEntities.each([&](
+        const auto& text,
+        const auto& shader,
+        const auto& graphics
+    ) {
+        if (textCount == snapshot.m_texts.size()) {
+            snapshot.m_texts.emplace_back();
+        }
+        TextSnapshot& textSnapshot = snapshot.m_texts[textCount++];
+        textSnapshot.m_text = text;
+        textSnapshot.m_shader = shader;
+        textSnapshot.m_graphics = graphics;
+    });
+    snapshot.m_texts.resize(textCount);
+}
@@ -0,0 +1,51 @@
+// -----------------------------------------------------------------------------
+// Onset Engine
+// https://github.com/dylanafterall/OnsetEngine.git
+//
+// system_transform.cpp
+//  implementation: system to extract Box2D body transforms into the registry
+// -----------------------------------------------------------------------------
+
+#include "system_transform.h"
+
+// bodies handled per job, small batches cost more in scheduling than they save
+static const std::size_t TRANSFORM_GRAIN_SIZE = 256;
+
+void TransformSystem::setRegistry(entt::registry* registry) {
+    m_registry = registry;
+}
+
+void TransformSystem::setJobManager(JobManager* jobManager) {
+    m_jobManager = jobManager;
+}
+
+void TransformSystem::update() {
+    auto bodies = (*m_registry).view<
+        BodyTransformComponent,
+        TransformComponent
+    >();
+
+    m_entities.clear();
+    for (auto entity : bodies) {
+        m_entities.push_back(entity);
+    }
+
+    // each chunk only writes the transforms of its own entities
+    m_jobManager->parallelFor(m_entities.size(), TRANSFORM_GRAIN_SIZE, [&](
+        std::size_t begin,
+        std::size_t end
+    ) {
+        for (std::size_t i = begin; i < end; i++) {
+            const auto& body = bodies.get<BodyTransformComponent>(m_entities[i]);
+            auto& transform = bodies.get<TransformComponent>(m_entities[i]);
+
+            transform.m_previousPosition = transform.m_position;
+            transform.m_previousAngle = transform.m_angle;
+            b2Vec2 position = body.m_body->GetPosition();
+            b2Vec2 velocity = body.m_body->GetLinearVelocity();
+            transform.m_position = glm::vec2(position.x, position.y);
+            transform.m_angle = body.m_body->GetAngle();
+            transform.m_velocity = glm::vec2(velocity.x, velocity.y);
+        }
+    });
+}
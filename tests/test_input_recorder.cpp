@@ -0,0 +1,96 @@
+// -----------------------------------------------------------------------------
+// Onset Engine
+// https://github.com/dylanafterall/OnsetEngine.git
+//
+// test_input_recorder.cpp
+//  checks that live input is disabled during a replay and enabled after it
+// -----------------------------------------------------------------------------
+
+#include "core_input_invoker.h"
+#include "core_input_recorder.h"
+
+#include "entt/entt.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+static int failures = 0;
+
+static void check(bool condition, const char* message) {
+    if (!condition) {
+        std::fprintf(stderr, "FAILED: %s\n", message);
+        failures++;
+    }
+}
+
+int main() {
+    const std::string path = "test_input_recorder.oninp";
+    InputInvoker inputInvoker;
+
+    // record two commands, at steps 0 and 2
+    // .........................................................................
+    {
+        entt::dispatcher dispatcher;
+        InputRecorder recorder;
+        recorder.connect(dispatcher);
+        check(recorder.startRecording(path), "recording file opens");
+        LeftCommand().execute(dispatcher);
+        dispatcher.update();
+        recorder.endStep();
+        recorder.endStep();
+        UpCommand().execute(dispatcher);
+        dispatcher.update();
+        recorder.stopRecording();
+    }
+
+    // replay them, live input comes back once the last one is dispatched
+    // .........................................................................
+    {
+        entt::dispatcher dispatcher;
+        InputRecorder recorder;
+        recorder.connect(dispatcher);
+        recorder.setInputInvoker(&inputInvoker);
+        check(recorder.startReplay(path), "recording replays");
+        check(recorder.isReplaying(), "replay has commands");
+        check(!inputInvoker.getCommandsEnabled(), "live input disabled during replay");
+
+        for (int step = 0; step < 2; step++) {
+            recorder.replayStep(dispatcher);
+            dispatcher.update();
+            recorder.endStep();
+        }
+        check(recorder.isReplaying(), "replay still running before its last step");
+        check(!inputInvoker.getCommandsEnabled(), "live input disabled before the last step");
+
+        recorder.replayStep(dispatcher);
+        dispatcher.update();
+        recorder.endStep();
+        check(!recorder.isReplaying(), "replay finished after its last step");
+        check(inputInvoker.getCommandsEnabled(), "live input enabled after replay");
+    }
+
+    // an empty recording leaves live input enabled
+    // .........................................................................
+    {
+        entt::dispatcher dispatcher;
+        InputRecorder recorder;
+        recorder.connect(dispatcher);
+        check(recorder.startRecording(path), "recording file opens");
+        recorder.stopRecording();
+
+        inputInvoker.setCommandsEnabled(true);
+        recorder.setInputInvoker(&inputInvoker);
+        check(recorder.startReplay(path), "empty recording replays");
+        check(!recorder.isReplaying(), "empty replay has no commands");
+        check(inputInvoker.getCommandsEnabled(), "live input enabled for empty replay");
+    }
+
+    std::remove(path.c_str());
+    if (failures) {
+        std::fprintf(stderr, "%d checks failed\n", failures);
+        return EXIT_FAILURE;
+    }
+    std::printf("all checks passed\n");
+    return EXIT_SUCCESS;
+}
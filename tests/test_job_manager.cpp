@@ -0,0 +1,111 @@
+// -----------------------------------------------------------------------------
+// Onset Engine
+// https://github.com/dylanafterall/OnsetEngine.git
+//
+// test_job_manager.cpp
+//  checks that a graph runs again without rebuilding, and that a throwing job
+//  is rethrown by run instead of leaving it waiting
+// -----------------------------------------------------------------------------
+
+#include "core_job_manager.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <stdexcept>
+
+static int failures = 0;
+
+static void check(bool condition, const char* message) {
+    if (!condition) {
+        std::fprintf(stderr, "FAILED: %s\n", message);
+        failures++;
+    }
+}
+
+int main() {
+    JobManager jobManager;
+    jobManager.initialize(3);
+
+    // one graph, built once and run several times
+    // .........................................................................
+    {
+        std::atomic<int> first{0};
+        std::atomic<int> second{0};
+        std::atomic<bool> ordered{true};
+        JobGraph graph;
+        unsigned int before = graph.addJob("before", [&]() { first++; });
+        unsigned int after = graph.addJob("after", [&]() {
+            if (first.load() <= second.load()) {
+                ordered = false;
+            }
+            second++;
+        });
+        graph.addDependency(before, after);
+        for (int run = 0; run < 100; run++) {
+            jobManager.run(graph);
+        }
+        check(first == 100 && second == 100, "every job runs on every run");
+        check(ordered, "dependencies hold on every run");
+    }
+
+    // a throwing job: run rethrows, later jobs are skipped, the graph reruns
+    // .........................................................................
+    {
+        std::atomic<bool> shouldThrow{true};
+        std::atomic<int> successorRuns{0};
+        JobGraph graph;
+        unsigned int thrower = graph.addJob("thrower", [&]() {
+            if (shouldThrow) {
+                throw std::runtime_error("job failed");
+            }
+        });
+        unsigned int successor = graph.addJob("successor", [&]() { successorRuns++; });
+        graph.addDependency(thrower, successor);
+
+        bool caught = false;
+        try {
+            jobManager.run(graph);
+        }
+        catch (const std::runtime_error&) {
+            caught = true;
+        }
+        check(caught, "run rethrows the job's exception");
+        check(successorRuns == 0, "jobs after a throwing job are skipped");
+
+        shouldThrow = false;
+        caught = false;
+        try {
+            jobManager.run(graph);
+        }
+        catch (...) {
+            caught = true;
+        }
+        check(!caught && successorRuns == 1, "graph runs again after an exception");
+    }
+
+    // parallelFor over several chunks rethrows as well
+    // .........................................................................
+    {
+        bool caught = false;
+        try {
+            jobManager.parallelFor(64, 1, [](std::size_t begin, std::size_t) {
+                if (begin == 17) {
+                    throw std::runtime_error("chunk failed");
+                }
+            });
+        }
+        catch (const std::runtime_error&) {
+            caught = true;
+        }
+        check(caught, "parallelFor rethrows a chunk's exception");
+    }
+
+    jobManager.destroy();
+    if (failures) {
+        std::fprintf(stderr, "%d checks failed\n", failures);
+        return EXIT_FAILURE;
+    }
+    std::printf("all checks passed\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,130 @@
+// -----------------------------------------------------------------------------
+// Onset Engine
+// https://github.com/dylanafterall/OnsetEngine.git
+//
+// bench_report.cpp
+//  implementation of the benchmark's frame time statistics and JSON report
+// -----------------------------------------------------------------------------
+
+#include "bench_report.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+
+// CPU cost of every event sharing a scope name
+struct ScopeCost {
+    const char* m_name = nullptr;
+    unsigned int m_calls = 0;
+    double m_totalMilliseconds = 0.0;
+    double m_maxMilliseconds = 0.0;
+};
+
+void BenchReport::addFrame(std::int64_t start, std::int64_t end) {
+    if (m_frameMilliseconds.empty()) {
+        m_measureStart = start;
+    }
+    m_measureEnd = end;
+    m_frameMilliseconds.push_back((end - start) / 1000000.0);
+}
+
+bool BenchReport::write(
+    const std::string& path, 
+    const BenchConfig& config, 
+    const std::vector<ProfileEvent>& events, 
+    const GpuProfileManager* gpu
+) {
+    std::ofstream file(path, std::ios::out | std::ios::trunc);
+    if (!file.is_open()) {
+        ONSET_ERROR("Bench failed to open report file {}", path);
+        return false;
+    }
+    file << std::fixed << std::setprecision(4);
+
+    // frame times
+    // .........................................................................
+    std::vector<double> sorted = m_frameMilliseconds;
+    std::sort(sorted.begin(), sorted.end());
+    double total = 0.0;
+    for (double frame : sorted) {
+        total += frame;
+    }
+    double mean = sorted.empty() ? 0.0 : total / sorted.size();
+
+    file << "{\n";
+    file << "  \"config\": {\"mode\": \"" << (config.m_headless ? "headless" : "gl")
+         << "\", \"bodies\": " << config.m_bodies
+         << ", \"lights\": " << config.m_lights
+         << ", \"texts\": " << config.m_texts
+         << ", \"warmup_frames\": " << config.m_warmupFrames
+         << ", \"replay\": \"" << config.m_replay << "\"},\n";
+    file << "  \"frames\": " << sorted.size() << ",\n";
+    file << "  \"frame_ms\": {\"mean\": " << mean
+         << ", \"p50\": " << percentile(sorted, 0.50)
+         << ", \"p95\": " << percentile(sorted, 0.95)
+         << ", \"p99\": " << percentile(sorted, 0.99)
+         << ", \"max\": " << (sorted.empty() ? 0.0 : sorted.back()) << "},\n";
+
+    // CPU scopes, in order of first appearance; names are literals, so equal
+    // names usually share a pointer, but compare contents to be sure
+    // .........................................................................
+    std::vector<ScopeCost> scopes;
+    for (const ProfileEvent& event : events) {
+        if (event.m_start < m_measureStart || event.m_end > m_measureEnd) {
+            continue;
+        }
+        auto scope = std::find_if(scopes.begin(), scopes.end(), [&event](const ScopeCost& cost) {
+            return cost.m_name == event.m_name || std::strcmp(cost.m_name, event.m_name) == 0;
+        });
+        if (scope == scopes.end()) {
+            scopes.emplace_back();
+            scope = scopes.end() - 1;
+            scope->m_name = event.m_name;
+        }
+        double duration = (event.m_end - event.m_start) / 1000000.0;
+        scope->m_calls++;
+        scope->m_totalMilliseconds += duration;
+        scope->m_maxMilliseconds = std::max(scope->m_maxMilliseconds, duration);
+    }
+
+    file << "  \"cpu_scopes\": [";
+    for (std::size_t i = 0; i < scopes.size(); i++) {
+        file << (i == 0 ? "\n" : ",\n") << "    {\"name\": \"" << scopes[i].m_name
+             << "\", \"calls\": " << scopes[i].m_calls
+             << ", \"ms_per_frame\": " << (sorted.empty() ? 0.0 : scopes[i].m_totalMilliseconds / sorted.size())
+             << ", \"max_ms\": " << scopes[i].m_maxMilliseconds << "}";
+    }
+    file << (scopes.empty() ? "],\n" : "\n  ],\n");
+
+    // GPU passes, averaged by the GpuProfileManager over the measured frames
+    // .........................................................................
+    file << "  \"gpu_passes\": [";
+    if (gpu) {
+        for (int pass = 0; pass < gpuPassCount; pass++) {
+            file << (pass == 0 ? "\n" : ",\n") << "    {\"name\": \"" << GpuProfileManager::getPassName(static_cast<GpuPass>(pass))
+                 << "\", \"ms_per_frame\": " << gpu->getAverageMilliseconds(static_cast<GpuPass>(pass)) << "}";
+        }
+        file << "\n  ";
+    }
+    file << "]\n}\n";
+
+    ONSET_INFO(
+        "Bench measured {} frames: p50 {:.3f} ms, p95 {:.3f} ms, p99 {:.3f} ms", 
+        sorted.size(), 
+        percentile(sorted, 0.50), 
+        percentile(sorted, 0.95), 
+        percentile(sorted, 0.99)
+    );
+    ONSET_INFO("Bench wrote report to {}", path);
+    return true;
+}
+
+double BenchReport::percentile(const std::vector<double>& sorted, double fraction) {
+    if (sorted.empty()) {
+        return 0.0;
+    }
+    std::size_t rank = static_cast<std::size_t>(std::ceil(fraction * sorted.size()));
+    return sorted[rank == 0 ? 0 : rank - 1];
+}
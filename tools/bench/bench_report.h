@@ -0,0 +1,74 @@
+// -----------------------------------------------------------------------------
+// Onset Engine
+// https://github.com/dylanafterall/OnsetEngine.git
+//
+// bench_report.h
+//  header for the benchmark's frame time statistics and JSON report
+// -----------------------------------------------------------------------------
+#ifndef BENCH_REPORT_H
+#define BENCH_REPORT_H
+
+#include "bench_scene.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * \brief   The BenchReport class.
+ * \details Collects the wall time of every measured frame, then writes a JSON
+ *          report of the frame time percentiles, the CPU cost of each profile
+ *          scope and, when rendering, the GPU cost of each render pass.
+ */
+class BenchReport {
+public:
+    /**
+     * \brief   The default constructor.
+     */
+    BenchReport() = default;
+    /**
+     * \brief   The default destructor.
+     */
+    ~BenchReport() = default;
+
+    /**
+     * \brief   The function addFrame.
+     * \details This function records the wall time of one measured frame.
+     * \param   start   Time the frame began, from ProfileManager::now().
+     * \param   end     Time the frame ended, from ProfileManager::now().
+     * \return  void, none.
+     */
+    void addFrame(std::int64_t, std::int64_t);
+    /**
+     * \brief   The function write.
+     * \details This function writes the report. Only profile events lying
+     *          within the measured frames are counted.
+     * \param   path    Path of the JSON file to write.
+     * \param   config  Parameters of the run, echoed in the report.
+     * \param   events  Every event collected by the ProfileManager.
+     * \param   gpu     The GpuProfileManager, or null when headless.
+     * \return  bool, true if the file was written.
+     */
+    bool write(const std::string&, const BenchConfig&, const std::vector<ProfileEvent>&, const GpuProfileManager*);
+
+private:
+    /**
+     * \brief   Return the nearest rank percentile of sorted frame times.
+     */
+    static double percentile(const std::vector<double>&, double);
+
+    /**
+     * \brief Wall time of each measured frame, in ms.
+     */
+    std::vector<double> m_frameMilliseconds;
+    /**
+     * \brief Start of the first measured frame.
+     */
+    std::int64_t m_measureStart = 0;
+    /**
+     * \brief End of the last measured frame.
+     */
+    std::int64_t m_measureEnd = 0;
+};
+
+#endif // BENCH_REPORT_H
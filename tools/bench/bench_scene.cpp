@@ -0,0 +1,248 @@
+// -----------------------------------------------------------------------------
+// Onset Engine
+// https://github.com/dylanafterall/OnsetEngine.git
+//
+// bench_scene.cpp
+//  implementation of the benchmark's parameterized synthetic scene
+// -----------------------------------------------------------------------------
+
+#include "bench_scene.h"
+
+// bodies spawn on a grid above the floor, which spans x in [-50, 50]
+static const unsigned int BODIES_PER_ROW = 36;
+static const float BODY_SPACING = 2.5f;
+// the lighting shader holds 3 shadowed point lights and 3 shadowed spot lights
+static const unsigned int SHADOWED_LIGHTS_PER_TYPE = 3;
+
+void BenchScene::create(Game& game, const BenchConfig& config) {
+    // the meshes stay mapped while their buffers are created
+    m_cubeMesh.open(MeshFile::getPath("cube"));
+    m_sphereMesh.open(MeshFile::getPath("sphere"));
+    m_groundMesh.open(MeshFile::getPath("ground"));
+
+    createStage(game);
+    for (unsigned int i = 0; i < config.m_bodies; i++) {
+        createBody(game, i);
+    }
+    for (unsigned int i = 0; i < config.m_lights; i++) {
+        createLight(game, i);
+    }
+    for (unsigned int i = 0; i < config.m_texts; i++) {
+        createText(game, i, config.m_headless);
+    }
+
+    m_cubeMesh.close();
+    m_sphereMesh.close();
+    m_groundMesh.close();
+}
+
+void BenchScene::createStage(Game& game) {
+    entt::registry& registry = game.getRegistry();
+    AssetManager& assets = game.getAssetManager();
+
+    // camera entity, far enough back to see the whole floor
+    // .........................................................................
+    CameraComponent camera(glm::vec3(0.0f, 25.0f, 90.0f));
+    camera.m_type = first;
+    auto cameraEntity = registry.create();
+    registry.emplace<CameraComponent>(cameraEntity, camera);
+
+    // floor entity (static box)
+    // .........................................................................
+    MaterialComponent floorMaterial;
+    BodyTransformComponent floorTransform;
+    TransformComponent floorBounds;
+    BodyPolygonComponent floorPolygon;
+    TextureComponent floorTexture;
+    ShaderProgramComponent floorShaderProgram;
+    RenderDataComponent floorGraphics;
+    floorMaterial.m_shininess = 32.0f;
+    floorTexture.m_diffuse = assets.getTexture("metal_diff");
+    floorTexture.m_specular = assets.getTexture("metal_spec");
+    floorTexture.m_normal = assets.getTexture("metal_norm");
+    floorShaderProgram.m_outputProgram = assets.getShaderProgram("basic_lighting");
+    floorShaderProgram.m_stencilProgram = assets.getShaderProgram("stencil");
+    floorGraphics.m_vertexCount = m_groundMesh.getVertexCount();
+    floorGraphics.m_indexCount = m_groundMesh.getIndexCount();
+    floorGraphics.m_vertexFormat = static_cast<VertexFormat>(m_groundMesh.getVertexFormat());
+    floorBounds.m_boundingRadius = m_groundMesh.getBoundingRadius();
+    floorPolygon.m_bodyDef.position.Set(0.0f, -1.0f);
+    floorTransform.m_body = game.getWorld().CreateBody(&floorPolygon.m_bodyDef);
+    floorPolygon.m_polygonShape.SetAsBox(50.0f, 1.0f);
+    floorTransform.m_body->CreateFixture(&floorPolygon.m_polygonShape, 0.0f);
+    game.getRenderSystem().createMeshBuffers(floorGraphics, "ground", m_groundMesh.getVertices(), m_groundMesh.getVerticesSize(), m_groundMesh.getIndices(), m_groundMesh.getIndicesSize(), 8, {3, 3, 2}, m_groundMesh.getLods());
+
+    auto floorEntity = registry.create();
+    registry.emplace<MaterialComponent>(floorEntity, floorMaterial);
+    registry.emplace<BodyTransformComponent>(floorEntity, floorTransform);
+    registry.emplace<TransformComponent>(floorEntity, floorBounds);
+    registry.emplace<TextureComponent>(floorEntity, floorTexture);
+    registry.emplace<ShaderProgramComponent>(floorEntity, floorShaderProgram);
+    registry.emplace<RenderDataComponent>(floorEntity, floorGraphics);
+}
+
+void BenchScene::createBody(Game& game, unsigned int index) {
+    entt::registry& registry = game.getRegistry();
+    AssetManager& assets = game.getAssetManager();
+    bool isCircle = (index % 2) == 0;
+
+    MaterialComponent material;
+    BodyTransformComponent transform;
+    TransformComponent bounds;
+    TextureComponent texture;
+    ShaderProgramComponent shaderProgram;
+    RenderDataComponent graphics;
+    material.m_shininess = 32.0f;
+    texture.m_diffuse = assets.getTexture(isCircle ? "rusted_diff" : "blocks_diff");
+    texture.m_specular = assets.getTexture(isCircle ? "rusted_spec" : "blocks_spec");
+    texture.m_normal = assets.getTexture(isCircle ? "rusted_norm" : "blocks_norm");
+    shaderProgram.m_outputProgram = assets.getShaderProgram("basic_lighting");
+    shaderProgram.m_stencilProgram = assets.getShaderProgram("stencil");
+
+    // grid position, odd rows shifted so the bodies topple as they settle
+    // no fixture user data: collisions between bench bodies play no sound
+    float x = -43.75f + (index % BODIES_PER_ROW) * BODY_SPACING + ((index / BODIES_PER_ROW) % 2) * 0.5f;
+    float y = 3.0f + (index / BODIES_PER_ROW) * BODY_SPACING;
+    b2BodyDef bodyDef;
+    bodyDef.type = b2_dynamicBody;
+    bodyDef.position.Set(x, y);
+    transform.m_body = game.getWorld().CreateBody(&bodyDef);
+    b2FixtureDef fixtureDef;
+    fixtureDef.density = 1.0f;
+    fixtureDef.friction = 0.3f;
+    if (isCircle) {
+        b2CircleShape circleShape;
+        circleShape.m_radius = 1.0f;
+        fixtureDef.shape = &circleShape;
+        transform.m_body->CreateFixture(&fixtureDef);
+        graphics.m_vertexCount = m_sphereMesh.getVertexCount();
+        graphics.m_indexCount = m_sphereMesh.getIndexCount();
+        graphics.m_vertexFormat = static_cast<VertexFormat>(m_sphereMesh.getVertexFormat());
+        bounds.m_boundingRadius = m_sphereMesh.getBoundingRadius();
+        game.getRenderSystem().createMeshBuffers(graphics, "sphere", m_sphereMesh.getVertices(), m_sphereMesh.getVerticesSize(), m_sphereMesh.getIndices(), m_sphereMesh.getIndicesSize(), 8, {3, 3, 2}, m_sphereMesh.getLods());
+    }
+    else {
+        ShapeSquareComponent squareShape;
+        b2PolygonShape polygonShape;
+        polygonShape.Set(squareShape.m_vertices, squareShape.m_vertexCount);
+        fixtureDef.shape = &polygonShape;
+        transform.m_body->CreateFixture(&fixtureDef);
+        graphics.m_vertexCount = m_cubeMesh.getVertexCount();
+        graphics.m_indexCount = m_cubeMesh.getIndexCount();
+        graphics.m_vertexFormat = static_cast<VertexFormat>(m_cubeMesh.getVertexFormat());
+        bounds.m_boundingRadius = m_cubeMesh.getBoundingRadius();
+        game.getRenderSystem().createMeshBuffers(graphics, "cube", m_cubeMesh.getVertices(), m_cubeMesh.getVerticesSize(), m_cubeMesh.getIndices(), m_cubeMesh.getIndicesSize(), 8, {3, 3, 2}, m_cubeMesh.getLods());
+    }
+
+    auto entity = registry.create();
+    registry.emplace<MaterialComponent>(entity, material);
+    registry.emplace<BodyTransformComponent>(entity, transform);
+    registry.emplace<TransformComponent>(entity, bounds);
+    registry.emplace<TextureComponent>(entity, texture);
+    registry.emplace<ShaderProgramComponent>(entity, shaderProgram);
+    registry.emplace<RenderDataComponent>(entity, graphics);
+}
+
+void BenchScene::createLight(Game& game, unsigned int index) {
+    entt::registry& registry = game.getRegistry();
+    AssetManager& assets = game.getAssetManager();
+    RenderSystem& renderSystem = game.getRenderSystem();
+    bool isPoint = (index % 2) == 0;
+    unsigned int typeIndex = index / 2;
+
+    // cycle through a few colors, so overlapping lights stay distinguishable
+    static const glm::vec3 colors[] = {
+        glm::vec3(1.0f, 0.0f, 0.0f),
+        glm::vec3(0.0f, 1.0f, 0.0f),
+        glm::vec3(0.0f, 0.0f, 1.0f),
+        glm::vec3(1.0f, 1.0f, 0.0f),
+        glm::vec3(1.0f, 0.0f, 1.0f),
+        glm::vec3(0.0f, 1.0f, 1.0f),
+    };
+    glm::vec3 color = colors[index % 6];
+
+    LightComponent light;
+    BodyTransformComponent transform;
+    TransformComponent bounds;
+    ShaderProgramComponent shaderProgram;
+    RenderDataComponent graphics;
+    ShadowFramebufferComponent shadow;
+    light.m_type = isPoint ? 1 : 2;
+    light.m_scale = glm::vec3(0.75f, 0.75f, 0.75f);
+    light.m_direction = glm::vec3(0.0f, -1.0f, 0.0f);
+    light.m_cutOff = glm::cos(glm::radians(15.0f));
+    light.m_outerCutOff = glm::cos(glm::radians(17.5f));
+    light.m_constant = 1.0f;
+    light.m_linear = isPoint ? 0.14f : 0.09f;
+    light.m_quadratic = isPoint ? 0.07f : 0.032f;
+    light.m_ambient = glm::vec3(0.0f, 0.0f, 0.0f);
+    light.m_diffuse = color;
+    light.m_specular = color;
+    shaderProgram.m_outputProgram = assets.getShaderProgram("solid_color");
+    shaderProgram.m_lightProgram = assets.getShaderProgram("basic_lighting");
+    shaderProgram.m_shadowProgram = assets.getShaderProgram(isPoint ? "shadow_depth_cube" : "shadow_depth");
+    graphics.m_vertexCount = m_sphereMesh.getVertexCount();
+    graphics.m_indexCount = m_sphereMesh.getIndexCount();
+    graphics.m_vertexFormat = static_cast<VertexFormat>(m_sphereMesh.getVertexFormat());
+    // the light mesh is scaled uniformly
+    bounds.m_boundingRadius = m_sphereMesh.getBoundingRadius() * light.m_scale.x;
+
+    // static bodies spread evenly over the floor
+    b2BodyDef bodyDef;
+    bodyDef.position.Set(-40.0f + (index % 9) * 10.0f, 12.0f + (index / 9) * 4.0f);
+    transform.m_body = game.getWorld().CreateBody(&bodyDef);
+    b2CircleShape circleShape;
+    circleShape.m_radius = 0.75f;
+    transform.m_body->CreateFixture(&circleShape, 1.0f);
+    renderSystem.createMeshBuffers(graphics, "sphere", m_sphereMesh.getVertices(), m_sphereMesh.getVerticesSize(), m_sphereMesh.getIndices(), m_sphereMesh.getIndicesSize(), 8, {3}, m_sphereMesh.getLods());
+
+    // lights past the shader's shadowed slots still draw their mesh, but
+    // neither light the scene nor cast shadows
+    shadow.m_index = typeIndex;
+    shadow.m_nearPlane = 1.0f;
+    shadow.m_farPlane = isPoint ? 32.0f : 15.0f;
+    shadow.m_type = 0;
+    if (typeIndex < SHADOWED_LIGHTS_PER_TYPE) {
+        if (isPoint) {
+            shadow.m_type = 2;
+            renderSystem.createShadowCubemap(shadow);
+        }
+        else {
+            shadow.m_type = 1;
+        }
+    }
+
+    auto entity = registry.create();
+    registry.emplace<LightComponent>(entity, light);
+    registry.emplace<BodyTransformComponent>(entity, transform);
+    registry.emplace<TransformComponent>(entity, bounds);
+    registry.emplace<ShaderProgramComponent>(entity, shaderProgram);
+    registry.emplace<RenderDataComponent>(entity, graphics);
+    registry.emplace<ShadowFramebufferComponent>(entity, shadow);
+}
+
+void BenchScene::createText(Game& game, unsigned int index, bool headless) {
+    entt::registry& registry = game.getRegistry();
+
+    TextComponent text;
+    ShaderProgramComponent shaderProgram;
+    RenderDataComponent graphics;
+    shaderProgram.m_outputProgram = game.getAssetManager().getShaderProgram("text");
+    text.m_xCoord = 10.0f;
+    text.m_yCoord = 10.0f + (index % 40) * 14.0f;
+    text.m_scale = 0.2f;
+    text.m_color = glm::vec3(1.0f, 1.0f, 1.0f);
+    // no font is loaded when headless
+    if (!headless) {
+        std::string message = "Onset Bench text string " + std::to_string(index);
+        for (std::string::const_iterator c = message.begin(); c != message.end(); c++) {
+            text.m_characters.insert(text.m_characters.end(), game.getTextManager().getCharacter(*c));
+        }
+    }
+    game.getRenderSystem().createTextBuffers(graphics);
+
+    auto entity = registry.create();
+    registry.emplace<TextComponent>(entity, text);
+    registry.emplace<ShaderProgramComponent>(entity, shaderProgram);
+    registry.emplace<RenderDataComponent>(entity, graphics);
+}
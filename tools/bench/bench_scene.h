@@ -0,0 +1,114 @@
+// -----------------------------------------------------------------------------
+// Onset Engine
+// https://github.com/dylanafterall/OnsetEngine.git
+//
+// bench_scene.h
+//  header for the benchmark's parameterized synthetic scene
+// -----------------------------------------------------------------------------
+#ifndef BENCH_SCENE_H
+#define BENCH_SCENE_H
+
+#include "core_game.h"
+#include "core_mesh_file.h"
+
+#include <string>
+
+/**
+ * \brief   The BenchConfig struct.
+ * \details Parameters of a benchmark run, set from the command line.
+ */
+struct BenchConfig {
+    /**
+     * \brief Number of dynamic bodies, alternating circles and boxes.
+     */
+    unsigned int m_bodies = 200;
+    /**
+     * \brief Number of lights, alternating point and spot lights.
+     */
+    unsigned int m_lights = 6;
+    /**
+     * \brief Number of text strings.
+     */
+    unsigned int m_texts = 10;
+    /**
+     * \brief Number of measured frames.
+     */
+    unsigned int m_frames = 1000;
+    /**
+     * \brief Number of frames run before measuring.
+     */
+    unsigned int m_warmupFrames = 60;
+    /**
+     * \brief Whether to run without a window or GL context.
+     */
+    bool m_headless = true;
+    /**
+     * \brief Path of the JSON report.
+     */
+    std::string m_output = "bench_results.json";
+    /**
+     * \brief Input recording to replay over the demo level, empty to run the
+     *        synthetic scene without input.
+     */
+    std::string m_replay;
+};
+
+/**
+ * \brief   The BenchScene class.
+ * \details Fills a Game's registry and world with a synthetic scene: a camera,
+ *          a static floor, and the configured numbers of bodies, lights and
+ *          text strings. Used as the level creation function of Game::setup.
+ */
+class BenchScene {
+public:
+    /**
+     * \brief   The default constructor.
+     */
+    BenchScene() = default;
+    /**
+     * \brief   The default destructor.
+     */
+    ~BenchScene() = default;
+
+    /**
+     * \brief   The function create.
+     * \details This function creates and registers every entity of the scene.
+     * \param   game    The game whose registry and world receive the scene.
+     * \param   config  Numbers of bodies, lights and text strings to create.
+     * \return  void, none.
+     */
+    void create(Game&, const BenchConfig&);
+
+private:
+    /**
+     * \brief   Create the camera and static floor.
+     */
+    void createStage(Game&);
+    /**
+     * \brief   Create one dynamic body, a circle for even indices else a box.
+     */
+    void createBody(Game&, unsigned int);
+    /**
+     * \brief   Create one light, a point light for even indices else a spot.
+     */
+    void createLight(Game&, unsigned int);
+    /**
+     * \brief   Create one text string.
+     */
+    void createText(Game&, unsigned int, bool);
+
+    /**
+     * \brief Mesh of the box bodies.
+     */
+    MeshFile m_cubeMesh;
+    /**
+     * \brief Mesh of the circle bodies and lights.
+     */
+    MeshFile m_sphereMesh;
+    /**
+     * \brief Mesh of the floor.
+     */
+    MeshFile m_groundMesh;
+};
+
+#endif // BENCH_SCENE_H
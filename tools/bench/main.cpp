@@ -0,0 +1,100 @@
+// -----------------------------------------------------------------------------
+// Onset Engine
+// https://github.com/dylanafterall/OnsetEngine.git
+//
+// main.cpp
+//  entry point for the OnsetBench benchmark tool
+// -----------------------------------------------------------------------------
+
+#include "bench_report.h"
+#include "bench_scene.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+// parse the unsigned value following argv[i], keeping the default if missing
+static void parseCount(int argc, char* argv[], int& i, unsigned int& value) {
+    if (i + 1 < argc && std::atoi(argv[i + 1]) >= 0) {
+        value = static_cast<unsigned int>(std::atoi(argv[++i]));
+    }
+}
+
+int main(int argc, char* argv[]) {
+    BenchConfig config;
+
+    // --bodies N, --lights M, --texts K: size of the synthetic scene
+    // --frames F, --warmup W: frames measured, after W unmeasured frames
+    // --gl: render to a window (e.g. LIBGL_ALWAYS_SOFTWARE=1 for llvmpipe)
+    // --output PATH: JSON report file
+    // --replay PATH: replay a recorded session over the demo level instead
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--bodies") == 0) {
+            parseCount(argc, argv, i, config.m_bodies);
+        }
+        else if (std::strcmp(argv[i], "--lights") == 0) {
+            parseCount(argc, argv, i, config.m_lights);
+        }
+        else if (std::strcmp(argv[i], "--texts") == 0) {
+            parseCount(argc, argv, i, config.m_texts);
+        }
+        else if (std::strcmp(argv[i], "--frames") == 0) {
+            parseCount(argc, argv, i, config.m_frames);
+        }
+        else if (std::strcmp(argv[i], "--warmup") == 0) {
+            parseCount(argc, argv, i, config.m_warmupFrames);
+        }
+        else if (std::strcmp(argv[i], "--gl") == 0) {
+            config.m_headless = false;
+        }
+        else if (std::strcmp(argv[i], "--headless") == 0) {
+            config.m_headless = true;
+        }
+        else if (std::strcmp(argv[i], "--output") == 0 && i + 1 < argc) {
+            config.m_output = argv[++i];
+        }
+        else if (std::strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+            config.m_replay = argv[++i];
+        }
+    }
+
+    Game game;
+    BenchScene scene;
+    BenchReport report;
+    game.setRunMode(config.m_headless ? headless : singleThreaded);
+
+    // pre loop
+    game.initialize();
+    if (!config.m_headless) {
+        // measure the frame itself, not the display's refresh rate
+        glfwSwapInterval(0);
+        game.getGpuProfileManager().setSummaryInterval(0);
+    }
+    if (config.m_replay.empty()) {
+        game.setup([&game, &scene, &config]() { scene.create(game, config); });
+    }
+    else {
+        // sessions are recorded in the demo level
+        game.setInputReplayPath(config.m_replay);
+        game.setup();
+    }
+
+    // bench loop
+    for (unsigned int frame = 0; frame < config.m_warmupFrames; frame++) {
+        game.runFrame();
+    }
+    game.getGpuProfileManager().resetAverages();
+    for (unsigned int frame = 0; frame < config.m_frames; frame++) {
+        std::int64_t start = ProfileManager::now();
+        game.runFrame();
+        report.addFrame(start, ProfileManager::now());
+    }
+
+    // post loop
+    std::vector<ProfileEvent> events;
+    game.getProfileManager().getEvents(events);
+    report.write(config.m_output, config, events, config.m_headless ? nullptr : &game.getGpuProfileManager());
+    game.destroy();
+
+    return 0;
+}
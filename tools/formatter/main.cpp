@@ -8,27 +8,22 @@
 
 #include "mesh_formatter.h"
 
+#include <cstdio>
+
 int main(int argc, char* argv[]) {
+	if (argc < 3) {
+		printf("usage: MeshFormatter <input.obj> <output.onmesh> [packed]\n");
+		return 1;
+	}
+
 	MeshFormatter formatter;
 	formatter.m_name = formatter.formatName(argv[1]);
-	std::string meshIncludeGuards = formatter.formatMeshIncludeGuards(argv[1]);
+	formatter.m_packed = argc > 3 && std::string(argv[3]) == "packed";
 
-	std::ofstream outputMeshFile (argv[2]);
-	outputMeshFile << "// -----------------------------------------------------------------------------" << "\n";
-	outputMeshFile << "// Onset Engine" << "\n";
-	outputMeshFile << "// https://github.com/dylanafterall/OnsetEngine.git" << "\n";
-	outputMeshFile << "//" << "\n";
-	outputMeshFile << "// " << argv[2] << "\n";
-	outputMeshFile << "//  component to hold vertex (x,y,z / i,j,k / u,v) data for OpenGL rendering " << "\n";
-	outputMeshFile << "// -----------------------------------------------------------------------------" << "\n";
-	outputMeshFile << "\n";
-	outputMeshFile << "#ifndef " << meshIncludeGuards << "\n";
-	outputMeshFile << "#define " << meshIncludeGuards << "\n";
-	outputMeshFile << "\n";
 	// pass in input (wavefront obj) file to be formatted for OpenGL rendering
-	outputMeshFile << formatter.formatMesh(argv[1]);
-	outputMeshFile << "#endif // " << meshIncludeGuards << std::endl;
-	outputMeshFile.close();
+	if (!formatter.formatMesh(argv[1]) || !formatter.writeMesh(argv[2])) {
+		return 1;
+	}
 
 	return 0;
-}
\ No newline at end of file
+}
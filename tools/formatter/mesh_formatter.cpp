@@ -3,15 +3,26 @@
 // https://github.com/dylanafterall/OnsetEngine.git
 //
 // mesh_formatter.cpp
-//  implementation for tool that reads in wavefront obj, converts to vertices[] 
+//  implementation for tool that reads in wavefront obj, converts to a binary 
+//  mesh file of vertices and indices, as floats or packed
 // -----------------------------------------------------------------------------
 
 #include "mesh_formatter.h"
 
+#include "glm/geometric.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+#include <map>
+#include <tuple>
+
 // formatName(): ---------------------------------------------------------------
 std::string MeshFormatter::formatName(const char* input) {
 	std::string name = "";
-	
+
 	int i = 0;
 	char ch;
 	while (input[i] && input[i] != '.') {
@@ -28,15 +39,79 @@ std::string MeshFormatter::formatName(const char* input) {
 	return name;
 }
 
-// formatMesh(): ---------------------------------------------------------------
-std::string MeshFormatter::formatMesh(const char* input) {
-	std::string str = "";
-	std::string header = "";
+// toHalf(): -------------------------------------------------------------------
+// IEEE 754 binary16, rounded to nearest
+static unsigned short toHalf(float value) {
+	unsigned int bits;
+	memcpy(&bits, &value, sizeof(bits));
+	unsigned int sign = (bits >> 16) & 0x8000;
+	int exponent = static_cast<int>((bits >> 23) & 0xFF) - 127 + 15;
+	unsigned int mantissa = bits & 0x7FFFFF;
+
+	// too small even for a subnormal half
+	if (exponent < -10) {
+		return static_cast<unsigned short>(sign);
+	}
+	// subnormal half, the implicit leading 1 shifts into the mantissa
+	if (exponent <= 0) {
+		mantissa |= 0x800000;
+		unsigned int shift = static_cast<unsigned int>(14 - exponent);
+		unsigned int half = mantissa >> shift;
+		if ((mantissa >> (shift - 1)) & 1) {
+			half++;
+		}
+		return static_cast<unsigned short>(sign | half);
+	}
+	// too large, infinity
+	if (exponent >= 31) {
+		return static_cast<unsigned short>(sign | 0x7C00);
+	}
+	// a rounding carry out of the mantissa correctly bumps the exponent
+	unsigned int half = (static_cast<unsigned int>(exponent) << 10) | (mantissa >> 13);
+	if (mantissa & 0x1000) {
+		half++;
+	}
+	return static_cast<unsigned short>(sign | half);
+}
+
+// toUnorm16(): ----------------------------------------------------------------
+// [0, 1] to [0, 65535], OpenGL reads it back with normalized = GL_TRUE
+static unsigned short toUnorm16(float value) {
+	value = std::min(std::max(value, 0.0f), 1.0f);
+	return static_cast<unsigned short>(std::lround(value * 65535.0f));
+}
+
+// toSnorm1010102(): -----------------------------------------------------------
+// unit vector to GL_INT_2_10_10_10_REV: x in the low 10 bits, then y, then z
+static unsigned int toSnorm1010102(const glm::vec3& normal) {
+	unsigned int packed = 0;
+	for (int i = 0; i < 3; i++) {
+		float value = std::min(std::max(normal[i], -1.0f), 1.0f);
+		int component = static_cast<int>(std::lround(value * 511.0f));
+		packed |= (static_cast<unsigned int>(component) & 0x3FF) << (i * 10);
+	}
+	return packed;
+}
+
+// appendBytes(): --------------------------------------------------------------
+// in host order, little endian like the engine reading the file in place
+template<typename Value>
+static void appendBytes(std::vector<unsigned char>& bytes, Value value) {
+	unsigned char raw[sizeof(Value)];
+	memcpy(raw, &value, sizeof(Value));
+	bytes.insert(bytes.end(), raw, raw + sizeof(Value));
+}
 
+// formatMesh(): ---------------------------------------------------------------
+bool MeshFormatter::formatMesh(const char* input) {
 	FILE* objFile = fopen(input, "r");
+	if (!objFile) {
+		printf("MeshFormatter failed to open %s\n", input);
+		return false;
+	}
 	char line[1024];
 
-	std::vector<glm::vec3> vertices;
+	std::vector<glm::vec3> positions;
 	glm::vec3 v;
 
 	std::vector<glm::vec3> normals;
@@ -45,17 +120,21 @@ std::string MeshFormatter::formatMesh(const char* input) {
 	std::vector<glm::vec2> texcoords;
 	glm::vec2 tc;
 
-	int vertexA, textureA, normalA, 
-		vertexB, textureB, normalB, 
-		vertexC, textureC, normalC;
+	int vertex[3], texture[3], normal[3];
 	int faceCount = 0;
 
+	// each unique (position / tex coord / normal) triple of the faces becomes
+	// one vertex, shared by every face using it through the index buffer
+	std::map<std::tuple<int, int, int>, unsigned int> uniqueVertices;
+	m_vertices.clear();
+	m_indices.clear();
+
 	while (fgets(line, 1024, objFile)) {
         // vertex information
 		if (strncmp(line, "v ", 2) == 0) {
 			// create an array of vertex information (x, y, z) and keep count
 			sscanf(line, "v %f %f %f", &v[0], &v[1], &v[2]);
-			vertices.emplace_back(v);
+			positions.emplace_back(v);
 		}
 
 		// normal vector information
@@ -65,111 +144,666 @@ std::string MeshFormatter::formatMesh(const char* input) {
 			normals.emplace_back(n);
 		}
 
-		// texture coordinate information 
+		// texture coordinate information
 		if (strncmp(line, "vt ", 3) == 0) {
 			// create an array of tex coord information (u, v) and keep count
 			sscanf(line, "vt %f %f", &tc[0], &tc[1]);
 			texcoords.emplace_back(tc);
 		}
 
-		// face information - use to populate the returnString
+		// face information - use to populate vertices and indices
 		if (strncmp(line, "f ", 2) == 0) {
 			sscanf(line, "f %d/%d/%d %d/%d/%d %d/%d/%d",
-				&vertexA, &textureA, &normalA,
-            	&vertexB, &textureB, &normalB, 
-            	&vertexC, &textureC, &normalC
-            );
-
-			// first vertex of face
-			str += 	"\t\t";
-			str += 	std::to_string(vertices[vertexA - 1][0]) + "f, " + 
-					std::to_string(vertices[vertexA - 1][1]) + "f, " + 
-					std::to_string(vertices[vertexA - 1][2]) + "f, ";
-			str += 	std::to_string(normals[normalA - 1][0]) + "f, " + 
-					std::to_string(normals[normalA - 1][1]) + "f, " + 
-					std::to_string(normals[normalA - 1][2]) + "f, ";
-			str += 	std::to_string(texcoords[textureA - 1][0]) + "f, " + 
-					std::to_string(texcoords[textureA - 1][1]) + "f, ";
-			// newline for the next vertex
-			str += 	"\n";
-
-			// second vertex of face
-			str += 	"\t\t";
-			str += 	std::to_string(vertices[vertexB - 1][0]) + "f, " + 
-					std::to_string(vertices[vertexB - 1][1]) + "f, " + 
-					std::to_string(vertices[vertexB - 1][2]) + "f, ";
-			str += 	std::to_string(normals[normalB - 1][0]) + "f, " + 
-					std::to_string(normals[normalB - 1][1]) + "f, " + 
-					std::to_string(normals[normalB - 1][2]) + "f, ";
-			str += 	std::to_string(texcoords[textureB - 1][0]) + "f, " + 
-					std::to_string(texcoords[textureB - 1][1]) + "f, ";
-			// newline for the next vertex
-			str += 	"\n";
-
-			// third vertex of face
-			str += 	"\t\t";
-			str += 	std::to_string(vertices[vertexC - 1][0]) + "f, " + 
-					std::to_string(vertices[vertexC - 1][1]) + "f, " + 
-					std::to_string(vertices[vertexC - 1][2]) + "f, ";
-			str += 	std::to_string(normals[normalC - 1][0]) + "f, " + 
-					std::to_string(normals[normalC - 1][1]) + "f, " + 
-					std::to_string(normals[normalC - 1][2]) + "f, ";
-			str += 	std::to_string(texcoords[textureC - 1][0]) + "f, " + 
-					std::to_string(texcoords[textureC - 1][1]) + "f, ";
-			// newline for the next vertex
-			str += 	"\n";
+				&vertex[0], &texture[0], &normal[0],
+				&vertex[1], &texture[1], &normal[1],
+				&vertex[2], &texture[2], &normal[2]
+			);
+
+			for (int i = 0; i < 3; i++) {
+				std::tuple<int, int, int> key(vertex[i], texture[i], normal[i]);
+				auto found = uniqueVertices.find(key);
+				if (found == uniqueVertices.end()) {
+					FormatterVertex unique;
+					unique.m_position = positions[vertex[i] - 1];
+					unique.m_normal = normals[normal[i] - 1];
+					unique.m_texcoord = texcoords[texture[i] - 1];
+					found = uniqueVertices.emplace(key, static_cast<unsigned int>(m_vertices.size())).first;
+					m_vertices.push_back(unique);
+				}
+				m_indices.push_back(found->second);
+			}
 
 			faceCount++;
 		}
 	}
+	fclose(objFile);
 
-	// remove the very last comma from the array (first newline, then space, then comma)
-	str.pop_back();
-	str.pop_back();
-	str.pop_back();
+	// coarser levels of detail, each simplified from the full detail mesh,
+	// until one saves too few triangles or loses the mesh's shape
+	glm::vec3 center(0.0f);
+	for (const FormatterVertex& vertex : m_vertices) {
+		center += vertex.m_position;
+	}
+	center /= static_cast<float>(std::max<std::size_t>(m_vertices.size(), 1));
+	float radius = 0.0f;
+	for (const FormatterVertex& vertex : m_vertices) {
+		radius = std::max(radius, glm::length(vertex.m_position - center));
+	}
+	std::vector<std::vector<unsigned int>> levels(1, m_indices);
+	std::vector<float> errors(1, 0.0f);
+	while (levels.size() < MAX_MESH_LODS) {
+		std::size_t target = static_cast<std::size_t>(levels.back().size() / 3 * LOD_RATIO) * 3;
+		float error = 0.0f;
+		std::vector<unsigned int> level = simplify(levels[0], target, error);
+		if (level.empty() || level.size() > levels.back().size() * LOD_MIN_REDUCTION || error > radius * LOD_MAX_ERROR) {
+			break;
+		}
+		levels.push_back(level);
+		errors.push_back(std::max(error, errors.back()));
+	}
 
-	// add closing } at end of m_vertices[]
-	str = str + "\n\t};\n\n";
+	// triangle order of each level for the post-transform cache, then for 
+	// overdraw, then vertex order for the pre-transform (fetch) cache, led by
+	// the full detail level
+	float acmrBefore = getACMR(levels[0], m_vertices.size());
+	m_indices.clear();
+	m_lods.clear();
+	for (std::size_t i = 0; i < levels.size(); i++) {
+		optimizeVertexCache(levels[i], m_vertices.size());
+		optimizeOverdraw(levels[i], m_vertices);
+		MeshLod lod = {};
+		lod.m_indexOffset = static_cast<std::uint32_t>(m_indices.size());
+		lod.m_indexCount = static_cast<std::uint32_t>(levels[i].size());
+		lod.m_error = errors[i];
+		m_lods.push_back(lod);
+		m_indices.insert(m_indices.end(), levels[i].begin(), levels[i].end());
+	}
+	optimizeVertexFetch(m_indices, m_vertices);
+	printf("%s: %d triangles, %d -> %zu vertices, ACMR %.3f -> %.3f\n",
+		m_name.c_str(), faceCount, faceCount * 3, m_vertices.size(),
+		acmrBefore, getACMR(levels[0], m_vertices.size())
+	);
+	for (std::size_t i = 1; i < m_lods.size(); i++) {
+		printf("%s: level %zu, %u triangles, error %.4f\n",
+			m_name.c_str(), i, m_lods[i].m_indexCount / 3, m_lods[i].m_error
+		);
+	}
 
-	// add m_verticesSize for populating VBO 
-	float f;
-	str = str + "\tint m_verticesSize = " + std::to_string(faceCount * 3 * 8 * sizeof(f)) + ";\n\n";
+	return faceCount > 0;
+}
 
-	// add m_vertexCount for RenderSystem to use
-	str = str + "\tint m_vertexCount = " + std::to_string(faceCount * 3) + ";\n";
+// writeMesh(): ----------------------------------------------------------------
+// header, level table, vertices and indices, as laid out in core_mesh_format.h
+bool MeshFormatter::writeMesh(const char* output) {
+	std::vector<unsigned char> bytes;
 
-	// add closing } at end of struct MeshComponent
-	str = str + "}; \n\n";
+	MeshFileHeader header = {};
+	memcpy(header.m_magic, MESH_MAGIC, sizeof(MESH_MAGIC));
+	header.m_version = MESH_VERSION;
+	header.m_vertexFormat = m_packed ? 1 : 0;
+	header.m_vertexCount = static_cast<std::uint32_t>(m_vertices.size());
+	header.m_vertexSize = m_packed ? 16 : 8 * sizeof(float);
+	header.m_indexCount = static_cast<std::uint32_t>(m_indices.size());
+	// position, normal, tex coords
+	header.m_attributeCount = 3;
+	header.m_attributes[0] = 3;
+	header.m_attributes[1] = 3;
+	header.m_attributes[2] = 2;
+	header.m_lodCount = static_cast<std::uint32_t>(m_lods.size());
 
-	// had to wait until after reading file to make header - needed faceCount
-	header += "struct Mesh";
-	header += m_name;
-	header += "Component { \n";
-	header += "\t" "float m_vertices[";
-	header += std::to_string(faceCount * 3 * 8);
-	header += "] = { \n";
-	str = header + str;
+	bytes.insert(bytes.end(), header.m_magic, header.m_magic + sizeof(header.m_magic));
+	appendBytes(bytes, header.m_version);
+	appendBytes(bytes, header.m_vertexFormat);
+	appendBytes(bytes, header.m_vertexCount);
+	appendBytes(bytes, header.m_vertexSize);
+	appendBytes(bytes, header.m_indexCount);
+	appendBytes(bytes, header.m_attributeCount);
+	for (std::uint32_t attribute : header.m_attributes) {
+		appendBytes(bytes, attribute);
+	}
+	appendBytes(bytes, header.m_lodCount);
+	for (std::uint32_t reserved : header.m_reserved) {
+		appendBytes(bytes, reserved);
+	}
+	for (const MeshLod& lod : m_lods) {
+		appendBytes(bytes, lod.m_indexOffset);
+		appendBytes(bytes, lod.m_indexCount);
+		appendBytes(bytes, lod.m_error);
+		appendBytes(bytes, lod.m_reserved);
+	}
 
-	fclose(objFile);
-	return str;
+	bool clamped = false;
+	for (const FormatterVertex& vertex : m_vertices) {
+		if (m_packed) {
+			// position x y z and a padding 1.0 as halves, the normal, u and v
+			appendBytes(bytes, toHalf(vertex.m_position[0]));
+			appendBytes(bytes, toHalf(vertex.m_position[1]));
+			appendBytes(bytes, toHalf(vertex.m_position[2]));
+			appendBytes(bytes, toHalf(1.0f));
+			appendBytes(bytes, toSnorm1010102(vertex.m_normal));
+			appendBytes(bytes, toUnorm16(vertex.m_texcoord[0]));
+			appendBytes(bytes, toUnorm16(vertex.m_texcoord[1]));
+			clamped = clamped
+				|| vertex.m_texcoord[0] < 0.0f || vertex.m_texcoord[0] > 1.0f
+				|| vertex.m_texcoord[1] < 0.0f || vertex.m_texcoord[1] > 1.0f;
+		}
+		else {
+			for (int i = 0; i < 3; i++) {
+				appendBytes(bytes, vertex.m_position[i]);
+			}
+			for (int i = 0; i < 3; i++) {
+				appendBytes(bytes, vertex.m_normal[i]);
+			}
+			for (int i = 0; i < 2; i++) {
+				appendBytes(bytes, vertex.m_texcoord[i]);
+			}
+		}
+	}
+	if (clamped) {
+		printf("%s: tex coords outside [0, 1] were clamped, use the float layout to repeat textures\n", m_name.c_str());
+	}
+	for (unsigned int index : m_indices) {
+		appendBytes(bytes, static_cast<std::uint32_t>(index));
+	}
+
+	std::ofstream outputMeshFile(output, std::ios::out | std::ios::binary);
+	outputMeshFile.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+	if (!outputMeshFile) {
+		printf("MeshFormatter failed to write %s\n", output);
+		return false;
+	}
+	return true;
 }
 
-// formatMeshIncludeGuards(): --------------------------------------------------
-std::string MeshFormatter::formatMeshIncludeGuards(const char* input) {
-	std::string str;
+// Quadric: -------------------------------------------------------------------
+// area weighted sum of squared distances to a set of planes ax + by + cz + d
+// = 0, as the symmetric 4x4 matrix of Garland and Heckbert's "Surface 
+// Simplification Using Quadric Error Metrics": a², ab, ac, ad, b², bc, bd, 
+// c², cd, d²
+struct Quadric {
+	double m_terms[10] = {};
+	double m_weight = 0.0;
+};
 
-	str += "COMPONENT_MESH_";
-	
-	int i = 0;
-	char ch;
+// addQuadric(): ---------------------------------------------------------------
+static void addQuadric(Quadric& quadric, const Quadric& other) {
+	for (int i = 0; i < 10; i++) {
+		quadric.m_terms[i] += other.m_terms[i];
+	}
+	quadric.m_weight += other.m_weight;
+}
 
-	while (input[i] && input[i] != '.') {
-		ch = input[i];
-		str += toupper(ch);
-		i++;
+// addPlane(): -----------------------------------------------------------------
+static void addPlane(Quadric& quadric, const glm::vec3& normal, float distance, float weight) {
+	double a = normal[0], b = normal[1], c = normal[2], d = distance;
+	double terms[10] = {a * a, a * b, a * c, a * d, b * b, b * c, b * d, c * c, c * d, d * d};
+	for (int i = 0; i < 10; i++) {
+		quadric.m_terms[i] += terms[i] * weight;
+	}
+	quadric.m_weight += weight;
+}
+
+// getQuadricError(): ----------------------------------------------------------
+// mean squared distance to the planes
+static double getQuadricError(const Quadric& quadric, const glm::vec3& position) {
+	if (quadric.m_weight <= 0.0) {
+		return 0.0;
+	}
+	const double* q = quadric.m_terms;
+	double x = position[0], y = position[1], z = position[2];
+	double error = q[0] * x * x + 2.0 * q[1] * x * y + 2.0 * q[2] * x * z + 2.0 * q[3] * x
+		+ q[4] * y * y + 2.0 * q[5] * y * z + 2.0 * q[6] * y
+		+ q[7] * z * z + 2.0 * q[8] * z
+		+ q[9];
+	return std::max(error / quadric.m_weight, 0.0);
+}
+
+// simplify(): -----------------------------------------------------------------
+// collapses edges, cheapest quadric error first, until the triangles fit in
+// targetIndexCount or no edge can collapse. A vertex collapses onto a
+// neighboring vertex, so the level keeps using the mesh's vertex data. 
+// Vertices on seams (one position, several normals or tex coords) and on 
+// borders never move, keeping the surface closed and its attributes intact.
+// error returns the largest root mean square distance of a collapsed vertex 
+// from the planes it gathered, the level's distance from the full detail
+// surface
+std::vector<unsigned int> MeshFormatter::simplify(const std::vector<unsigned int>& indices, std::size_t targetIndexCount, float& error) {
+	std::size_t vertexCount = m_vertices.size();
+
+	// vertices sharing a position are one point of the surface
+	std::map<std::tuple<float, float, float>, unsigned int> positions;
+	std::vector<unsigned int> points(vertexCount);
+	std::vector<int> copies(vertexCount, 0);
+	for (std::size_t i = 0; i < vertexCount; i++) {
+		const glm::vec3& position = m_vertices[i].m_position;
+		std::tuple<float, float, float> key(position[0], position[1], position[2]);
+		points[i] = positions.emplace(key, static_cast<unsigned int>(i)).first->second;
+		copies[points[i]]++;
+	}
+
+	// border edges belong to a single face
+	std::map<std::pair<unsigned int, unsigned int>, int> edgeFaces;
+	for (std::size_t face = 0; face < indices.size() / 3; face++) {
+		for (int i = 0; i < 3; i++) {
+			unsigned int a = points[indices[face * 3 + i]];
+			unsigned int b = points[indices[face * 3 + (i + 1) % 3]];
+			edgeFaces[std::make_pair(std::min(a, b), std::max(a, b))]++;
+		}
+	}
+	std::vector<bool> locked(vertexCount, false);
+	for (const auto& edge : edgeFaces) {
+		if (edge.second != 2) {
+			locked[edge.first.first] = true;
+			locked[edge.first.second] = true;
+		}
+	}
+	for (std::size_t i = 0; i < vertexCount; i++) {
+		locked[i] = locked[points[i]] || copies[points[i]] > 1;
+	}
+
+	// the planes of each point's faces
+	std::vector<Quadric> quadrics(vertexCount);
+	for (std::size_t face = 0; face < indices.size() / 3; face++) {
+		const glm::vec3& a = m_vertices[indices[face * 3]].m_position;
+		const glm::vec3& b = m_vertices[indices[face * 3 + 1]].m_position;
+		const glm::vec3& c = m_vertices[indices[face * 3 + 2]].m_position;
+		glm::vec3 normal = glm::cross(b - a, c - a);
+		float length = glm::length(normal);
+		if (length <= 0.0f) {
+			continue;
+		}
+		normal /= length;
+		for (int i = 0; i < 3; i++) {
+			addPlane(quadrics[points[indices[face * 3 + i]]], normal, -glm::dot(normal, a), length * 0.5f);
+		}
+	}
+
+	struct Collapse {
+		double m_cost;
+		unsigned int m_from;
+		unsigned int m_to;
+	};
+	std::vector<unsigned int> result = indices;
+	std::vector<std::vector<unsigned int>> pointFaces(vertexCount);
+	std::vector<Collapse> collapses;
+	std::vector<bool> touched(vertexCount);
+	std::vector<unsigned int> remap(vertexCount);
+	double largestCost = 0.0;
+
+	// in passes, each collapsing edges apart from the last ones collapsed
+	while (result.size() > targetIndexCount) {
+		std::size_t faceCount = result.size() / 3;
+		for (auto& faces : pointFaces) {
+			faces.clear();
+		}
+		collapses.clear();
+		for (std::size_t face = 0; face < faceCount; face++) {
+			for (int i = 0; i < 3; i++) {
+				pointFaces[points[result[face * 3 + i]]].push_back(static_cast<unsigned int>(face));
+				unsigned int a = result[face * 3 + i];
+				unsigned int b = result[face * 3 + (i + 1) % 3];
+				if (!locked[a]) {
+					collapses.push_back({getQuadricError(quadrics[points[a]], m_vertices[b].m_position), a, b});
+				}
+				if (!locked[b]) {
+					collapses.push_back({getQuadricError(quadrics[points[b]], m_vertices[a].m_position), b, a});
+				}
+			}
+		}
+		std::sort(collapses.begin(), collapses.end(), [](const Collapse& a, const Collapse& b) {
+			return a.m_cost < b.m_cost;
+		});
+
+		std::fill(touched.begin(), touched.end(), false);
+		for (std::size_t i = 0; i < vertexCount; i++) {
+			remap[i] = static_cast<unsigned int>(i);
+		}
+		std::size_t removeCount = (result.size() - targetIndexCount) / 3;
+		std::size_t removed = 0;
+		for (const Collapse& collapse : collapses) {
+			if (removed >= removeCount) {
+				break;
+			}
+			unsigned int from = points[collapse.m_from];
+			unsigned int to = points[collapse.m_to];
+			if (touched[from] || touched[to]) {
+				continue;
+			}
+
+			// the edge's two faces disappear, and the other faces of the
+			// point neither flip nor fold onto a third shared neighbor
+			int sharedFaces = 0;
+			bool flips = false;
+			std::vector<unsigned int> fromNeighbors, toNeighbors;
+			for (unsigned int face : pointFaces[from]) {
+				bool shared = false;
+				for (int i = 0; i < 3; i++) {
+					unsigned int point = points[result[face * 3 + i]];
+					shared = shared || point == to;
+					if (point != from) {
+						fromNeighbors.push_back(point);
+					}
+				}
+				if (shared) {
+					sharedFaces++;
+					continue;
+				}
+				glm::vec3 corners[3];
+				glm::vec3 moved[3];
+				for (int i = 0; i < 3; i++) {
+					unsigned int index = result[face * 3 + i];
+					corners[i] = m_vertices[index].m_position;
+					moved[i] = points[index] == from ? m_vertices[collapse.m_to].m_position : corners[i];
+				}
+				glm::vec3 before = glm::cross(corners[1] - corners[0], corners[2] - corners[0]);
+				glm::vec3 after = glm::cross(moved[1] - moved[0], moved[2] - moved[0]);
+				flips = flips || glm::dot(before, after) <= 0.0f;
+			}
+			for (unsigned int face : pointFaces[to]) {
+				for (int i = 0; i < 3; i++) {
+					unsigned int point = points[result[face * 3 + i]];
+					if (point != to) {
+						toNeighbors.push_back(point);
+					}
+				}
+			}
+			std::sort(fromNeighbors.begin(), fromNeighbors.end());
+			fromNeighbors.erase(std::unique(fromNeighbors.begin(), fromNeighbors.end()), fromNeighbors.end());
+			std::sort(toNeighbors.begin(), toNeighbors.end());
+			toNeighbors.erase(std::unique(toNeighbors.begin(), toNeighbors.end()), toNeighbors.end());
+			std::vector<unsigned int> commonNeighbors;
+			std::set_intersection(
+				fromNeighbors.begin(), fromNeighbors.end(),
+				toNeighbors.begin(), toNeighbors.end(),
+				std::back_inserter(commonNeighbors)
+			);
+			if (sharedFaces != 2 || flips || commonNeighbors.size() != 2) {
+				continue;
+			}
+
+			remap[collapse.m_from] = collapse.m_to;
+			addQuadric(quadrics[to], quadrics[from]);
+			largestCost = std::max(largestCost, collapse.m_cost);
+			touched[from] = true;
+			touched[to] = true;
+			for (unsigned int neighbor : fromNeighbors) {
+				touched[neighbor] = true;
+			}
+			removed += 2;
+		}
+		if (removed == 0) {
+			break;
+		}
+
+		// drop the faces collapsed to a line
+		std::size_t kept = 0;
+		for (std::size_t face = 0; face < faceCount; face++) {
+			unsigned int a = remap[result[face * 3]];
+			unsigned int b = remap[result[face * 3 + 1]];
+			unsigned int c = remap[result[face * 3 + 2]];
+			if (points[a] != points[b] && points[b] != points[c] && points[c] != points[a]) {
+				result[kept++] = a;
+				result[kept++] = b;
+				result[kept++] = c;
+			}
+		}
+		result.resize(kept);
+	}
+
+	error = static_cast<float>(std::sqrt(largestCost));
+	return result;
+}
+
+// getVertexScore(): -----------------------------------------------------------
+// Forsyth's vertex score: recently used vertices score high (the last face's
+// three equally, to avoid favoring strips), as do vertices with few faces
+// left, so that lone faces are not left behind
+static float getVertexScore(int cachePosition, int remainingFaces) {
+	if (remainingFaces == 0) {
+		return -1.0f;
+	}
+
+	float score = 0.0f;
+	if (cachePosition >= 0) {
+		if (cachePosition < 3) {
+			score = 0.75f;
+		}
+		else {
+			float scale = 1.0f / (MeshFormatter::CACHE_SIZE - 3);
+			score = powf(1.0f - (cachePosition - 3) * scale, 1.5f);
+		}
+	}
+	score += 2.0f * powf(static_cast<float>(remainingFaces), -0.5f);
+	return score;
+}
+
+// optimizeVertexCache(): ------------------------------------------------------
+// greedily emits the best scoring face, as in Tom Forsyth's "Linear-Speed
+// Vertex Cache Optimisation", with a simulated LRU cache of CACHE_SIZE
+void MeshFormatter::optimizeVertexCache(std::vector<unsigned int>& indices, std::size_t vertexCount) {
+	std::size_t faceCount = indices.size() / 3;
+
+	// faces of each vertex, not yet emitted
+	std::vector<unsigned int> faceOffsets(vertexCount + 1, 0);
+	for (unsigned int index : indices) {
+		faceOffsets[index + 1]++;
+	}
+	for (std::size_t i = 0; i < vertexCount; i++) {
+		faceOffsets[i + 1] += faceOffsets[i];
+	}
+	std::vector<unsigned int> vertexFaces(indices.size());
+	std::vector<int> remainingFaces(vertexCount, 0);
+	for (std::size_t face = 0; face < faceCount; face++) {
+		for (int i = 0; i < 3; i++) {
+			unsigned int index = indices[face * 3 + i];
+			vertexFaces[faceOffsets[index] + remainingFaces[index]++] = static_cast<unsigned int>(face);
+		}
+	}
+
+	std::vector<int> cachePositions(vertexCount, -1);
+	std::vector<float> vertexScores(vertexCount);
+	for (std::size_t i = 0; i < vertexCount; i++) {
+		vertexScores[i] = getVertexScore(-1, remainingFaces[i]);
+	}
+	std::vector<float> faceScores(faceCount);
+	std::vector<bool> emitted(faceCount, false);
+	for (std::size_t face = 0; face < faceCount; face++) {
+		faceScores[face] = vertexScores[indices[face * 3]]
+			+ vertexScores[indices[face * 3 + 1]]
+			+ vertexScores[indices[face * 3 + 2]];
 	}
 
-	str += "_H";
+	std::vector<unsigned int> cache;
+	std::vector<unsigned int> nextCache;
+	std::vector<unsigned int> result;
+	result.reserve(indices.size());
+	int bestFace = -1;
 
-	return str;
-}
\ No newline at end of file
+	for (std::size_t step = 0; step < faceCount; step++) {
+		// no face touches the cache: start over from the best face left
+		if (bestFace < 0) {
+			float bestScore = -1.0f;
+			for (std::size_t face = 0; face < faceCount; face++) {
+				if (!emitted[face] && faceScores[face] > bestScore) {
+					bestScore = faceScores[face];
+					bestFace = static_cast<int>(face);
+				}
+			}
+		}
+
+		// emit the face, and drop it from its vertices' face lists
+		emitted[bestFace] = true;
+		nextCache.clear();
+		for (int i = 0; i < 3; i++) {
+			unsigned int index = indices[bestFace * 3 + i];
+			result.push_back(index);
+			nextCache.push_back(index);
+
+			unsigned int* faces = &vertexFaces[faceOffsets[index]];
+			for (int j = 0; j < remainingFaces[index]; j++) {
+				if (faces[j] == static_cast<unsigned int>(bestFace)) {
+					faces[j] = faces[remainingFaces[index] - 1];
+					break;
+				}
+			}
+			remainingFaces[index]--;
+		}
+
+		// the face's vertices move to the front of the cache
+		for (unsigned int index : cache) {
+			if (std::find(nextCache.begin(), nextCache.begin() + 3, index) == nextCache.begin() + 3) {
+				nextCache.push_back(index);
+			}
+		}
+		for (std::size_t i = 0; i < nextCache.size(); i++) {
+			cachePositions[nextCache[i]] = i < CACHE_SIZE ? static_cast<int>(i) : -1;
+		}
+		// rescore what the face touched, and pick the next face among them
+		bestFace = -1;
+		float bestScore = -1.0f;
+		for (unsigned int index : nextCache) {
+			vertexScores[index] = getVertexScore(cachePositions[index], remainingFaces[index]);
+		}
+		for (unsigned int index : nextCache) {
+			const unsigned int* faces = &vertexFaces[faceOffsets[index]];
+			for (int j = 0; j < remainingFaces[index]; j++) {
+				unsigned int face = faces[j];
+				faceScores[face] = vertexScores[indices[face * 3]]
+					+ vertexScores[indices[face * 3 + 1]]
+					+ vertexScores[indices[face * 3 + 2]];
+				if (faceScores[face] > bestScore) {
+					bestScore = faceScores[face];
+					bestFace = static_cast<int>(face);
+				}
+			}
+		}
+		if (nextCache.size() > CACHE_SIZE) {
+			nextCache.resize(CACHE_SIZE);
+		}
+		cache.swap(nextCache);
+	}
+
+	indices.swap(result);
+}
+
+// optimizeOverdraw(): ---------------------------------------------------------
+// splits the cache ordered faces into clusters where the cache restarts, then
+// draws the clusters facing away from the mesh's center first, as in Sander,
+// Nehab and Barczak's "Fast Triangle Reordering for Vertex Locality and
+// Reduced Overdraw", so convex parts occlude the rest from most views
+void MeshFormatter::optimizeOverdraw(std::vector<unsigned int>& indices, const std::vector<FormatterVertex>& vertices) {
+	std::size_t faceCount = indices.size() / 3;
+	if (faceCount < 2) {
+		return;
+	}
+
+	// a cluster starts at each face missing the cache on all three vertices
+	std::vector<std::size_t> clusters;
+	std::vector<unsigned int> timestamps(vertices.size(), 0);
+	unsigned int time = CACHE_SIZE + 1;
+	for (std::size_t face = 0; face < faceCount; face++) {
+		int misses = 0;
+		for (int i = 0; i < 3; i++) {
+			unsigned int index = indices[face * 3 + i];
+			if (time - timestamps[index] > CACHE_SIZE) {
+				timestamps[index] = time++;
+				misses++;
+			}
+		}
+		if (face == 0 || misses == 3) {
+			clusters.push_back(face);
+		}
+	}
+	clusters.push_back(faceCount);
+
+	// area weighted centroid and normal of the mesh and each cluster
+	std::vector<glm::vec3> clusterCentroids(clusters.size() - 1, glm::vec3(0.0f));
+	std::vector<glm::vec3> clusterNormals(clusters.size() - 1, glm::vec3(0.0f));
+	std::vector<float> clusterAreas(clusters.size() - 1, 0.0f);
+	glm::vec3 meshCentroid(0.0f);
+	float meshArea = 0.0f;
+	for (std::size_t cluster = 0; cluster + 1 < clusters.size(); cluster++) {
+		for (std::size_t face = clusters[cluster]; face < clusters[cluster + 1]; face++) {
+			const glm::vec3& a = vertices[indices[face * 3]].m_position;
+			const glm::vec3& b = vertices[indices[face * 3 + 1]].m_position;
+			const glm::vec3& c = vertices[indices[face * 3 + 2]].m_position;
+			glm::vec3 normal = glm::cross(b - a, c - a);
+			float area = glm::length(normal);
+			glm::vec3 centroid = (a + b + c) * (area / 3.0f);
+			clusterCentroids[cluster] += centroid;
+			clusterNormals[cluster] += normal;
+			clusterAreas[cluster] += area;
+			meshCentroid += centroid;
+			meshArea += area;
+		}
+	}
+	if (meshArea > 0.0f) {
+		meshCentroid /= meshArea;
+	}
+
+	std::vector<float> sortKeys(clusters.size() - 1, 0.0f);
+	std::vector<std::size_t> order(clusters.size() - 1);
+	for (std::size_t cluster = 0; cluster + 1 < clusters.size(); cluster++) {
+		order[cluster] = cluster;
+		float normalLength = glm::length(clusterNormals[cluster]);
+		if (clusterAreas[cluster] > 0.0f && normalLength > 0.0f) {
+			glm::vec3 centroid = clusterCentroids[cluster] / clusterAreas[cluster];
+			sortKeys[cluster] = glm::dot(centroid - meshCentroid, clusterNormals[cluster] / normalLength);
+		}
+	}
+	std::stable_sort(order.begin(), order.end(), [&sortKeys](std::size_t a, std::size_t b) {
+		return sortKeys[a] > sortKeys[b];
+	});
+
+	std::vector<unsigned int> result;
+	result.reserve(indices.size());
+	for (std::size_t cluster : order) {
+		result.insert(result.end(), indices.begin() + clusters[cluster] * 3, indices.begin() + clusters[cluster + 1] * 3);
+	}
+
+	// cluster seams cost cache misses, keep the cache order if they cost many
+	if (getACMR(result, vertices.size()) <= getACMR(indices, vertices.size()) * OVERDRAW_THRESHOLD) {
+		indices.swap(result);
+	}
+}
+
+// optimizeVertexFetch(): ------------------------------------------------------
+// renumbers vertices in order of first use, so the vertex shader reads the
+// vertex buffer close to linearly
+void MeshFormatter::optimizeVertexFetch(std::vector<unsigned int>& indices, std::vector<FormatterVertex>& vertices) {
+	const unsigned int unused = ~0u;
+	std::vector<unsigned int> remap(vertices.size(), unused);
+	std::vector<FormatterVertex> result;
+	result.reserve(vertices.size());
+
+	for (unsigned int& index : indices) {
+		if (remap[index] == unused) {
+			remap[index] = static_cast<unsigned int>(result.size());
+			result.push_back(vertices[index]);
+		}
+		index = remap[index];
+	}
+
+	vertices.swap(result);
+}
+
+// getACMR(): ------------------------------------------------------------------
+// average cache miss ratio: vertex shader runs per face, through a FIFO cache
+// of CACHE_SIZE. 3 for unindexed faces, 0.5 at best for a regular grid
+float MeshFormatter::getACMR(const std::vector<unsigned int>& indices, std::size_t vertexCount) {
+	if (indices.empty()) {
+		return 0.0f;
+	}
+
+	std::vector<unsigned int> timestamps(vertexCount, 0);
+	unsigned int time = CACHE_SIZE + 1;
+	unsigned int misses = 0;
+	for (unsigned int index : indices) {
+		if (time - timestamps[index] > CACHE_SIZE) {
+			timestamps[index] = time++;
+			misses++;
+		}
+	}
+
+	return static_cast<float>(misses) / (indices.size() / 3);
+}
@@ -3,12 +3,15 @@
 // https://github.com/dylanafterall/OnsetEngine.git
 //
 // mesh_formatter.h
-//  header for tool that reads in wavefront obj, converts to vertices[] 
+//  header for tool that reads in wavefront obj, converts to a binary mesh file
+//  of vertices and indices, as floats or packed
 // -----------------------------------------------------------------------------
 
 #ifndef MESH_FORMATTER_H
 #define MESH_FORMATTER_H
 
+#include "core_mesh_format.h"
+
 #include "glm/vec2.hpp"
 #include "glm/vec3.hpp"
 
@@ -17,18 +20,48 @@
 #include <ctype.h>
 #include <vector>
 
+// one unique (position / normal / tex coord) combination of the obj file
+struct FormatterVertex {
+	glm::vec3 m_position;
+	glm::vec3 m_normal;
+	glm::vec2 m_texcoord;
+};
+
 class MeshFormatter {
 public:
 	MeshFormatter() = default;
 	~MeshFormatter() = default;
 
 	std::string formatName(const char*);
-	std::string formatMesh(const char*);
-	std::string formatMeshIncludeGuards(const char*);
+	bool formatMesh(const char*);
+	bool writeMesh(const char*);
 
 	std::string m_name;
+	// 16 byte vertices: half float position, 2_10_10_10 normal, unorm16 uv
+	bool m_packed = false;
+
+	// simulated post-transform cache, in vertices
+	static constexpr unsigned int CACHE_SIZE = 32;
+	// overdraw ordering is kept only if the cache miss ratio grows by less
+	static constexpr float OVERDRAW_THRESHOLD = 1.05f;
+	// each level of detail aims at this fraction of the last level's 
+	// triangles, and is dropped unless it has at most LOD_MIN_REDUCTION of them
+	static constexpr float LOD_RATIO = 0.5f;
+	static constexpr float LOD_MIN_REDUCTION = 0.75f;
+	// nor may its error pass this fraction of the mesh's bounding radius
+	static constexpr float LOD_MAX_ERROR = 0.25f;
 
 private:
+	std::vector<unsigned int> simplify(const std::vector<unsigned int>&, std::size_t, float&);
+	void optimizeVertexCache(std::vector<unsigned int>&, std::size_t);
+	void optimizeOverdraw(std::vector<unsigned int>&, const std::vector<FormatterVertex>&);
+	void optimizeVertexFetch(std::vector<unsigned int>&, std::vector<FormatterVertex>&);
+	float getACMR(const std::vector<unsigned int>&, std::size_t);
+
+	std::vector<FormatterVertex> m_vertices;
+	// every level's triangles, full detail first, and the level table
+	std::vector<unsigned int> m_indices;
+	std::vector<MeshLod> m_lods;
 };
 
-#endif // MESH_FORMATTER_H
\ No newline at end of file
+#endif // MESH_FORMATTER_H
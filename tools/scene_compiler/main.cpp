@@ -0,0 +1,27 @@
+// -----------------------------------------------------------------------------
+// Onset Engine
+// https://github.com/dylanafterall/OnsetEngine.git
+//
+// main.cpp
+//  entry point for the scene compiler tool
+// -----------------------------------------------------------------------------
+
+#include "scene_compiler.h"
+
+#include <iostream>
+
+int main(int argc, char* argv[]) {
+    if (argc != 3) {
+        std::cerr << "usage: SceneCompiler <input.scene> <output.onsc>" << std::endl;
+        return 1;
+    }
+
+    SceneCompiler compiler;
+    if (!compiler.compile(argv[1], argv[2])) {
+        std::cerr << "SceneCompiler: " << compiler.getError() << std::endl;
+        return 1;
+    }
+    std::cout << "SceneCompiler: " << argv[2] << ", " << compiler.getEntityCount() << " entities" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,653 @@
+// -----------------------------------------------------------------------------
+// Onset Engine
+// https://github.com/dylanafterall/OnsetEngine.git
+//
+// scene_compiler.cpp
+//  implementation of tool that compiles text scene descriptions to binary
+// -----------------------------------------------------------------------------
+
+#include "scene_compiler.h"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+// _____________________________________________________________________________
+// -----------------------------------------------------------------------------
+// component descriptions
+// _____________________________________________________________________________
+// -----------------------------------------------------------------------------
+
+namespace {
+
+/**
+ * \brief How the value of a key is parsed and stored.
+ *          floatField:  comma separated floats
+ *          uintField:   an unsigned integer
+ *          stringField: a string table offset
+ *          enumField:   index of a name in m_names, plus m_enumBase
+ *          cosineField: an angle in degrees, stored as its cosine
+ *          radianField: an angle in degrees, stored in radians
+ *          layoutField: up to 4 attribute sizes, stored after their count
+ */
+enum FieldKind {floatField = 0, uintField, stringField, enumField, cosineField, radianField, layoutField};
+
+struct FieldDesc {
+    const char* m_key;
+    FieldKind m_kind;
+    std::size_t m_offset;
+    unsigned int m_count;
+    const char* const* m_names;
+    unsigned int m_enumBase;
+};
+
+struct ComponentDesc {
+    const char* m_keyword;
+    std::size_t m_size;
+    std::vector<FieldDesc> m_fields;
+};
+
+const char* const CAMERA_TYPES[] = {"first", "second", "third", nullptr};
+const char* const LIGHT_TYPES[] = {"directional", "point", "spot", nullptr};
+const char* const BODY_TYPES[] = {"static", "kinematic", "dynamic", nullptr};
+const char* const SHADOW_TYPES[] = {"none", "spot", "point", nullptr};
+const char* const BOOLEANS[] = {"false", "true", nullptr};
+
+#define SCENE_FIELD(blob, key, kind, member, count) \
+    {key, kind, offsetof(blob, member), count, nullptr, 0}
+#define SCENE_ENUM(blob, key, member, names, base) \
+    {key, enumField, offsetof(blob, member), 1, names, base}
+
+// indexed by SceneComponentType
+const ComponentDesc COMPONENTS[sceneComponentCount] = {
+    {"camera", sizeof(SceneCameraBlob), {
+        SCENE_FIELD(SceneCameraBlob, "position", floatField, m_position, 3),
+        SCENE_ENUM(SceneCameraBlob, "type", m_type, CAMERA_TYPES, 1),
+    }},
+    {"skybox", sizeof(SceneSkyboxBlob), {
+        SCENE_FIELD(SceneSkyboxBlob, "id", uintField, m_id, 1),
+    }},
+    {"light", sizeof(SceneLightBlob), {
+        SCENE_ENUM(SceneLightBlob, "type", m_type, LIGHT_TYPES, 0),
+        SCENE_FIELD(SceneLightBlob, "scale", floatField, m_scale, 3),
+        SCENE_FIELD(SceneLightBlob, "direction", floatField, m_direction, 3),
+        SCENE_FIELD(SceneLightBlob, "cutoff", cosineField, m_cutOff, 1),
+        SCENE_FIELD(SceneLightBlob, "outer_cutoff", cosineField, m_outerCutOff, 1),
+        SCENE_FIELD(SceneLightBlob, "constant", floatField, m_constant, 1),
+        SCENE_FIELD(SceneLightBlob, "linear", floatField, m_linear, 1),
+        SCENE_FIELD(SceneLightBlob, "quadratic", floatField, m_quadratic, 1),
+        SCENE_FIELD(SceneLightBlob, "ambient", floatField, m_ambient, 3),
+        SCENE_FIELD(SceneLightBlob, "diffuse", floatField, m_diffuse, 3),
+        SCENE_FIELD(SceneLightBlob, "specular", floatField, m_specular, 3),
+    }},
+    {"material", sizeof(SceneMaterialBlob), {
+        SCENE_FIELD(SceneMaterialBlob, "shininess", floatField, m_shininess, 1),
+    }},
+    {"texture", sizeof(SceneTextureBlob), {
+        SCENE_FIELD(SceneTextureBlob, "diffuse", stringField, m_diffuse, 1),
+        SCENE_FIELD(SceneTextureBlob, "specular", stringField, m_specular, 1),
+        SCENE_FIELD(SceneTextureBlob, "normal", stringField, m_normal, 1),
+        SCENE_FIELD(SceneTextureBlob, "cubemap", stringField, m_cubemap, 1),
+    }},
+    {"shader", sizeof(SceneShaderBlob), {
+        SCENE_FIELD(SceneShaderBlob, "output", stringField, m_output, 1),
+        SCENE_FIELD(SceneShaderBlob, "light", stringField, m_light, 1),
+        SCENE_FIELD(SceneShaderBlob, "shadow", stringField, m_shadow, 1),
+        SCENE_FIELD(SceneShaderBlob, "stencil", stringField, m_stencil, 1),
+    }},
+    {"mesh", sizeof(SceneMeshBlob), {
+        SCENE_FIELD(SceneMeshBlob, "name", stringField, m_mesh, 1),
+        SCENE_FIELD(SceneMeshBlob, "layout", layoutField, m_attributeCount, 4),
+    }},
+    {"text", sizeof(SceneTextBlob), {
+        SCENE_FIELD(SceneTextBlob, "x", floatField, m_x, 1),
+        SCENE_FIELD(SceneTextBlob, "y", floatField, m_y, 1),
+        SCENE_FIELD(SceneTextBlob, "scale", floatField, m_scale, 1),
+        SCENE_FIELD(SceneTextBlob, "color", floatField, m_color, 3),
+        SCENE_FIELD(SceneTextBlob, "message", stringField, m_message, 1),
+    }},
+    {"sprite", sizeof(SceneSpriteBlob), {
+        SCENE_FIELD(SceneSpriteBlob, "shininess", floatField, m_shininess, 1),
+        SCENE_FIELD(SceneSpriteBlob, "position", floatField, m_position, 3),
+        SCENE_FIELD(SceneSpriteBlob, "rotation", floatField, m_rotation, 1),
+        SCENE_FIELD(SceneSpriteBlob, "scale", floatField, m_scale, 3),
+    }},
+    {"player", sizeof(ScenePlayerBlob), {
+        SCENE_FIELD(ScenePlayerBlob, "id", uintField, m_id, 1),
+    }},
+    {"body", sizeof(SceneBodyBlob), {
+        SCENE_ENUM(SceneBodyBlob, "type", m_type, BODY_TYPES, 0),
+        SCENE_FIELD(SceneBodyBlob, "position", floatField, m_position, 2),
+        SCENE_FIELD(SceneBodyBlob, "angle", radianField, m_angle, 1),
+    }},
+    {"circle", sizeof(SceneCircleBlob), {
+        SCENE_FIELD(SceneCircleBlob, "center", floatField, m_center, 2),
+        SCENE_FIELD(SceneCircleBlob, "radius", floatField, m_radius, 1),
+        SCENE_FIELD(SceneCircleBlob, "density", floatField, m_density, 1),
+        SCENE_FIELD(SceneCircleBlob, "friction", floatField, m_friction, 1),
+        SCENE_FIELD(SceneCircleBlob, "restitution", floatField, m_restitution, 1),
+    }},
+    {"box", sizeof(SceneBoxBlob), {
+        SCENE_FIELD(SceneBoxBlob, "half_size", floatField, m_halfSize, 2),
+        SCENE_FIELD(SceneBoxBlob, "center", floatField, m_center, 2),
+        SCENE_FIELD(SceneBoxBlob, "angle", radianField, m_angle, 1),
+        SCENE_FIELD(SceneBoxBlob, "density", floatField, m_density, 1),
+        SCENE_FIELD(SceneBoxBlob, "friction", floatField, m_friction, 1),
+        SCENE_FIELD(SceneBoxBlob, "restitution", floatField, m_restitution, 1),
+    }},
+    {"fixture", sizeof(SceneFixtureBlob), {
+        SCENE_FIELD(SceneFixtureBlob, "type", uintField, m_fixtureType, 1),
+    }},
+    {"audio", sizeof(SceneAudioBlob), {
+        SCENE_FIELD(SceneAudioBlob, "collision", stringField, m_collision, 1),
+        SCENE_FIELD(SceneAudioBlob, "select_on", stringField, m_selectOn, 1),
+        SCENE_FIELD(SceneAudioBlob, "select_off", stringField, m_selectOff, 1),
+        SCENE_FIELD(SceneAudioBlob, "pitch", floatField, m_pitch, 1),
+        SCENE_FIELD(SceneAudioBlob, "gain", floatField, m_gain, 1),
+        SCENE_ENUM(SceneAudioBlob, "loop", m_loop, BOOLEANS, 0),
+    }},
+    {"shadow", sizeof(SceneShadowBlob), {
+        SCENE_ENUM(SceneShadowBlob, "type", m_type, SHADOW_TYPES, 0),
+        SCENE_FIELD(SceneShadowBlob, "index", uintField, m_index, 1),
+        SCENE_FIELD(SceneShadowBlob, "near", floatField, m_nearPlane, 1),
+        SCENE_FIELD(SceneShadowBlob, "far", floatField, m_farPlane, 1),
+    }},
+};
+
+#undef SCENE_FIELD
+#undef SCENE_ENUM
+
+float toRadians(float degrees) {
+    return degrees * 3.14159265358979f / 180.0f;
+}
+
+// fill a blob with the defaults of the engine component it describes: Box2D's
+// fixture defaults, the demo's light attenuation, absent strings
+void setDefaults(SceneComponentType type, unsigned char* blob) {
+    switch (type) {
+    case sceneCamera: {
+        SceneCameraBlob camera = {{0.0f, 0.0f, 20.0f}, 1};
+        std::memcpy(blob, &camera, sizeof(camera));
+        break;
+    }
+    case sceneLight: {
+        SceneLightBlob light = {
+            0,
+            {1.0f, 1.0f, 1.0f},
+            {0.0f, -1.0f, 0.0f},
+            std::cos(toRadians(15.0f)),
+            std::cos(toRadians(17.5f)),
+            1.0f, 0.09f, 0.032f,
+            {0.0f, 0.0f, 0.0f},
+            {1.0f, 1.0f, 1.0f},
+            {1.0f, 1.0f, 1.0f}
+        };
+        std::memcpy(blob, &light, sizeof(light));
+        break;
+    }
+    case sceneMaterial: {
+        SceneMaterialBlob material = {32.0f};
+        std::memcpy(blob, &material, sizeof(material));
+        break;
+    }
+    case sceneTexture:
+    case sceneShader:
+        // 4 string offsets
+        for (int i = 0; i < 4; i++) {
+            std::memcpy(blob + i * 4, &SCENE_NO_STRING, 4);
+        }
+        break;
+    case sceneMesh: {
+        SceneMeshBlob mesh = {SCENE_NO_STRING, 0, {0, 0, 0, 0}};
+        std::memcpy(blob, &mesh, sizeof(mesh));
+        break;
+    }
+    case sceneText: {
+        SceneTextBlob text = {0.0f, 0.0f, 1.0f, {1.0f, 1.0f, 1.0f}, SCENE_NO_STRING};
+        std::memcpy(blob, &text, sizeof(text));
+        break;
+    }
+    case sceneSprite: {
+        SceneSpriteBlob sprite = {32.0f, {0.0f, 0.0f, 0.0f}, 0.0f, {1.0f, 1.0f, 1.0f}};
+        std::memcpy(blob, &sprite, sizeof(sprite));
+        break;
+    }
+    case sceneCircle: {
+        SceneCircleBlob circle = {{0.0f, 0.0f}, 1.0f, 0.0f, 0.2f, 0.0f};
+        std::memcpy(blob, &circle, sizeof(circle));
+        break;
+    }
+    case sceneBox: {
+        SceneBoxBlob box = {{1.0f, 1.0f}, {0.0f, 0.0f}, 0.0f, 0.0f, 0.2f, 0.0f};
+        std::memcpy(blob, &box, sizeof(box));
+        break;
+    }
+    case sceneAudio: {
+        SceneAudioBlob audio = {SCENE_NO_STRING, SCENE_NO_STRING, SCENE_NO_STRING, 1.0f, 1.0f, 0};
+        std::memcpy(blob, &audio, sizeof(audio));
+        break;
+    }
+    case sceneShadow: {
+        SceneShadowBlob shadow = {0, 0, 1.0f, 25.0f};
+        std::memcpy(blob, &shadow, sizeof(shadow));
+        break;
+    }
+    default:
+        // ids and types, all zero
+        std::memset(blob, 0, COMPONENTS[type].m_size);
+        break;
+    }
+}
+
+// parse comma separated floats, exactly count of them
+bool parseFloats(const std::string& value, unsigned int count, float* out) {
+    std::stringstream stream(value);
+    std::string item;
+    unsigned int parsed = 0;
+    while (std::getline(stream, item, ',')) {
+        char* end = nullptr;
+        float number = std::strtof(item.c_str(), &end);
+        if (item.empty() || *end != '\0' || parsed == count) {
+            return false;
+        }
+        out[parsed++] = number;
+    }
+    return parsed == count;
+}
+
+bool parseUnsigned(const std::string& value, std::uint32_t& out) {
+    char* end = nullptr;
+    unsigned long number = std::strtoul(value.c_str(), &end, 10);
+    if (value.empty() || value[0] == '-' || *end != '\0' || number > 0xFFFFFFFFul) {
+        return false;
+    }
+    out = static_cast<std::uint32_t>(number);
+    return true;
+}
+
+} // namespace
+
+// _____________________________________________________________________________
+// -----------------------------------------------------------------------------
+// compile
+// _____________________________________________________________________________
+// -----------------------------------------------------------------------------
+
+bool SceneCompiler::compile(const std::string& inputPath, const std::string& outputPath) {
+    m_templates.clear();
+    m_entities.clear();
+    m_stringTable.clear();
+    m_stringOffsets.clear();
+    m_componentData.clear();
+    m_inputPath = inputPath;
+    m_error.clear();
+
+    std::ifstream input(inputPath);
+    if (!input.is_open()) {
+        m_error = "cannot open " + inputPath;
+        return false;
+    }
+    if (!parse(input)) {
+        return false;
+    }
+
+    // records, templates first so entities can refer to them by index
+    // .........................................................................
+    std::map<std::string, std::uint32_t> templateIndices;
+    std::vector<SceneRecord> records;
+    for (const ParsedRecord& parsed : m_templates) {
+        SceneRecord record;
+        if (!writeRecord(parsed, nullptr, record)) {
+            return false;
+        }
+        templateIndices[parsed.m_name] = static_cast<std::uint32_t>(records.size());
+        records.push_back(record);
+    }
+    for (const ParsedRecord& parsed : m_entities) {
+        const ParsedRecord* base = nullptr;
+        std::uint32_t templateIndex = SCENE_NO_TEMPLATE;
+        if (!parsed.m_template.empty()) {
+            auto found = templateIndices.find(parsed.m_template);
+            if (found == templateIndices.end()) {
+                return fail(parsed.m_line, "unknown template '" + parsed.m_template + "'");
+            }
+            templateIndex = found->second;
+            base = &m_templates[templateIndex];
+        }
+        SceneRecord record;
+        if (!writeRecord(parsed, base, record)) {
+            return false;
+        }
+        record.m_template = templateIndex;
+        records.push_back(record);
+    }
+
+    // file, every field written as little endian 32 bit words
+    // .........................................................................
+    while (m_stringTable.size() % 4 != 0) {
+        m_stringTable.push_back('\0');
+    }
+    std::ofstream output(outputPath, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!output.is_open()) {
+        m_error = "cannot write " + outputPath;
+        return false;
+    }
+    auto writeWord = [&output](std::uint32_t word) {
+        for (int shift = 0; shift < 32; shift += 8) {
+            output.put(static_cast<char>((word >> shift) & 0xFF));
+        }
+    };
+
+    output.write(SCENE_MAGIC, sizeof(SCENE_MAGIC));
+    writeWord(SCENE_VERSION);
+    writeWord(static_cast<std::uint32_t>(m_stringTable.size()));
+    writeWord(static_cast<std::uint32_t>(m_templates.size()));
+    writeWord(static_cast<std::uint32_t>(m_entities.size()));
+    writeWord(static_cast<std::uint32_t>(m_componentData.size() * 4));
+    writeWord(0);
+    output.write(m_stringTable.data(), static_cast<std::streamsize>(m_stringTable.size()));
+    for (const SceneRecord& record : records) {
+        writeWord(record.m_name);
+        writeWord(record.m_template);
+        writeWord(record.m_componentOffset);
+        writeWord(record.m_componentCount);
+    }
+    for (std::uint32_t word : m_componentData) {
+        writeWord(word);
+    }
+    output.close();
+    if (!output) {
+        m_error = "failed writing " + outputPath;
+        return false;
+    }
+    return true;
+}
+
+const std::string& SceneCompiler::getError() const {
+    return m_error;
+}
+
+std::size_t SceneCompiler::getEntityCount() const {
+    return m_entities.size();
+}
+
+// _____________________________________________________________________________
+// -----------------------------------------------------------------------------
+// parsing
+// _____________________________________________________________________________
+// -----------------------------------------------------------------------------
+
+bool SceneCompiler::parse(std::istream& input) {
+    std::map<std::string, bool> names;
+    ParsedRecord* current = nullptr;
+    std::string line;
+    int lineNumber = 0;
+
+    while (std::getline(input, line)) {
+        lineNumber++;
+        std::vector<std::string> tokens;
+        if (!tokenize(line, lineNumber, tokens)) {
+            return false;
+        }
+        if (tokens.empty()) {
+            continue;
+        }
+
+        // block start and end
+        // .....................................................................
+        if (tokens[0] == "template" || tokens[0] == "entity") {
+            if (current) {
+                return fail(lineNumber, "missing 'end' of '" + current->m_name + "'");
+            }
+            bool isTemplate = tokens[0] == "template";
+            bool hasTemplate = tokens.size() == 4 && tokens[2] == ":";
+            if (tokens.size() != 2 && !hasTemplate) {
+                return fail(lineNumber, "expected '" + tokens[0] + " <name> [: <template>]'");
+            }
+            if (isTemplate && hasTemplate) {
+                return fail(lineNumber, "templates cannot derive from templates");
+            }
+            if (names.count(tokens[1])) {
+                return fail(lineNumber, "'" + tokens[1] + "' is defined twice");
+            }
+            names[tokens[1]] = true;
+
+            std::vector<ParsedRecord>& records = isTemplate ? m_templates : m_entities;
+            records.emplace_back();
+            current = &records.back();
+            current->m_name = tokens[1];
+            current->m_template = hasTemplate ? tokens[3] : "";
+            current->m_line = lineNumber;
+            continue;
+        }
+        if (tokens[0] == "end") {
+            if (!current || tokens.size() != 1) {
+                return fail(lineNumber, "unexpected 'end'");
+            }
+            current = nullptr;
+            continue;
+        }
+
+        // component line
+        // .....................................................................
+        if (!current) {
+            return fail(lineNumber, "component '" + tokens[0] + "' outside of a template or entity");
+        }
+        ParsedComponent component;
+        component.m_line = lineNumber;
+        int type = 0;
+        while (type < sceneComponentCount && tokens[0] != COMPONENTS[type].m_keyword) {
+            type++;
+        }
+        if (type == sceneComponentCount) {
+            return fail(lineNumber, "unknown component '" + tokens[0] + "'");
+        }
+        component.m_type = static_cast<SceneComponentType>(type);
+        for (const ParsedComponent& other : current->m_components) {
+            if (other.m_type == component.m_type) {
+                return fail(lineNumber, "component '" + tokens[0] + "' is given twice");
+            }
+        }
+        for (std::size_t i = 1; i < tokens.size(); i++) {
+            std::size_t equals = tokens[i].find('=');
+            if (equals == std::string::npos || equals == 0) {
+                return fail(lineNumber, "expected key=value, found '" + tokens[i] + "'");
+            }
+            component.m_keys[tokens[i].substr(0, equals)] = tokens[i].substr(equals + 1);
+        }
+        current->m_components.push_back(component);
+    }
+
+    if (current) {
+        return fail(current->m_line, "missing 'end' of '" + current->m_name + "'");
+    }
+    return true;
+}
+
+bool SceneCompiler::tokenize(const std::string& line, int lineNumber, std::vector<std::string>& tokens) {
+    std::string token;
+    bool inToken = false;
+    bool inQuotes = false;
+    for (char c : line) {
+        if (inQuotes) {
+            if (c == '"') {
+                inQuotes = false;
+            }
+            else {
+                token.push_back(c);
+            }
+        }
+        else if (c == '"') {
+            inQuotes = true;
+            inToken = true;
+        }
+        else if (c == '#') {
+            break;
+        }
+        else if (c == ' ' || c == '\t' || c == '\r') {
+            if (inToken) {
+                tokens.push_back(token);
+                token.clear();
+                inToken = false;
+            }
+        }
+        else {
+            token.push_back(c);
+            inToken = true;
+        }
+    }
+    if (inQuotes) {
+        return fail(lineNumber, "unterminated string");
+    }
+    if (inToken) {
+        tokens.push_back(token);
+    }
+    return true;
+}
+
+// _____________________________________________________________________________
+// -----------------------------------------------------------------------------
+// output
+// _____________________________________________________________________________
+// -----------------------------------------------------------------------------
+
+bool SceneCompiler::writeRecord(const ParsedRecord& parsed, const ParsedRecord* base, SceneRecord& record) {
+    record.m_name = addString(parsed.m_name);
+    record.m_template = SCENE_NO_TEMPLATE;
+    record.m_componentOffset = static_cast<std::uint32_t>(m_componentData.size() * 4);
+    record.m_componentCount = static_cast<std::uint32_t>(parsed.m_components.size());
+
+    for (const ParsedComponent& component : parsed.m_components) {
+        // keys given by the entity override its template's, and the merged
+        // blob replaces the template's when loading
+        ParsedComponent merged = component;
+        if (base) {
+            for (const ParsedComponent& baseComponent : base->m_components) {
+                if (baseComponent.m_type == component.m_type) {
+                    merged.m_keys = baseComponent.m_keys;
+                    for (const auto& key : component.m_keys) {
+                        merged.m_keys[key.first] = key.second;
+                    }
+                }
+            }
+        }
+        if (!writeComponent(merged)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool SceneCompiler::writeComponent(const ParsedComponent& component) {
+    const ComponentDesc& desc = COMPONENTS[component.m_type];
+    std::vector<unsigned char> blob(desc.m_size);
+    setDefaults(component.m_type, blob.data());
+
+    for (const auto& key : component.m_keys) {
+        const FieldDesc* field = nullptr;
+        for (const FieldDesc& candidate : desc.m_fields) {
+            if (key.first == candidate.m_key) {
+                field = &candidate;
+            }
+        }
+        if (!field) {
+            return fail(component.m_line, "'" + std::string(desc.m_keyword) + "' has no key '" + key.first + "'");
+        }
+
+        unsigned char* destination = blob.data() + field->m_offset;
+        bool valid = true;
+        switch (field->m_kind) {
+        case floatField:
+            valid = parseFloats(key.second, field->m_count, reinterpret_cast<float*>(destination));
+            break;
+        case cosineField:
+        case radianField: {
+            float degrees = 0.0f;
+            valid = parseFloats(key.second, 1, &degrees);
+            float value = field->m_kind == cosineField ? std::cos(toRadians(degrees)) : toRadians(degrees);
+            std::memcpy(destination, &value, 4);
+            break;
+        }
+        case uintField: {
+            std::uint32_t value = 0;
+            valid = parseUnsigned(key.second, value);
+            std::memcpy(destination, &value, 4);
+            break;
+        }
+        case stringField: {
+            std::uint32_t offset = key.second.empty() ? SCENE_NO_STRING : addString(key.second);
+            std::memcpy(destination, &offset, 4);
+            break;
+        }
+        case enumField: {
+            std::uint32_t index = 0;
+            while (field->m_names[index] && key.second != field->m_names[index]) {
+                index++;
+            }
+            valid = field->m_names[index] != nullptr;
+            std::uint32_t value = index + field->m_enumBase;
+            std::memcpy(destination, &value, 4);
+            break;
+        }
+        case layoutField: {
+            // the attribute count, then up to 4 attribute sizes
+            std::stringstream stream(key.second);
+            std::string item;
+            std::uint32_t values[5] = {0, 0, 0, 0, 0};
+            while (valid && std::getline(stream, item, ',')) {
+                valid = values[0] < field->m_count && parseUnsigned(item, values[values[0] + 1]) && values[values[0] + 1] > 0;
+                values[0]++;
+            }
+            valid = valid && values[0] > 0;
+            std::memcpy(destination, values, sizeof(values));
+            break;
+        }
+        }
+        if (!valid) {
+            return fail(component.m_line, "bad value '" + key.second + "' for '" + key.first + "'");
+        }
+    }
+
+    if (component.m_type == sceneMesh) {
+        SceneMeshBlob mesh;
+        std::memcpy(&mesh, blob.data(), sizeof(mesh));
+        if (mesh.m_mesh == SCENE_NO_STRING || mesh.m_attributeCount == 0) {
+            return fail(component.m_line, "'mesh' needs a name and a layout");
+        }
+    }
+    if (component.m_type == sceneShadow) {
+        SceneShadowBlob shadow;
+        std::memcpy(&shadow, blob.data(), sizeof(shadow));
+        if (!isValidShadow(shadow)) {
+            return fail(component.m_line, "'shadow' index must be below " + std::to_string(shadow.m_type == 1 ? SCENE_SPOT_SHADOWS : SCENE_POINT_SHADOWS));
+        }
+    }
+
+    m_componentData.push_back(static_cast<std::uint32_t>(component.m_type) | static_cast<std::uint32_t>(desc.m_size) << 16);
+    for (std::size_t i = 0; i < desc.m_size; i += 4) {
+        std::uint32_t word = 0;
+        std::memcpy(&word, blob.data() + i, 4);
+        m_componentData.push_back(word);
+    }
+    return true;
+}
+
+std::uint32_t SceneCompiler::addString(const std::string& value) {
+    auto found = m_stringOffsets.find(value);
+    if (found != m_stringOffsets.end()) {
+        return found->second;
+    }
+    std::uint32_t offset = static_cast<std::uint32_t>(m_stringTable.size());
+    m_stringTable.append(value);
+    m_stringTable.push_back('\0');
+    m_stringOffsets[value] = offset;
+    return offset;
+}
+
+bool SceneCompiler::fail(int line, const std::string& message) {
+    m_error = m_inputPath + ":" + std::to_string(line) + ": " + message;
+    return false;
+}
@@ -0,0 +1,116 @@
+// -----------------------------------------------------------------------------
+// Onset Engine
+// https://github.com/dylanafterall/OnsetEngine.git
+//
+// scene_compiler.h
+//  header for tool that compiles text scene descriptions to binary scenes
+// -----------------------------------------------------------------------------
+#ifndef SCENE_COMPILER_H
+#define SCENE_COMPILER_H
+
+#include "core_scene_format.h"
+
+#include <cstdint>
+#include <istream>
+#include <map>
+#include <string>
+#include <vector>
+
+/**
+ * \brief   The SceneCompiler class.
+ * \details Compiles a text scene description (.scene) to the binary layout of
+ *          core_scene_format.h (.onsc). Component keys left out take the
+ *          defaults of the engine's components, and an entity's components
+ *          are merged over its template's here, so the engine only copies
+ *          finished blobs. See README.txt for the text format.
+ */
+class SceneCompiler {
+public:
+    /**
+     * \brief   The default constructor.
+     */
+    SceneCompiler() = default;
+    /**
+     * \brief   The default destructor.
+     */
+    ~SceneCompiler() = default;
+
+    /**
+     * \brief   The function compile.
+     * \details This function parses a text scene and writes the binary scene.
+     * \param   inputPath   Path of the .scene file to read.
+     * \param   outputPath  Path of the .onsc file to write.
+     * \return  bool, true if the scene was valid and written.
+     */
+    bool compile(const std::string&, const std::string&);
+    /**
+     * \brief   The function getError.
+     * \return  const std::string&, the reason the last compile failed.
+     */
+    const std::string& getError() const;
+    /**
+     * \brief   The function getEntityCount.
+     * \return  std::size_t, number of entities of the last compiled scene.
+     */
+    std::size_t getEntityCount() const;
+
+private:
+    /**
+     * \brief One component line: its type and raw key=value pairs.
+     */
+    struct ParsedComponent {
+        SceneComponentType m_type = sceneCamera;
+        std::map<std::string, std::string> m_keys;
+        int m_line = 0;
+    };
+    /**
+     * \brief One template or entity block.
+     */
+    struct ParsedRecord {
+        std::string m_name;
+        std::string m_template;
+        std::vector<ParsedComponent> m_components;
+        int m_line = 0;
+    };
+
+    /**
+     * \brief   Parse the text scene into m_templates and m_entities.
+     */
+    bool parse(std::istream&);
+    /**
+     * \brief   Split a line into tokens, keeping quoted strings whole.
+     */
+    bool tokenize(const std::string&, int, std::vector<std::string>&);
+    /**
+     * \brief   Append a component's header and blob to m_componentData.
+     */
+    bool writeComponent(const ParsedComponent&);
+    /**
+     * \brief   Append a record's components, returning its SceneRecord.
+     */
+    bool writeRecord(const ParsedRecord&, const ParsedRecord*, SceneRecord&);
+    /**
+     * \brief   Return the offset of a string, adding it to the table if new.
+     */
+    std::uint32_t addString(const std::string&);
+    /**
+     * \brief   Record an error at a line of the text scene, returning false.
+     */
+    bool fail(int, const std::string&);
+
+    std::vector<ParsedRecord> m_templates;
+    std::vector<ParsedRecord> m_entities;
+    /**
+     * \brief Null terminated strings, and the offset of each.
+     */
+    std::string m_stringTable;
+    std::map<std::string, std::uint32_t> m_stringOffsets;
+    /**
+     * \brief Component headers and blobs, as 32 bit words.
+     */
+    std::vector<std::uint32_t> m_componentData;
+    std::string m_inputPath;
+    std::string m_error;
+};
+
+#endif // SCENE_COMPILER_H